@@ -0,0 +1,240 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "airport-map-provider.h"
+#include "generic-layer.h"
+#include "map-math.h"
+#include "map-provider.h"
+#include "misc.h"
+#include "nav-db.h"
+#include "raster.h"
+
+#define ALLOC_CHUNK 256
+
+/* Symbols are 9x9 bitmaps (see raster_blit_bitmap), centered on the
+ * airport and drawn over an 11x11 halo that keeps them readable on any
+ * background.*/
+#define SYMBOL_SIZE 9
+#define HALO_SIZE 11
+#define HALO_RADIUS AIRPORT_MAP_SYMBOL_RADIUS
+
+static const uint8_t symbol_ring[SYMBOL_SIZE * 2] = {
+    0x3e, 0x00,
+    0x41, 0x00,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x41, 0x00,
+    0x3e, 0x00,
+};
+
+static const uint8_t symbol_disc[SYMBOL_SIZE * 2] = {
+    0x3e, 0x00,
+    0x7f, 0x00,
+    0xff, 0x80,
+    0xff, 0x80,
+    0xff, 0x80,
+    0xff, 0x80,
+    0xff, 0x80,
+    0x7f, 0x00,
+    0x3e, 0x00,
+};
+
+static const uint8_t symbol_heliport[SYMBOL_SIZE * 2] = {
+    0x3e, 0x00,
+    0x41, 0x00,
+    0xa2, 0x80,
+    0xa2, 0x80,
+    0xbe, 0x80,
+    0xa2, 0x80,
+    0xa2, 0x80,
+    0x41, 0x00,
+    0x3e, 0x00,
+};
+
+static const uint8_t symbol_halo[HALO_SIZE * 2] = {
+    0x1f, 0x00,
+    0x3f, 0x80,
+    0x7f, 0xc0,
+    0xff, 0xe0,
+    0xff, 0xe0,
+    0xff, 0xe0,
+    0xff, 0xe0,
+    0xff, 0xe0,
+    0x7f, 0xc0,
+    0x3f, 0x80,
+    0x1f, 0x00,
+};
+
+typedef struct{
+    const uint8_t *bits;
+    uint8_t min_level; /*Not drawn when zoomed out further*/
+    SDL_Color color;
+}AirportSymbol;
+
+static const AirportSymbol symbols[N_NAV_AIRPORT_TYPES] = {
+    [NAV_AIRPORT_UNKNOWN] = {symbol_ring, 10, {0x80, 0x00, 0x80, SDL_ALPHA_OPAQUE}},
+    [NAV_AIRPORT_SMALL] = {symbol_ring, 9, {0x80, 0x00, 0x80, SDL_ALPHA_OPAQUE}},
+    [NAV_AIRPORT_MEDIUM] = {symbol_disc, 8, {0x11, 0x56, 0xFF, SDL_ALPHA_OPAQUE}},
+    [NAV_AIRPORT_LARGE] = {symbol_disc, 7, {0x11, 0x56, 0xFF, SDL_ALPHA_OPAQUE}},
+    [NAV_AIRPORT_HELIPORT] = {symbol_heliport, 10, {0x80, 0x00, 0x80, SDL_ALPHA_OPAQUE}},
+    [NAV_AIRPORT_SEAPLANE] = {symbol_ring, 10, {0x11, 0x56, 0xFF, SDL_ALPHA_OPAQUE}},
+};
+#define SYMBOLS_MIN_LEVEL 7
+
+static AirportMapProvider *airport_map_provider_dispose(AirportMapProvider *self);
+static GenericLayer *airport_map_provider_get_tile(AirportMapProvider *self,
+                                                   uintf8_t level,
+                                                   int32_t x, int32_t y);
+
+static MapProviderOps airport_map_provider_ops = {
+    .get_tile = (MapProviderGetTileFunc)airport_map_provider_get_tile,
+    .dispose = (MapProviderDisposeFunc)airport_map_provider_dispose
+};
+
+AirportMapProvider *airport_map_provider_new(void)
+{
+    AirportMapProvider *self;
+
+    self = calloc(1, sizeof(AirportMapProvider));
+    if(self){
+        if(!airport_map_provider_init(self))
+            return (AirportMapProvider*)map_provider_free(MAP_PROVIDER(self));
+    }
+    return self;
+}
+
+AirportMapProvider *airport_map_provider_init(AirportMapProvider *self)
+{
+    map_provider_init(MAP_PROVIDER(self), &airport_map_provider_ops, 10);
+
+    self->ids = malloc(sizeof(uint32_t) * ALLOC_CHUNK);
+    if(!self->ids)
+        return NULL;
+    self->aids = ALLOC_CHUNK;
+
+    return self;
+}
+
+static AirportMapProvider *airport_map_provider_dispose(AirportMapProvider *self)
+{
+    if(self->ids)
+        free(self->ids);
+    return self;
+}
+
+/**
+ * @brief Finds the airports whose symbol shows on a tile, even partly,
+ * whatever their type.
+ *
+ * @param self an AirportMapProvider
+ * @param level The tile's level
+ * @param x The tile's x coordinate (in tiles)
+ * @param y The tile's y coordinate (in tiles)
+ * @return The number of airports found, their ids are in @p self ids
+ * until the next call.
+ */
+size_t airport_map_provider_find(AirportMapProvider *self,
+                                 uintf8_t level,
+                                 int32_t x, int32_t y)
+{
+    size_t rv;
+    void *tmp;
+
+    rv = nav_db_find_in_area(level,
+        x * 256 - HALO_RADIUS, y * 256 - HALO_RADIUS,
+        x * 256 + 255 + HALO_RADIUS, y * 256 + 255 + HALO_RADIUS,
+        self->ids, self->aids
+    );
+    if(rv > self->aids){
+        tmp = realloc(self->ids, sizeof(uint32_t) * (rv + ALLOC_CHUNK));
+        if(!tmp)
+            return self->aids;
+        self->ids = tmp;
+        self->aids = rv + ALLOC_CHUNK;
+        rv = nav_db_find_in_area(level,
+            x * 256 - HALO_RADIUS, y * 256 - HALO_RADIUS,
+            x * 256 + 255 + HALO_RADIUS, y * 256 + 255 + HALO_RADIUS,
+            self->ids, self->aids
+        );
+    }
+    return rv;
+}
+
+/**
+ * @brief Tells whether airports of a given type have a symbol at a
+ * given level: small ones are only shown when zoomed in.
+ *
+ * @param type The airport type, see NavAirportType
+ * @param level The map level
+ * @return true if the symbol is drawn, false otherwise
+ */
+bool airport_map_provider_shows(uint32_t type, uintf8_t level)
+{
+    if(type >= N_NAV_AIRPORT_TYPES)
+        type = NAV_AIRPORT_UNKNOWN;
+    return level >= SYMBOLS_MIN_LEVEL && level >= symbols[type].min_level;
+}
+
+static GenericLayer *airport_map_provider_get_tile(AirportMapProvider *self,
+                                                   uintf8_t level,
+                                                   int32_t x, int32_t y)
+{
+    GenericLayer *rv;
+    const NavAirport *airport;
+    const AirportSymbol *symbol;
+    Uint32 halo, color;
+    int32_t px, py;
+    size_t nids;
+
+    if(level < SYMBOLS_MIN_LEVEL)
+        return NULL;
+
+    nids = airport_map_provider_find(self, level, x, y);
+    if(!nids)
+        return NULL;
+
+    rv = generic_layer_new(256, 256);
+    if(!rv)
+        return NULL;
+
+    halo = SDL_MapRGBA(rv->canvas->format, 255, 255, 255, SDL_ALPHA_OPAQUE);
+    generic_layer_lock(rv);
+    /*Halos first, so that close airports don't hide each other*/
+    for(int pass = 0; pass < 2; pass++){
+        for(size_t i = 0; i < nids; i++){
+            airport = nav_db_airport(self->ids[i]);
+            symbol = &symbols[airport->type < N_NAV_AIRPORT_TYPES ? airport->type : NAV_AIRPORT_UNKNOWN];
+            if(level < symbol->min_level)
+                continue;
+
+            map_math_geo_to_pixel(airport->latitude, airport->longitude, level, &px, &py);
+            px -= x * 256;
+            py -= y * 256;
+            if(!pass){
+                raster_blit_bitmap(rv->canvas, px - HALO_RADIUS, py - HALO_RADIUS,
+                    symbol_halo, HALO_SIZE, HALO_SIZE, 2, halo
+                );
+            }else{
+                color = SDL_MapRGBA(rv->canvas->format,
+                    symbol->color.r, symbol->color.g, symbol->color.b, symbol->color.a
+                );
+                raster_blit_bitmap(rv->canvas, px - SYMBOL_SIZE / 2, py - SYMBOL_SIZE / 2,
+                    symbol->bits, SYMBOL_SIZE, SYMBOL_SIZE, 2, color
+                );
+            }
+        }
+    }
+    generic_layer_unlock(rv);
+
+    return rv;
+}
@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef AIRPORT_MAP_PROVIDER_H
+#define AIRPORT_MAP_PROVIDER_H
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "map-provider.h"
+#include "misc.h"
+
+/*Half the size of a symbol, halo included*/
+#define AIRPORT_MAP_SYMBOL_RADIUS 5
+
+/* Draws the airports of the navigation database (see nav-db.h) as
+ * symbols over the map tiles, using its spatial index to only go
+ * through the airports of each tile.*/
+typedef struct{
+    MapProvider super;
+
+    uint32_t *ids;
+    size_t aids;
+}AirportMapProvider;
+
+AirportMapProvider *airport_map_provider_new(void);
+AirportMapProvider *airport_map_provider_init(AirportMapProvider *self);
+
+size_t airport_map_provider_find(AirportMapProvider *self,
+                                 uintf8_t level,
+                                 int32_t x, int32_t y);
+bool airport_map_provider_shows(uint32_t type, uintf8_t level);
+
+#endif /* AIRPORT_MAP_PROVIDER_H */
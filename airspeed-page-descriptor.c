@@ -48,6 +48,12 @@ AirspeedPageDescriptor *airspeed_page_descriptor_new(int page_w, int page_h_min,
         10, 5,
         BOTTUM_UP, airspeed_ladder_page_init
     );
+    snprintf(LADDER_PAGE_DESCRIPTOR(self)->bake_key, LADDER_BAKE_KEY_MAX,
+        "ias-%dx%d-%d-%d-%d-%d-%d-%d-%d-%d",
+        LADDER_PAGE_DESCRIPTOR(self)->width, LADDER_PAGE_DESCRIPTOR(self)->height,
+        unit_px_sz, small_step_width, big_step_width,
+        v_so, v_s1, v_fe, v_no, v_ne
+    );
 
     return self;
 }
@@ -58,7 +64,6 @@ LadderPage *airspeed_ladder_page_init(LadderPage *self)
     vruler_ladder_page_init(self, LocationRight);
 
     airspeed_ladder_page_draw_arcs(self);
-    generic_layer_build_texture(GENERIC_LAYER(self));
 
     return self;
 }
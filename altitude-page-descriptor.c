@@ -30,6 +30,11 @@ AltitudePageDescriptor *altitude_page_descriptor_new(int page_w, int page_h_min,
         small_step_width, big_step_width,
         100, 20,
         BOTTUM_UP, altitude_ladder_page_init);
+    snprintf(LADDER_PAGE_DESCRIPTOR(self)->bake_key, LADDER_BAKE_KEY_MAX,
+        "alt-%dx%d-%d-%d-%d",
+        LADDER_PAGE_DESCRIPTOR(self)->width, LADDER_PAGE_DESCRIPTOR(self)->height,
+        unit_px_sz, small_step_width, big_step_width
+    );
 
     return self;
 }
@@ -38,7 +43,6 @@ AltitudePageDescriptor *altitude_page_descriptor_new(int page_w, int page_h_min,
 LadderPage *altitude_ladder_page_init(LadderPage *self)
 {
     vruler_ladder_page_init(self, LocationLeft);
-    generic_layer_build_texture(GENERIC_LAYER(self));
 
     return self;
 }
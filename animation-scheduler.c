@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "animation-scheduler.h"
+
+#define ALLOC_CHUNK 16
+
+static AnimationScheduler scheduler = {0};
+
+/**
+ * @brief Gets the state of @p animation, adding it to the running
+ * animations if it's not there yet. A new state starts at the current
+ * value of the animation targets, not moving.
+ *
+ * The returned pointer is only valid until the next call.
+ *
+ * @param animation The animation
+ * @return The state, NULL on failure.
+ */
+AnimationState *animation_scheduler_activate(BaseAnimation *animation)
+{
+    AnimationState *state;
+    void *tmp;
+
+    if(animation->slot >= 0)
+        return &scheduler.states[animation->slot];
+
+    if(scheduler.nstates == scheduler.allocated){
+        tmp = realloc(scheduler.states, sizeof(AnimationState) * (scheduler.allocated + ALLOC_CHUNK));
+        if(!tmp){
+            printf("%s: Couldn't schedule animation, not animating\n", __FUNCTION__);
+            return NULL;
+        }
+        scheduler.states = tmp;
+        scheduler.allocated += ALLOC_CHUNK;
+    }
+
+    animation->slot = scheduler.nstates++;
+    state = &scheduler.states[animation->slot];
+    *state = (AnimationState){
+        .animation = animation,
+        .value = base_animation_read(animation),
+        .omega = animation->omega,
+        .epsilon = animation->epsilon
+    };
+    state->to = state->value;
+
+    return state;
+}
+
+/*Swaps the last state in, so that the array stays packed*/
+static void animation_scheduler_remove_at(size_t i)
+{
+    scheduler.states[i].animation->slot = -1;
+    if(i != --scheduler.nstates){
+        scheduler.states[i] = scheduler.states[scheduler.nstates];
+        scheduler.states[i].animation->slot = i;
+    }
+}
+
+/**
+ * @brief Drops @p animation from the running animations, if it's
+ * there.
+ */
+void animation_scheduler_remove(BaseAnimation *animation)
+{
+    if(animation->slot >= 0)
+        animation_scheduler_remove_at(animation->slot);
+}
+
+/**
+ * @brief Moves all running animations @p dt milliseconds forward and
+ * writes their targets.
+ *
+ * Owners of animations that have changed a target are marked dirty.
+ *
+ * @param dt Time elapsed since the last call, in milliseconds
+ * @return true if any target has changed, false otherwise.
+ */
+bool animation_scheduler_step(uint32_t dt)
+{
+    AnimationState *state;
+    BaseAnimation *animation;
+    double t, x, k, e;
+    bool done, rv;
+
+    if(dt > ANIMATION_MAX_DT)
+        dt = ANIMATION_MAX_DT;
+    t = dt / 1000.0;
+
+    rv = false;
+    for(size_t i = 0; i < scheduler.nstates; ){
+        state = &scheduler.states[i];
+        animation = state->animation;
+        /* The end value is left for one more frame before the animation
+         * is said to be finished: gauges with children check
+         * that flag in their update_state to pass the value on, that would
+         * otherwise be missed.*/
+        if(animation->last_value_reached){
+            animation->finished = true;
+            animation->last_value_reached = false;
+            animation_scheduler_remove_at(i);
+            continue;
+        }
+
+        switch(state->kind){
+            case ANIMATION_TWEEN:
+                state->elapsed += dt;
+                done = state->elapsed >= state->duration;
+                if(!done)
+                    state->value = state->from + (state->to - state->from) * (state->elapsed / state->duration);
+                break;
+            case ANIMATION_SPRING:
+                /*Exact solution of the critically damped spring, stable whatever dt*/
+                x = state->value - state->to;
+                k = state->velocity + state->omega * x;
+                e = exp(-state->omega * t);
+                state->value = state->to + (x + k * t) * e;
+                state->velocity = (state->velocity - state->omega * k * t) * e;
+                done = fabs(state->value - state->to) < state->epsilon
+                    && fabs(state->velocity) < state->epsilon * state->omega;
+                break;
+            case ANIMATION_SMOOTH:
+                state->value = state->to + (state->value - state->to) * exp(-state->omega * t);
+                done = fabs(state->value - state->to) < state->epsilon;
+                break;
+            default:
+                done = true;
+                break;
+        }
+        if(done){
+            state->value = state->to;
+            state->velocity = 0;
+            animation->last_value_reached = true;
+        }
+
+        if(base_animation_write(animation, state->value)){
+            if(animation->dirty)
+                *animation->dirty = true;
+            rv = true;
+        }
+        i++;
+    }
+
+    return rv;
+}
+
+/**
+ * @brief Number of animations running.
+ */
+size_t animation_scheduler_running(void)
+{
+    return scheduler.nstates;
+}
+
+/**
+ * @brief Releases the scheduler memory. Call once all animations have
+ * been freed.
+ */
+void animation_scheduler_shutdown(void)
+{
+    for(size_t i = 0; i < scheduler.nstates; i++)
+        scheduler.states[i].animation->slot = -1;
+    free(scheduler.states);
+    scheduler = (AnimationScheduler){0};
+}
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef ANIMATION_SCHEDULER_H
+#define ANIMATION_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "base-animation.h"
+
+/* Process-wide list of the running animations, kept in a contiguous
+ * array and all updated by a single animation_scheduler_step call per
+ * frame, before rendering. Gauges are told about changes through the
+ * animation's dirty flag: they don't have to poll their animations.
+ *
+ * Finished animations are dropped from the array, idle gauges cost
+ * nothing.
+ */
+#define ANIMATION_MAX_DT 100 /*ms, longer frames (stalls) are clamped*/
+
+typedef struct{
+    BaseAnimation *animation;
+    AnimationKind kind;
+
+    double value; /*current value*/
+    double velocity; /*springs: units per second*/
+    double to;
+
+    /*tweens*/
+    double from;
+    float elapsed; /*ms*/
+    float duration; /*ms*/
+
+    /*springs and smoothing*/
+    float omega;
+    double epsilon;
+}AnimationState;
+
+typedef struct{
+    AnimationState *states;
+    size_t nstates;
+    size_t allocated;
+}AnimationScheduler;
+
+AnimationState *animation_scheduler_activate(BaseAnimation *animation);
+void animation_scheduler_remove(BaseAnimation *animation);
+
+bool animation_scheduler_step(uint32_t dt);
+size_t animation_scheduler_running(void);
+void animation_scheduler_shutdown(void);
+#endif /* ANIMATION_SCHEDULER_H */
@@ -0,0 +1,322 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "asset-blob.h"
+
+#define ASSET_BLOB_ALIGN 16
+
+typedef struct{
+    AssetBlobEntry entry;
+    SDL_Surface *surface; /*RGBA32 copy*/
+}AssetBlobRecord;
+
+typedef struct{
+    /*Mapped blob, runtime*/
+    uint8_t *base;
+    size_t size;
+    AssetBlobHeader *header;
+    AssetBlobEntry *entries;
+
+    size_t hits;
+    size_t misses;
+
+    /*Assets generated live, bake time*/
+    bool recording;
+    AssetBlobRecord *records;
+    size_t n_records;
+    size_t a_records;
+}AssetBlob;
+
+static AssetBlob blob = {0};
+
+/**
+ * @brief Maps a blob made by sofis-bake. Lookups will fail (and
+ * callers generate the assets live) if the blob can't be used.
+ *
+ * Surfaces returned by asset_blob_get_surface point into the mapping:
+ * asset_blob_close must only be called once they have all been freed.
+ *
+ * @param filename The blob to map
+ * @return true on success, false otherwise.
+ */
+bool asset_blob_open(const char *filename)
+{
+    struct stat st;
+    AssetBlobHeader *header;
+    void *base;
+    int fd;
+
+    if(blob.base)
+        asset_blob_close();
+
+    fd = open(filename, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &st) < 0 || st.st_size < sizeof(AssetBlobHeader)){
+        close(fd);
+        return false;
+    }
+    /* Private writable mapping: pages stay shared with the page cache
+     * until someone draws on a surface, which then gets its own copy*/
+    base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED){
+        printf("Couldn't map %s\n", filename);
+        return false;
+    }
+
+    header = base;
+    if(memcmp(header->magic, ASSET_BLOB_MAGIC, sizeof(ASSET_BLOB_MAGIC))
+       || header->version != ASSET_BLOB_VERSION
+       || header->stamp != ASSET_BLOB_STAMP
+       || header->size != st.st_size
+       || sizeof(AssetBlobHeader) + header->nentries * sizeof(AssetBlobEntry) > st.st_size){
+        printf("Ignoring stale or invalid asset blob %s\n", filename);
+        munmap(base, st.st_size);
+        return false;
+    }
+
+    blob.base = base;
+    blob.size = st.st_size;
+    blob.header = header;
+    blob.entries = (AssetBlobEntry*)(blob.base + sizeof(AssetBlobHeader));
+
+    return true;
+}
+
+/**
+ * @brief Unmaps the blob. All surfaces obtained from it must have
+ * been freed.
+ */
+void asset_blob_close(void)
+{
+    if(blob.base)
+        munmap(blob.base, blob.size);
+    blob.base = NULL;
+    blob.size = 0;
+    blob.header = NULL;
+    blob.entries = NULL;
+}
+
+static int asset_blob_entry_cmp(const void *key, const void *entry)
+{
+    return strncmp(key, ((const AssetBlobEntry*)entry)->name, ASSET_NAME_MAX);
+}
+
+/**
+ * @brief Gets a baked asset.
+ *
+ * @param name The asset name
+ * @param source The file the asset comes from. The baked copy is
+ * considered stale if the file has been modified since. NULL for
+ * generated assets.
+ * @return A RGBA32 surface using the blob pixels, to be freed by the
+ * caller with SDL_FreeSurface. NULL if there is no usable copy of
+ * the asset, which must then be generated live.
+ */
+SDL_Surface *asset_blob_get_surface(const char *name, const char *source)
+{
+    AssetBlobEntry *entry;
+    struct stat st;
+    SDL_Surface *rv;
+
+    if(!blob.base)
+        return NULL;
+
+    entry = bsearch(name, blob.entries, blob.header->nentries, sizeof(AssetBlobEntry), asset_blob_entry_cmp);
+    if(!entry)
+        goto miss;
+    /*A missing source file leaves the baked copy as the only one*/
+    if(source && stat(source, &st) == 0
+       && (st.st_mtime != entry->mtime || st.st_size != entry->fsize))
+        goto miss;
+    if(entry->format != SDL_PIXELFORMAT_RGBA32
+       || entry->offset % ASSET_BLOB_ALIGN
+       || entry->offset + (uint64_t)entry->pitch * entry->h > blob.size)
+        goto miss;
+
+    rv = SDL_CreateRGBSurfaceWithFormatFrom(
+        blob.base + entry->offset,
+        entry->w, entry->h,
+        32, entry->pitch,
+        entry->format
+    );
+    if(!rv)
+        goto miss;
+    blob.hits++;
+    return rv;
+
+miss:
+    blob.misses++;
+    return NULL;
+}
+
+void asset_blob_get_stats(size_t *hits, size_t *misses)
+{
+    if(hits) *hits = blob.hits;
+    if(misses) *misses = blob.misses;
+}
+
+/**
+ * @brief Starts recording assets generated live, for them to be
+ * saved with asset_blob_record_save. Used by sofis-bake.
+ */
+void asset_blob_record_start(void)
+{
+    blob.recording = true;
+}
+
+bool asset_blob_recording(void)
+{
+    return blob.recording;
+}
+
+/**
+ * @brief Records an asset that has been generated live. Does nothing
+ * if not recording or if an asset with the same name has already been
+ * recorded.
+ *
+ * @param name The asset name, at most ASSET_NAME_MAX-1 chars
+ * @param surface The asset pixels, copied
+ * @param source See asset_blob_get_surface
+ * @return true if the asset is recorded, false otherwise.
+ */
+bool asset_blob_record(const char *name, SDL_Surface *surface, const char *source)
+{
+    AssetBlobRecord *record;
+    struct stat st;
+    void *tmp;
+
+    if(!blob.recording || !surface)
+        return false;
+    if(strlen(name) >= ASSET_NAME_MAX){
+        printf("Asset name too long, not baking it: %s\n", name);
+        return false;
+    }
+    for(size_t i = 0; i < blob.n_records; i++){
+        if(!strcmp(blob.records[i].entry.name, name))
+            return true;
+    }
+
+    if(blob.n_records == blob.a_records){
+        tmp = realloc(blob.records, sizeof(AssetBlobRecord) * (blob.a_records + 16));
+        if(!tmp)
+            return false;
+        blob.records = tmp;
+        blob.a_records += 16;
+    }
+    record = &blob.records[blob.n_records];
+    *record = (AssetBlobRecord){0};
+
+    record->surface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if(!record->surface){
+        printf("Couldn't convert asset %s: %s\n", name, SDL_GetError());
+        return false;
+    }
+    strncpy(record->entry.name, name, ASSET_NAME_MAX - 1);
+    if(source && stat(source, &st) == 0){
+        record->entry.mtime = st.st_mtime;
+        record->entry.fsize = st.st_size;
+    }
+    record->entry.w = record->surface->w;
+    record->entry.h = record->surface->h;
+    record->entry.pitch = record->surface->w * 4;
+    record->entry.format = SDL_PIXELFORMAT_RGBA32;
+    blob.n_records++;
+
+    return true;
+}
+
+static int asset_blob_record_cmp(const void *a, const void *b)
+{
+    return strncmp(((const AssetBlobRecord*)a)->entry.name,
+                   ((const AssetBlobRecord*)b)->entry.name,
+                   ASSET_NAME_MAX);
+}
+
+/**
+ * @brief Writes all recorded assets to @p filename and drops them.
+ * The blob is written aside and then moved in place so that a running
+ * instance never sees a partial file.
+ *
+ * @param filename The blob to create
+ * @return true on success, false otherwise.
+ */
+bool asset_blob_record_save(const char *filename)
+{
+    static const uint8_t pad[ASSET_BLOB_ALIGN] = {0};
+    AssetBlobHeader header;
+    AssetBlobRecord *record;
+    char tmpname[512];
+    uint64_t offset;
+    FILE *fp;
+    bool rv;
+
+    qsort(blob.records, blob.n_records, sizeof(AssetBlobRecord), asset_blob_record_cmp);
+
+    offset = sizeof(AssetBlobHeader) + blob.n_records * sizeof(AssetBlobEntry);
+    for(size_t i = 0; i < blob.n_records; i++){
+        record = &blob.records[i];
+        offset = (offset + ASSET_BLOB_ALIGN - 1) & ~(uint64_t)(ASSET_BLOB_ALIGN - 1);
+        record->entry.offset = offset;
+        offset += (uint64_t)record->entry.pitch * record->entry.h;
+    }
+    header = (AssetBlobHeader){
+        .version = ASSET_BLOB_VERSION,
+        .nentries = blob.n_records,
+        .size = offset,
+        .stamp = ASSET_BLOB_STAMP
+    };
+    memcpy(header.magic, ASSET_BLOB_MAGIC, sizeof(ASSET_BLOB_MAGIC));
+
+    snprintf(tmpname, sizeof(tmpname), "%s.tmp", filename);
+    fp = fopen(tmpname, "wb");
+    if(!fp){
+        printf("Couldn't open %s for writing\n", tmpname);
+        return false;
+    }
+    rv = fwrite(&header, sizeof(AssetBlobHeader), 1, fp) == 1;
+    for(size_t i = 0; rv && i < blob.n_records; i++)
+        rv = fwrite(&blob.records[i].entry, sizeof(AssetBlobEntry), 1, fp) == 1;
+    for(size_t i = 0; rv && i < blob.n_records; i++){
+        record = &blob.records[i];
+        offset = ftell(fp);
+        if(offset < record->entry.offset)
+            rv = fwrite(pad, record->entry.offset - offset, 1, fp) == 1;
+        SDL_LockSurface(record->surface);
+        for(int y = 0; rv && y < record->surface->h; y++){
+            rv = fwrite((uint8_t*)record->surface->pixels + y * record->surface->pitch,
+                        record->entry.pitch, 1, fp) == 1;
+        }
+        SDL_UnlockSurface(record->surface);
+    }
+    if(fclose(fp) != 0)
+        rv = false;
+    if(rv && rename(tmpname, filename) != 0)
+        rv = false;
+    if(!rv){
+        printf("Couldn't write asset blob %s\n", filename);
+        unlink(tmpname);
+    }
+
+    for(size_t i = 0; i < blob.n_records; i++)
+        SDL_FreeSurface(blob.records[i].surface);
+    free(blob.records);
+    blob.records = NULL;
+    blob.n_records = blob.a_records = 0;
+    blob.recording = false;
+
+    return rv;
+}
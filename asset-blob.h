@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef ASSET_BLOB_H
+#define ASSET_BLOB_H
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+#include "res-dirs.h"
+
+/* Baked assets: gauge art loaded from files or generated at startup
+ * (ladder pages), stored as ready-to-upload RGBA32 pixels in a single
+ * file made by sofis-bake. At runtime the file is mapped and surfaces
+ * point straight into the mapping.
+ *
+ * Anything missing or stale in the blob is generated live as before.
+ * Bump ASSET_BLOB_VERSION when the layout changes. Generated assets
+ * have no source file to check: the blob is stamped with
+ * ASSET_BLOB_STAMP, a hash of the generators' sources given by the
+ * build, and only used by a program built with the same stamp.
+ */
+#define ASSET_BLOB_MAGIC "SFSBAKE"
+#define ASSET_BLOB_VERSION 2
+#define ASSET_NAME_MAX 64
+
+#ifndef ASSET_BLOB_STAMP
+#define ASSET_BLOB_STAMP 0
+#endif
+
+#ifndef BAKE_FILE
+#define BAKE_FILE SFS_HOME"/resources/sofis.bake"
+#endif
+
+typedef struct{
+    char magic[8];
+    uint32_t version;
+    uint32_t nentries;
+    uint64_t size; /*Whole file, catches truncated blobs*/
+    uint64_t stamp; /*ASSET_BLOB_STAMP of sofis-bake*/
+}AssetBlobHeader;
+
+/*Entries follow the header, sorted by name*/
+typedef struct{
+    char name[ASSET_NAME_MAX];
+    /*Source file stamp, both 0 for generated assets*/
+    int64_t mtime;
+    uint64_t fsize;
+
+    uint64_t offset; /*From the start of the blob, 16 bytes aligned*/
+    uint32_t w, h;
+    uint32_t pitch;
+    uint32_t format; /*Always SDL_PIXELFORMAT_RGBA32 for now*/
+}AssetBlobEntry;
+
+bool asset_blob_open(const char *filename);
+void asset_blob_close(void);
+SDL_Surface *asset_blob_get_surface(const char *name, const char *source);
+void asset_blob_get_stats(size_t *hits, size_t *misses);
+
+void asset_blob_record_start(void);
+bool asset_blob_recording(void);
+bool asset_blob_record(const char *name, SDL_Surface *surface, const char *source);
+bool asset_blob_record_save(const char *filename);
+#endif /* ASSET_BLOB_H */
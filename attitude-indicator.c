@@ -17,6 +17,7 @@
 #include "base-animation.h"
 #include "base-gauge.h"
 #include "generic-layer.h"
+#include "horizon-renderer.h"
 #include "misc.h"
 #include "resource-manager.h"
 #include "roll-slip-gauge.h"
@@ -34,8 +35,9 @@ static BaseGaugeOps attitude_indicator_ops = {
    .dispose = (DisposeFunc)attitude_indicator_dispose
 };
 
-static SDL_Surface *attitude_indicator_get_etched_ball(AttitudeIndicator *self);
+#if ENABLE_3D
 static SDL_Surface *attitude_indicator_draw_ruler(AttitudeIndicator *self, int size, int ppm, PCF_Font *font, SDL_Color *col);
+#endif
 
 AttitudeIndicator *attitude_indicator_new(int width, int height)
 {
@@ -67,8 +69,10 @@ AttitudeIndicator *attitude_indicator_init(AttitudeIndicator *self, int width, i
     generic_layer_init_from_file(&self->markers[MARKER_LEFT], IMG_DIR"/left-marker.png");
     generic_layer_init_from_file(&self->markers[MARKER_RIGHT], IMG_DIR"/right-marker.png");
     generic_layer_init_from_file(&self->markers[MARKER_CENTER], IMG_DIR"/center-marker.png");
-    for(int i = 0; i < 3; i++)
+    for(int i = 0; i < 3; i++){
         generic_layer_build_texture(&self->markers[i]);
+        generic_layer_release_canvas(&self->markers[i]);
+    }
 
 	self->rollslip = roll_slip_gauge_new();
 
@@ -99,7 +103,19 @@ AttitudeIndicator *attitude_indicator_init(AttitudeIndicator *self, int width, i
         self->locations[ROLL_SLIP].y
     );
 
-    attitude_indicator_get_etched_ball(self);
+    /* The horizon rotates around the common center and the ladder has
+     * 9 pixels per 2.5 degrees graduation. The sky gradient covers the
+     * first 22.5% of the height above the horizon line*/
+    if(!horizon_renderer_init(&self->horizon,
+        width, height,
+        &(SDL_Point){
+            .x = round(width/2.0) - 1,
+            .y = self->common_center.y - 1
+        },
+        9/2.5, self->size,
+        round(height*0.225),
+        resource_manager_get_font(TERMINUS_12)))
+        return NULL;
 #if ENABLE_3D
     /* Verticaly 7 pixels -> 1 degree, 2.5 degrees = 17 pixels
      * Horizontaly 8 pixels -> 1 degree.
@@ -128,12 +144,6 @@ AttitudeIndicator *attitude_indicator_init(AttitudeIndicator *self, int width, i
     generic_layer_init(&self->phh_overlay, self->diagonal, self->pitch_ruler->h);
 #endif
 
-#if !USE_SDL_GPU
-	self->state.rbuffer = SDL_CreateRGBSurfaceWithFormat(0, width*2, height*2, 32, SDL_PIXELFORMAT_RGBA32);
-	self->renderer =  SDL_CreateSoftwareRenderer(self->state.rbuffer);
-    self->ball_texture = SDL_CreateTextureFromSurface(self->renderer, self->etched_ball.canvas);
-#endif
-
     return self;
 }
 
@@ -167,12 +177,7 @@ static void *attitude_indicator_dispose(AttitudeIndicator *self)
 	for(int i = 0; i < 3; i++){
         generic_layer_dispose(&self->markers[i]);
 	}
-#if !USE_SDL_GPU
-	if(self->state.rbuffer)
-		SDL_FreeSurface(self->state.rbuffer);
-	SDL_DestroyRenderer(self->renderer);
-#endif
-    generic_layer_dispose(&self->etched_ball);
+    horizon_renderer_dispose(&self->horizon);
 #if ENABLE_3D
     if(self->horizon_src)
         SDL_FreeSurface(self->horizon_src);
@@ -197,9 +202,11 @@ bool attitude_indicator_set_roll(AttitudeIndicator *self, float value, bool anim
                 goto fallback;
         }
         animation = BASE_GAUGE(self)->animations[AI_ROLL_ANIMATION];
-        base_animation_start(animation, self->roll, value, DEFAULT_DURATION);
+        base_animation_spring_to(animation, value);
     }else{
 fallback:
+        if(BASE_GAUGE(self)->nanimations > AI_ROLL_ANIMATION)
+            base_animation_stop(BASE_GAUGE(self)->animations[AI_ROLL_ANIMATION]);
         self->roll = value;
         roll_slip_gauge_set_value(self->rollslip, value, false);
         BASE_GAUGE(self)->dirty = true;
@@ -225,9 +232,11 @@ bool attitude_indicator_set_pitch(AttitudeIndicator *self, float value, bool ani
                 goto fallback;
         }
         animation = BASE_GAUGE(self)->animations[AI_PITCH_ANIMATION];
-        base_animation_start(animation, self->pitch, value, DEFAULT_DURATION);
+        base_animation_spring_to(animation, value);
     }else{
 fallback:
+        if(BASE_GAUGE(self)->nanimations > AI_PITCH_ANIMATION)
+            base_animation_stop(BASE_GAUGE(self)->animations[AI_PITCH_ANIMATION]);
         if(value != self->pitch){
             self->pitch = value;
             BASE_GAUGE(self)->dirty = true;
@@ -249,126 +258,7 @@ bool attitude_indicator_set_heading(AttitudeIndicator *self, float value)
 }
 
 
-Uint32 interpolate_color_p(const SDL_PixelFormat *format, Uint32 from, Uint32 to, float progress)
-{
-    Uint8 fr,fg,fb;
-    Uint8 tr,tg,tb;
-    Uint8 rv_r, rv_g, rv_b;
-
-    SDL_GetRGB(from, format, &fr, &fg, &fb);
-    SDL_GetRGB(to, format, &tr, &tg, &tb);
-//	printf("Interpolate between (%d,%d,%d) and (%d,%d,%d), progress=%0.2f percent\n",fr,fg,fb,tr,tg,tb, progress*100);
-
-#if 1
-    rv_r = fr + round((tr-fr)*progress);
-    rv_g = fg + round((tg-fg)*progress);
-    rv_b = fb + round((tb-fb)*progress);
-#elif 0
-    rv_r = round((1.0-progress) * fr + progress * tr + 0.5);
-    rv_g = round((1.0-progress) * fg + progress * tg + 0.5);
-    rv_b = round((1.0-progress) * fb + progress * tb + 0.5);
-#endif
-
-    return SDL_MapRGB(format, rv_r, rv_g, rv_b);
-}
-
-float range_progress(float value, float start, float end)
-{
-	float rv;
-	float _v, _s, _e;
-	_v = value - start;
-	_e = end - start;
-
-	rv = _v/_e;
-
-//    printf("Progress=%0.2f value=%0.2f start=%0.2f, end=%0.2f\n",rv, value, start, end);
-	return rv;
-}
-
-SDL_Surface *attitude_indicator_draw_ball(AttitudeIndicator *self)
-{
-    Uint32 *pixels;
-    SDL_Surface *surface;
-    int x, y, limit;
-    Uint32 white;
-    Uint32 sky,sky_down;
-    Uint32 earth;
-
-    self->ball_window = (SDL_Rect){
-        .x = 0, .y = 0,
-        .w = base_gauge_w(BASE_GAUGE(self)),
-        .h = base_gauge_h(BASE_GAUGE(self))
-    };
-
-    self->ball_all = (SDL_Rect){
-        .x = 0, .y = 0,
-        .w = self->ball_window.w*2,
-        .h = self->ball_window.h*2
-    };
-
-    surface = SDL_CreateRGBSurfaceWithFormat(0, self->ball_all.w, self->ball_all.h, 32, SDL_PIXELFORMAT_RGBA32);
-    SDL_LockSurface(surface);
-    pixels = surface->pixels;
-
-    white = SDL_UWHITE(surface);
-//    earth = SDL_MapRGB(surface->format, 0x46, 0x2b, 0x0c);
-//    earth = SDL_MapRGB(surface->format, 0x45, 0x2a, 0x06);
-//    earth = SDL_MapRGB(surface->format, 0x44, 0x28, 0x07);
-//    earth = SDL_MapRGB(surface->format, 0x3f, 0x28, 0x0a);
-    earth = SDL_MapRGB(surface->format, 0x58, 0x34, 0x0a);
-//    sky = SDL_MapRGB(surface->format, 0x13, 0x51, 0xd3);
-    sky = SDL_MapRGB(surface->format, 0x00, 0x50, 0xff);
-    sky_down = SDL_MapRGB(surface->format, 0x52, 0x6c, 0xd0);
-
-
-
-    //limit = round(surface->h*0.4); /*40/60 split between sky and earth*/
-    SDLExt_RectCenter(&self->ball_window, &self->ball_all); /*window x,y coordinates are now relative to "all" x,y*/
-    limit = self->ball_window.y + round(self->ball_window.h*0.4); /*40/60 split between sky and earth*/
-
-	self->ball_horizon = limit; /*self->ball_horizon is in "all" units*/
-    self->ball_center.y = limit; /*TODO: Merge these two center.y and limit*/
-    self->ball_center.x = round(self->ball_all.w/2.0)-1;
-
-	int first_gradient = round(limit * 0.25); /*First gradiant from the centerline to 25% up*/
-	int first_gradiant_stop = limit - first_gradient;
-	Uint32 color;
-
-    /*Draw the sky*/
-    for(y = limit; y >= 0; y--){
-		if(y  > first_gradiant_stop){
-			float progress;
-			progress = range_progress(y, limit, first_gradiant_stop);
-
-			color = interpolate_color_p(surface->format, sky_down, sky, progress );
-		}else{
-			color = sky;
-//			exit(0);
-		}
-        for(int x = 0; x < surface->w; x++){
-	        pixels[y * surface->w + x] = color;
-        }
-    }
-
-    /*Draw a white center line*/
-	y = limit;
-    for(x = 0; x < surface->w; x++){
-        pixels[y * surface->w + x] = white;
-    }
-
-    /*Draw the earth*/
-    int start = y +1;
-    for(y = start; y < surface->h; y++){
-        for(int x = 0; x < surface->w; x++){
-//            pixels[y * surface->w + x] = interpolate_color(surface->format, white, earth, y, start, surface->h-1);
-            pixels[y * surface->w + x] = earth;
-        }
-    }
-    SDL_UnlockSurface(surface);
-
-    return surface;
-}
-
+#if ENABLE_3D
 /**
  * Draws a vertical pitch "ruler".
  *
@@ -500,6 +390,7 @@ static SDL_Surface *attitude_indicator_draw_ruler(AttitudeIndicator *self, int s
 
     return rv;
 }
+#endif
 
 
 /*TODO: This might go in a Ruler class*/
@@ -552,37 +443,6 @@ int attitude_indicator_resolve_increment(AttitudeIndicator *self, float value)
 
 
 
-static SDL_Surface *attitude_indicator_get_etched_ball(AttitudeIndicator *self)
-{
-	if(!self->etched_ball.canvas){
-        SDL_Surface *ball, *ruler;
-		SDL_Rect ball_pos;
-		SDL_Rect ruler_pos;
-
-        ball = attitude_indicator_draw_ball(self);
-        ruler = attitude_indicator_draw_ruler(self, self->size, 9, resource_manager_get_font(TERMINUS_12), &SDL_WHITE);
-
-        generic_layer_init(&self->etched_ball, self->ball_all.w, self->ball_all.h);
-
-		/* First place the ball and the scale, such has the middle of the the scale is on
-		 * the same line as the "middle" of the ball. They both need to have the same y coordinate
-		 * on screen.
-		 * */
-		SDL_BlitSurface(ball, NULL, self->etched_ball.canvas, NULL);
-
-		ruler_pos.x = round(self->ball_all.w/2.0) - self->ruler_center.x;
-		ruler_pos.y = self->ball_horizon - self->ruler_center.y;
-
-		SDL_BlitSurface(ruler, NULL, self->etched_ball.canvas, &ruler_pos);
-
-        SDL_FreeSurface(ball);
-        SDL_FreeSurface(ruler);
-	}
-    generic_layer_build_texture(&self->etched_ball);
-
-	return self->etched_ball.canvas;
-}
-
 static void attitude_indicator_update_state(AttitudeIndicator *self, Uint32 dt)
 {
     BaseAnimation *animation;
@@ -594,40 +454,7 @@ static void attitude_indicator_update_state(AttitudeIndicator *self, Uint32 dt)
         }
     }
 
-    /*First find out a view-sized window into the larger ball buffer for a 0deg pitch*/
-    self->state.win = (SDL_Rect){
-        .x = self->ball_center.x - (round(base_gauge_w(BASE_GAUGE(self))/2.0) -1), /*Is ball_window useless?*/
-        .y = self->ball_center.y - (self->common_center.y - 1),
-        .w = base_gauge_w(BASE_GAUGE(self)),
-        .h = base_gauge_h(BASE_GAUGE(self))
-    };
-    /*Then apply to correct y offset to account for pitch*/
-    self->state.win.y += attitude_indicator_resolve_increment(self, self->pitch * -1.0);
-
-    /* Now that we have the correct self->state.window, rotate it to account for roll
-     * The rotation center must be 40% of the height and middle width
-     * */
-    self->state.rcenter = (SDL_Point){
-        .x = self->state.win.x + (round(self->state.win.w/2.0)-1),
-        .y = self->state.win.y + (round(self->state.win.h*0.4)-1)
-    };
-
-    self->state.dst_clip = (SDL_Rect){
-        self->state.rcenter.x - self->state.win.x,
-        self->state.rcenter.y - self->state.win.y,
-        0,0
-    };
-#if !USE_SDL_GPU
-	if(self->roll != 0){
-        SDL_RenderCopyEx(self->renderer, self->ball_texture,
-            NULL, NULL,
-            self->roll, &self->state.rcenter,
-            SDL_FLIP_NONE
-        );
-	}else{
-        SDL_BlitSurface(self->etched_ball.canvas, NULL, self->state.rbuffer, NULL);
-    }
-#endif
+    horizon_renderer_set_attitude(&self->horizon, -self->roll, self->pitch);
 #if ENABLE_3D
     int horizon_y = self->common_center.y-1;
     int increment = 0;
@@ -784,13 +611,7 @@ static void attitude_indicator_render(AttitudeIndicator *self, Uint32 dt, Render
 {
 #if USE_SDL_GPU
     if(self->mode == AI_MODE_2D){
-        base_gauge_blit_rotated_texture(BASE_GAUGE(self), ctx,
-            self->etched_ball.texture,
-            NULL,
-            -self->roll,
-            &self->state.rcenter,
-            NULL,
-            &self->state.dst_clip);
+        horizon_renderer_render(&self->horizon, ctx);
     }else{
 #if ENABLE_3D
         base_gauge_blit_rotated_texture(BASE_GAUGE(self), ctx,
@@ -805,11 +626,7 @@ static void attitude_indicator_render(AttitudeIndicator *self, Uint32 dt, Render
 #endif
     }
 #else
-    base_gauge_blit(BASE_GAUGE(self), ctx,
-        self->state.rbuffer,
-        &self->state.win,
-        NULL
-    );
+    horizon_renderer_render(&self->horizon, ctx);
 #endif
     base_gauge_blit_layer(BASE_GAUGE(self), ctx, &self->markers[MARKER_LEFT], NULL, &self->locations[MARKER_LEFT]);
     base_gauge_blit_layer(BASE_GAUGE(self), ctx, &self->markers[MARKER_RIGHT], NULL, &self->locations[MARKER_RIGHT]);
@@ -10,6 +10,7 @@
 
 #include "base-gauge.h"
 #include "generic-layer.h"
+#include "horizon-renderer.h"
 #include "roll-slip-gauge.h"
 #include <stdint.h>
 
@@ -30,18 +31,12 @@ typedef enum{
     AI_MODE_3D
 }AttitudeIndicatorDisplayMode;
 
-typedef struct{
-    SDL_Point rcenter;
-    SDL_Rect dst_clip;
-    SDL_Rect win;
-#if !USE_SDL_GPU
-    SDL_Surface *rbuffer; /*rotation buffer*/
-#endif
 #if ENABLE_3D
+typedef struct{
     SDL_Rect phh_drect;
     SDL_Point phh_rcenter;
-#endif
 }AttitudeIndicatorState;
+#endif
 
 typedef struct{
     BaseGauge super;
@@ -57,23 +52,13 @@ typedef struct{
 	int size; /*number of 10s markings*/
     AttitudeIndicatorDisplayMode mode;
 
-    SDL_Rect ball_window; /*Visible portion*/
-    SDL_Rect ball_all; /*Visible portion plus extended area*/
-	int ball_horizon;
-    SDL_Point ball_center;
-
 	SDL_Point ruler_center;
 	int ruler_middle;
 	int ruler_middlex;
 
     GenericLayer markers[3]; //left, right, center
 	SDL_Rect locations[LOCATION_MAX];
-#if !USE_SDL_GPU
-	SDL_Renderer *renderer;
-	SDL_Texture *ball_texture;
-#endif
-
-    GenericLayer etched_ball;
+    HorizonRenderer horizon; /*2D mode*/
 #if USE_SDL_GPU && ENABLE_3D
     SDL_Surface *horizon_src;
     SDL_Surface *pitch_ruler; /*pitch ruler*/
@@ -81,8 +66,9 @@ typedef struct{
     GenericLayer phh_overlay; /*pitch/horizon/heading*/
     bool phh_inited;
 #endif
-
+#if ENABLE_3D
     AttitudeIndicatorState state;
+#endif
 }AttitudeIndicator;
 
 
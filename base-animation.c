@@ -7,10 +7,10 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "base-animation.h"
-
-static inline void base_animation_process_floats(BaseAnimation *self, float increment);
+#include "animation-scheduler.h"
 
 
 BaseAnimation *base_animation_new(ValueType type, size_t ntargets, ...)
@@ -35,7 +35,7 @@ BaseAnimation *base_animation_new(ValueType type, size_t ntargets, ...)
 /**
  * @brief Inits a BaseAnimation to animate a set of targets
  *
- * Targets are pointers to the value(s) to animate
+ * Targets are pointers to the value(s) to animate, all of type @p type.
  *
  *
  *
@@ -64,11 +64,18 @@ BaseAnimation *base_animation_vainit(BaseAnimation *self, ValueType type, size_t
     for(int i = 0; i < ntargets; i++){
         self->targets[i] = va_arg(ap, void*);
     }
+
+    self->omega = DEFAULT_OMEGA;
+    /*Integer targets are done once rounding gives the end value*/
+    self->epsilon = (type == TYPE_FLOAT || type == TYPE_DOUBLE) ? DEFAULT_EPSILON : 0.5;
+    self->slot = -1;
+    self->finished = true;
     return self;
 }
 
 BaseAnimation *base_animation_dispose(BaseAnimation *self)
 {
+    animation_scheduler_remove(self);
     if(self->targets)
         free(self->targets);
     return self;
@@ -92,58 +99,165 @@ void base_animation_ref(BaseAnimation *self)
     self->refcount++;
 }
 
+/*Sets the targets right away, when the scheduler can't take the animation*/
+static void base_animation_jump(BaseAnimation *self, double to)
+{
+    if(base_animation_write(self, to) && self->dirty)
+        *self->dirty = true;
+    self->end = to;
+    self->finished = true;
+    self->last_value_reached = false;
+}
+
+/**
+ * @brief Animates the targets linearly from @p from to @p to in @p
+ * duration milliseconds. Any running animation is replaced.
+ *
+ * @param self a BaseAnimation
+ * @param from Start value
+ * @param to End value
+ * @param duration Duration, in milliseconds
+ */
 void base_animation_start(BaseAnimation *self, float from, float to, float duration)
 {
-    self->start = from;
+    AnimationState *state;
+
+    state = animation_scheduler_activate(self);
+    if(!state){
+        base_animation_jump(self, to);
+        return;
+    }
+    state->kind = ANIMATION_TWEEN;
+    state->value = from;
+    state->velocity = 0;
+    state->from = from;
+    state->to = to;
+    state->elapsed = 0;
+    state->duration = duration;
+
     self->end = to;
-    self->duration = duration;
-    self->time_progress = 0.0;
     self->finished = false;
     self->last_value_reached = false;
 }
 
+static void base_animation_retarget(BaseAnimation *self, AnimationKind kind, double to)
+{
+    AnimationState *state;
+
+    state = animation_scheduler_activate(self);
+    if(!state){
+        base_animation_jump(self, to);
+        return;
+    }
+    /* Whatever was running before, the motion carries on from the
+     * current value (and speed for springs)*/
+    if(kind != ANIMATION_SPRING)
+        state->velocity = 0;
+    state->kind = kind;
+    state->to = to;
+    state->omega = self->omega;
+    state->epsilon = self->epsilon;
+
+    self->end = to;
+    self->finished = false;
+    self->last_value_reached = false;
+}
+
+/**
+ * @brief Moves the targets to @p to with a critically damped spring. If
+ * the animation is already running, only the target value changes:
+ * the motion continues from the current value and speed, which keeps
+ * things smooth when new values keep coming in.
+ *
+ * Stiffness is set by the omega field of @p self.
+ *
+ * @param self a BaseAnimation
+ * @param to The value to go to
+ */
+void base_animation_spring_to(BaseAnimation *self, double to)
+{
+    base_animation_retarget(self, ANIMATION_SPRING, to);
+}
+
 /**
+ * @brief Moves the targets to @p to with exponential smoothing: each
+ * second, the remaining distance is divided by e^omega. Like springs,
+ * retargeting doesn't restart anything.
  *
+ * @param self a BaseAnimation
+ * @param to The value to go to
+ */
+void base_animation_smooth_to(BaseAnimation *self, double to)
+{
+    base_animation_retarget(self, ANIMATION_SMOOTH, to);
+}
+
+/**
+ * @brief Stops the animation where it is. Targets are left untouched.
  *
- * @param dt time elapsed since last call (milliseconds)
- * @return value matching the given time
- * */
-bool base_animation_loop(BaseAnimation *self, uint32_t dt)
+ * @param self a BaseAnimation
+ */
+void base_animation_stop(BaseAnimation *self)
 {
-    float progress;
-    float dv;
-    float new_value;
-
-    /* We don't set finished when setting the last value
-     * to be called one more time to allow gauges that have
-     * children to process the last value.
-     * Otherwise self->finished whould be true in the gauge's
-     * update_state during the iteration where the last value
-     * has been reached
-     */
-    if(self->last_value_reached){
-        self->finished = true;
-        return false;
-    }
+    animation_scheduler_remove(self);
+    self->finished = true;
+    self->last_value_reached = false;
+}
 
-    self->time_progress += dt; //millis
-    progress = self->time_progress / self->duration; /*percentage*/
-    if(progress > 1.0f)
-        progress = 1.0f;
+/**
+ * @brief Current value of the (first) target.
+ */
+double base_animation_read(BaseAnimation *self)
+{
+    void *target;
 
-    dv = self->end - self->start;
-    new_value = self->start + dv * progress;
-    if(self->targets_type == TYPE_FLOAT){
-        base_animation_process_floats(self, new_value);
+    if(!self->ntargets)
+        return 0;
+    target = self->targets[0];
+    switch(self->targets_type){
+        case TYPE_INT8: return *(int8_t *)target;
+        case TYPE_UINT8: return *(uint8_t *)target;
+        case TYPE_INT16: return *(int16_t *)target;
+        case TYPE_UINT16: return *(uint16_t *)target;
+        case TYPE_INT32: return *(int32_t *)target;
+        case TYPE_UINT32: return *(uint32_t *)target;
+        case TYPE_FLOAT: return *(float *)target;
+        case TYPE_DOUBLE: return *(double *)target;
+        default: return 0;
     }
-    return true;
 }
 
-static inline void base_animation_process_floats(BaseAnimation *self, float new_value)
+#define WRITE_TARGETS(type, v) \
+    do{ \
+        type nv = (v); \
+        for(int i = 0; i < self->ntargets; i++){ \
+            if(*(type *)self->targets[i] != nv){ \
+                *(type *)self->targets[i] = nv; \
+                rv = true; \
+            } \
+        } \
+    }while(0)
+
+/**
+ * @brief Sets all targets to @p value, rounded for integer targets.
+ *
+ * @return true if at least one target has changed, false otherwise.
+ */
+bool base_animation_write(BaseAnimation *self, double value)
 {
-    for(int i = 0; i < self->ntargets; i++){
-        *((float *)self->targets[i]) = new_value;
+    bool rv;
+
+    rv = false;
+    switch(self->targets_type){
+        case TYPE_INT8: WRITE_TARGETS(int8_t, lround(value)); break;
+        case TYPE_UINT8: WRITE_TARGETS(uint8_t, lround(value)); break;
+        case TYPE_INT16: WRITE_TARGETS(int16_t, lround(value)); break;
+        case TYPE_UINT16: WRITE_TARGETS(uint16_t, lround(value)); break;
+        case TYPE_INT32: WRITE_TARGETS(int32_t, lround(value)); break;
+        case TYPE_UINT32: WRITE_TARGETS(uint32_t, llround(value)); break;
+        case TYPE_FLOAT: WRITE_TARGETS(float, value); break;
+        case TYPE_DOUBLE: WRITE_TARGETS(double, value); break;
+        default: break;
     }
-   if(new_value == self->end)
-       self->last_value_reached = true;
+    return rv;
 }
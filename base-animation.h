@@ -14,11 +14,26 @@
 #include <stdbool.h>
 
 #define DEFAULT_DURATION 1000 /*milliseconds*/
+#define DEFAULT_OMEGA 6.0f /*1/s, a spring covers ~95% of a step in 790ms*/
+#define DEFAULT_EPSILON 0.01 /*Settle threshold for float targets*/
 
-/* BaseAnimation can be extended in the future (if needed)
- * by making base_animation_loop virtual there is no need
- * for that at the moment and doing it would add an additional
- * indirection each frame.
+/* A BaseAnimation drives one or more values (targets) of the same
+ * type. It only holds the targets and the settings: animations that
+ * are running live in the AnimationScheduler (see
+ * animation-scheduler.h), which updates them all in a single pass
+ * each frame.
+ *
+ * Three kinds of motion are available:
+ *  - tween: linear, from a value to another in a given time. Starting
+ *  a new one restarts from the current value.
+ *  - spring: critically damped spring. Moving the target while it's
+ *  running keeps the current value and speed, there is no restart.
+ *  - smooth: exponential smoothing, like a spring without inertia.
+ *  Closer to the data, but each new value shows as a change of speed.
+ *
+ * BaseAnimation can be extended in the future (if needed) by making the
+ * stepping virtual. There is no need for that at the moment and doing
+ * it would add an additional indirection each frame.
  */
 
 typedef enum{
@@ -33,23 +48,25 @@ typedef enum{
     N_TYPES
 }ValueType;
 
+typedef enum{
+    ANIMATION_TWEEN,
+    ANIMATION_SPRING,
+    ANIMATION_SMOOTH
+}AnimationKind;
+
 typedef struct{
-    /* targets, floats only now
-     * will be generic using a void**
-     * and a type enum to handle all
-     * numeric types.
-     * */
-    float **targets;
+    /*targets, all of targets_type*/
+    void **targets;
     ValueType targets_type;
     size_t ntargets;
 
-    /*values*/
-    float start;
-    float end;
+    double end; /*value being animated to*/
+
+    float omega; /*springs and smoothing: how fast the target is reached (1/s)*/
+    double epsilon; /*springs and smoothing: distance under which the target is considered reached*/
 
-    /*milliseconds*/
-    float duration;
-    float time_progress;
+    bool *dirty; /*Raised when the targets are changed, usually the owning gauge's*/
+    int slot; /*Index in the scheduler, -1 when not running*/
 
     bool finished;
     bool last_value_reached;
@@ -64,5 +81,10 @@ void base_animation_unref(BaseAnimation *self);
 void base_animation_ref(BaseAnimation *self);
 
 void base_animation_start(BaseAnimation *self, float from, float to, float duration);
-bool base_animation_loop(BaseAnimation *self, uint32_t dt);
+void base_animation_spring_to(BaseAnimation *self, double to);
+void base_animation_smooth_to(BaseAnimation *self, double to);
+void base_animation_stop(BaseAnimation *self);
+
+double base_animation_read(BaseAnimation *self);
+bool base_animation_write(BaseAnimation *self, double value);
 #endif /* BASE_ANIMATION_H */
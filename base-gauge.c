@@ -7,6 +7,7 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "SDL_gpu.h"
 
@@ -70,6 +71,11 @@ void *base_gauge_dispose(BaseGauge *self)
 
     if(self->ops->dispose)
         self->ops->dispose(self);
+#if ENABLE_PERF_COUNTERS
+    if(self->perf)
+        perf_counters_detach(self->perf);
+    self->perf = NULL;
+#endif
     return self;
 }
 
@@ -170,6 +176,7 @@ bool base_gauge_add_animation(BaseGauge *self, BaseAnimation *animation)
         self->animations = tmp;
     }
     self->animations[self->nanimations] = animation;
+    animation->dirty = &self->dirty;
     base_animation_ref(animation);
     self->nanimations++;
 
@@ -177,25 +184,47 @@ bool base_gauge_add_animation(BaseGauge *self, BaseAnimation *animation)
 }
 
 
+/**
+ * @brief Renders @p self and its children.
+ *
+ * Animations are not stepped here: animation_scheduler_step must be
+ * called once per frame beforehand, it marks the gauges whose animations
+ * have changed something as dirty.
+ *
+ * @param self a BaseGauge
+ * @param dt Time elapsed since the last frame, in milliseconds
+ * @param ctx Where to render
+ */
 void base_gauge_render(BaseGauge *self, Uint32 dt, RenderContext *ctx)
 {
-    bool rv;
-    for(int i = 0; i < self->nanimations; i++){
-        if(!self->animations[i]->finished){
-            rv = base_animation_loop(self->animations[i], dt);
-            /*If at least one animation has changed something
-             * we need to retrace */
-            if(rv)
-                self->dirty = true;
-        }
-    }
+#if ENABLE_PERF_COUNTERS
+    uint64_t start;
+    if(perf_counters_enabled && !self->perf)
+        self->perf = perf_counters_get(self, self->ops);
+#endif
     if(self->dirty){
-        if(self->ops->update_state)
+        if(self->ops->update_state){
+#if ENABLE_PERF_COUNTERS
+            if(perf_counters_enabled && self->perf){
+                start = perf_counters_now();
+                self->ops->update_state(self, dt);
+                perf_counters_record(self->perf, PERF_UPDATE_STATE, perf_counters_now() - start);
+            }else
+#endif
             self->ops->update_state(self, dt);
+        }
         self->dirty = false;
     }
-    if(self->ops->render)
+    if(self->ops->render){
+#if ENABLE_PERF_COUNTERS
+        if(perf_counters_enabled && self->perf){
+            start = perf_counters_now();
+            self->ops->render(self, dt, ctx);
+            perf_counters_record(self->perf, PERF_RENDER, perf_counters_now() - start);
+        }else
+#endif
         self->ops->render(self, dt, ctx);
+    }
     for(int i = 0; i < self->nchildren; i++){
         SDL_Rect child_location = {
             .x = ctx->location->x + self->children[i]->frame.x,
@@ -216,6 +245,33 @@ void base_gauge_render(BaseGauge *self, Uint32 dt, RenderContext *ctx)
     }
 }
 
+/**
+ * @brief Tells whether rendering @p self (and its children) would
+ * produce something different from the last frame, i.e. if the gauge
+ * or one of its children is dirty or has a running animation.
+ *
+ * Used to skip frames altogether when nothing moves.
+ *
+ * @param self a BaseGauge
+ * @return true if the gauge needs to be re-rendered, false otherwise
+ */
+bool base_gauge_needs_render(BaseGauge *self)
+{
+    if(self->dirty)
+        return true;
+
+    for(int i = 0; i < self->nanimations; i++){
+        if(!self->animations[i]->finished)
+            return true;
+    }
+
+    for(int i = 0; i < self->nchildren; i++){
+        if(base_gauge_needs_render(self->children[i]))
+            return true;
+    }
+    return false;
+}
+
 /*******TAKEN FROM BUFFERED_GAUGE**************/
 
 
@@ -447,66 +503,143 @@ void base_gauge_draw_outline(BaseGauge *self, RenderContext *ctx, SDL_Color *col
 #endif
 }
 
-void base_gauge_draw_static_font_patch(BaseGauge *self, RenderContext *ctx,
-                                       PCF_StaticFont *font,
-                                       PCF_StaticFontPatch *patch)
-{
-    SDL_Rect dst_rect; /*final destination*/
-    SDL_Rect src_rect;
-
-    src_rect = (SDL_Rect){
-        .x = patch->src.x,
-        .y = patch->src.y,
-        .w = font->metrics.characterWidth,
-        .h = font->metrics.ascent + font->metrics.descent
-    };
+#if USE_SDL_GPU
+/*Glyph batches are submitted in chunks of at most that many quads*/
+#define GLYPH_BATCH_QUADS 256
+static float glyph_values[GLYPH_BATCH_QUADS * 4 * 4]; /*x, y, s, t*/
+static unsigned short glyph_indices[GLYPH_BATCH_QUADS * 6];
+static bool glyph_indices_ready = false;
 
-    dst_rect = (SDL_Rect){
-        .x = patch->dst.x,
-        .y = patch->dst.y,
-        .w = font->metrics.characterWidth,
-        .h = font->metrics.ascent + font->metrics.descent
-    };
+static void base_gauge_flush_glyphs(RenderContext *ctx, PCF_StaticFont *font, size_t nquads)
+{
+    if(!glyph_indices_ready){
+        for(int i = 0; i < GLYPH_BATCH_QUADS; i++){
+            glyph_indices[i*6 + 0] = i*4 + 0;
+            glyph_indices[i*6 + 1] = i*4 + 1;
+            glyph_indices[i*6 + 2] = i*4 + 2;
+            glyph_indices[i*6 + 3] = i*4 + 0;
+            glyph_indices[i*6 + 4] = i*4 + 2;
+            glyph_indices[i*6 + 5] = i*4 + 3;
+        }
+        glyph_indices_ready = true;
+    }
+    GPU_TriangleBatch(font->texture, ctx->target.target,
+        nquads * 4, glyph_values,
+        nquads * 6, glyph_indices,
+        GPU_BATCH_XY_ST
+    );
+}
+#endif
 
+/**
+ * Draws @p npatches glyphs of @p font. With SDL_gpu, all of them go to
+ * the GPU as a single textured triangle batch instead of a blit each.
+ *
+ * @param use_rects when true, patch sizes are taken from the patches
+ * (clipped text, see PCF_StaticFontPreWriteStringOffset), otherwise
+ * all patches are a full glyph cell.
+ */
+static void base_gauge_draw_static_font_run(BaseGauge *self, RenderContext *ctx,
+                                            PCF_StaticFont *font,
+                                            PCF_StaticFontPatch *patches,
+                                            size_t npatches, bool use_rects)
+{
+    PCF_StaticFontPatch *patch;
+    int w, h;
 #if USE_SDL_GPU
-    if(!font->texture) /*TODO refactor: Have this a pre-requisite*/
-        PCF_StaticFontCreateTexture(font);
+    float x0, y0, x1, y1;
+    float s0, t0, s1, t1;
+    float tw, th;
+    float *q;
+    size_t nquads;
+
+    tw = font->texture->w;
+    th = font->texture->h;
+    nquads = 0;
+#endif
 
-    base_gauge_blit_texture(self, ctx, font->texture, &src_rect, &dst_rect);
+    for(size_t i = 0; i < npatches; i++){
+        patch = &patches[i];
+        if(patch->src.x < 0) /*Nothing visible*/
+            continue;
+        w = use_rects ? patch->src.w : font->metrics.characterWidth;
+        h = use_rects ? patch->src.h : font->metrics.ascent + font->metrics.descent;
+#if USE_SDL_GPU
+        x0 = patch->dst.x + ctx->location->x;
+        y0 = patch->dst.y + ctx->location->y;
+        x1 = x0 + w;
+        y1 = y0 + h;
+        s0 = patch->src.x / tw;
+        t0 = patch->src.y / th;
+        s1 = (patch->src.x + w) / tw;
+        t1 = (patch->src.y + h) / th;
+
+        q = &glyph_values[nquads * 16];
+        q[0]  = x0; q[1]  = y0; q[2]  = s0; q[3]  = t0;
+        q[4]  = x1; q[5]  = y0; q[6]  = s1; q[7]  = t0;
+        q[8]  = x1; q[9]  = y1; q[10] = s1; q[11] = t1;
+        q[12] = x0; q[13] = y1; q[14] = s0; q[15] = t1;
+        if(++nquads == GLYPH_BATCH_QUADS){
+            base_gauge_flush_glyphs(ctx, font, nquads);
+            nquads = 0;
+        }
 #else
-    base_gauge_blit(self, ctx, font->raster, &src_rect, &dst_rect);
+        base_gauge_blit(self, ctx, font->raster,
+            &(SDL_Rect){patch->src.x, patch->src.y, w, h},
+            &(SDL_Rect){patch->dst.x, patch->dst.y, w, h}
+        );
+#endif
+    }
+#if USE_SDL_GPU
+    if(nquads)
+        base_gauge_flush_glyphs(ctx, font, nquads);
 #endif
 }
 
+void base_gauge_draw_static_font_patch(BaseGauge *self, RenderContext *ctx,
+                                       PCF_StaticFont *font,
+                                       PCF_StaticFontPatch *patch)
+{
+    base_gauge_draw_static_font_run(self, ctx, font, patch, 1, false);
+}
+
 void base_gauge_draw_static_font_rect_patch(BaseGauge *self, RenderContext *ctx,
                                             PCF_StaticFont *font,
                                             PCF_StaticFontPatch *patch)
 {
-    SDL_Rect dst_rect; /*final destination*/
-    SDL_Rect src_rect;
-
-    src_rect = (SDL_Rect){
-        .x = patch->src.x,
-        .y = patch->src.y,
-        .w = patch->src.w,
-        .h = patch->src.h
-    };
-
-    dst_rect = (SDL_Rect){
-        .x = patch->dst.x,
-        .y = patch->dst.y,
-        .w = patch->src.w,
-        .h = patch->src.h
-    };
+    base_gauge_draw_static_font_run(self, ctx, font, patch, 1, true);
+}
 
-#if USE_SDL_GPU
-    if(!font->texture) /*TODO refactor: Have this a pre-requisite*/
-        PCF_StaticFontCreateTexture(font);
+/**
+ * @brief Draws a string laid out by PCF_StaticFontPreWriteString (or
+ * glyph_run_cache_layout). All patches are full glyph cells.
+ *
+ * @param self a BaseGauge
+ * @param ctx The gauge's render context
+ * @param font The font the patches refer to. Its texture must exist
+ * (see resource_manager_get_static_font).
+ * @param patches The patches to draw, in gauge coordinates
+ * @param npatches The number of patches
+ */
+void base_gauge_draw_static_font_patches(BaseGauge *self, RenderContext *ctx,
+                                         PCF_StaticFont *font,
+                                         PCF_StaticFontPatch *patches,
+                                         size_t npatches)
+{
+    base_gauge_draw_static_font_run(self, ctx, font, patches, npatches, false);
+}
 
-    base_gauge_blit_texture(self, ctx, font->texture, &src_rect, &dst_rect);
-#else
-    base_gauge_blit(self, ctx, font->raster, &src_rect, &dst_rect);
-#endif
+/**
+ * @brief Same as base_gauge_draw_static_font_patches for patches laid
+ * out by PCF_StaticFontPreWriteStringOffset, that can be partial glyphs.
+ * Patches with a negative source x are skipped.
+ */
+void base_gauge_draw_static_font_rect_patches(BaseGauge *self, RenderContext *ctx,
+                                              PCF_StaticFont *font,
+                                              PCF_StaticFontPatch *patches,
+                                              size_t npatches)
+{
+    base_gauge_draw_static_font_run(self, ctx, font, patches, npatches, true);
 }
 
 
@@ -555,3 +688,108 @@ int base_gauge_blit_rotated_texture(BaseGauge *self, RenderContext *ctx,
 	}
     return 1;
 }
+
+/**
+ * @brief Starts drawing a picture turned by @p angle and scaled by
+ * @p scale about @p about: blits done with
+ * base_gauge_blit_layer_transformed until base_gauge_end_transform all
+ * go through the same transform, computed once, and are clipped to the
+ * gauge (or ctx->portion of it) within the target's current clip.
+ * Unlike transforming each blit about its own center, patches stay
+ * joined.
+ *
+ * SDL_gpu only.
+ *
+ * @param self a BaseGauge
+ * @param ctx The gauge's render context
+ * @param angle The rotation, in degrees clockwise
+ * @param scale The scale, 1 to keep the size
+ * @param about The center of the transform, in gauge coordinates
+ * @param transform Where to keep the transform until base_gauge_end_transform
+ * @return true on success, false when transforms are not supported.
+ */
+bool base_gauge_begin_transform(BaseGauge *self, RenderContext *ctx,
+                                double angle, double scale, SDL_Point *about,
+                                RenderTransform *transform)
+{
+#if USE_SDL_GPU
+    GPU_Target *target;
+    GPU_Rect clip;
+
+    transform->cos = cos(angle * M_PI / 180.0) * scale;
+    transform->sin = sin(angle * M_PI / 180.0) * scale;
+    transform->about = *about;
+
+    target = ctx->target.target;
+    transform->had_clip = target->use_clip_rect;
+    transform->old_clip = target->clip_rect;
+    if(ctx->portion)
+        clip = rectf_offset(ctx->portion, ctx->location);
+    else
+        clip = (GPU_Rect){ctx->location->x, ctx->location->y, base_gauge_w(self), base_gauge_h(self)};
+    if(transform->had_clip && !GPU_IntersectRect(clip, transform->old_clip, &clip))
+        clip.w = clip.h = 0; /*Nothing to draw*/
+    GPU_SetClipRect(target, clip);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Same as base_gauge_blit_layer, going through the transform
+ * started by base_gauge_begin_transform. @p srcrect and @p dstrect must
+ * have the same size.
+ */
+int base_gauge_blit_layer_transformed(BaseGauge *self, RenderContext *ctx,
+                                      RenderTransform *transform,
+                                      GenericLayer *src,
+                                      SDL_Rect *srcrect, SDL_Rect *dstrect)
+{
+#if USE_SDL_GPU
+    static unsigned short indices[6] = {0, 1, 2, 0, 2, 3};
+    float values[4 * 4]; /*x, y, s, t*/
+    float corners[4][2];
+    float tw, th, x, y;
+
+    tw = src->texture->w;
+    th = src->texture->h;
+    corners[0][0] = dstrect->x;                corners[0][1] = dstrect->y;
+    corners[1][0] = dstrect->x + dstrect->w;   corners[1][1] = dstrect->y;
+    corners[2][0] = dstrect->x + dstrect->w;   corners[2][1] = dstrect->y + dstrect->h;
+    corners[3][0] = dstrect->x;                corners[3][1] = dstrect->y + dstrect->h;
+    for(int i = 0; i < 4; i++){
+        x = corners[i][0] - transform->about.x;
+        y = corners[i][1] - transform->about.y;
+        values[i*4 + 0] = ctx->location->x + transform->about.x + x * transform->cos - y * transform->sin;
+        values[i*4 + 1] = ctx->location->y + transform->about.y + x * transform->sin + y * transform->cos;
+    }
+    values[2] = values[14] = srcrect->x / tw;
+    values[6] = values[10] = (srcrect->x + srcrect->w) / tw;
+    values[3] = values[7] = srcrect->y / th;
+    values[11] = values[15] = (srcrect->y + srcrect->h) / th;
+
+    GPU_TriangleBatch(src->texture, ctx->target.target,
+        4, values,
+        6, indices,
+        GPU_BATCH_XY_ST
+    );
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Ends a transform started by base_gauge_begin_transform.
+ */
+void base_gauge_end_transform(BaseGauge *self, RenderContext *ctx,
+                              RenderTransform *transform)
+{
+#if USE_SDL_GPU
+    if(transform->had_clip)
+        GPU_SetClipRect(ctx->target.target, transform->old_clip);
+    else
+        GPU_UnsetClip(ctx->target.target);
+#endif
+}
@@ -14,6 +14,7 @@
 #include "SDL_pcf.h"
 #include "base-animation.h"
 #include "generic-layer.h"
+#include "perf-counters.h"
 
 typedef union{
     SDL_Surface *surface;
@@ -27,6 +28,16 @@ typedef struct{
     SDL_Rect *portion; /*Portion of the gauge to render*/
 }RenderContext;
 
+/*A rotation and scaling shared by several blits, see base_gauge_begin_transform*/
+typedef struct{
+    float cos; /*times the scale*/
+    float sin; /*times the scale*/
+    SDL_Point about; /*gauge coordinates*/
+
+    GPU_Rect old_clip;
+    bool had_clip;
+}RenderTransform;
+
 typedef void  (*RenderFunc)(void *self, Uint32 dt, RenderContext *ctx);
 typedef void  (*StateUpdateFunc)(void *self, Uint32 dt);
 typedef void* (*DisposeFunc)(void *self);
@@ -55,6 +66,9 @@ typedef struct _BaseGauge{
     BaseAnimation **animations;
     size_t nanimations;
     size_t animations_size; /*allocated animations*/
+#if ENABLE_PERF_COUNTERS
+    PerfCounter *perf; /*lazily set on first render*/
+#endif
 }BaseGauge;
 
 #define BASE_GAUGE_OPS(self) ((BaseGaugeOps*)(self))
@@ -90,6 +104,7 @@ void base_gauge_move_by(BaseGauge *self, int xinc, int yinc);
 bool base_gauge_move_child(BaseGauge *self, BaseGauge *child, int new_x, int new_y);
 
 void base_gauge_render(BaseGauge *self, Uint32 dt, RenderContext *ctx);
+bool base_gauge_needs_render(BaseGauge *self);
 
 int base_gauge_blit_layer(BaseGauge *self, RenderContext *ctx,
                           GenericLayer *src,
@@ -114,9 +129,27 @@ void base_gauge_draw_static_font_patch(BaseGauge *self, RenderContext *ctx,
 void base_gauge_draw_static_font_rect_patch(BaseGauge *self, RenderContext *ctx,
                                             PCF_StaticFont *font,
                                             PCF_StaticFontPatch *patch);
+void base_gauge_draw_static_font_patches(BaseGauge *self, RenderContext *ctx,
+                                         PCF_StaticFont *font,
+                                         PCF_StaticFontPatch *patches,
+                                         size_t npatches);
+void base_gauge_draw_static_font_rect_patches(BaseGauge *self, RenderContext *ctx,
+                                              PCF_StaticFont *font,
+                                              PCF_StaticFontPatch *patches,
+                                              size_t npatches);
 
 int base_gauge_blit_rotated_texture(BaseGauge *self, RenderContext *ctx,
                                     GPU_Image *src, SDL_Rect *srcrect,
                                     double angle, SDL_Point *about,
                                     SDL_Rect *dstrect, SDL_Rect *clip);
+
+bool base_gauge_begin_transform(BaseGauge *self, RenderContext *ctx,
+                                double angle, double scale, SDL_Point *about,
+                                RenderTransform *transform);
+int base_gauge_blit_layer_transformed(BaseGauge *self, RenderContext *ctx,
+                                      RenderTransform *transform,
+                                      GenericLayer *src,
+                                      SDL_Rect *srcrect, SDL_Rect *dstrect);
+void base_gauge_end_transform(BaseGauge *self, RenderContext *ctx,
+                              RenderTransform *transform);
 #endif /* BASE_GAUGE_H */
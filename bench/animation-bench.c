@@ -0,0 +1,198 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Animations under sampled data: a smooth signal (altitude-like) is
+ * sampled at the rates data sources deliver (5 to 25 Hz) and fed to
+ * an animation rendered at 50 FPS, the way gauges do.
+ *
+ * Compares the fixed duration tween restarted on each sample (what
+ * gauges used to do) with springs and smoothing, that are retargeted.
+ * Reports the mean lag behind the real signal and the jitter: how much
+ * the change of speed between two frames differs from the signal's
+ * own, i.e. the jerks added by the sampling and the animation.
+ *
+ * Then times animation_scheduler_step with many animations running.
+ *
+ * Built by `make bench-animation`.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "animation-scheduler.h"
+#include "base-animation.h"
+
+#define DEFAULT_SECONDS 60
+#define DEFAULT_ANIMATIONS 1000
+#define FRAME_MS 20 /*50 FPS*/
+
+static const int rates[] = {5, 10, 25}; /*Hz*/
+
+typedef enum{
+    RUN_TWEEN,
+    RUN_SPRING,
+    RUN_SMOOTH,
+    N_RUNS
+}RunKind;
+
+static const char *run_names[] = {"tween", "spring", "smooth"};
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-s seconds] [-n animations]\n", progname);
+}
+
+/*Climbs, levels off, turns back: feet*/
+static double signal_at(double ms)
+{
+    double t = ms / 1000.0;
+    return 3000 + 1500 * sin(t * 2 * M_PI / 20.0) + 200 * sin(t * 2 * M_PI / 3.0);
+}
+
+static void run(RunKind kind, int rate, int seconds, double *lag, double *jitter)
+{
+    BaseAnimation *animation;
+    float value;
+    double prev, prev_speed, speed;
+    double truth_speed, prev_truth_speed;
+    uint32_t now, next_sample;
+    size_t nframes;
+
+    value = signal_at(0);
+    animation = base_animation_new(TYPE_FLOAT, 1, &value);
+    base_animation_ref(animation);
+
+    *lag = *jitter = 0;
+    prev = value;
+    prev_speed = prev_truth_speed = 0;
+    nframes = 0;
+    next_sample = 0;
+    for(now = 0; now < seconds * 1000; now += FRAME_MS){
+        while(next_sample <= now){
+            switch(kind){
+                case RUN_TWEEN:
+                    base_animation_start(animation, value, signal_at(next_sample), DEFAULT_DURATION);
+                    break;
+                case RUN_SPRING:
+                    base_animation_spring_to(animation, signal_at(next_sample));
+                    break;
+                case RUN_SMOOTH:
+                    base_animation_smooth_to(animation, signal_at(next_sample));
+                    break;
+                default:
+                    break;
+            }
+            next_sample += 1000 / rate;
+        }
+        animation_scheduler_step(FRAME_MS);
+
+        speed = value - prev;
+        truth_speed = signal_at(now) - signal_at(now - FRAME_MS);
+        *lag += fabs(value - signal_at(now));
+        if(nframes)
+            *jitter += fabs((speed - prev_speed) - (truth_speed - prev_truth_speed));
+        prev = value;
+        prev_speed = speed;
+        prev_truth_speed = truth_speed;
+        nframes++;
+    }
+    *lag /= nframes;
+    *jitter /= nframes - 1;
+
+    base_animation_unref(animation);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    int seconds = DEFAULT_SECONDS;
+    size_t nanimations = DEFAULT_ANIMATIONS;
+    double lag, jitter;
+    BaseAnimation **animations;
+    float *values;
+    uint64_t start, elapsed;
+    size_t nsteps;
+
+    while((opt = getopt(argc, argv, "s:n:h")) != -1){
+        switch(opt){
+            case 's': seconds = atoi(optarg); break;
+            case 'n': nanimations = strtoul(optarg, NULL, 10); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(seconds <= 0 || !nanimations){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("%ds of signal, %d FPS, lag in ft, jitter in ft/frame\n", seconds, 1000/FRAME_MS);
+    printf("%6s", "rate");
+    for(int k = 0; k < N_RUNS; k++)
+        printf(" %8s lag %8s jit", run_names[k], run_names[k]);
+    printf("\n");
+    for(int r = 0; r < sizeof(rates)/sizeof(rates[0]); r++){
+        printf("%4dHz", rates[r]);
+        for(int k = 0; k < N_RUNS; k++){
+            run(k, rates[r], seconds, &lag, &jitter);
+            printf(" %12.2f %12.3f", lag, jitter);
+        }
+        printf("\n");
+    }
+
+    /*Per frame cost, all animations running*/
+    animations = calloc(nanimations, sizeof(BaseAnimation*));
+    values = calloc(nanimations, sizeof(float));
+    if(!animations || !values){
+        printf("Couldn't allocate %zu animations\n", nanimations);
+        exit(EXIT_FAILURE);
+    }
+    for(size_t i = 0; i < nanimations; i++){
+        animations[i] = base_animation_new(TYPE_FLOAT, 1, &values[i]);
+        if(!animations[i]){
+            printf("Couldn't allocate %zu animations\n", nanimations);
+            exit(EXIT_FAILURE);
+        }
+        base_animation_ref(animations[i]);
+    }
+    nsteps = 0;
+    start = bench_now();
+    for(uint32_t now = 0; now < seconds * 1000; now += FRAME_MS, nsteps++){
+        if(now % 100 == 0){ /*10Hz data*/
+            for(size_t i = 0; i < nanimations; i++)
+                base_animation_spring_to(animations[i], signal_at(now + i));
+        }
+        animation_scheduler_step(FRAME_MS);
+    }
+    elapsed = bench_now() - start;
+    printf("Step: %zu animations, %.3f us/frame (%.1f ns/animation), data included\n",
+        nanimations,
+        elapsed/1000.0/nsteps,
+        elapsed*1.0/nsteps/nanimations
+    );
+
+    for(size_t i = 0; i < nanimations; i++)
+        base_animation_unref(animations[i]);
+    free(animations);
+    free(values);
+    animation_scheduler_shutdown();
+
+    return 0;
+}
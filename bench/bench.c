@@ -0,0 +1,436 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Headless, reproducible benchmark: renders the PFD, side panel and
+ * map into an off-screen surface using SDL's dummy video driver. Data
+ * comes from a FGTapeDataSource played on a fixed virtual clock so that
+ * two runs see exactly the same inputs regardless of how fast frames
+ * are rendered.
+ *
+ * Built with the software path (USE_SDL_GPU=0) by `make bench` so it
+ * can run on machines without a GPU.
+ *
+ * Allocations are counted by wrapping malloc and friends at link time
+ * (-Wl,--wrap=...), see the Makefile.
+ *
+ * With -k, bursts of keys (as from a rotary encoder) are pushed to SDL's
+ * queue and typed in the Direct-To dialog, and the time from each key
+ * to the end of the frame showing its effect is measured: the frames
+ * waited on the virtual clock plus the time to handle the events and
+ * render. -e limits the events handled per frame, -e 1 being one key
+ * per frame.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <SDL2/SDL.h>
+
+#include "animation-scheduler.h"
+#include "base-gauge.h"
+#include "basic-hud.h"
+#include "data-source.h"
+#include "dialogs/direct-to-dialog.h"
+#include "fg-tape-data-source.h"
+#include "ladder-page-renderer.h"
+#include "map-gauge.h"
+#include "nav-db.h"
+#include "nav-engine.h"
+#include "perf-counters.h"
+#include "resource-manager.h"
+#include "side-panel.h"
+#include "sdl-colors.h"
+#include "widgets/base-widget.h"
+
+#define SCREEN_WIDTH 640
+#define SCREEN_HEIGHT 480
+
+#define DEFAULT_FRAMES 2000
+#define DEFAULT_WARMUP 100
+#define DEFAULT_STEP 20 /*virtual milliseconds per frame, 50 FPS*/
+#define DEFAULT_TAPE "fg-io/fg-tape/dr400.fgtape"
+#define DEFAULT_TAPE_POS 120 /*seconds*/
+#define INPUT_PERIOD 10 /*frames between two bursts of keys*/
+#define INPUT_RESET 32 /*bursts, before the dialog gets reset*/
+
+typedef struct{
+    size_t nmalloc;
+    size_t ncalloc;
+    size_t nrealloc;
+    size_t nfree;
+    size_t bytes; /*requested through malloc/calloc/realloc*/
+}AllocStats;
+
+/* Updated atomically: worker threads (e.g ladder pages) allocate
+ * alongside the main thread. Read with alloc_stats_get*/
+static AllocStats alloc_stats = {0};
+
+#define alloc_stats_add(field, n) __atomic_fetch_add(&alloc_stats.field, (n), __ATOMIC_RELAXED)
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size)
+{
+    alloc_stats_add(nmalloc, 1);
+    alloc_stats_add(bytes, size);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+    alloc_stats_add(ncalloc, 1);
+    alloc_stats_add(bytes, nmemb * size);
+    return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    alloc_stats_add(nrealloc, 1);
+    alloc_stats_add(bytes, size);
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr)
+{
+    if(ptr)
+        alloc_stats_add(nfree, 1);
+    __real_free(ptr);
+}
+
+static void alloc_stats_get(AllocStats *self)
+{
+    *self = (AllocStats){
+        .nmalloc = __atomic_load_n(&alloc_stats.nmalloc, __ATOMIC_RELAXED),
+        .ncalloc = __atomic_load_n(&alloc_stats.ncalloc, __ATOMIC_RELAXED),
+        .nrealloc = __atomic_load_n(&alloc_stats.nrealloc, __ATOMIC_RELAXED),
+        .nfree = __atomic_load_n(&alloc_stats.nfree, __ATOMIC_RELAXED),
+        .bytes = __atomic_load_n(&alloc_stats.bytes, __ATOMIC_RELAXED)
+    };
+}
+
+static inline size_t alloc_stats_count(AllocStats *self)
+{
+    return self->nmalloc + self->ncalloc + self->nrealloc;
+}
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int bench_cmp_u64(const void *a, const void *b)
+{
+    uint64_t ia = *(const uint64_t*)a;
+    uint64_t ib = *(const uint64_t*)b;
+
+    return (ia > ib) - (ia < ib);
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-n frames] [-w warmup] [-s step_ms] [-t tape] [-p tape_pos] [-k keys_per_burst] [-e events_per_frame]"
+#if ENABLE_PERF_COUNTERS
+           " [-o perf.csv]"
+#endif
+           "\n", progname);
+}
+
+static void bench_report(const char *title, uint64_t *frames, size_t nframes, Uint32 step)
+{
+    uint64_t total;
+    size_t over;
+
+    qsort(frames, nframes, sizeof(uint64_t), bench_cmp_u64);
+    total = 0;
+    for(int i = 0; i < nframes; i++)
+        total += frames[i];
+
+    printf("%s (us) over %zu samples:\n", title, nframes);
+    printf("  min  %8.1f\n", frames[0]/1000.0);
+    printf("  mean %8.1f\n", total/1000.0/nframes);
+    printf("  p50  %8.1f\n", frames[(nframes-1)*50/100]/1000.0);
+    printf("  p90  %8.1f\n", frames[(nframes-1)*90/100]/1000.0);
+    printf("  p95  %8.1f\n", frames[(nframes-1)*95/100]/1000.0);
+    printf("  p99  %8.1f\n", frames[(nframes-1)*99/100]/1000.0);
+    printf("  max  %8.1f\n", frames[nframes-1]/1000.0);
+    over = 0;
+    for(int i = 0; i < nframes; i++){
+        if(frames[i] > step * 1000000ull)
+            over++;
+    }
+    printf("  over budget (%u ms): %zu\n", step, over);
+}
+
+/* A burst of keys, all pushed at once, as SDL would queue them in
+ * between two frames. Goes through the characters, appending one every
+ * 4 bursts. Returns the number of keys pushed.*/
+static size_t bench_push_keys(size_t nkeys, size_t burst)
+{
+    SDL_Event event;
+    size_t rv;
+
+    rv = 0;
+    for(size_t i = 0; i < nkeys; i++){
+        event = (SDL_Event){.type = SDL_KEYDOWN};
+        event.key.state = SDL_PRESSED;
+        event.key.keysym.sym = (i == 0 && burst % 4 == 3) ? SDLK_RIGHT : SDLK_DOWN;
+        if(SDL_PushEvent(&event) == 1)
+            rv++;
+    }
+    return rv;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t nframes = DEFAULT_FRAMES;
+    size_t nwarmup = DEFAULT_WARMUP;
+    Uint32 step = DEFAULT_STEP;
+    char *tape = DEFAULT_TAPE;
+    int tape_pos = DEFAULT_TAPE_POS;
+    size_t nkeys = 0;
+    size_t max_events = 0; /*per frame, 0 for all of them*/
+#if ENABLE_PERF_COUNTERS
+    char *csv = NULL;
+#endif
+
+    while((opt = getopt(argc, argv, "n:w:s:t:p:k:e:o:h")) != -1){
+        switch(opt){
+            case 'n': nframes = strtoul(optarg, NULL, 10); break;
+            case 'w': nwarmup = strtoul(optarg, NULL, 10); break;
+            case 's': step = strtoul(optarg, NULL, 10); break;
+            case 't': tape = optarg; break;
+            case 'p': tape_pos = atoi(optarg); break;
+            case 'k': nkeys = strtoul(optarg, NULL, 10); break;
+            case 'e': max_events = strtoul(optarg, NULL, 10); break;
+#if ENABLE_PERF_COUNTERS
+            case 'o': csv = optarg; break;
+#endif
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!nframes || !step){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if(SDL_Init(SDL_INIT_VIDEO) < 0){
+        printf("Couldn't init SDL: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    SDL_Surface *screen = SDL_CreateRGBSurfaceWithFormat(0,
+        SCREEN_WIDTH, SCREEN_HEIGHT,
+        32, SDL_PIXELFORMAT_RGBA32
+    );
+    if(!screen){
+        printf("Couldn't create off-screen surface: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    RenderTarget rtarget = {.surface = screen};
+
+    FGTapeDataSource *ds = fg_tape_data_source_new(tape, tape_pos);
+    if(!ds){
+        printf("Couldn't open tape %s, bailing out\n", tape);
+        exit(EXIT_FAILURE);
+    }
+    data_source_set(DATA_SOURCE(ds));
+
+    AllocStats setup_start, setup_end;
+    alloc_stats_get(&setup_start);
+
+    BasicHud *hud = basic_hud_new();
+    hud->attitude->mode = AI_MODE_2D;
+    SidePanel *panel = side_panel_new(-1, -1);
+    MapGauge *map = map_gauge_new(190, 150);
+    map_gauge_set_level(map, 7);
+
+    SDL_Rect whole = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+    SDL_Rect sprect = {0, 0, base_gauge_w(BASE_GAUGE(panel)), base_gauge_h(BASE_GAUGE(panel))};
+    SDL_Rect maprect = {
+        SCREEN_WIDTH-200, SCREEN_HEIGHT-160,
+        base_gauge_w(BASE_GAUGE(map)), base_gauge_h(BASE_GAUGE(map))
+    };
+
+    DirectToDialog *ddt = NULL;
+    SDL_Rect ddtrect = {SCREEN_WIDTH/2, SCREEN_HEIGHT/2 - 100, 12*20, 304};
+    if(nkeys){
+        if(!nav_db_open(NAVDATA_FILE))
+            printf("No navigation database, Direct-To will be empty (see make navdata)\n");
+        ddt = direct_to_dialog_new();
+        if(!ddt){
+            printf("Couldn't create the Direct-To dialog\n");
+            exit(EXIT_FAILURE);
+        }
+        ddt->visible = true;
+    }
+
+    data_source_add_events_listener(DATA_SOURCE(ds), hud, 3,
+        ATTITUDE_DATA, basic_hud_attitude_changed,
+        DYNAMICS_DATA, basic_hud_dynamics_changed,
+        LOCATION_DATA, basic_hud_location_changed
+    );
+    data_source_add_listener(DATA_SOURCE(ds), ENGINE_DATA, &(ValueListener){
+        .callback = (ValueListenerFunc)side_panel_engine_data_changed,
+        .target = panel
+    });
+    data_source_add_events_listener(DATA_SOURCE(ds), map, 3,
+        LOCATION_DATA, map_gauge_location_changed,
+        ATTITUDE_DATA, map_gauge_attitude_changed,
+        ROUTE_DATA, map_gauge_route_changed
+    );
+    nav_engine_start(DATA_SOURCE(ds));
+    data_source_frame(DATA_SOURCE(ds), 0); /*Initial fix*/
+
+    alloc_stats_get(&setup_end);
+    size_t setup_allocs = alloc_stats_count(&setup_end) - alloc_stats_count(&setup_start);
+
+    uint64_t *frames = calloc(nframes, sizeof(uint64_t));
+    /* Frame each pending key was pushed in, in order, then latency of
+     * each handled one*/
+    size_t max_keys = (nwarmup + nframes) / INPUT_PERIOD * nkeys + nkeys;
+    size_t *pushed = calloc(max_keys, sizeof(size_t));
+    uint64_t *latencies = calloc(max_keys, sizeof(uint64_t));
+    if(!frames || !pushed || !latencies){
+        printf("Couldn't allocate %zu samples\n", nframes);
+        exit(EXIT_FAILURE);
+    }
+    size_t npushed = 0, nhandled = 0, nlatencies = 0, nbursts = 0;
+
+    Uint32 vclock = 0; /*virtual milliseconds*/
+    Uint32 last_data = 0;
+    AllocStats run_start = {0};
+    size_t hits_start = 0, misses_start = 0;
+    size_t label_hits_start = 0, label_misses_start = 0;
+    uint64_t wall_start = 0;
+
+    for(size_t i = 0; i < nwarmup + nframes; i++){
+        if(i == nwarmup){
+            alloc_stats_get(&run_start);
+            hits_start = map->tile_cache.hits;
+            misses_start = map->tile_cache.misses;
+            label_hits_start = map->labels.hits;
+            label_misses_start = map->labels.misses;
+            wall_start = bench_now();
+        }
+        uint64_t start = bench_now();
+
+        if(ddt){
+            if(i % INPUT_PERIOD == 0){
+                if(nbursts && nbursts % INPUT_RESET == 0)
+                    direct_to_dialog_reset(ddt);
+                for(size_t k = bench_push_keys(nkeys, nbursts); k > 0; k--)
+                    pushed[npushed++] = i;
+                nbursts++;
+            }
+            SDL_Event event;
+            size_t nevents = 0;
+            while((!max_events || nevents < max_events) && SDL_PollEvent(&event) == 1){
+                if(event.type != SDL_KEYDOWN)
+                    continue;
+                base_widget_handle_event(BASE_WIDGET(ddt), &event.key);
+                nevents++;
+            }
+            nhandled += nevents;
+        }
+
+        vclock += step;
+        if(data_source_frame(DATA_SOURCE(ds), vclock - last_data))
+            last_data = vclock;
+
+        animation_scheduler_step(step);
+        SDL_FillRect(screen, NULL, SDL_UFBLUE(screen));
+        base_gauge_render(BASE_GAUGE(hud), step, &(RenderContext){rtarget, &whole, NULL});
+        base_gauge_render(BASE_GAUGE(panel), step, &(RenderContext){rtarget, &sprect, NULL});
+        base_gauge_render(BASE_GAUGE(map), step, &(RenderContext){rtarget, &maprect, NULL});
+        if(ddt)
+            base_gauge_render(BASE_GAUGE(ddt), step, &(RenderContext){rtarget, &ddtrect, NULL});
+
+        uint64_t end = bench_now();
+        if(i >= nwarmup)
+            frames[i - nwarmup] = end - start;
+        /*Keys shown by this frame, waited for (i - pushed) frames*/
+        for(; nlatencies < nhandled; nlatencies++){
+            latencies[nlatencies] = (i - pushed[nlatencies]) * step * 1000000ull
+                                  + (end - start);
+        }
+    }
+    uint64_t wall = bench_now() - wall_start;
+
+    AllocStats run_end;
+    alloc_stats_get(&run_end);
+    size_t run_allocs = alloc_stats_count(&run_end) - alloc_stats_count(&run_start);
+    size_t run_bytes = run_end.bytes - run_start.bytes;
+    size_t hits = map->tile_cache.hits - hits_start;
+    size_t misses = map->tile_cache.misses - misses_start;
+    size_t label_hits = map->labels.hits - label_hits_start;
+    size_t label_misses = map->labels.misses - label_misses_start;
+
+    printf("Tape: %s from %ds, %u ms virtual step, %zu warmup frames\n",
+        tape, tape_pos, step, nwarmup);
+    printf("Wall time: %.3f s (%.1f FPS)\n", wall/1e9, nframes/(wall/1e9));
+    bench_report("Frame time", frames, nframes, step);
+    if(ddt){
+        printf("Input: %zu keys by bursts of %zu every %d frames, %s per frame, %zu not handled\n",
+            npushed, nkeys, INPUT_PERIOD,
+            max_events ? "limited" : "all events", npushed - nhandled
+        );
+        if(nlatencies)
+            bench_report("Input to photon", latencies, nlatencies, step);
+    }
+    printf("Allocations: setup %zu, run %zu (%.2f/frame, %zu bytes), frees %zu\n",
+        setup_allocs, run_allocs, run_allocs*1.0/nframes, run_bytes,
+        run_end.nfree - run_start.nfree
+    );
+    printf("Tile cache: %zu hits, %zu misses (%.1f%% hit rate)\n",
+        hits, misses, (hits + misses) ? hits*100.0/(hits + misses) : 100.0
+    );
+    printf("Label placement: %zu hits, %zu misses (%.1f%% hit rate)\n",
+        label_hits, label_misses,
+        (label_hits + label_misses) ? label_hits*100.0/(label_hits + label_misses) : 100.0
+    );
+#if ENABLE_PERF_COUNTERS
+    if(csv && perf_counters_dump_csv(csv))
+        printf("Perf counters written to %s\n", csv);
+#endif
+
+    free(frames);
+    free(pushed);
+    free(latencies);
+    if(ddt){
+        base_gauge_free(BASE_GAUGE(ddt));
+        nav_db_close();
+    }
+    base_gauge_free(BASE_GAUGE(hud));
+    base_gauge_free(BASE_GAUGE(panel));
+    base_gauge_free(BASE_GAUGE(map));
+#if ENABLE_PERF_COUNTERS
+    perf_counters_shutdown();
+#endif
+    data_source_free(DATA_SOURCE(ds));
+    ladder_page_renderer_shutdown();
+    animation_scheduler_shutdown();
+    resource_manager_shutdown();
+    SDL_FreeSurface(screen);
+    SDL_Quit();
+
+    return 0;
+}
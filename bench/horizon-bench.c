@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Per-frame cost of the procedural horizon (software rasterizer) at
+ * various roll angles. For each angle, pitch sweeps the whole ladder
+ * range so that every frame has a different geometry.
+ *
+ * Built with the software path (USE_SDL_GPU=0) by `make bench-horizon`.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <SDL2/SDL.h>
+
+#include "horizon-renderer.h"
+#include "resource-manager.h"
+
+#define DEFAULT_WIDTH 640
+#define DEFAULT_HEIGHT 480
+#define DEFAULT_FRAMES 500
+#define LADDER_SIZE 2 /*same as AttitudeIndicator*/
+
+static const float rolls[] = {0, 5, 15, 30, 45, 60, 90, 135, 180};
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int bench_cmp_u64(const void *a, const void *b)
+{
+    uint64_t ia = *(const uint64_t*)a;
+    uint64_t ib = *(const uint64_t*)b;
+
+    return (ia > ib) - (ia < ib);
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-n frames] [-W width] [-H height]\n", progname);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t nframes = DEFAULT_FRAMES;
+    int width = DEFAULT_WIDTH;
+    int height = DEFAULT_HEIGHT;
+    HorizonRenderer horizon = {0};
+
+    while((opt = getopt(argc, argv, "n:W:H:h")) != -1){
+        switch(opt){
+            case 'n': nframes = strtoul(optarg, NULL, 10); break;
+            case 'W': width = atoi(optarg); break;
+            case 'H': height = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!nframes || width <= 0 || height <= 0){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if(SDL_Init(SDL_INIT_VIDEO) < 0){
+        printf("Couldn't init SDL: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    SDL_Surface *screen = SDL_CreateRGBSurfaceWithFormat(0,
+        width, height,
+        32, SDL_PIXELFORMAT_RGBA32
+    );
+    if(!screen){
+        printf("Couldn't create off-screen surface: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    RenderContext ctx = {
+        .target.surface = screen,
+        .location = &(SDL_Rect){0, 0, width, height},
+        .portion = NULL
+    };
+
+    /*Same setup as the AttitudeIndicator*/
+    if(!horizon_renderer_init(&horizon, width, height,
+        &(SDL_Point){round(width/2.0) - 1, round(height*0.4) - 1},
+        9/2.5, LADDER_SIZE,
+        round(height*0.225),
+        resource_manager_get_font(TERMINUS_12))){
+        printf("Couldn't create the horizon\n");
+        exit(EXIT_FAILURE);
+    }
+
+    uint64_t *frames = calloc(nframes, sizeof(uint64_t));
+    if(!frames){
+        printf("Couldn't allocate %zu samples\n", nframes);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("Horizon %dx%d, %zu frames per roll angle, times in us\n", width, height, nframes);
+    printf("%8s %8s %8s %8s %8s\n", "roll", "mean", "p50", "p95", "max");
+    for(int r = 0; r < sizeof(rolls)/sizeof(rolls[0]); r++){
+        uint64_t total = 0;
+
+        for(size_t i = 0; i < nframes; i++){
+            float pitch = (LADDER_SIZE*10 + 5) * sinf(i * 2 * M_PI / nframes);
+            uint64_t start = bench_now();
+
+            horizon_renderer_set_attitude(&horizon, -rolls[r], pitch);
+            horizon_renderer_render(&horizon, &ctx);
+
+            frames[i] = bench_now() - start;
+            total += frames[i];
+        }
+        qsort(frames, nframes, sizeof(uint64_t), bench_cmp_u64);
+        printf("%8.1f %8.1f %8.1f %8.1f %8.1f\n",
+            rolls[r],
+            total/1000.0/nframes,
+            frames[(nframes-1)*50/100]/1000.0,
+            frames[(nframes-1)*95/100]/1000.0,
+            frames[nframes-1]/1000.0
+        );
+    }
+
+    free(frames);
+    horizon_renderer_dispose(&horizon);
+    resource_manager_shutdown();
+    SDL_FreeSurface(screen);
+    SDL_Quit();
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Raster primitives: the per-pixel loops the generators used to have
+ * against raster.c, on a ladder page sized canvas. Each pattern is
+ * drawn by both, outputs are compared so that a port can't silently
+ * change what the gauges look like.
+ *
+ * Built with the software path (USE_SDL_GPU=0) by `make bench-raster`.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <SDL2/SDL.h>
+
+#include "raster.h"
+
+#define DEFAULT_ITERATIONS 500
+#define DEFAULT_W 68
+#define DEFAULT_H 1024
+
+#define GLYPH_W 8
+#define GLYPH_H 13
+
+typedef enum{
+    PATTERN_HSPAN,  /*Full rows: digit barrel etch marks, vertical ruler hatches*/
+    PATTERN_VSPAN,  /*Full columns: horizontal ruler hatches*/
+    PATTERN_RECT,   /*Ruler color zones*/
+    PATTERN_LADDER, /*ladder_page_draw_ruler*/
+    PATTERN_GLYPH,  /*1bpp glyphs, clipped on the edges*/
+    N_PATTERNS
+}Pattern;
+
+static const char *pattern_names[] = {"hspan", "vspan", "rect", "ladder", "glyph"};
+
+/*'8' in a 8x13 cell*/
+static const uint8_t glyph[GLYPH_H] = {
+    0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00
+};
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-n iterations] [-w width] [-H height]\n", progname);
+}
+
+/*Before: pixel by pixel, index computed for each one*/
+static void draw_loop(SDL_Surface *s, Pattern pattern, Uint32 color)
+{
+    Uint32 *pixels = s->pixels;
+
+    switch(pattern){
+        case PATTERN_HSPAN:
+            for(int y = 0; y < s->h; y += 4)
+                for(int x = 0; x < s->w; x++)
+                    pixels[y * s->w + x] = color;
+            break;
+        case PATTERN_VSPAN:
+            for(int x = 0; x < s->w; x += 4)
+                for(int y = 0; y < s->h; y++)
+                    pixels[y * s->w + x] = color;
+            break;
+        case PATTERN_RECT:
+            for(int i = 0; i < 4; i++)
+                for(int y = i * s->h/4; y <= (i + 1) * s->h/4 - 2; y++)
+                    for(int x = s->w/4; x <= s->w - 1; x++)
+                        pixels[y * s->w + x] = color + i;
+            break;
+        case PATTERN_LADDER:
+            for(int y = s->h - 1, cnt = 1; y >= 0; y--, cnt++){
+                int firstx = s->w - 1;
+                if(cnt % 10 == 0)
+                    firstx -= (cnt % 50 == 0) ? 15 : 5;
+                for(int x = firstx; x <= s->w - 1; x++)
+                    pixels[y * s->w + x] = color;
+            }
+            break;
+        case PATTERN_GLYPH:
+            for(int gy = -GLYPH_H/2; gy < s->h; gy += GLYPH_H + 1){
+                for(int gx = -GLYPH_W/2; gx < s->w; gx += GLYPH_W){
+                    for(int y = 0; y < GLYPH_H; y++){
+                        for(int x = 0; x < GLYPH_W; x++){
+                            if(gx + x < 0 || gx + x >= s->w || gy + y < 0 || gy + y >= s->h)
+                                continue;
+                            if(glyph[y] & (0x80 >> x))
+                                pixels[(gy + y) * s->w + gx + x] = color;
+                        }
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*After: raster.c*/
+static void draw_raster(SDL_Surface *s, Pattern pattern, Uint32 color)
+{
+    switch(pattern){
+        case PATTERN_HSPAN:
+            for(int y = 0; y < s->h; y += 4)
+                raster_hspan(s, 0, s->w - 1, y, color);
+            break;
+        case PATTERN_VSPAN:
+            for(int x = 0; x < s->w; x += 4)
+                raster_vspan(s, x, 0, s->h - 1, color);
+            break;
+        case PATTERN_RECT:
+            for(int i = 0; i < 4; i++)
+                raster_fill_rect(s, s->w/4, i * s->h/4, s->w - 1, (i + 1) * s->h/4 - 2, color + i);
+            break;
+        case PATTERN_LADDER:
+            raster_vspan(s, s->w - 1, 0, s->h - 1, color);
+            for(int y = s->h - 1, cnt = 1; y >= 0; y--, cnt++){
+                if(cnt % 10 != 0)
+                    continue;
+                raster_hspan(s, s->w - 1 - ((cnt % 50 == 0) ? 15 : 5), s->w - 1, y, color);
+            }
+            break;
+        case PATTERN_GLYPH:
+            for(int gy = -GLYPH_H/2; gy < s->h; gy += GLYPH_H + 1)
+                for(int gx = -GLYPH_W/2; gx < s->w; gx += GLYPH_W)
+                    raster_blit_bitmap(s, gx, gy, glyph, GLYPH_W, GLYPH_H, 1, color);
+            break;
+        default:
+            break;
+    }
+}
+
+static uint64_t run(SDL_Surface *s, Pattern pattern, bool raster, size_t niter)
+{
+    uint64_t start;
+
+    start = bench_now();
+    for(size_t i = 0; i < niter; i++){
+        memset(s->pixels, 0, (size_t)s->pitch * s->h);
+        if(raster)
+            draw_raster(s, pattern, 0xff00ffff);
+        else
+            draw_loop(s, pattern, 0xff00ffff);
+    }
+    return bench_now() - start;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t niter = DEFAULT_ITERATIONS;
+    int w = DEFAULT_W;
+    int h = DEFAULT_H;
+    SDL_Surface *ref, *dst;
+    uint64_t tloop, traster;
+    bool mismatch;
+
+    while((opt = getopt(argc, argv, "n:w:H:h")) != -1){
+        switch(opt){
+            case 'n': niter = strtoul(optarg, NULL, 10); break;
+            case 'w': w = atoi(optarg); break;
+            case 'H': h = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!niter || w < 16 || h < 16){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    /*Surfaces are plain memory, no need for a video driver*/
+    ref = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+    if(!ref || !dst){
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    if(ref->pitch != w * 4){
+        printf("Padded surfaces are not supported by the per-pixel loops\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("Drawing on %dx%d, %zu iterations per pattern, mean times in us\n",
+        w, h, niter
+    );
+    printf("%8s %13s %13s %8s\n", "pattern", "loop", "raster", "speedup");
+    mismatch = false;
+    for(int p = 0; p < N_PATTERNS; p++){
+        tloop = run(ref, p, false, niter);
+        traster = run(dst, p, true, niter);
+        printf("%8s %13.2f %13.2f %7.2fx",
+            pattern_names[p],
+            tloop/1000.0/niter, traster/1000.0/niter,
+            traster ? (double)tloop/traster : 0.0
+        );
+        if(memcmp(ref->pixels, dst->pixels, (size_t)w * h * 4)){
+            printf("  OUTPUT MISMATCH");
+            mismatch = true;
+        }
+        printf("\n");
+    }
+
+    SDL_FreeSurface(ref);
+    SDL_FreeSurface(dst);
+
+    return mismatch ? EXIT_FAILURE : EXIT_SUCCESS;
+}
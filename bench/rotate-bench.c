@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Software rotation: SDL_RenderCopyEx (software renderer, as the
+ * gauges used to do) against rotate_blit, nearest and bilinear. Each
+ * run rotates an image into a same-sized buffer, clearing it first,
+ * which is what the compass and roll/slip gauges do every frame.
+ *
+ * Built with the software path (USE_SDL_GPU=0) by `make bench-rotate`.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include "rotate-blit.h"
+#include "res-dirs.h"
+
+#define DEFAULT_ITERATIONS 200
+#define DEFAULT_IMAGE IMG_DIR"/compass-inner.png"
+
+static const float angles[] = {0, 1.5, 10, 30, 45, 90, 137.5, 180, 270};
+
+typedef enum{
+    RUN_SDL,
+    RUN_NEAREST,
+    RUN_BILINEAR,
+    N_RUNS
+}RunKind;
+
+static const char *run_names[] = {"RenderCopyEx", "nearest", "bilinear"};
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-n iterations] [-f image]\n", progname);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t niter = DEFAULT_ITERATIONS;
+    const char *filename = DEFAULT_IMAGE;
+    SDL_Surface *loaded, *src, *dst;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_Point center;
+    uint64_t start, elapsed;
+
+    while((opt = getopt(argc, argv, "n:f:h")) != -1){
+        switch(opt){
+            case 'n': niter = strtoul(optarg, NULL, 10); break;
+            case 'f': filename = optarg; break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!niter){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if(SDL_Init(SDL_INIT_VIDEO) < 0){
+        printf("Couldn't init SDL: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    loaded = IMG_Load(filename);
+    if(!loaded){
+        printf("Couldn't load %s: %s\n", filename, SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    src = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    dst = src ? SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 32, SDL_PIXELFORMAT_RGBA32) : NULL;
+    if(!dst){
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    texture = renderer ? SDL_CreateTextureFromSurface(renderer, src) : NULL;
+    if(!texture){
+        printf("Couldn't create software renderer: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    center = (SDL_Point){(src->w - 1)/2, (src->h - 1)/2};
+
+    printf("Rotating %dx%d, %zu iterations per angle, mean times in us\n",
+        src->w, src->h, niter
+    );
+    printf("%8s", "angle");
+    for(int k = 0; k < N_RUNS; k++)
+        printf(" %13s", run_names[k]);
+    printf("\n");
+
+    for(int a = 0; a < sizeof(angles)/sizeof(angles[0]); a++){
+        printf("%8.1f", angles[a]);
+        for(int k = 0; k < N_RUNS; k++){
+            start = bench_now();
+            for(size_t i = 0; i < niter; i++){
+                switch(k){
+                    case RUN_SDL:
+                        SDL_FillRect(dst, NULL, 0x00000000);
+                        SDL_RenderCopyEx(renderer, texture,
+                            NULL, NULL,
+                            angles[a], &center, SDL_FLIP_NONE
+                        );
+                        break;
+                    case RUN_NEAREST:
+                    case RUN_BILINEAR:
+                        rotate_blit(src,
+                            center.x + 0.5f, center.y + 0.5f,
+                            dst,
+                            center.x + 0.5f, center.y + 0.5f,
+                            angles[a], NULL,
+                            k == RUN_NEAREST ? ROTATE_NEAREST : ROTATE_BILINEAR,
+                            ROTATE_COPY
+                        );
+                        break;
+                }
+            }
+            elapsed = bench_now() - start;
+            printf(" %13.1f", elapsed/1000.0/niter);
+        }
+        printf("\n");
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_Quit();
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Direct-To search: typing queries one character at a time over a
+ * database of N airports (those of the navigation database, repeated
+ * with other codes to get to N), the way the dialog filters its list on
+ * each keystroke.
+ *
+ * Compares the search index with the former full scan (strcasestr on
+ * every label) and checks that both find the same airports.
+ *
+ * Built by `make bench-search`.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "search-index.h"
+#include "nav-db.h"
+
+#define DEFAULT_ENTRIES 50000
+#define DEFAULT_ROUNDS 10
+
+static const char *queries[] = {
+    "lfpg",
+    "paris",
+    "saint",
+    "mont",
+    "lf12",
+    "charles de",
+    "sur",
+    "zzz"
+};
+#define NQUERIES (sizeof(queries)/sizeof(queries[0]))
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-f navdata] [-n entries] [-r rounds]\n", progname);
+}
+
+/*Former filter: returns the matching labels, in label order*/
+static size_t scan(char **labels, size_t nlabels, const char *query, uint32_t *results)
+{
+    size_t rv = 0;
+
+    for(size_t i = 0; i < nlabels; i++){
+        if(strcasestr(labels[i], query))
+            results[rv++] = i;
+    }
+    return rv;
+}
+
+static int id_cmp(const void *a, const void *b)
+{
+    uint32_t ia = *(const uint32_t *)a;
+    uint32_t ib = *(const uint32_t *)b;
+
+    return (ia > ib) - (ia < ib);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t nentries = DEFAULT_ENTRIES;
+    int rounds = DEFAULT_ROUNDS;
+    const char *navdata = NAVDATA_FILE;
+    const NavAirport *airport;
+    size_t nairports;
+    char **labels;
+    uint32_t *expected, *sorted;
+    const uint32_t *found;
+    size_t nexpected, nfound;
+    SearchIndex index;
+    char query[SEARCH_MAX_QUERY];
+    uint64_t start, elapsed;
+    uint64_t scan_total, scan_max, index_total, index_max;
+    size_t nkeys;
+    int rv;
+
+    while((opt = getopt(argc, argv, "f:n:r:h")) != -1){
+        switch(opt){
+            case 'f': navdata = optarg; break;
+            case 'n': nentries = strtoul(optarg, NULL, 10); break;
+            case 'r': rounds = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!nentries || rounds <= 0){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    if(!nav_db_open(navdata) || !(nairports = nav_db_airport_count())){
+        printf("Couldn't use navigation database %s, see make navdata\n", navdata);
+        exit(EXIT_FAILURE);
+    }
+
+    labels = malloc(sizeof(char*) * nentries);
+    expected = malloc(sizeof(uint32_t) * nentries);
+    sorted = malloc(sizeof(uint32_t) * nentries);
+    if(!labels || !expected || !sorted){
+        printf("Couldn't allocate %zu entries\n", nentries);
+        exit(EXIT_FAILURE);
+    }
+    for(size_t i = 0; i < nentries; i++){
+        airport = nav_db_airport(i % nairports);
+        /*Original codes first, then made up ones*/
+        if(i < nairports)
+            rv = asprintf(&labels[i], "%s", nav_db_string(airport->label));
+        else
+            rv = asprintf(&labels[i], "%c%c%04zu - %s",
+                'A' + (int)(i / 10000) % 26, 'A' + (int)(i / 260000) % 26,
+                i % 10000, nav_db_string(airport->name)
+            );
+        if(rv < 0){
+            printf("Couldn't allocate %zu entries\n", nentries);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    start = bench_now();
+    if(!search_index_init(&index, labels, nentries)){
+        printf("Couldn't build the index\n");
+        exit(EXIT_FAILURE);
+    }
+    elapsed = bench_now() - start;
+    printf("%zu entries, index built in %.2f ms (%zu words, %u postings)\n",
+        nentries, elapsed / 1e6, index.nwords, index.gram_starts[SEARCH_GRAMS]);
+
+    rv = EXIT_SUCCESS;
+    printf("%-12s %8s %10s %10s %10s %10s\n",
+        "query", "results", "scan avg", "scan max", "index avg", "index max");
+    for(size_t q = 0; q < NQUERIES; q++){
+        scan_total = scan_max = index_total = index_max = 0;
+        nkeys = 0;
+        nfound = 0;
+        for(int r = 0; r < rounds; r++){
+            search_index_query(&index, NULL, &found); /*dialog reset*/
+            for(size_t len = 1; len <= strlen(queries[q]); len++, nkeys++){
+                strncpy(query, queries[q], len);
+                query[len] = '\0';
+
+                start = bench_now();
+                nexpected = scan(labels, nentries, query, expected);
+                elapsed = bench_now() - start;
+                scan_total += elapsed;
+                if(elapsed > scan_max) scan_max = elapsed;
+
+                start = bench_now();
+                nfound = search_index_query(&index, query, &found);
+                elapsed = bench_now() - start;
+                index_total += elapsed;
+                if(elapsed > index_max) index_max = elapsed;
+
+                /*Same airports, the order differs (prefix hits first)*/
+                memcpy(sorted, found, sizeof(uint32_t) * nfound);
+                qsort(sorted, nfound, sizeof(uint32_t), id_cmp);
+                if(nfound != nexpected || memcmp(sorted, expected, sizeof(uint32_t) * nfound)){
+                    printf("Mismatch for \"%s\": %zu found, %zu expected\n", query, nfound, nexpected);
+                    rv = EXIT_FAILURE;
+                }
+            }
+        }
+        printf("%-12s %8zu %8.1fus %8.1fus %8.1fus %8.1fus\n",
+            queries[q], nfound,
+            scan_total / 1e3 / nkeys, scan_max / 1e3,
+            index_total / 1e3 / nkeys, index_max / 1e3
+        );
+    }
+
+    search_index_dispose(&index);
+    for(size_t i = 0; i < nentries; i++)
+        free(labels[i]);
+    free(labels);
+    free(expected);
+    free(sorted);
+    nav_db_close();
+
+    return rv;
+}
@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Navigation database spatial queries: k nearest airports and airports
+ * within a map tile, over a synthetic worldwide database of N airports
+ * (clustered like real ones: dense areas and empty oceans).
+ *
+ * Checks every answer against a full scan of the airports.
+ *
+ * Built by `make bench-spatial`.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "nav-db.h"
+#include "map-math.h"
+
+#define DEFAULT_ENTRIES 80000
+#define DEFAULT_QUERIES 2000
+#define NCLUSTERS 64
+#define MAX_K 25
+#define MAX_AREA_IDS 65536
+
+static const size_t ks[] = {1, 10, MAX_K};
+#define NKS (sizeof(ks)/sizeof(ks[0]))
+static const uint8_t levels[] = {7, 9, 11};
+#define NLEVELS (sizeof(levels)/sizeof(levels[0]))
+
+static inline uint64_t bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline double bench_random(double min, double max)
+{
+    return min + (max - min) * (rand() / (double)RAND_MAX);
+}
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-n entries] [-q queries]\n", progname);
+}
+
+/* Airports around a few centers, a tenth of them scattered: the
+ * searches have to cross empty tiles, as over the oceans.*/
+static bool make_database(const char *filename, size_t nentries)
+{
+    NavAirport *airports;
+    char *strings;
+    double centers[NCLUSTERS][2];
+    size_t c;
+    bool rv;
+
+    airports = calloc(nentries, sizeof(NavAirport));
+    strings = strdup("XXXX - Synthetic");
+    if(!airports || !strings){
+        free(airports);
+        free(strings);
+        return false;
+    }
+    for(c = 0; c < NCLUSTERS; c++){
+        centers[c][0] = bench_random(-60, 70);
+        centers[c][1] = bench_random(-180, 180);
+    }
+    for(size_t i = 0; i < nentries; i++){
+        if(i % 10 == 0){
+            airports[i].latitude = bench_random(-80, 80);
+            airports[i].longitude = bench_random(-180, 180);
+        }else{
+            c = rand() % NCLUSTERS;
+            airports[i].latitude = fmax(-84, fmin(84, centers[c][0] + bench_random(-4, 4)));
+            airports[i].longitude = fmod(centers[c][1] + bench_random(-6, 6) + 540, 360) - 180;
+        }
+        airports[i].type = NAV_AIRPORT_SMALL;
+        airports[i].label = 0;
+        airports[i].label_len = strlen(strings);
+        airports[i].code = 0;
+        airports[i].name = 7;
+    }
+    rv = nav_db_write(filename, airports, nentries, strings, strlen(strings) + 1);
+    free(airports);
+    free(strings);
+    return rv;
+}
+
+/*Full scan, keeps the k nearest*/
+static size_t scan_nearest(double latitude, double longitude, size_t k, NavDbNeighbor *neighbors)
+{
+    const NavAirport *airport;
+    size_t rv, j;
+    double d;
+
+    rv = 0;
+    for(size_t i = 0; i < nav_db_airport_count(); i++){
+        airport = nav_db_airport(i);
+        d = nav_db_distance(latitude, longitude, airport->latitude, airport->longitude);
+        if(rv == k && d >= neighbors[k-1].distance)
+            continue;
+        if(rv < k)
+            rv++;
+        for(j = rv - 1; j > 0 && neighbors[j-1].distance > d; j--)
+            neighbors[j] = neighbors[j-1];
+        neighbors[j] = (NavDbNeighbor){.id = i, .distance = d};
+    }
+    return rv;
+}
+
+static size_t scan_area(uint8_t level, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    const NavAirport *airport;
+    int32_t px, py;
+    size_t rv;
+
+    rv = 0;
+    for(size_t i = 0; i < nav_db_airport_count(); i++){
+        airport = nav_db_airport(i);
+        map_math_geo_to_pixel(airport->latitude, airport->longitude, level, &px, &py);
+        if(px >= left && px <= right && py >= top && py <= bottom)
+            rv++;
+    }
+    return rv;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    size_t nentries = DEFAULT_ENTRIES;
+    size_t nqueries = DEFAULT_QUERIES;
+    char filename[] = "/tmp/spatial-bench-XXXXXX";
+    NavDbNeighbor found[MAX_K], expected[MAX_K];
+    uint32_t *ids;
+    size_t nfound, nexpected, nresults;
+    double latitude, longitude;
+    int32_t px, py;
+    uint64_t start, elapsed, total, max;
+    int fd, rv;
+
+    while((opt = getopt(argc, argv, "n:q:h")) != -1){
+        switch(opt){
+            case 'n': nentries = strtoul(optarg, NULL, 10); break;
+            case 'q': nqueries = strtoul(optarg, NULL, 10); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(!nentries || !nqueries){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    srand(42);
+    fd = mkstemp(filename);
+    if(fd < 0){
+        printf("Couldn't create a temporary file\n");
+        exit(EXIT_FAILURE);
+    }
+    close(fd);
+    ids = malloc(sizeof(uint32_t) * MAX_AREA_IDS);
+    if(!ids || !make_database(filename, nentries) || !nav_db_open(filename)){
+        printf("Couldn't make a database of %zu airports\n", nentries);
+        unlink(filename);
+        exit(EXIT_FAILURE);
+    }
+    printf("%zu airports, %zu queries\n", nentries, nqueries);
+
+    rv = EXIT_SUCCESS;
+    printf("%-14s %10s %10s %10s\n", "query", "results", "avg", "max");
+    for(size_t k = 0; k < NKS; k++){
+        total = max = 0;
+        nresults = 0;
+        srand(1);
+        for(size_t q = 0; q < nqueries; q++){
+            latitude = bench_random(-80, 80);
+            longitude = bench_random(-180, 180);
+
+            start = bench_now();
+            nfound = nav_db_find_nearest(latitude, longitude, ks[k], found);
+            elapsed = bench_now() - start;
+            total += elapsed;
+            if(elapsed > max) max = elapsed;
+            nresults += nfound;
+
+            /*Ties aside, the same distances*/
+            nexpected = scan_nearest(latitude, longitude, ks[k], expected);
+            if(nfound != nexpected){
+                printf("Nearest %zu at %f,%f: %zu found, %zu expected\n",
+                    ks[k], latitude, longitude, nfound, nexpected);
+                rv = EXIT_FAILURE;
+                continue;
+            }
+            for(size_t i = 0; i < nfound; i++){
+                if(found[i].distance != expected[i].distance){
+                    printf("Nearest %zu at %f,%f: #%zu is %.0fm away, expected %.0fm\n",
+                        ks[k], latitude, longitude, i, found[i].distance, expected[i].distance);
+                    rv = EXIT_FAILURE;
+                    break;
+                }
+            }
+        }
+        printf("nearest k=%-4zu %10.1f %8.2fus %8.2fus\n",
+            ks[k], nresults / (double)nqueries, total / 1e3 / nqueries, max / 1e3);
+    }
+
+    for(size_t l = 0; l < NLEVELS; l++){
+        total = max = 0;
+        nresults = 0;
+        srand(2);
+        for(size_t q = 0; q < nqueries; q++){
+            /*A map tile around an airport, as the map draws them*/
+            const NavAirport *airport = nav_db_airport(rand() % nentries);
+            map_math_geo_to_pixel(airport->latitude, airport->longitude, levels[l], &px, &py);
+            px = px / 256 * 256;
+            py = py / 256 * 256;
+
+            start = bench_now();
+            nfound = nav_db_find_in_area(levels[l], px, py, px + 255, py + 255, ids, MAX_AREA_IDS);
+            elapsed = bench_now() - start;
+            total += elapsed;
+            if(elapsed > max) max = elapsed;
+            nresults += nfound;
+
+            nexpected = scan_area(levels[l], px, py, px + 255, py + 255);
+            if(nfound != nexpected){
+                printf("Tile %d,%d at level %d: %zu found, %zu expected\n",
+                    px / 256, py / 256, levels[l], nfound, nexpected);
+                rv = EXIT_FAILURE;
+            }
+        }
+        printf("tile level=%-3d %10.1f %8.2fus %8.2fus\n",
+            levels[l], nresults / (double)nqueries, total / 1e3 / nqueries, max / 1e3);
+    }
+
+    nav_db_close();
+    unlink(filename);
+    free(ids);
+    return rv;
+}
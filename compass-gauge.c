@@ -15,6 +15,7 @@
 #include "misc.h"
 #include "text-gauge.h"
 #include "res-dirs.h"
+#include "rotate-blit.h"
 
 static void compass_gauge_render(CompassGauge *self, Uint32 dt, RenderContext *ctx);
 static void compass_gauge_update_state(CompassGauge *self, Uint32 dt);
@@ -52,6 +53,11 @@ CompassGauge *compass_gauge_init(CompassGauge *self)
         printf("Couldn't load compass inner ring\n");
         return NULL;
     }
+#if !USE_SDL_GPU
+    /*rotate_blit needs the same format on both sides*/
+    if(!generic_layer_convert(&self->inner, SDL_PIXELFORMAT_RGBA32))
+        return NULL;
+#endif
 
     self->caption = text_gauge_new("000\x8f", true, 28, 12);
     if(!self->caption)
@@ -108,8 +114,8 @@ CompassGauge *compass_gauge_init(CompassGauge *self)
         generic_layer_h(&self->inner),
         32, SDL_PIXELFORMAT_RGBA32
     );
-	self->renderer =  SDL_CreateSoftwareRenderer(self->state.rbuffer);
-    self->texture = SDL_CreateTextureFromSurface(self->renderer, self->inner.canvas);
+    if(!self->state.rbuffer)
+        return NULL;
 #endif
     return self;
 }
@@ -118,6 +124,11 @@ static void *compass_gauge_dispose(CompassGauge *self)
 {
     generic_layer_dispose(&self->outer);
     generic_layer_dispose(&self->inner);
+#if !USE_SDL_GPU
+    if(self->state.rbuffer)
+        SDL_FreeSurface(self->state.rbuffer);
+    self->state.rbuffer = NULL;
+#endif
 
     return self;
 }
@@ -140,16 +151,14 @@ bool compass_gauge_set_value(CompassGauge *self, float value, bool animated)
 static void compass_gauge_update_state(CompassGauge *self, Uint32 dt)
 {
 #if !USE_SDL_GPU
-    SDL_FillRect(self->state.rbuffer, NULL, 0x00000000);
-	if(SFV_GAUGE(self)->value != 0){
-        SDL_RenderCopyEx(self->renderer, self->texture,
-            NULL, NULL,
-            SFV_GAUGE(self)->value * -1.0f,
-            &self->icenter, SDL_FLIP_NONE
-        );
-	}else{
-        SDL_BlitSurface(self->inner.canvas, NULL,self->state.rbuffer, NULL);
-    }
+    /*Pivot on the center of the icenter pixel*/
+    rotate_blit(self->inner.canvas,
+        self->icenter.x + 0.5f, self->icenter.y + 0.5f,
+        self->state.rbuffer,
+        self->icenter.x + 0.5f, self->icenter.y + 0.5f,
+        SFV_GAUGE(self)->value * -1.0f,
+        NULL, ROTATE_BILINEAR, ROTATE_COPY
+    );
 #endif
     text_gauge_set_value_formatn(self->caption,
         4, /*3 digits plus degree sign*/
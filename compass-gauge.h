@@ -29,10 +29,6 @@ typedef struct{
     SDL_Point icenter;
     SDL_Rect inner_rect;
     SDL_Rect outer_rect;
-#if !USE_SDL_GPU
-    SDL_Renderer *renderer;
-    SDL_Texture *texture;
-#endif
     CompassGaugeState state;
 }CompassGauge;
 
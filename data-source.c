@@ -78,6 +78,38 @@ bool data_source_add_listener(DataSource *self, DataType type, ValueListener *li
     return true;
 }
 
+/**
+ * @brief Removes a listener added with data_source_add_listener (or
+ * data_source_add_events_listener). Objects listening to a DataSource
+ * that outlives them must remove their listeners when disposed.
+ *
+ * Not to be called from a listener.
+ *
+ * @param self a DataSource, NULL for the current instance
+ * @param type The data the listener was added for
+ * @param listener The callback and target the listener was added with
+ * @return true if the listener was found and removed, false otherwise
+ */
+bool data_source_remove_listener(DataSource *self, DataType type, ValueListener *listener)
+{
+    uintf8_t idx, limit;
+
+    self = self ? self : data_source_get_instance();
+
+    get_listener_range(type, &idx, &limit);
+    for(int i = idx; i < idx + self->nlisteners[type]; i++){
+        if(self->listeners[i].callback != listener->callback
+           || self->listeners[i].target != listener->target)
+            continue;
+        /*Keep listeners packed, in the order they were added*/
+        for(; i < idx + self->nlisteners[type] - 1; i++)
+            self->listeners[i] = self->listeners[i + 1];
+        self->nlisteners[type]--;
+        return true;
+    }
+    return false;
+}
+
 
 void data_source_print_listener_stats(DataSource *self)
 {
@@ -87,12 +119,14 @@ void data_source_print_listener_stats(DataSource *self)
         "\tattitude: %zu\n"
         "\tdynamics: %zu\n"
         "\tengine data: %zu\n"
-        "\troute: %zu\n",
+        "\troute: %zu\n"
+        "\tnav: %zu\n",
         self->nlisteners[LOCATION_DATA],
         self->nlisteners[ATTITUDE_DATA],
         self->nlisteners[DYNAMICS_DATA],
         self->nlisteners[ENGINE_DATA],
-        self->nlisteners[ROUTE_DATA]
+        self->nlisteners[ROUTE_DATA],
+        self->nlisteners[NAV_DATA]
     );
 }
 
@@ -120,6 +154,7 @@ void data_source_set_location(DataSource *self, LocationData *location)
 
     data_source_fire_listeners(self, LOCATION_DATA, location);
     self->location = *location;
+    self->generation++;
 }
 
 void data_source_set_attitude(DataSource *self, AttitudeData *attitude)
@@ -131,6 +166,7 @@ void data_source_set_attitude(DataSource *self, AttitudeData *attitude)
 
     data_source_fire_listeners(self, ATTITUDE_DATA, attitude);
     self->attitude = *attitude;
+    self->generation++;
 }
 
 void data_source_set_dynamics(DataSource *self, DynamicsData *dynamics)
@@ -141,6 +177,7 @@ void data_source_set_dynamics(DataSource *self, DynamicsData *dynamics)
         return;
     data_source_fire_listeners(self, DYNAMICS_DATA, dynamics);
     self->dynamics = *dynamics;
+    self->generation++;
 }
 
 
@@ -152,6 +189,7 @@ void data_source_set_engine_data(DataSource *self, EngineData *engine_data)
         return;
     data_source_fire_listeners(self, ENGINE_DATA, engine_data);
     self->engine_data = *engine_data;
+    self->generation++;
 }
 
 void data_source_set_route_data(DataSource *self, RouteData *route_data)
@@ -162,6 +200,18 @@ void data_source_set_route_data(DataSource *self, RouteData *route_data)
         return;
     data_source_fire_listeners(self, ROUTE_DATA, route_data);
     self->route = *route_data;
+    self->generation++;
+}
+
+void data_source_set_nav_data(DataSource *self, NavData *nav_data)
+{
+    self = self ? self : data_source_get_instance();
+
+    if(nav_data_equals(nav_data, &self->nav))
+        return;
+    data_source_fire_listeners(self, NAV_DATA, nav_data);
+    self->nav = *nav_data;
+    self->generation++;
 }
 
 
@@ -189,6 +239,12 @@ static bool get_listener_range(DataType type, uintf8_t *start, uintf8_t *limit)
                     + MAX_DYNAMICS_LISTENERS + MAX_ENGINE_DATA_LISTENERS;
             *limit = *start + MAX_ROUTE_DATA_LISTENERS;
             return true;
+        case NAV_DATA:
+            *start =  MAX_LOCATION_LISTENERS+MAX_ATTITUDE_LISTENERS
+                    + MAX_DYNAMICS_LISTENERS + MAX_ENGINE_DATA_LISTENERS
+                    + MAX_ROUTE_DATA_LISTENERS;
+            *limit = *start + MAX_NAV_DATA_LISTENERS;
+            return true;
         break;
         default:
             printf("CRIT: %s: bad type, problems ahead!\n",__FUNCTION__);
@@ -13,17 +13,19 @@
 
 #include "geo-location.h"
 
-#define MAX_LOCATION_LISTENERS 3
+#define MAX_LOCATION_LISTENERS 5
 #define MAX_ATTITUDE_LISTENERS 3
 #define MAX_DYNAMICS_LISTENERS 1
 #define MAX_ENGINE_DATA_LISTENERS 1
 #define MAX_ROUTE_DATA_LISTENERS 2
+#define MAX_NAV_DATA_LISTENERS 2
 #define TOTAL_MAX_LISTENERS \
           MAX_LOCATION_LISTENERS \
         + MAX_ATTITUDE_LISTENERS \
         + MAX_DYNAMICS_LISTENERS \
         + MAX_ENGINE_DATA_LISTENERS \
-        + MAX_ROUTE_DATA_LISTENERS
+        + MAX_ROUTE_DATA_LISTENERS \
+        + MAX_NAV_DATA_LISTENERS
 
 typedef struct _DataSource DataSource;
 typedef bool (*DataSourceFrameFunc)(DataSource *self, uint32_t dt);
@@ -49,6 +51,7 @@ typedef enum{
     DYNAMICS_DATA,
     ENGINE_DATA,
     ROUTE_DATA,
+    NAV_DATA,
     N_VALUE_TYPES
 }DataType;
 
@@ -84,6 +87,20 @@ typedef struct{
     GeoLocation from;
 }RouteData;
 
+/*Active leg, kept up to date by the nav engine (see nav-engine.h)*/
+typedef struct{
+    bool active;
+    float dtk; /*desired track, degrees true*/
+    float bearing; /*to the destination, degrees true*/
+    float distance; /*to the destination, NM*/
+    float xtk; /*cross-track error, NM, positive right of the leg*/
+    float ground_speed; /*kts, from the location samples*/
+    float ete; /*seconds, negative when unknown*/
+    /* Where the values were computed. Listeners are called before
+     * DataSource.location would be, see data_source_set_nav_data*/
+    GeoLocation position;
+}NavData;
+
 typedef struct _DataSource{
     DataSourceOps *ops;
 
@@ -92,6 +109,7 @@ typedef struct _DataSource{
     DynamicsData dynamics;
     EngineData engine_data;
     RouteData route;
+    NavData nav;
 
     /* We want to avoid dynamic allocation for these.
      * Thus the adding functio will emit a warning at runtime if the values are
@@ -104,6 +122,19 @@ typedef struct _DataSource{
     size_t nlisteners[N_VALUE_TYPES];
 
     bool has_fix;
+    /* Incremented each time a value actually changes, allows
+     * the main loop to know when new data came in*/
+    uint32_t generation;
+    /* Time base of the values (ms): the dt data_source_frame is driven
+     * with, summed. @clock only moves when the source used its dt (returned
+     * true), @now is the time of values set during the current frame.
+     * Unlike wall-clock time it follows replays and virtual clocks.*/
+    uint32_t clock;
+    uint32_t now;
+    /* Set by the main loop, called by sources that receive data on
+     * threads of their own: the loop may be idle, waiting for events.
+     * Can be NULL*/
+    void (*wake)(void);
 }DataSource;
 
 #define DATA_SOURCE(self) ((DataSource*)self)
@@ -112,6 +143,7 @@ DataSource *data_source_get_instance(void);
 void data_source_set(DataSource *source);
 
 bool data_source_add_listener(DataSource *self, DataType type, ValueListener *listener);
+bool data_source_remove_listener(DataSource *self, DataType type, ValueListener *listener);
 size_t data_source_add_events_listener(DataSource *self, void *target,
                                            size_t nevents, ...);
 void data_source_print_listener_stats(DataSource *self);
@@ -121,6 +153,7 @@ void data_source_set_attitude(DataSource *self, AttitudeData *attitude);
 void data_source_set_dynamics(DataSource *self, DynamicsData *dynamics);
 void data_source_set_engine_data(DataSource *self, EngineData *engine_data);
 void data_source_set_route_data(DataSource *self, RouteData *route_data);
+void data_source_set_nav_data(DataSource *self, NavData *nav_data);
 
 static inline DataSource *data_source_init(DataSource *self, DataSourceOps *ops)
 {
@@ -138,7 +171,19 @@ static inline DataSource *data_source_dispose(DataSource *self)
 
 static inline bool data_source_frame(DataSource *self, uint32_t dt)
 {
-    return self->ops->frame(self, dt);
+    bool rv;
+
+    self->now = self->clock + dt;
+    rv = self->ops->frame(self, dt);
+    if(rv)
+        self->clock = self->now;
+    return rv;
+}
+
+static inline void data_source_wake(DataSource *self)
+{
+    if(self->wake)
+        self->wake();
 }
 
 static inline DataSource *data_source_free(DataSource *self)
@@ -186,4 +231,17 @@ static inline bool route_data_equals(RouteData *a, RouteData *b)
            && (a->from.latitude == b->from.latitude)
            && (a->from.longitude == b->from.longitude);
 }
+
+static inline bool nav_data_equals(NavData *a, NavData *b)
+{
+    return    (a->active == b->active)
+           && (a->dtk == b->dtk)
+           && (a->bearing == b->bearing)
+           && (a->distance == b->distance)
+           && (a->xtk == b->xtk)
+           && (a->ground_speed == b->ground_speed)
+           && (a->ete == b->ete)
+           && (a->position.latitude == b->position.latitude)
+           && (a->position.longitude == b->position.longitude);
+}
 #endif /* DATA_SOURCE_H */
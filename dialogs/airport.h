@@ -1,10600 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
- *
- * This file is part of SoFIS - an open source EFIS
- *
- * SPDX-License-Identifier: GPL-2.0-only
- */
-#ifndef AIRPORT_H
-#define AIRPORT_H
-#include <stdlib.h>
-
-typedef struct{
-    char *code;
-    char *name;
-    double latitude;
-    double longitude;
-    int elevation;
-}Airport;
-
-static Airport french_airports[] = {
-    {
-        .code = "LF0121",
-        .name = "La Trancliere",
-        .latitude = 46.0958333333333,
-        .longitude = 5.28611111111111,
-        .elevation = 820,
-    },
-    {
-        .code = "LF0125",
-        .name = "Lavours",
-        .latitude = 45.7958333333333,
-        .longitude = 5.77388888888889,
-        .elevation = 768,
-    },
-    {
-        .code = "LF0151",
-        .name = "Corbonod Seyssel",
-        .latitude = 45.9613888888889,
-        .longitude = 5.81805555555556,
-        .elevation = 1175,
-    },
-    {
-        .code = "LF0152",
-        .name = "Crottet Le Bief",
-        .latitude = 46.285,
-        .longitude = 4.88611111111111,
-        .elevation = 597,
-    },
-    {
-        .code = "LF0153",
-        .name = "Izenave",
-        .latitude = 46.0275,
-        .longitude = 5.52388888888889,
-        .elevation = 2280,
-    },
-    {
-        .code = "LF0154",
-        .name = "Polliat",
-        .latitude = 46.2561111111111,
-        .longitude = 5.14944444444444,
-        .elevation = 718,
-    },
-    {
-        .code = "LF0157",
-        .name = "Mionnay",
-        .latitude = 45.9005555555556,
-        .longitude = 4.89611111111111,
-        .elevation = 900,
-    },
-    {
-        .code = "LF0158",
-        .name = "Rhone Lavours",
-        .latitude = 45.8108333333333,
-        .longitude = 5.78138888888889,
-        .elevation = 767,
-    },
-    {
-        .code = "LF0159",
-        .name = "Montrevel en Bresse",
-        .latitude = 46.345,
-        .longitude = 5.14222222222222,
-        .elevation = 620,
-    },
-    {
-        .code = "LF0160",
-        .name = "Tallissieu",
-        .latitude = 45.8716666666667,
-        .longitude = 5.72694444444444,
-        .elevation = 1433,
-    },
-    {
-        .code = "LF0161",
-        .name = "Chaneins",
-        .latitude = 46.1063888888889,
-        .longitude = 4.85111111111111,
-        .elevation = 800,
-    },
-    {
-        .code = "LF0221",
-        .name = "Azur Ulm",
-        .latitude = 49.4611111111111,
-        .longitude = 3.84833333333333,
-        .elevation = 240,
-    },
-    {
-        .code = "LF0223",
-        .name = "Mosloy",
-        .latitude = 49.1747222222222,
-        .longitude = 3.15472222222222,
-        .elevation = 453,
-    },
-    {
-        .code = "LF0225",
-        .name = "Ployart",
-        .latitude = 49.5038888888889,
-        .longitude = 3.73805555555556,
-        .elevation = 580,
-    },
-    {
-        .code = "LF0226",
-        .name = "Brochot",
-        .latitude = 48.9766666666667,
-        .longitude = 3.37333333333333,
-        .elevation = 574,
-    },
-    {
-        .code = "LF0253",
-        .name = "Neuflieux",
-        .latitude = 49.6111111111111,
-        .longitude = 3.14861111111111,
-        .elevation = 195,
-    },
-    {
-        .code = "LF0256",
-        .name = "Corbeny ",
-        .latitude = 49.4575,
-        .longitude = 3.85444444444444,
-        .elevation = 230,
-    },
-    {
-        .code = "LF0257",
-        .name = "Taillefontaine",
-        .latitude = 49.3069444444444,
-        .longitude = 3.06527777777778,
-        .elevation = 475,
-    },
-    {
-        .code = "LF0258",
-        .name = "La Flamengrie",
-        .latitude = 50.0002777777778,
-        .longitude = 3.94472222222222,
-        .elevation = 642,
-    },
-    {
-        .code = "LF0259",
-        .name = "Base Ulm du Val de l'Ailette",
-        .latitude = 49.5675,
-        .longitude = 3.23027777777778,
-        .elevation = 184,
-    },
-    {
-        .code = "LF0324",
-        .name = "Veauce",
-        .latitude = 46.1733333333333,
-        .longitude = 3.05888888888889,
-        .elevation = 1570,
-    },
-    {
-        .code = "LF0353",
-        .name = "Saint Fargeol Les Fougeres",
-        .latitude = 46.1416666666667,
-        .longitude = 2.61138888888889,
-        .elevation = 1706,
-    },
-    {
-        .code = "LF0354",
-        .name = "Verneuil en Bourbonnais",
-        .latitude = 46.36,
-        .longitude = 3.26833333333333,
-        .elevation = 885,
-    },
-    {
-        .code = "LF0355",
-        .name = "Banelle",
-        .latitude = 46.1252777777778,
-        .longitude = 3.28694444444444,
-        .elevation = 355,
-    },
-    {
-        .code = "LF0369",
-        .name = "La Tuiliere",
-        .latitude = 46.5327777777778,
-        .longitude = 3.11833333333333,
-        .elevation = 860,
-    },
-    {
-        .code = "LF0421",
-        .name = "Clamensane les 3 Fontaines",
-        .latitude = 44.314318784384,
-        .longitude = 6.07152620103625,
-        .elevation = 2933,
-    },
-    {
-        .code = "LF0426",
-        .name = "Thorame Haute Les Serres",
-        .latitude = 44.1230555555556,
-        .longitude = 6.56,
-        .elevation = 6129,
-    },
-    {
-        .code = "LF0429",
-        .name = "Sainte Croix sur Verdon",
-        .latitude = 43.7786111111111,
-        .longitude = 6.15972222222222,
-        .elevation = 2190,
-    },
-    {
-        .code = "LF0430",
-        .name = "Seyne les Alpes",
-        .latitude = 44.3419444444444,
-        .longitude = 6.37277777777778,
-        .elevation = 3937,
-    },
-    {
-        .code = "LF0431",
-        .name = "La Motte du Caire",
-        .latitude = 44.3227777777778,
-        .longitude = 6.03138888888889,
-        .elevation = 2132,
-    },
-    {
-        .code = "LF0434",
-        .name = "Thorame Haute Les Serres 2",
-        .latitude = 44.115,
-        .longitude = 6.53861111111111,
-        .elevation = 6398,
-    },
-    {
-        .code = "LF0451",
-        .name = "Hippodrome Oraison",
-        .latitude = 43.9213888888889,
-        .longitude = 5.90416666666667,
-        .elevation = 1100,
-    },
-    {
-        .code = "LF0452",
-        .name = "Segries",
-        .latitude = 43.8677777777778,
-        .longitude = 6.17833333333333,
-        .elevation = 2657,
-    },
-    {
-        .code = "LF0453",
-        .name = "Cruis Mas Des Grailles",
-        .latitude = 44.0602777777778,
-        .longitude = 5.85305555555555,
-        .elevation = 2270,
-    },
-    {
-        .code = "LF0456",
-        .name = "Banon",
-        .latitude = 44.0722222222222,
-        .longitude = 5.63916666666667,
-        .elevation = 3723,
-    },
-    {
-        .code = "LF0458",
-        .name = "Thorame-Haute Chamatte",
-        .latitude = 44.1397222222222,
-        .longitude = 6.54833333333333,
-        .elevation = 6827,
-    },
-    {
-        .code = "LF0459",
-        .name = "Thorame Basse",
-        .latitude = 44.0769444444445,
-        .longitude = 6.47361111111111,
-        .elevation = 3609,
-    },
-    {
-        .code = "LF0523",
-        .name = "Glacier Lombard",
-        .latitude = 45.1083333333333,
-        .longitude = 6.32222222222222,
-        .elevation = 10695,
-    },
-    {
-        .code = "LF0524",
-        .name = "Grand Terrus",
-        .latitude = 44.4227777777778,
-        .longitude = 5.64416666666667,
-        .elevation = 2871,
-    },
-    {
-        .code = "LF0538",
-        .name = "Saint Etienne en Devoluy",
-        .latitude = 44.6680555555556,
-        .longitude = 5.90472222222222,
-        .elevation = 6201,
-    },
-    {
-        .code = "LF0551",
-        .name = "Crots",
-        .latitude = 44.5366666666667,
-        .longitude = 6.435,
-        .elevation = 2600,
-    },
-    {
-        .code = "LF0553",
-        .name = "Colombe d'Eyguians",
-        .latitude = 44.365,
-        .longitude = 5.78666666666667,
-        .elevation = 2410,
-    },
-    {
-        .code = "LF0621",
-        .name = "Isola 2000",
-        .latitude = 44.1716666666667,
-        .longitude = 7.16305555555556,
-        .elevation = 7620,
-    },
-    {
-        .code = "LF0651",
-        .name = "Juan Les Pins",
-        .latitude = 43.5655555555556,
-        .longitude = 7.1025,
-        .elevation = 0,
-    },
-    {
-        .code = "LF0652",
-        .name = "Cipieres Alpes d'Azur ULM",
-        .latitude = 43.7791666666667,
-        .longitude = 6.86305555555556,
-        .elevation = 3740,
-    },
-    {
-        .code = "LF0654",
-        .name = "Valberg",
-        .latitude = 44.1069444444444,
-        .longitude = 6.93944444444444,
-        .elevation = 5680,
-    },
-    {
-        .code = "LF0723",
-        .name = "Notre-Dame-des-Neiges-Abbaye",
-        .latitude = 44.6005555555556,
-        .longitude = 3.92666666666667,
-        .elevation = 3760,
-    },
-    {
-        .code = "LF0725",
-        .name = "Le Bez",
-        .latitude = 44.6336111111111,
-        .longitude = 4.04611111111111,
-        .elevation = 4320,
-    },
-    {
-        .code = "LF0753",
-        .name = "Deyras Saint Victor",
-        .latitude = 45.0933333333333,
-        .longitude = 4.70694444444444,
-        .elevation = 1425,
-    },
-    {
-        .code = "LF0851",
-        .name = "Avaux - Les Bourdons ",
-        .latitude = 49.4805555555556,
-        .longitude = 4.075,
-        .elevation = 374,
-    },
-    {
-        .code = "LF0921",
-        .name = "Aleu",
-        .latitude = 42.9002777777778,
-        .longitude = 1.27527777777778,
-        .elevation = 3445,
-    },
-    {
-        .code = "LF0922",
-        .name = "Artigat - Martin Gu'air",
-        .latitude = 43.1466666666667,
-        .longitude = 1.44,
-        .elevation = 730,
-    },
-    {
-        .code = "LF0924",
-        .name = "La Plagne Bouirex",
-        .latitude = 42.8666666666667,
-        .longitude = 1.13833333333333,
-        .elevation = 5249,
-    },
-    {
-        .code = "LF0925",
-        .name = "Villeneuve du Latou",
-        .latitude = 43.2044444444444,
-        .longitude = 1.41916666666667,
-        .elevation = 1330,
-    },
-    {
-        .code = "LF0926",
-        .name = "Cerizols",
-        .latitude = 43.1288888888889,
-        .longitude = 1.06944444444444,
-        .elevation = 0,
-    },
-    {
-        .code = "LF0927",
-        .name = "Troye d'Ariege",
-        .latitude = 43.02,
-        .longitude = 1.8775,
-        .elevation = 1377,
-    },
-    {
-        .code = "LF0928",
-        .name = "Ferme de Bon repos - Regat",
-        .latitude = 42.9838888888889,
-        .longitude = 1.89361111111111,
-        .elevation = 1341,
-    },
-    {
-        .code = "LF0951",
-        .name = "Sarrat",
-        .latitude = 43.2086111111111,
-        .longitude = 1.70861111111111,
-        .elevation = 846,
-    },
-    {
-        .code = "LF0952",
-        .name = "Fabas",
-        .latitude = 43.1102777777778,
-        .longitude = 1.11583333333333,
-        .elevation = 1299,
-    },
-    {
-        .code = "LF0953",
-        .name = "Ustou",
-        .latitude = 42.7813888888889,
-        .longitude = 1.22583333333333,
-        .elevation = 5896,
-    },
-    {
-        .code = "LF0954",
-        .name = "Erce",
-        .latitude = 42.8511111111111,
-        .longitude = 1.29722222222222,
-        .elevation = 2950,
-    },
-    {
-        .code = "LF1021",
-        .name = "Montardoise",
-        .latitude = 48.4680555555556,
-        .longitude = 4.19777777777778,
-        .elevation = 580,
-    },
-    {
-        .code = "LF1022",
-        .name = "Ville sur Arce",
-        .latitude = 48.0883333333333,
-        .longitude = 4.43583333333333,
-        .elevation = 910,
-    },
-    {
-        .code = "LF1054",
-        .name = "Viapres le petit",
-        .latitude = 48.5727777777778,
-        .longitude = 4.03555555555556,
-        .elevation = 250,
-    },
-    {
-        .code = "LF1055",
-        .name = "Romilly",
-        .latitude = 48.5,
-        .longitude = 3.75416666666667,
-        .elevation = 256,
-    },
-    {
-        .code = "LF1056",
-        .name = "Amance",
-        .latitude = 48.3508333333333,
-        .longitude = 4.505,
-        .elevation = 430,
-    },
-    {
-        .code = "LF1123",
-        .name = "Baraigne",
-        .latitude = 43.3233333333333,
-        .longitude = 1.83361111111111,
-        .elevation = 920,
-    },
-    {
-        .code = "LF1125",
-        .name = "Nebias",
-        .latitude = 42.8916666666667,
-        .longitude = 2.12361111111111,
-        .elevation = 1830,
-    },
-    {
-        .code = "LF1151",
-        .name = "Fleury d'Aude",
-        .latitude = 43.2136111111111,
-        .longitude = 3.13,
-        .elevation = 100,
-    },
-    {
-        .code = "LF1153",
-        .name = "Limoux",
-        .latitude = 43.0572222222222,
-        .longitude = 2.22638888888889,
-        .elevation = 660,
-    },
-    {
-        .code = "LF1156",
-        .name = "Ulm Saint Couat",
-        .latitude = 43.2111111111111,
-        .longitude = 2.64638888888889,
-        .elevation = 307,
-    },
-    {
-        .code = "LF1158",
-        .name = "Beaugaillard",
-        .latitude = 43.1786111111111,
-        .longitude = 1.95166666666667,
-        .elevation = 930,
-    },
-    {
-        .code = "LF1159",
-        .name = "Argeliers",
-        .latitude = 43.3083333333333,
-        .longitude = 2.89333333333333,
-        .elevation = 140,
-    },
-    {
-        .code = "LF1222",
-        .name = "La Brousse Golinhac ",
-        .latitude = 44.5811111111111,
-        .longitude = 2.59138888888889,
-        .elevation = 2185,
-    },
-    {
-        .code = "LF1225",
-        .name = "Graissac le Faula",
-        .latitude = 44.7708333333333,
-        .longitude = 2.78861111111111,
-        .elevation = 2800,
-    },
-    {
-        .code = "LF1226",
-        .name = "Therondels Douzalbats",
-        .latitude = 44.8930555555556,
-        .longitude = 2.71805555555556,
-        .elevation = 3068,
-    },
-    {
-        .code = "LF1231",
-        .name = "Villefranche de Panat",
-        .latitude = 44.0991666666667,
-        .longitude = 2.69527777777778,
-        .elevation = 2385,
-    },
-    {
-        .code = "LF1232",
-        .name = "Ste Croix",
-        .latitude = 44.4138888888889,
-        .longitude = 1.94333333333333,
-        .elevation = 1128,
-    },
-    {
-        .code = "LF1233",
-        .name = "Sarrans Cantoin",
-        .latitude = 44.8261111111111,
-        .longitude = 2.84333333333333,
-        .elevation = 3140,
-    },
-    {
-        .code = "LF1251",
-        .name = "Bozouls",
-        .latitude = 44.4780555555556,
-        .longitude = 2.74722222222222,
-        .elevation = 1991,
-    },
-    {
-        .code = "LF1254",
-        .name = "Saint Felix de Lunel",
-        .latitude = 44.5625,
-        .longitude = 2.54194444444444,
-        .elevation = 1900,
-    },
-    {
-        .code = "LF1255",
-        .name = "Barrage de Pareloup",
-        .latitude = 44.2077777777778,
-        .longitude = 2.72277777777778,
-        .elevation = 2635,
-    },
-    {
-        .code = "LF1301",
-        .name = "Martigues-Henri Fabre",
-        .latitude = 43.4208333333333,
-        .longitude = 5.07777777777778,
-        .elevation = 0,
-    },
-    {
-        .code = "LF1352",
-        .name = "Jouques Bedes",
-        .latitude = 43.6613888888889,
-        .longitude = 5.68694444444444,
-        .elevation = 1378,
-    },
-    {
-        .code = "LF1353",
-        .name = "La Ciotat",
-        .latitude = 43.1736111111111,
-        .longitude = 5.64138888888889,
-        .elevation = 0,
-    },
-    {
-        .code = "LF1354",
-        .name = "Meyrargues",
-        .latitude = 43.6525890394483,
-        .longitude = 5.52511157141794,
-        .elevation = 650,
-    },
-    {
-        .code = "LF1355",
-        .name = "Marseille Hydro",
-        .latitude = 43.2991666666667,
-        .longitude = 5.3475,
-        .elevation = 0,
-    },
-    {
-        .code = "LF1422",
-        .name = "Bonneville la Louvet",
-        .latitude = 49.2633333333333,
-        .longitude = 0.371666666666667,
-        .elevation = 361,
-    },
-    {
-        .code = "LF1451",
-        .name = "Courseulles sur Mer",
-        .latitude = 49.3141666666667,
-        .longitude = -0.453333333333333,
-        .elevation = 150,
-    },
-    {
-        .code = "LF1452",
-        .name = "La Boissiere",
-        .latitude = 49.125,
-        .longitude = 0.1425,
-        .elevation = 540,
-    },
-    {
-        .code = "LF1454",
-        .name = "Rouvres",
-        .latitude = 49.02,
-        .longitude = -0.198333333333333,
-        .elevation = 345,
-    },
-    {
-        .code = "LF1456",
-        .name = "Omaha Beach",
-        .latitude = 49.3530555555556,
-        .longitude = -0.842777777777778,
-        .elevation = 203,
-    },
-    {
-        .code = "LF1457",
-        .name = "ZTN AIR",
-        .latitude = 49.0313888888889,
-        .longitude = 0.0361111111111111,
-        .elevation = 102,
-    },
-    {
-        .code = "LF1522",
-        .name = "Trizac",
-        .latitude = 45.268333,
-        .longitude = 2.54805599999997,
-        .elevation = 3300,
-    },
-    {
-        .code = "LF1525",
-        .name = "Polminhac",
-        .latitude = 44.9427777777778,
-        .longitude = 2.5775,
-        .elevation = 2090,
-    },
-    {
-        .code = "LF1552",
-        .name = "Le Peuch",
-        .latitude = 44.9002777777778,
-        .longitude = 3.10666666666667,
-        .elevation = 3000,
-    },
-    {
-        .code = "LF1553",
-        .name = "Le Bruel",
-        .latitude = 44.7430555555556,
-        .longitude = 2.20027777777778,
-        .elevation = 1427,
-    },
-    {
-        .code = "LF1625",
-        .name = "Pillac",
-        .latitude = 45.3316666666667,
-        .longitude = 0.184722222222222,
-        .elevation = 335,
-    },
-    {
-        .code = "LF1627",
-        .name = "Saint Maurice",
-        .latitude = 45.9666666666667,
-        .longitude = 0.739722222222222,
-        .elevation = 755,
-    },
-    {
-        .code = "LF1628",
-        .name = "Saint Meme Les Carrieres",
-        .latitude = 45.6327777777778,
-        .longitude = -0.159722222222222,
-        .elevation = 82,
-    },
-    {
-        .code = "LF1629",
-        .name = "Saint Coutant",
-        .latitude = 46.0188888888889,
-        .longitude = 0.433055555555556,
-        .elevation = 600,
-    },
-    {
-        .code = "LF1631",
-        .name = "Le Luquet",
-        .latitude = 45.6433333333333,
-        .longitude = 0.331111111111111,
-        .elevation = 400,
-    },
-    {
-        .code = "LF1651",
-        .name = "Aignes et Puyperoux",
-        .latitude = 45.4616666666667,
-        .longitude = 0.157777777777778,
-        .elevation = 619,
-    },
-    {
-        .code = "LF1652",
-        .name = "Brettes",
-        .latitude = 46.0111111111111,
-        .longitude = 0.0525,
-        .elevation = 400,
-    },
-    {
-        .code = "LF1653",
-        .name = "Saint Ciers",
-        .latitude = 45.8505555555556,
-        .longitude = 0.265277777777778,
-        .elevation = 314,
-    },
-    {
-        .code = "LF1654",
-        .name = "Belzagot",
-        .latitude = 45.3566666666667,
-        .longitude = 0.109722222222222,
-        .elevation = 210,
-    },
-    {
-        .code = "LF1655",
-        .name = "CHENOMMET",
-        .latitude = 45.9261111111111,
-        .longitude = 0.261388888888889,
-        .elevation = 330,
-    },
-    {
-        .code = "LF1726",
-        .name = "Jarnac Champagne",
-        .latitude = 45.5597222222222,
-        .longitude = -0.417777777777778,
-        .elevation = 200,
-    },
-    {
-        .code = "LF1727",
-        .name = "Nantille",
-        .latitude = 45.8455555555556,
-        .longitude = -0.478333333333333,
-        .elevation = 134,
-    },
-    {
-        .code = "LF1751",
-        .name = "Corme Ecluse",
-        .latitude = 45.6208333333333,
-        .longitude = -0.851388888888889,
-        .elevation = 98,
-    },
-    {
-        .code = "LF1752",
-        .name = "Aigrefeuille d'Aunis",
-        .latitude = 46.1272222222222,
-        .longitude = -0.951666666666667,
-        .elevation = 110,
-    },
-    {
-        .code = "LF1753",
-        .name = "Le Thou",
-        .latitude = 46.0861111111111,
-        .longitude = -0.943611111111111,
-        .elevation = 89,
-    },
-    {
-        .code = "LF1755",
-        .name = "Courcon Eol'Aunis",
-        .latitude = 46.2483333333333,
-        .longitude = -0.830277777777778,
-        .elevation = 39,
-    },
-    {
-        .code = "LF1756",
-        .name = "Bourcefranc",
-        .latitude = 45.8719444444444,
-        .longitude = -1.13111111111111,
-        .elevation = 0,
-    },
-    {
-        .code = "LF1757",
-        .name = "Arvert",
-        .latitude = 45.7502777777778,
-        .longitude = -1.10194444444444,
-        .elevation = 13,
-    },
-    {
-        .code = "LF1821",
-        .name = "Coust Colombiers",
-        .latitude = 46.6791666666667,
-        .longitude = 2.57444444444444,
-        .elevation = 720,
-    },
-    {
-        .code = "LF1822",
-        .name = "Guilly",
-        .latitude = 47.1483333333333,
-        .longitude = 2.59888888888889,
-        .elevation = 574,
-    },
-    {
-        .code = "LF1826",
-        .name = "Sury en Vaux",
-        .latitude = 47.3808333333333,
-        .longitude = 2.7825,
-        .elevation = 1000,
-    },
-    {
-        .code = "LF1852",
-        .name = "Dun sur Auron",
-        .latitude = 46.8761111111111,
-        .longitude = 2.50361111111111,
-        .elevation = 515,
-    },
-    {
-        .code = "LF1853",
-        .name = "Sainte Thorette",
-        .latitude = 47.0758333333333,
-        .longitude = 2.21388888888889,
-        .elevation = 400,
-    },
-    {
-        .code = "LF1854",
-        .name = "Saint Christophe",
-        .latitude = 46.5811111111111,
-        .longitude = 2.40444444444444,
-        .elevation = 880,
-    },
-    {
-        .code = "LF1856",
-        .name = "Jouet sur l'Aubois",
-        .latitude = 47.0422222222222,
-        .longitude = 2.995,
-        .elevation = 640,
-    },
-    {
-        .code = "LF1921",
-        .name = "Eyburie",
-        .latitude = 45.4852777777778,
-        .longitude = 1.645,
-        .elevation = 1316,
-    },
-    {
-        .code = "LF1923",
-        .name = "Peyrelevade",
-        .latitude = 45.7077777777778,
-        .longitude = 2.0325,
-        .elevation = 2493,
-    },
-    {
-        .code = "LF1926",
-        .name = "Lagarde Enval",
-        .latitude = 45.1772222222222,
-        .longitude = 1.80277777777778,
-        .elevation = 1600,
-    },
-    {
-        .code = "LF1927",
-        .name = "Troches-Pompadour",
-        .latitude = 45.4080555555556,
-        .longitude = 1.42027777777778,
-        .elevation = 1368,
-    },
-    {
-        .code = "LF1929",
-        .name = "Saint Cernin de Larche",
-        .latitude = 45.1077777777778,
-        .longitude = 1.41055555555556,
-        .elevation = 331,
-    },
-    {
-        .code = "LF1930",
-        .name = "Varieras",
-        .latitude = 45.6105555555556,
-        .longitude = 1.99277777777778,
-        .elevation = 2755,
-    },
-    {
-        .code = "LF1951",
-        .name = "Les Chanseves",
-        .latitude = 45.09,
-        .longitude = 1.85527777777778,
-        .elevation = 1550,
-    },
-    {
-        .code = "LF1952",
-        .name = "Lagleygeolle",
-        .latitude = 45.0802777777778,
-        .longitude = 1.67333333333333,
-        .elevation = 1380,
-    },
-    {
-        .code = "LF1953",
-        .name = "Perols sur Vezere",
-        .latitude = 45.5872222222222,
-        .longitude = 2.01333333333333,
-        .elevation = 2800,
-    },
-    {
-        .code = "LF1954",
-        .name = "Savignoux",
-        .latitude = 45.0125,
-        .longitude = 1.78194444444444,
-        .elevation = 886,
-    },
-    {
-        .code = "LF2022",
-        .name = "Cargese",
-        .latitude = 42.1755555555556,
-        .longitude = 8.60888888888889,
-        .elevation = 17,
-    },
-    {
-        .code = "LF2121",
-        .name = "Auxey Duresses",
-        .latitude = 46.9988888888889,
-        .longitude = 4.735,
-        .elevation = 1378,
-    },
-    {
-        .code = "LF2122",
-        .name = "Chaume et Courchamp",
-        .latitude = 47.575,
-        .longitude = 5.35111111111111,
-        .elevation = 930,
-    },
-    {
-        .code = "LF2123",
-        .name = "Dampierre et Flee",
-        .latitude = 47.4775,
-        .longitude = 5.35833333333333,
-        .elevation = 751,
-    },
-    {
-        .code = "LF2127",
-        .name = "Chazan",
-        .latitude = 47.2158333333333,
-        .longitude = 4.90416666666667,
-        .elevation = 1516,
-    },
-    {
-        .code = "LF2132",
-        .name = "Souhil",
-        .latitude = 47.9225,
-        .longitude = 4.76861111111111,
-        .elevation = 792,
-    },
-    {
-        .code = "LF2134",
-        .name = "Recey Le Mont de Lucey",
-        .latitude = 47.7941666666667,
-        .longitude = 4.855,
-        .elevation = 1300,
-    },
-    {
-        .code = "LF2151",
-        .name = "Saint Jean de Losne",
-        .latitude = 47.0736111111111,
-        .longitude = 5.26611111111111,
-        .elevation = 600,
-    },
-    {
-        .code = "LF2161",
-        .name = "Chateau La Chassagne",
-        .latitude = 47.309444444444,
-        .longitude = 4.81944444444457,
-        .elevation = 1118,
-    },
-    {
-        .code = "LF2162",
-        .name = "Saint-Romain",
-        .latitude = 47.0169444444444,
-        .longitude = 4.69972222222222,
-        .elevation = 1850,
-    },
-    {
-        .code = "LF2163",
-        .name = "Nantoux",
-        .latitude = 47.0241666666667,
-        .longitude = 4.75722222222222,
-        .elevation = 1138,
-    },
-    {
-        .code = "LF2164",
-        .name = "Blanot",
-        .latitude = 47.1738888888889,
-        .longitude = 4.23361111111111,
-        .elevation = 1575,
-    },
-    {
-        .code = "LF2221",
-        .name = "Kerfot la Paimpolaise",
-        .latitude = 48.7238888888889,
-        .longitude = -3.02694444444444,
-        .elevation = 308,
-    },
-    {
-        .code = "LF2321",
-        .name = "Evaux",
-        .latitude = 46.17,
-        .longitude = 2.43083333333333,
-        .elevation = 1512,
-    },
-    {
-        .code = "LF2351",
-        .name = "Le Pommier",
-        .latitude = 46.1966666666667,
-        .longitude = 1.45277777777778,
-        .elevation = 1140,
-    },
-    {
-        .code = "LF2353",
-        .name = "Le Pouyollet Lizieres",
-        .latitude = 46.2125,
-        .longitude = 1.57222222222222,
-        .elevation = 1380,
-    },
-    {
-        .code = "LF2421",
-        .name = "Augignac",
-        .latitude = 45.5630555555556,
-        .longitude = 0.704444444444444,
-        .elevation = 865,
-    },
-    {
-        .code = "LF2422",
-        .name = "Beaumont",
-        .latitude = 44.7661111111111,
-        .longitude = 0.724722222222222,
-        .elevation = 508,
-    },
-    {
-        .code = "LF2423",
-        .name = "Condat sur Vezere",
-        .latitude = 45.1038888888889,
-        .longitude = 1.215,
-        .elevation = 499,
-    },
-    {
-        .code = "LF2424",
-        .name = "Coursac",
-        .latitude = 45.110696804337,
-        .longitude = 0.64083567725288,
-        .elevation = 730,
-    },
-    {
-        .code = "LF2426",
-        .name = "Eyrignac",
-        .latitude = 44.9430555555556,
-        .longitude = 1.31194444444444,
-        .elevation = 820,
-    },
-    {
-        .code = "LF2428",
-        .name = "Javerlhac",
-        .latitude = 45.5538888888889,
-        .longitude = 0.558611111111111,
-        .elevation = 633,
-    },
-    {
-        .code = "LF2430",
-        .name = "Lalinde",
-        .latitude = 44.8808333333333,
-        .longitude = 0.744444444444444,
-        .elevation = 614,
-    },
-    {
-        .code = "LF2431",
-        .name = "Liorac sur Louyre",
-        .latitude = 44.9188888888889,
-        .longitude = 0.645555555555556,
-        .elevation = 518,
-    },
-    {
-        .code = "LF2432",
-        .name = "Pressignac Vicq Rebeyrotte",
-        .latitude = 44.9027777777778,
-        .longitude = 0.748055555555555,
-        .elevation = 643,
-    },
-    {
-        .code = "LF2433",
-        .name = "La Rochebeaucourt Argentine",
-        .latitude = 45.4666666666667,
-        .longitude = 0.3875,
-        .elevation = 468,
-    },
-    {
-        .code = "LF2434",
-        .name = "Saint Crepin Carlucet",
-        .latitude = 44.9669444444444,
-        .longitude = 1.25083333333333,
-        .elevation = 840,
-    },
-    {
-        .code = "LF2436",
-        .name = "Saint Julien",
-        .latitude = 44.7286111111111,
-        .longitude = 0.446111111111111,
-        .elevation = 449,
-    },
-    {
-        .code = "LF2437",
-        .name = "Le Rigola Bourdeilles",
-        .latitude = 45.3038888888889,
-        .longitude = 0.596388888888889,
-        .elevation = 580,
-    },
-    {
-        .code = "LF2438",
-        .name = "Bas Meygnaud Valeuil",
-        .latitude = 45.3269444444445,
-        .longitude = 0.636388888888889,
-        .elevation = 405,
-    },
-    {
-        .code = "LF2443",
-        .name = "Peyrillac",
-        .latitude = 44.8902777777778,
-        .longitude = 1.41638888888889,
-        .elevation = 2950,
-    },
-    {
-        .code = "LF2446",
-        .name = "Sud-Ouest Aero-Loisirs",
-        .latitude = 45.4405555555556,
-        .longitude = 1.22694444444444,
-        .elevation = 1148,
-    },
-    {
-        .code = "LF2449",
-        .name = "Hautefaye",
-        .latitude = 45.5452777777778,
-        .longitude = 0.493333333333333,
-        .elevation = 450,
-    },
-    {
-        .code = "LF2452",
-        .name = "Sanet Agonac",
-        .latitude = 45.2525,
-        .longitude = 0.763055555555556,
-        .elevation = 546,
-    },
-    {
-        .code = "LF2453",
-        .name = "Ferme Milhac- Oie en Perigord",
-        .latitude = 45.1133333333333,
-        .longitude = 0.9225,
-        .elevation = 754,
-    },
-    {
-        .code = "LF2454",
-        .name = "Terrasson le Bos",
-        .latitude = 45.1344444444444,
-        .longitude = 1.33666666666667,
-        .elevation = 292,
-    },
-    {
-        .code = "LF2458",
-        .name = "Piste du Tartou",
-        .latitude = 45.6502777777778,
-        .longitude = 0.575,
-        .elevation = 756,
-    },
-    {
-        .code = "LF2461",
-        .name = "Galinat Tamnies les Eyzies",
-        .latitude = 44.9919444444444,
-        .longitude = 1.14194444444444,
-        .elevation = 655,
-    },
-    {
-        .code = "LF2462",
-        .name = "Plazac",
-        .latitude = 45.0266666666667,
-        .longitude = 1.01416666666667,
-        .elevation = 700,
-    },
-    {
-        .code = "LF2463",
-        .name = "Thenac",
-        .latitude = 44.7452777777778,
-        .longitude = 0.325555555555556,
-        .elevation = 328,
-    },
-    {
-        .code = "LF2465",
-        .name = "Le Pas de l'Aze",
-        .latitude = 45.22,
-        .longitude = 0.478055555555556,
-        .elevation = 495,
-    },
-    {
-        .code = "LF2466",
-        .name = "Clissac",
-        .latitude = 44.9102777777778,
-        .longitude = 1.29138888888889,
-        .elevation = 500,
-    },
-    {
-        .code = "LF2467",
-        .name = "Malbec",
-        .latitude = 45.0077777777778,
-        .longitude = 1.01611111111111,
-        .elevation = 850,
-    },
-    {
-        .code = "LF2468",
-        .name = "Mauzens et Miremont",
-        .latitude = 44.9997222222222,
-        .longitude = 0.906388888888889,
-        .elevation = 800,
-    },
-    {
-        .code = "LF2469",
-        .name = "Campsegret",
-        .latitude = 44.9611111111111,
-        .longitude = 0.563888888888889,
-        .elevation = 567,
-    },
-    {
-        .code = "LF2521",
-        .name = "Lanans",
-        .latitude = 47.3025,
-        .longitude = 6.45305555555556,
-        .elevation = 1640,
-    },
-    {
-        .code = "LF2552",
-        .name = "Bonnay",
-        .latitude = 47.3336111111111,
-        .longitude = 6.03583333333333,
-        .elevation = 751,
-    },
-    {
-        .code = "LF2553",
-        .name = "Fournet Blancheroche",
-        .latitude = 47.1777777777778,
-        .longitude = 6.81361111111111,
-        .elevation = 2874,
-    },
-    {
-        .code = "LF2554",
-        .name = "Arc sous Cicon",
-        .latitude = 47.0458333333333,
-        .longitude = 6.38888888888889,
-        .elevation = 2608,
-    },
-    {
-        .code = "LF2555",
-        .name = "Athose",
-        .latitude = 47.0766666666667,
-        .longitude = 6.28944444444444,
-        .elevation = 2360,
-    },
-    {
-        .code = "LF2557",
-        .name = "La Vrine Paramoteur",
-        .latitude = 46.9761111111111,
-        .longitude = 6.33222222222222,
-        .elevation = 2707,
-    },
-    {
-        .code = "LF2621",
-        .name = "Faucon",
-        .latitude = 44.5369444444444,
-        .longitude = 5.30861111111111,
-        .elevation = 3300,
-    },
-    {
-        .code = "LF2622",
-        .name = "Bellegarde en Diois",
-        .latitude = 44.5536111111111,
-        .longitude = 5.43833333333333,
-        .elevation = 3378,
-    },
-    {
-        .code = "LF2623",
-        .name = "Col de Bacchus",
-        .latitude = 44.8530555555556,
-        .longitude = 5.16916666666667,
-        .elevation = 3200,
-    },
-    {
-        .code = "LF2624",
-        .name = "L'Escoulin",
-        .latitude = 44.8158333333333,
-        .longitude = 5.22027777777778,
-        .elevation = 2165,
-    },
-    {
-        .code = "LF2628",
-        .name = "Etoile Rhone",
-        .latitude = 44.83,
-        .longitude = 4.86888888888889,
-        .elevation = 377,
-    },
-    {
-        .code = "LF2629",
-        .name = "Ratieres Les Allandaines",
-        .latitude = 45.1661111111111,
-        .longitude = 4.97916666666667,
-        .elevation = 886,
-    },
-    {
-        .code = "LF2651",
-        .name = "Base ULM Anthony Delluc",
-        .latitude = 45.0119444444444,
-        .longitude = 5.08388888888889,
-        .elevation = 656,
-    },
-    {
-        .code = "LF2655",
-        .name = "Saint Martin",
-        .latitude = 44.5880555555556,
-        .longitude = 5.54138888888889,
-        .elevation = 3205,
-    },
-    {
-        .code = "LF2721",
-        .name = "Saint Cyr La Campagne",
-        .latitude = 49.2530555555556,
-        .longitude = 1.02888888888889,
-        .elevation = 370,
-    },
-    {
-        .code = "LF2722",
-        .name = "Berville sur Mer",
-        .latitude = 49.4358333333333,
-        .longitude = 0.363611111111111,
-        .elevation = 16,
-    },
-    {
-        .code = "LF2723",
-        .name = "Breuilpont",
-        .latitude = 48.96,
-        .longitude = 1.43833333333333,
-        .elevation = 312,
-    },
-    {
-        .code = "LF2751",
-        .name = "Les Noyers",
-        .latitude = 49.2597222222222,
-        .longitude = 1.66138888888889,
-        .elevation = 328,
-    },
-    {
-        .code = "LF2752",
-        .name = "Cesseville Ferme des Moulins",
-        .latitude = 49.1783333333333,
-        .longitude = 0.996388888888889,
-        .elevation = 485,
-    },
-    {
-        .code = "LF2753",
-        .name = "Val de Reuil",
-        .latitude = 49.2813888888889,
-        .longitude = 1.23138888888889,
-        .elevation = 33,
-    },
-    {
-        .code = "LF2822",
-        .name = "Champrond Le Petit Bois Landry",
-        .latitude = 48.3938888888889,
-        .longitude = 1.0575,
-        .elevation = 853,
-    },
-    {
-        .code = "LF2823",
-        .name = "Loulappe",
-        .latitude = 48.4383333333333,
-        .longitude = 1.27444444444444,
-        .elevation = 577,
-    },
-    {
-        .code = "LF2825",
-        .name = "Santilly",
-        .latitude = 48.1588888888889,
-        .longitude = 1.85333333333333,
-        .elevation = 425,
-    },
-    {
-        .code = "LF2827",
-        .name = "Fontaine Simon",
-        .latitude = 48.5069444444444,
-        .longitude = 0.9925,
-        .elevation = 689,
-    },
-    {
-        .code = "LF2829",
-        .name = "Voves Viabon",
-        .latitude = 48.2111111111111,
-        .longitude = 1.67333333333333,
-        .elevation = 476,
-    },
-    {
-        .code = "LF2830",
-        .name = "Ecrosnes",
-        .latitude = 48.5608333333333,
-        .longitude = 1.73055555555556,
-        .elevation = 515,
-    },
-    {
-        .code = "LF2834",
-        .name = "Les Ailes d'Eure et Loir",
-        .latitude = 48.5922222222222,
-        .longitude = 1.5375,
-        .elevation = 480,
-    },
-    {
-        .code = "LF2851",
-        .name = "Houville La Branche",
-        .latitude = 48.4530555555556,
-        .longitude = 1.62972222222222,
-        .elevation = 496,
-    },
-    {
-        .code = "LF2853",
-        .name = "Le Gault St Denis",
-        .latitude = 48.2183333333333,
-        .longitude = 1.49611111111111,
-        .elevation = 446,
-    },
-    {
-        .code = "LF2854",
-        .name = "La Saussaye",
-        .latitude = 48.4125,
-        .longitude = 1.55388888888889,
-        .elevation = 495,
-    },
-    {
-        .code = "LF2855",
-        .name = "La maison des pionniers",
-        .latitude = 48.8244444444444,
-        .longitude = 1.58388888888889,
-        .elevation = 360,
-    },
-    {
-        .code = "LF2856",
-        .name = "Le Buternay",
-        .latitude = 48.6119444444444,
-        .longitude = 0.841944444444444,
-        .elevation = 522,
-    },
-    {
-        .code = "LF2857",
-        .name = "Paramoteur Paris Ouest",
-        .latitude = 48.7675,
-        .longitude = 1.54055555555556,
-        .elevation = 433,
-    },
-    {
-        .code = "LF2858",
-        .name = "club du Houssay",
-        .latitude = 48.2269444444444,
-        .longitude = 1.38527777777778,
-        .elevation = 429,
-    },
-    {
-        .code = "LF2859",
-        .name = "Les Ailes d'Horus",
-        .latitude = 48.4922222222222,
-        .longitude = 1.76305555555556,
-        .elevation = 501,
-    },
-    {
-        .code = "LF2860",
-        .name = "Plein Ciel Paramoteur",
-        .latitude = 48.6044444444444,
-        .longitude = 1.58694444444444,
-        .elevation = 439,
-    },
-    {
-        .code = "LF2921",
-        .name = "Plouarzel",
-        .latitude = 48.4225,
-        .longitude = -4.69694444444445,
-        .elevation = 400,
-    },
-    {
-        .code = "LF2922",
-        .name = "Poullaouen Le Stancou",
-        .latitude = 48.3572222222222,
-        .longitude = -3.66333333333333,
-        .elevation = 492,
-    },
-    {
-        .code = "LF2923",
-        .name = "Querlarn Plobannalec Lesconi",
-        .latitude = 47.8186111111111,
-        .longitude = -4.25027777777778,
-        .elevation = 49,
-    },
-    {
-        .code = "LF2925",
-        .name = "Le Grand Chene",
-        .latitude = 48.3402777777778,
-        .longitude = -3.71472222222222,
-        .elevation = 450,
-    },
-    {
-        .code = "LF2B24",
-        .name = "domaine Aliso Rossi",
-        .latitude = 42.6469444444444,
-        .longitude = 9.28805555555556,
-        .elevation = 49,
-    },
-    {
-        .code = "LF2B25",
-        .name = "Aleria Padulone",
-        .latitude = 42.1080555555556,
-        .longitude = 9.5425,
-        .elevation = 5,
-    },
-    {
-        .code = "LF3023",
-        .name = "Tornac",
-        .latitude = 44.0122222222222,
-        .longitude = 3.96333333333333,
-        .elevation = 690,
-    },
-    {
-        .code = "LF3025",
-        .name = "Remoulins",
-        .latitude = 43.9472222222222,
-        .longitude = 4.58833333333333,
-        .elevation = 105,
-    },
-    {
-        .code = "LF3026",
-        .name = "Montcalm",
-        .latitude = 43.5716666666667,
-        .longitude = 4.30138888888889,
-        .elevation = 10,
-    },
-    {
-        .code = "LF3052",
-        .name = "Saint Victor",
-        .latitude = 44.0352777777778,
-        .longitude = 4.47361111111111,
-        .elevation = 430,
-    },
-    {
-        .code = "LF3053",
-        .name = "Le Grand Plantier",
-        .latitude = 43.8227777777778,
-        .longitude = 4.12611111111111,
-        .elevation = 300,
-    },
-    {
-        .code = "LF3126",
-        .name = "Sabonneres",
-        .latitude = 43.4547222222222,
-        .longitude = 1.07416666666667,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF3128",
-        .name = "Bois de la Pierre",
-        .latitude = 43.3419444444444,
-        .longitude = 1.14361111111111,
-        .elevation = 840,
-    },
-    {
-        .code = "LF3129",
-        .name = "Pene de Soulit",
-        .latitude = 42.7930555555556,
-        .longitude = 0.4625,
-        .elevation = 6240,
-    },
-    {
-        .code = "LF3130",
-        .name = "Uls",
-        .latitude = 42.8519444444444,
-        .longitude = 0.848888888888889,
-        .elevation = 6568,
-    },
-    {
-        .code = "LF3131",
-        .name = "Cap de Barres",
-        .latitude = 42.8641666666667,
-        .longitude = 0.516111111111111,
-        .elevation = 5798,
-    },
-    {
-        .code = "LF3132",
-        .name = "Cap de Pouy",
-        .latitude = 42.7847222222222,
-        .longitude = 0.545,
-        .elevation = 5905,
-    },
-    {
-        .code = "LF3133",
-        .name = "Honteyde",
-        .latitude = 42.8361111111111,
-        .longitude = 0.502777777777778,
-        .elevation = 6234,
-    },
-    {
-        .code = "LF3134",
-        .name = "L'Isle en Dodon",
-        .latitude = 43.3808333333333,
-        .longitude = 0.851666666666667,
-        .elevation = 918,
-    },
-    {
-        .code = "LF3135",
-        .name = "Saint Felix Lauragais",
-        .latitude = 43.4386111111111,
-        .longitude = 1.90888888888889,
-        .elevation = 712,
-    },
-    {
-        .code = "LF3136",
-        .name = "Gardouch",
-        .latitude = 43.4016666666667,
-        .longitude = 1.68638888888889,
-        .elevation = 564,
-    },
-    {
-        .code = "LF3137",
-        .name = "Cier de Riviere",
-        .latitude = 43.0677777777778,
-        .longitude = 0.628611111111111,
-        .elevation = 1312,
-    },
-    {
-        .code = "LF3138",
-        .name = "Bacaneres",
-        .latitude = 42.8380555555556,
-        .longitude = 0.658611111111111,
-        .elevation = 6532,
-    },
-    {
-        .code = "LF3140",
-        .name = "Villematier",
-        .latitude = 43.8272222222222,
-        .longitude = 1.48972222222222,
-        .elevation = 354,
-    },
-    {
-        .code = "LF3151",
-        .name = "Le Fousseret",
-        .latitude = 43.2688888888889,
-        .longitude = 1.05388888888889,
-        .elevation = 820,
-    },
-    {
-        .code = "LF3153",
-        .name = "Balesta Nature",
-        .latitude = 43.1533333333333,
-        .longitude = 0.995,
-        .elevation = 1394,
-    },
-    {
-        .code = "LF3154",
-        .name = "Labastide St Sernin ",
-        .latitude = 43.7336111111111,
-        .longitude = 1.45972222222222,
-        .elevation = 500,
-    },
-    {
-        .code = "LF3155",
-        .name = "Marmouzet ",
-        .latitude = 43.2455555555556,
-        .longitude = 1.23166666666667,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF3156",
-        .name = "Le Tucoulet",
-        .latitude = 43.2011111111111,
-        .longitude = 0.5475,
-        .elevation = 1627,
-    },
-    {
-        .code = "LF3157",
-        .name = "Le Burgaud",
-        .latitude = 43.8147222222222,
-        .longitude = 1.14083333333333,
-        .elevation = 600,
-    },
-    {
-        .code = "LF3158",
-        .name = "Gibel",
-        .latitude = 43.3013888888889,
-        .longitude = 1.7025,
-        .elevation = 980,
-    },
-    {
-        .code = "LF3159",
-        .name = "Molas",
-        .latitude = 43.4166666666667,
-        .longitude = 0.753611111111111,
-        .elevation = 862,
-    },
-    {
-        .code = "LF3160",
-        .name = "Carbonne",
-        .latitude = 43.2791666666667,
-        .longitude = 1.19222222222222,
-        .elevation = 709,
-    },
-    {
-        .code = "LF3161",
-        .name = "Saint Fereol",
-        .latitude = 43.4369444444444,
-        .longitude = 2.02555555555556,
-        .elevation = 1148,
-    },
-    {
-        .code = "LF3162",
-        .name = "Cox",
-        .latitude = 43.7627777777778,
-        .longitude = 1.05111111111111,
-        .elevation = 940,
-    },
-    {
-        .code = "LF3163",
-        .name = "Girosp",
-        .latitude = 43.0216666666667,
-        .longitude = 0.779166666666667,
-        .elevation = 1870,
-    },
-    {
-        .code = "LF3221",
-        .name = "Bretagne d'Armagnac",
-        .latitude = 43.8922222222222,
-        .longitude = 0.145555555555556,
-        .elevation = 419,
-    },
-    {
-        .code = "LF3225",
-        .name = "Biran",
-        .latitude = 43.6775,
-        .longitude = 0.408611111111111,
-        .elevation = 669,
-    },
-    {
-        .code = "LF3226",
-        .name = "Berdoues",
-        .latitude = 43.4705555555556,
-        .longitude = 0.389166666666667,
-        .elevation = 665,
-    },
-    {
-        .code = "LF3227",
-        .name = "Manent Montane",
-        .latitude = 43.3469444444444,
-        .longitude = 0.610833333333333,
-        .elevation = 1001,
-    },
-    {
-        .code = "LF3228",
-        .name = "Duffort",
-        .latitude = 43.3497222222222,
-        .longitude = 0.412222222222222,
-        .elevation = 290,
-    },
-    {
-        .code = "LF3229",
-        .name = "La Boulouze",
-        .latitude = 43.4991666666667,
-        .longitude = 1.01888888888889,
-        .elevation = 656,
-    },
-    {
-        .code = "LF3230",
-        .name = "Saint Elix Theux",
-        .latitude = 43.4372222222222,
-        .longitude = 0.454166666666667,
-        .elevation = 760,
-    },
-    {
-        .code = "LF3231",
-        .name = "Isle de Noe",
-        .latitude = 43.5925,
-        .longitude = 0.395,
-        .elevation = 590,
-    },
-    {
-        .code = "LF3232",
-        .name = "Idrac Respailles",
-        .latitude = 43.5119444444444,
-        .longitude = 0.435277777777778,
-        .elevation = 775,
-    },
-    {
-        .code = "LF3233",
-        .name = "Lectoure Marsolan",
-        .latitude = 43.9552777777778,
-        .longitude = 0.521388888888889,
-        .elevation = 590,
-    },
-    {
-        .code = "LF3238",
-        .name = "Simorre le Puntous",
-        .latitude = 43.4394444444444,
-        .longitude = 0.746944444444444,
-        .elevation = 900,
-    },
-    {
-        .code = "LF3251",
-        .name = "Maupas",
-        .latitude = 43.8305555555556,
-        .longitude = -0.123611111111111,
-        .elevation = 250,
-    },
-    {
-        .code = "LF3253",
-        .name = "Saint Blancard",
-        .latitude = 43.3355555555556,
-        .longitude = 0.665,
-        .elevation = 950,
-    },
-    {
-        .code = "LF3254",
-        .name = "Saint Clar",
-        .latitude = 43.9122222222222,
-        .longitude = 0.747222222222222,
-        .elevation = 574,
-    },
-    {
-        .code = "LF3255",
-        .name = "Brugnens",
-        .latitude = 43.8336111111111,
-        .longitude = 0.731111111111111,
-        .elevation = 597,
-    },
-    {
-        .code = "LF3257",
-        .name = "Montreal du Gers",
-        .latitude = 43.9436111111111,
-        .longitude = 0.191944444444444,
-        .elevation = 301,
-    },
-    {
-        .code = "LF3259",
-        .name = "Gelard",
-        .latitude = 43.5027777777778,
-        .longitude = 0.195277777777778,
-        .elevation = 591,
-    },
-    {
-        .code = "LF3260",
-        .name = "En Lebe",
-        .latitude = 43.6683333333333,
-        .longitude = 0.916388888888889,
-        .elevation = 590,
-    },
-    {
-        .code = "LF3261",
-        .name = "Chelan",
-        .latitude = 43.3416666666667,
-        .longitude = 0.531388888888889,
-        .elevation = 865,
-    },
-    {
-        .code = "LF3264",
-        .name = "Bassoues",
-        .latitude = 43.5783333333333,
-        .longitude = 0.269444444444444,
-        .elevation = 600,
-    },
-    {
-        .code = "LF3265",
-        .name = "Mauvezin Monplaisir",
-        .latitude = 43.7366666666667,
-        .longitude = 0.864444444444444,
-        .elevation = 510,
-    },
-    {
-        .code = "LF3266",
-        .name = "Nauxion",
-        .latitude = 43.7372222222222,
-        .longitude = 0.473611111111111,
-        .elevation = 745,
-    },
-    {
-        .code = "LF3267",
-        .name = "Arrouede",
-        .latitude = 43.3547222222222,
-        .longitude = 0.58,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF3268",
-        .name = "Gondrin",
-        .latitude = 43.9069444444444,
-        .longitude = 0.248888888888889,
-        .elevation = 540,
-    },
-    {
-        .code = "LF3269",
-        .name = "BASE ULM VIELLA",
-        .latitude = 43.6111111111111,
-        .longitude = -0.12,
-        .elevation = 500,
-    },
-    {
-        .code = "LF3270",
-        .name = "Monferran Saves ",
-        .latitude = 43.6019444444444,
-        .longitude = 0.967777777777778,
-        .elevation = 984,
-    },
-    {
-        .code = "LF3321",
-        .name = "Bazas Cazats",
-        .latitude = 44.4627777777778,
-        .longitude = -0.187777777777778,
-        .elevation = 300,
-    },
-    {
-        .code = "LF3322",
-        .name = "Saint Pierre",
-        .latitude = 44.6672222222222,
-        .longitude = -0.219722222222222,
-        .elevation = 158,
-    },
-    {
-        .code = "LF3323",
-        .name = "Sainte Foy",
-        .latitude = 44.6294444444444,
-        .longitude = -0.156666666666667,
-        .elevation = 217,
-    },
-    {
-        .code = "LF3324",
-        .name = "Cabanac et Villagrains",
-        .latitude = 44.6141666666667,
-        .longitude = -0.576388888888889,
-        .elevation = 192,
-    },
-    {
-        .code = "LF3327",
-        .name = "Sainte Helene",
-        .latitude = 44.9838888888889,
-        .longitude = -0.907777777777778,
-        .elevation = 80,
-    },
-    {
-        .code = "LF3328",
-        .name = "Le Barp",
-        .latitude = 44.6088888888889,
-        .longitude = -0.669444444444444,
-        .elevation = 230,
-    },
-    {
-        .code = "LF3351",
-        .name = "Campin",
-        .latitude = 44.4363888888889,
-        .longitude = -0.0219444444444444,
-        .elevation = 35,
-    },
-    {
-        .code = "LF3352",
-        .name = "Arbis",
-        .latitude = 44.6805555555556,
-        .longitude = -0.257222222222222,
-        .elevation = 200,
-    },
-    {
-        .code = "LF3353",
-        .name = "Carcans",
-        .latitude = 45.0538888888889,
-        .longitude = -1.04027777777778,
-        .elevation = 60,
-    },
-    {
-        .code = "LF3354",
-        .name = "Cestas",
-        .latitude = 44.7019444444445,
-        .longitude = -0.785277777777778,
-        .elevation = 192,
-    },
-    {
-        .code = "LF3355",
-        .name = "ulm air estuaire",
-        .latitude = 45.015,
-        .longitude = -0.498333333333333,
-        .elevation = 9,
-    },
-    {
-        .code = "LF3356",
-        .name = "Saint Estephe",
-        .latitude = 45.2361111111111,
-        .longitude = -0.752222222222222,
-        .elevation = 20,
-    },
-    {
-        .code = "LF3357",
-        .name = "Chateau Venus",
-        .latitude = 44.6291666666667,
-        .longitude = -0.376944444444444,
-        .elevation = 70,
-    },
-    {
-        .code = "LF3422",
-        .name = "Limbardier",
-        .latitude = 43.3255555555556,
-        .longitude = 3.18611111111111,
-        .elevation = 105,
-    },
-    {
-        .code = "LF3423",
-        .name = "Puisserguier",
-        .latitude = 43.3991666666667,
-        .longitude = 3.03388888888889,
-        .elevation = 606,
-    },
-    {
-        .code = "LF3424",
-        .name = "Sauvian",
-        .latitude = 43.2722222222222,
-        .longitude = 3.25055555555556,
-        .elevation = 91,
-    },
-    {
-        .code = "LF3425",
-        .name = "Mas Nouguier ",
-        .latitude = 43.6058333333333,
-        .longitude = 3.28527777777778,
-        .elevation = 1214,
-    },
-    {
-        .code = "LF3461",
-        .name = "Pignan",
-        .latitude = 43.5683333333333,
-        .longitude = 3.75055555555556,
-        .elevation = 130,
-    },
-    {
-        .code = "LF3462",
-        .name = "Saint Drezery",
-        .latitude = 43.7369444444444,
-        .longitude = 3.96027777777778,
-        .elevation = 321,
-    },
-    {
-        .code = "LF3466",
-        .name = "ULM LECROS",
-        .latitude = 43.8797222222222,
-        .longitude = 3.34638888888889,
-        .elevation = 2395,
-    },
-    {
-        .code = "LF3467",
-        .name = "Les champs blancs",
-        .latitude = 43.2944444444444,
-        .longitude = 3.47444444444444,
-        .elevation = 36,
-    },
-    {
-        .code = "LF3468",
-        .name = "Campagne",
-        .latitude = 43.7927777777778,
-        .longitude = 4.03666666666667,
-        .elevation = 177,
-    },
-    {
-        .code = "LF3469",
-        .name = "Sete ULM",
-        .latitude = 43.4,
-        .longitude = 3.65472222222222,
-        .elevation = 0,
-    },
-    {
-        .code = "LF3470",
-        .name = "Plaine de Lacan",
-        .latitude = 43.8488888888889,
-        .longitude = 3.915,
-        .elevation = 466,
-    },
-    {
-        .code = "LF3531",
-        .name = "Moulins le Haut Bois",
-        .latitude = 48.0016666666667,
-        .longitude = -1.35222222222222,
-        .elevation = 200,
-    },
-    {
-        .code = "LF3533",
-        .name = "Langon",
-        .latitude = 47.7641666666667,
-        .longitude = -1.86138888888889,
-        .elevation = 295,
-    },
-    {
-        .code = "LF3551",
-        .name = "Landean (Fougeres)",
-        .latitude = 48.4283333333333,
-        .longitude = -1.16,
-        .elevation = 541,
-    },
-    {
-        .code = "LF3552",
-        .name = "Amanlis Janze",
-        .latitude = 47.9930555555556,
-        .longitude = -1.49138888888889,
-        .elevation = 203,
-    },
-    {
-        .code = "LF3553",
-        .name = "Mont Saint Michel",
-        .latitude = 48.6044444444444,
-        .longitude = -1.55166666666667,
-        .elevation = 16,
-    },
-    {
-        .code = "LF3555",
-        .name = "La Dominelais ",
-        .latitude = 47.75,
-        .longitude = -1.64944444444444,
-        .elevation = 138,
-    },
-    {
-        .code = "LF3557",
-        .name = "La Baillee sous Champ Fleu",
-        .latitude = 48.1875,
-        .longitude = -1.49638888888889,
-        .elevation = 171,
-    },
-    {
-        .code = "LF3558",
-        .name = "Queneleuc",
-        .latitude = 48.0983333333333,
-        .longitude = -2.07638888888889,
-        .elevation = 246,
-    },
-    {
-        .code = "LF3559",
-        .name = "la cudelais",
-        .latitude = 48.415,
-        .longitude = -1.52222222222222,
-        .elevation = 141,
-    },
-    {
-        .code = "LF3560",
-        .name = "Neuville ",
-        .latitude = 48.3102777777778,
-        .longitude = -1.58138888888889,
-        .elevation = 87,
-    },
-    {
-        .code = "LF3622",
-        .name = "Saint Benoit du Sault",
-        .latitude = 46.4535695300358,
-        .longitude = 1.4043562698364,
-        .elevation = 770,
-    },
-    {
-        .code = "LF3623",
-        .name = "Brandes La Perouille",
-        .latitude = 46.6908333333333,
-        .longitude = 1.53027777777778,
-        .elevation = 535,
-    },
-    {
-        .code = "LF3624",
-        .name = "Grange Dieu Levroux",
-        .latitude = 46.96,
-        .longitude = 1.66027777777778,
-        .elevation = 540,
-    },
-    {
-        .code = "LF3625",
-        .name = "Vicq sur Nahon Echalier",
-        .latitude = 47.1108333333333,
-        .longitude = 1.56361111111111,
-        .elevation = 500,
-    },
-    {
-        .code = "LF3627",
-        .name = "Lourouer Saint Laurent",
-        .latitude = 46.6397062283013,
-        .longitude = 2.01445698738098,
-        .elevation = 660,
-    },
-    {
-        .code = "LF3628",
-        .name = "Prissac",
-        .latitude = 46.5194444444444,
-        .longitude = 1.31194444444444,
-        .elevation = 582,
-    },
-    {
-        .code = "LF3630",
-        .name = "Le Pavillon",
-        .latitude = 46.6733333333333,
-        .longitude = 1.46194444444444,
-        .elevation = 525,
-    },
-    {
-        .code = "LF3651",
-        .name = "Reuilly",
-        .latitude = 47.0755555555556,
-        .longitude = 2.02555555555556,
-        .elevation = 495,
-    },
-    {
-        .code = "LF3652",
-        .name = "Villentrois Les Mardelles",
-        .latitude = 47.17,
-        .longitude = 1.44444444444444,
-        .elevation = 413,
-    },
-    {
-        .code = "LF3721",
-        .name = "Neuvy le Roi ",
-        .latitude = 47.5866666666667,
-        .longitude = 0.628611111111111,
-        .elevation = 400,
-    },
-    {
-        .code = "LF3724",
-        .name = "Orbigny Les Pallis",
-        .latitude = 47.2205555555556,
-        .longitude = 1.29388888888889,
-        .elevation = 528,
-    },
-    {
-        .code = "LF3730",
-        .name = "Jacopeau",
-        .latitude = 47.4183333333333,
-        .longitude = 0.323611111111111,
-        .elevation = 285,
-    },
-    {
-        .code = "LF3732",
-        .name = "La Palenderie",
-        .latitude = 47.6277777777778,
-        .longitude = 0.626944444444445,
-        .elevation = 410,
-    },
-    {
-        .code = "LF3733",
-        .name = "Hippolytaine",
-        .latitude = 47.0591666666667,
-        .longitude = 1.14333333333333,
-        .elevation = 456,
-    },
-    {
-        .code = "LF3751",
-        .name = "Bournan",
-        .latitude = 47.0833333333333,
-        .longitude = 0.718333333333333,
-        .elevation = 377,
-    },
-    {
-        .code = "LF3752",
-        .name = "Loches",
-        .latitude = 47.1538888888889,
-        .longitude = 1.01416666666667,
-        .elevation = 390,
-    },
-    {
-        .code = "LF3753",
-        .name = "Channay sur Lathan",
-        .latitude = 47.4611111111111,
-        .longitude = 0.236666666666667,
-        .elevation = 300,
-    },
-    {
-        .code = "LF3754",
-        .name = "Saint Branchs",
-        .latitude = 47.2211111111111,
-        .longitude = 0.737777777777778,
-        .elevation = 300,
-    },
-    {
-        .code = "LF3755",
-        .name = "Saint Hippolyte",
-        .latitude = 47.0613888888889,
-        .longitude = 1.14416666666667,
-        .elevation = 423,
-    },
-    {
-        .code = "LF3759",
-        .name = "Morand ",
-        .latitude = 47.5372222222222,
-        .longitude = 1.01694444444444,
-        .elevation = 377,
-    },
-    {
-        .code = "LF3760",
-        .name = "Ferme de la Braudiere",
-        .latitude = 47.5622222222222,
-        .longitude = 0.307222222222222,
-        .elevation = 256,
-    },
-    {
-        .code = "LF3761",
-        .name = "Lemere",
-        .latitude = 47.0866666666667,
-        .longitude = 0.343055555555556,
-        .elevation = 300,
-    },
-    {
-        .code = "LF3763",
-        .name = "Brizay",
-        .latitude = 47.1016666666667,
-        .longitude = 0.383055555555556,
-        .elevation = 89,
-    },
-    {
-        .code = "LF3764",
-        .name = "La Provenderie",
-        .latitude = 47.585222222222,
-        .longitude = 0.554777777777758,
-        .elevation = 410,
-    },
-    {
-        .code = "LF3765",
-        .name = "Les Bardellieres",
-        .latitude = 47.4980555555556,
-        .longitude = 0.437777777777778,
-        .elevation = 360,
-    },
-    {
-        .code = "LF3767",
-        .name = "La Cante",
-        .latitude = 47.0111111111111,
-        .longitude = 0.671111111111111,
-        .elevation = 229,
-    },
-    {
-        .code = "LF3768",
-        .name = "Chateau de l'Estang",
-        .latitude = 47.2069444444444,
-        .longitude = 1.26444444444444,
-        .elevation = 466,
-    },
-    {
-        .code = "LF3821",
-        .name = "Col de Belledonne",
-        .latitude = 45.1666666666667,
-        .longitude = 5.98722222222222,
-        .elevation = 9120,
-    },
-    {
-        .code = "LF3822",
-        .name = "Crete de Brouffiers",
-        .latitude = 45.0377777777778,
-        .longitude = 5.87944444444445,
-        .elevation = 7251,
-    },
-    {
-        .code = "LF3823",
-        .name = "Dome de la Lauze",
-        .latitude = 44.9986111111111,
-        .longitude = 6.24583333333333,
-        .elevation = 11647,
-    },
-    {
-        .code = "LF3824",
-        .name = "Glacier de la Barbaratre",
-        .latitude = 45.1605555555556,
-        .longitude = 6.13888888888889,
-        .elevation = 9669,
-    },
-    {
-        .code = "LF3825",
-        .name = "Col de Sarenne",
-        .latitude = 45.0875,
-        .longitude = 6.14583333333333,
-        .elevation = 6500,
-    },
-    {
-        .code = "LF3826",
-        .name = "Notre Dame de La Salette",
-        .latitude = 44.8419444444444,
-        .longitude = 5.96277777777778,
-        .elevation = 5184,
-    },
-    {
-        .code = "LF3828",
-        .name = "Mens",
-        .latitude = 44.8055555555556,
-        .longitude = 5.75361111111111,
-        .elevation = 2800,
-    },
-    {
-        .code = "LF3832",
-        .name = "L'Alpe du Grand Serre",
-        .latitude = 45.0,
-        .longitude = 5.83444444444444,
-        .elevation = 6700,
-    },
-    {
-        .code = "LF3833",
-        .name = "Leyrieu",
-        .latitude = 45.7680555555556,
-        .longitude = 5.24388888888889,
-        .elevation = 663,
-    },
-    {
-        .code = "LF3851",
-        .name = "Monestier de Clermont Les Verd",
-        .latitude = 44.9241666666667,
-        .longitude = 5.61222222222222,
-        .elevation = 3250,
-    },
-    {
-        .code = "LF3852",
-        .name = "Frontonas",
-        .latitude = 45.6441666666667,
-        .longitude = 5.1825,
-        .elevation = 680,
-    },
-    {
-        .code = "LF3853",
-        .name = "Saint Vincent de Mercuze",
-        .latitude = 45.3683333333333,
-        .longitude = 5.96888888888889,
-        .elevation = 846,
-    },
-    {
-        .code = "LF3856",
-        .name = "Oulles - La Bergerie",
-        .latitude = 45.0666666666667,
-        .longitude = 5.96583333333333,
-        .elevation = 6500,
-    },
-    {
-        .code = "LF3857",
-        .name = "Lumbin",
-        .latitude = 45.3019444444444,
-        .longitude = 5.91555555555556,
-        .elevation = 720,
-    },
-    {
-        .code = "LF3869",
-        .name = "Crachier",
-        .latitude = 45.5497222222222,
-        .longitude = 5.21944444444444,
-        .elevation = 1463,
-    },
-    {
-        .code = "LF3870",
-        .name = "Grand champ",
-        .latitude = 45.4405555555556,
-        .longitude = 4.85166666666667,
-        .elevation = 720,
-    },
-    {
-        .code = "LF3871",
-        .name = "Montaud",
-        .latitude = 45.2583333333333,
-        .longitude = 5.55416666666667,
-        .elevation = 2650,
-    },
-    {
-        .code = "LF3872",
-        .name = "les Banchets",
-        .latitude = 45.0025,
-        .longitude = 6.12611111111111,
-        .elevation = 5413,
-    },
-    {
-        .code = "LF3873",
-        .name = "Base paramoteur Assieu",
-        .latitude = 45.4022222222222,
-        .longitude = 4.84111111111111,
-        .elevation = 797,
-    },
-    {
-        .code = "LF3874",
-        .name = "Saint Hilaire du Rosier",
-        .latitude = 45.0908333333333,
-        .longitude = 5.23111111111111,
-        .elevation = 722,
-    },
-    {
-        .code = "LF3921",
-        .name = "Lombard",
-        .latitude = 46.7694444444444,
-        .longitude = 5.49833333333333,
-        .elevation = 682,
-    },
-    {
-        .code = "LF3922",
-        .name = "Balaiseaux",
-        .latitude = 46.9686111111111,
-        .longitude = 5.46972222222222,
-        .elevation = 699,
-    },
-    {
-        .code = "LF3923",
-        .name = "Saint Claude",
-        .latitude = 46.3847222222222,
-        .longitude = 5.77027777777778,
-        .elevation = 2051,
-    },
-    {
-        .code = "LF3951",
-        .name = "Doucier",
-        .latitude = 46.6636111111111,
-        .longitude = 5.76138888888889,
-        .elevation = 1735,
-    },
-    {
-        .code = "LF3953",
-        .name = "Boissia",
-        .latitude = 46.5744444444444,
-        .longitude = 5.71,
-        .elevation = 1585,
-    },
-    {
-        .code = "LF3954",
-        .name = "Vigearde",
-        .latitude = 47.2075,
-        .longitude = 5.705,
-        .elevation = 955,
-    },
-    {
-        .code = "LF3956",
-        .name = "Arbois-Ulm",
-        .latitude = 46.8972222222222,
-        .longitude = 5.71805555555556,
-        .elevation = 940,
-    },
-    {
-        .code = "LF3957",
-        .name = "aero Sermange",
-        .latitude = 47.1880555555556,
-        .longitude = 5.64777777777778,
-        .elevation = 869,
-    },
-    {
-        .code = "LF3958",
-        .name = "Arthenas",
-        .latitude = 46.5722222222222,
-        .longitude = 5.53666666666667,
-        .elevation = 1560,
-    },
-    {
-        .code = "LF4051",
-        .name = "Amou",
-        .latitude = 43.5872222222222,
-        .longitude = -0.765277777777778,
-        .elevation = 250,
-    },
-    {
-        .code = "LF4052",
-        .name = "Latecoere",
-        .latitude = 44.3538888888889,
-        .longitude = -1.16722222222222,
-        .elevation = 59,
-    },
-    {
-        .code = "LF4123",
-        .name = "Souesmes",
-        .latitude = 47.4483333333333,
-        .longitude = 2.21083333333333,
-        .elevation = 443,
-    },
-    {
-        .code = "LF4124",
-        .name = "Souge",
-        .latitude = 47.7625,
-        .longitude = 0.738888888888889,
-        .elevation = 203,
-    },
-    {
-        .code = "LF4125",
-        .name = "Montrichard",
-        .latitude = 47.3352777777778,
-        .longitude = 1.20305555555556,
-        .elevation = 210,
-    },
-    {
-        .code = "LF4128",
-        .name = "Fougeres sur Bievre",
-        .latitude = 47.4583333333333,
-        .longitude = 1.36638888888889,
-        .elevation = 335,
-    },
-    {
-        .code = "LF4129",
-        .name = "Cosseneux Vouzon",
-        .latitude = 47.6025,
-        .longitude = 2.08666666666667,
-        .elevation = 394,
-    },
-    {
-        .code = "LF4130",
-        .name = "Pontlevoy",
-        .latitude = 47.3852777777778,
-        .longitude = 1.21888888888889,
-        .elevation = 347,
-    },
-    {
-        .code = "LF4131",
-        .name = "Vouzon le Rabot",
-        .latitude = 47.6561111111111,
-        .longitude = 1.9875,
-        .elevation = 426,
-    },
-    {
-        .code = "LF4152",
-        .name = "Les Chateaux",
-        .latitude = 47.3333333333333,
-        .longitude = 1.27583333333333,
-        .elevation = 239,
-    },
-    {
-        .code = "LF4153",
-        .name = "Chauvigny du Perche",
-        .latitude = 47.9488888888889,
-        .longitude = 1.06888888888889,
-        .elevation = 623,
-    },
-    {
-        .code = "LF4155",
-        .name = "Chouzy-sur-Cisse",
-        .latitude = 47.5069444444444,
-        .longitude = 1.23277777777778,
-        .elevation = 210,
-    },
-    {
-        .code = "LF4156",
-        .name = "Oucques",
-        .latitude = 47.8266666666667,
-        .longitude = 1.31861111111111,
-        .elevation = 419,
-    },
-    {
-        .code = "LF4157",
-        .name = "Selles Saint Denis",
-        .latitude = 47.4,
-        .longitude = 1.91694444444444,
-        .elevation = 293,
-    },
-    {
-        .code = "LF4221",
-        .name = "Col du Beal",
-        .latitude = 45.6811111111111,
-        .longitude = 3.78861111111111,
-        .elevation = 4825,
-    },
-    {
-        .code = "LF4222",
-        .name = "La Jasserie",
-        .latitude = 45.3902777777778,
-        .longitude = 4.57805555555556,
-        .elevation = 4550,
-    },
-    {
-        .code = "LF4223",
-        .name = "Montverdun",
-        .latitude = 45.7044444444444,
-        .longitude = 4.07472222222222,
-        .elevation = 1296,
-    },
-    {
-        .code = "LF4224",
-        .name = "Precieux",
-        .latitude = 45.5880555555556,
-        .longitude = 4.17555555555556,
-        .elevation = 1200,
-    },
-    {
-        .code = "LF4225",
-        .name = "Roanne Mably",
-        .latitude = 46.0855555555556,
-        .longitude = 4.08666666666667,
-        .elevation = 895,
-    },
-    {
-        .code = "LF4226",
-        .name = "Cret de Montieux",
-        .latitude = 45.4638888888889,
-        .longitude = 4.60777777777778,
-        .elevation = 2384,
-    },
-    {
-        .code = "LF4229",
-        .name = "Maubeu",
-        .latitude = 45.4933333333333,
-        .longitude = 4.46388888888889,
-        .elevation = 1650,
-    },
-    {
-        .code = "LF4321",
-        .name = "Mazeyrat",
-        .latitude = 45.1080555555556,
-        .longitude = 3.50361111111111,
-        .elevation = 1700,
-    },
-    {
-        .code = "LF4323",
-        .name = "Les Vastres",
-        .latitude = 44.9852777777778,
-        .longitude = 4.2675,
-        .elevation = 3706,
-    },
-    {
-        .code = "LF4423",
-        .name = "Saint Brevin les Pins",
-        .latitude = 47.2713888888889,
-        .longitude = -2.13027777777778,
-        .elevation = 10,
-    },
-    {
-        .code = "LF4451",
-        .name = "Frossay",
-        .latitude = 47.2391666666667,
-        .longitude = -1.87777777777778,
-        .elevation = 10,
-    },
-    {
-        .code = "LF4452",
-        .name = "La Planche",
-        .latitude = 47.0277777777778,
-        .longitude = -1.43444444444444,
-        .elevation = 105,
-    },
-    {
-        .code = "LF4453",
-        .name = "Nantes Heric",
-        .latitude = 47.3858333333333,
-        .longitude = -1.63555555555556,
-        .elevation = 110,
-    },
-    {
-        .code = "LF4454",
-        .name = "Le Quilloux",
-        .latitude = 47.5994444444444,
-        .longitude = -1.91472222222222,
-        .elevation = 120,
-    },
-    {
-        .code = "LF4455",
-        .name = "La Possardiere",
-        .latitude = 46.9644444444444,
-        .longitude = -1.70333333333333,
-        .elevation = 65,
-    },
-    {
-        .code = "LF4456",
-        .name = "les Moisans",
-        .latitude = 47.2761111111111,
-        .longitude = -2.09694444444444,
-        .elevation = 10,
-    },
-    {
-        .code = "LF4457",
-        .name = "Campbon La Bertheliere",
-        .latitude = 47.4208333333333,
-        .longitude = -2.01194444444444,
-        .elevation = 146,
-    },
-    {
-        .code = "LF4524",
-        .name = "Ligny",
-        .latitude = 47.7055555555556,
-        .longitude = 1.77833333333333,
-        .elevation = 371,
-    },
-    {
-        .code = "LF4525",
-        .name = "La Selle en Hermoy",
-        .latitude = 48.0161111111111,
-        .longitude = 2.89972222222222,
-        .elevation = 440,
-    },
-    {
-        .code = "LF4552",
-        .name = "Saint Benoit sur Loire",
-        .latitude = 47.7916666666667,
-        .longitude = 2.33555555555556,
-        .elevation = 367,
-    },
-    {
-        .code = "LF4553",
-        .name = "Beaugency",
-        .latitude = 47.7494444444444,
-        .longitude = 1.57888888888889,
-        .elevation = 370,
-    },
-    {
-        .code = "LF4554",
-        .name = "Beaulieu sur Loire",
-        .latitude = 47.5575,
-        .longitude = 2.82555555555556,
-        .elevation = 443,
-    },
-    {
-        .code = "LF4555",
-        .name = "Mardie",
-        .latitude = 47.9036111111111,
-        .longitude = 2.06777777777778,
-        .elevation = 435,
-    },
-    {
-        .code = "LF4556",
-        .name = "Marsainvilliers",
-        .latitude = 48.2216666666667,
-        .longitude = 2.26111111111111,
-        .elevation = 416,
-    },
-    {
-        .code = "LF4557",
-        .name = "Villemoutier",
-        .latitude = 47.9702777777778,
-        .longitude = 2.57361111111111,
-        .elevation = 328,
-    },
-    {
-        .code = "LF4558",
-        .name = "Cravant les Lilas",
-        .latitude = 47.8366666666667,
-        .longitude = 1.61777777777778,
-        .elevation = 377,
-    },
-    {
-        .code = "LF4559",
-        .name = "Egry",
-        .latitude = 48.1063888888889,
-        .longitude = 2.44805555555556,
-        .elevation = 361,
-    },
-    {
-        .code = "LF4560",
-        .name = "La Rosetaine",
-        .latitude = 48.1283333333333,
-        .longitude = 2.93722222222222,
-        .elevation = 429,
-    },
-    {
-        .code = "LF4561",
-        .name = "Les Avant Gardes",
-        .latitude = 47.8130555555556,
-        .longitude = 2.23527777777778,
-        .elevation = 350,
-    },
-    {
-        .code = "LF4562",
-        .name = "St Germain",
-        .latitude = 47.9583333333333,
-        .longitude = 2.84333333333333,
-        .elevation = 450,
-    },
-    {
-        .code = "LF4563",
-        .name = "Mezieres lez Clery",
-        .latitude = 47.8108333333333,
-        .longitude = 1.84083333333333,
-        .elevation = 344,
-    },
-    {
-        .code = "LF4564",
-        .name = "AIR et ESPACE",
-        .latitude = 48.0419444444444,
-        .longitude = 3.07611111111111,
-        .elevation = 540,
-    },
-    {
-        .code = "LF4565",
-        .name = "ULM LA CAVE",
-        .latitude = 47.8722222222222,
-        .longitude = 2.45444444444444,
-        .elevation = 410,
-    },
-    {
-        .code = "LF4621",
-        .name = "Calviac",
-        .latitude = 44.9277777777778,
-        .longitude = 2.06805555555556,
-        .elevation = 2100,
-    },
-    {
-        .code = "LF4623",
-        .name = "Lacave Le Frau",
-        .latitude = 44.8416666666667,
-        .longitude = 1.58916666666667,
-        .elevation = 980,
-    },
-    {
-        .code = "LF4624",
-        .name = "Loupiac",
-        .latitude = 44.8313888888889,
-        .longitude = 1.47472222222222,
-        .elevation = 895,
-    },
-    {
-        .code = "LF4627",
-        .name = "Saint Medard de Presque",
-        .latitude = 44.8430555555556,
-        .longitude = 1.83111111111111,
-        .elevation = 1246,
-    },
-    {
-        .code = "LF4628",
-        .name = "Montaigu de Quercy Valprionde",
-        .latitude = 44.365,
-        .longitude = 1.09222222222222,
-        .elevation = 883,
-    },
-    {
-        .code = "LF4629",
-        .name = "Cabrerets",
-        .latitude = 44.5141666666667,
-        .longitude = 1.5925,
-        .elevation = 1177,
-    },
-    {
-        .code = "LF4630",
-        .name = "Bigues Carlucet",
-        .latitude = 44.7441666666667,
-        .longitude = 1.61833333333333,
-        .elevation = 1045,
-    },
-    {
-        .code = "LF4631",
-        .name = "Vers",
-        .latitude = 44.4863888888889,
-        .longitude = 1.53305555555556,
-        .elevation = 981,
-    },
-    {
-        .code = "LF4632",
-        .name = "Montfaucon",
-        .latitude = 44.6911111111111,
-        .longitude = 1.61916666666667,
-        .elevation = 1148,
-    },
-    {
-        .code = "LF4651",
-        .name = "Cezac",
-        .latitude = 44.3475,
-        .longitude = 1.34777777777778,
-        .elevation = 902,
-    },
-    {
-        .code = "LF4652",
-        .name = "les landes",
-        .latitude = 44.9442250793634,
-        .longitude = 1.64698967933657,
-        .elevation = 700,
-    },
-    {
-        .code = "LF4722",
-        .name = "Castillonnes ",
-        .latitude = 44.6986111111111,
-        .longitude = 0.638888888888889,
-        .elevation = 394,
-    },
-    {
-        .code = "LF4723",
-        .name = "Condezaygues",
-        .latitude = 44.479722,
-        .longitude = 0.916098371688804,
-        .elevation = 0,
-    },
-    {
-        .code = "LF4724",
-        .name = "Montpezat d'Agenais",
-        .latitude = 44.3641666666667,
-        .longitude = 0.491388888888889,
-        .elevation = 120,
-    },
-    {
-        .code = "LF4725",
-        .name = "Sembas",
-        .latitude = 44.3375,
-        .longitude = 0.649444444444444,
-        .elevation = 787,
-    },
-    {
-        .code = "LF4726",
-        .name = "Tremons",
-        .latitude = 44.4080555555556,
-        .longitude = 0.890833333333333,
-        .elevation = 341,
-    },
-    {
-        .code = "LF4729",
-        .name = "Saumont Gentieu",
-        .latitude = 44.1116666666667,
-        .longitude = 0.466111111111111,
-        .elevation = 410,
-    },
-    {
-        .code = "LF4730",
-        .name = "Claude Vayssiere",
-        .latitude = 44.5991666666667,
-        .longitude = 0.341388888888889,
-        .elevation = 249,
-    },
-    {
-        .code = "LF4732",
-        .name = "Clairac",
-        .latitude = 44.3611111111111,
-        .longitude = 0.403888888888889,
-        .elevation = 98,
-    },
-    {
-        .code = "LF4733",
-        .name = "Lamourache Nord",
-        .latitude = 44.6211111111111,
-        .longitude = 0.193611111111111,
-        .elevation = 364,
-    },
-    {
-        .code = "LF4735",
-        .name = "Lavardac",
-        .latitude = 44.1708333333333,
-        .longitude = 0.308611111111111,
-        .elevation = 180,
-    },
-    {
-        .code = "LF4736",
-        .name = "Levignac de Guyenne",
-        .latitude = 44.6194444444444,
-        .longitude = 0.231388888888889,
-        .elevation = 213,
-    },
-    {
-        .code = "LF4737",
-        .name = "St Jean de Duras",
-        .latitude = 44.7080555555556,
-        .longitude = 0.296944444444444,
-        .elevation = 145,
-    },
-    {
-        .code = "LF4738",
-        .name = "Villeton",
-        .latitude = 44.3569444444444,
-        .longitude = 0.286111111111111,
-        .elevation = 85,
-    },
-    {
-        .code = "LF4751",
-        .name = "Fourques",
-        .latitude = 44.4675,
-        .longitude = 0.158333333333333,
-        .elevation = 70,
-    },
-    {
-        .code = "LF4752",
-        .name = "Segalas",
-        .latitude = 44.5913888888889,
-        .longitude = 0.556944444444444,
-        .elevation = 436,
-    },
-    {
-        .code = "LF4753",
-        .name = "Caudecoste",
-        .latitude = 44.1055555555556,
-        .longitude = 0.724722222222222,
-        .elevation = 323,
-    },
-    {
-        .code = "LF4754",
-        .name = "Fauillet",
-        .latitude = 44.4194444444444,
-        .longitude = 0.295,
-        .elevation = 100,
-    },
-    {
-        .code = "LF4755",
-        .name = "Mascar",
-        .latitude = 44.6491666666667,
-        .longitude = 0.818888888888889,
-        .elevation = 300,
-    },
-    {
-        .code = "LF4756",
-        .name = "Bouglon",
-        .latitude = 44.4013888888889,
-        .longitude = 0.110833333333333,
-        .elevation = 246,
-    },
-    {
-        .code = "LF4825",
-        .name = "Fenestres",
-        .latitude = 44.8441666666667,
-        .longitude = 3.18805555555556,
-        .elevation = 3610,
-    },
-    {
-        .code = "LF4861",
-        .name = "La Canourgue Conques",
-        .latitude = 44.4152018104989,
-        .longitude = 3.28463368249517,
-        .elevation = 2920,
-    },
-    {
-        .code = "LF4862",
-        .name = "Ribennes La Cheminade",
-        .latitude = 44.6586111111111,
-        .longitude = 3.34166666666667,
-        .elevation = 3550,
-    },
-    {
-        .code = "LF4863",
-        .name = "Saint Martin de Boubeaux",
-        .latitude = 44.2118167104827,
-        .longitude = 3.91310224533074,
-        .elevation = 1624,
-    },
-    {
-        .code = "LF4923",
-        .name = "Saint Sigismond",
-        .latitude = 47.4394444444444,
-        .longitude = -0.935833333333333,
-        .elevation = 243,
-    },
-    {
-        .code = "LF4925",
-        .name = "Soucelles",
-        .latitude = 47.5802777777778,
-        .longitude = -0.412222222222222,
-        .elevation = 170,
-    },
-    {
-        .code = "LF4946",
-        .name = "Soulaire",
-        .latitude = 47.5655555555556,
-        .longitude = -0.549722222222222,
-        .elevation = 148,
-    },
-    {
-        .code = "LF4954",
-        .name = "St Macaire du bois",
-        .latitude = 47.1263888888889,
-        .longitude = -0.281388888888889,
-        .elevation = 170,
-    },
-    {
-        .code = "LF4955",
-        .name = "Valanjou",
-        .latitude = 47.2244444444444,
-        .longitude = -0.568333333333333,
-        .elevation = 262,
-    },
-    {
-        .code = "LF4956",
-        .name = "Coutures",
-        .latitude = 47.3661111111111,
-        .longitude = -0.330555555555556,
-        .elevation = 100,
-    },
-    {
-        .code = "LF4957",
-        .name = "Jumelles",
-        .latitude = 47.4355555555556,
-        .longitude = -0.0966666666666667,
-        .elevation = 130,
-    },
-    {
-        .code = "LF4958",
-        .name = "Chesnaie ULM",
-        .latitude = 47.3394444444444,
-        .longitude = -0.925,
-        .elevation = 380,
-    },
-    {
-        .code = "LF5021",
-        .name = "Dragey",
-        .latitude = 48.7052777777778,
-        .longitude = -1.49388888888889,
-        .elevation = 147,
-    },
-    {
-        .code = "LF5022",
-        .name = "Portbail",
-        .latitude = 49.3352777777778,
-        .longitude = -1.71388888888889,
-        .elevation = 49,
-    },
-    {
-        .code = "LF5122",
-        .name = "Servon Melzicourt",
-        .latitude = 49.205,
-        .longitude = 4.83083333333333,
-        .elevation = 410,
-    },
-    {
-        .code = "LF5123",
-        .name = "Courtisols les Houches",
-        .latitude = 48.9952777777778,
-        .longitude = 4.49666666666667,
-        .elevation = 492,
-    },
-    {
-        .code = "LF5124",
-        .name = "Reims Concept ULM",
-        .latitude = 49.2047222222222,
-        .longitude = 3.73333333333333,
-        .elevation = 557,
-    },
-    {
-        .code = "LF5152",
-        .name = "Bouzy",
-        .latitude = 49.0822222222222,
-        .longitude = 4.13666666666667,
-        .elevation = 360,
-    },
-    {
-        .code = "LF5154",
-        .name = "Lac du Der",
-        .latitude = 48.5666666666667,
-        .longitude = 4.73,
-        .elevation = 436,
-    },
-    {
-        .code = "LF5155",
-        .name = "Champagne Vol Libre",
-        .latitude = 48.9361111111111,
-        .longitude = 4.06166666666667,
-        .elevation = 335,
-    },
-    {
-        .code = "LF5156",
-        .name = "Epoye ULM Reims Concept ULM",
-        .latitude = 49.2772222222222,
-        .longitude = 4.24055555555556,
-        .elevation = 328,
-    },
-    {
-        .code = "LF5224",
-        .name = "Harricourt la Gonio",
-        .latitude = 48.2802777777778,
-        .longitude = 4.91444444444444,
-        .elevation = 1214,
-    },
-    {
-        .code = "LF5225",
-        .name = "Laville aux Bois",
-        .latitude = 48.0927777777778,
-        .longitude = 5.20194444444444,
-        .elevation = 1227,
-    },
-    {
-        .code = "LF5252",
-        .name = "les ailes du der",
-        .latitude = 48.4358333333333,
-        .longitude = 4.85194444444444,
-        .elevation = 561,
-    },
-    {
-        .code = "LF5321",
-        .name = "Andouille le Tertre picard",
-        .latitude = 48.1772222222222,
-        .longitude = -0.850277777777778,
-        .elevation = 410,
-    },
-    {
-        .code = "LF5322",
-        .name = "La Rogerie",
-        .latitude = 48.3116666666667,
-        .longitude = -0.535277777777778,
-        .elevation = 420,
-    },
-    {
-        .code = "LF5323",
-        .name = "La Bazouge de Chemere",
-        .latitude = 48.0130555555556,
-        .longitude = -0.494166666666667,
-        .elevation = 308,
-    },
-    {
-        .code = "LF5324",
-        .name = "Beausoleil",
-        .latitude = 47.7775,
-        .longitude = -0.551111111111111,
-        .elevation = 236,
-    },
-    {
-        .code = "LF5325",
-        .name = "Courcite",
-        .latitude = 48.29,
-        .longitude = -0.259166666666667,
-        .elevation = 787,
-    },
-    {
-        .code = "LF5351",
-        .name = "Aron Les Ecottays",
-        .latitude = 48.2830555555556,
-        .longitude = -0.515833333333333,
-        .elevation = 426,
-    },
-    {
-        .code = "LF5421",
-        .name = "Mont sur Meurthe",
-        .latitude = 48.5425,
-        .longitude = 6.44166666666667,
-        .elevation = 814,
-    },
-    {
-        .code = "LF5422",
-        .name = "Villerupt Micheville",
-        .latitude = 49.4852777777778,
-        .longitude = 5.91777777777778,
-        .elevation = 1305,
-    },
-    {
-        .code = "LF5423",
-        .name = "Herbeviller",
-        .latitude = 48.5561111111111,
-        .longitude = 6.76888888888889,
-        .elevation = 860,
-    },
-    {
-        .code = "LF5451",
-        .name = "Hoeville",
-        .latitude = 48.715,
-        .longitude = 6.43861111111111,
-        .elevation = 1004,
-    },
-    {
-        .code = "LF5453",
-        .name = "Grand Couronne",
-        .latitude = 48.7661111111111,
-        .longitude = 6.22111111111111,
-        .elevation = 1250,
-    },
-    {
-        .code = "LF5454",
-        .name = "Laloeuf",
-        .latitude = 48.4633333333333,
-        .longitude = 6.02416666666667,
-        .elevation = 1000,
-    },
-    {
-        .code = "LF5521",
-        .name = "Cornieville Geville",
-        .latitude = 48.7638888888889,
-        .longitude = 5.69555555555556,
-        .elevation = 904,
-    },
-    {
-        .code = "LF5523",
-        .name = "Chassey Beaupre",
-        .latitude = 48.4538888888889,
-        .longitude = 5.44555555555556,
-        .elevation = 1143,
-    },
-    {
-        .code = "LF5524",
-        .name = "Beauclair",
-        .latitude = 49.4611111111111,
-        .longitude = 5.10888888888889,
-        .elevation = 600,
-    },
-    {
-        .code = "LF5525",
-        .name = "Fains Veel",
-        .latitude = 48.78,
-        .longitude = 5.11055555555556,
-        .elevation = 827,
-    },
-    {
-        .code = "LF5526",
-        .name = "Montmedy Marville",
-        .latitude = 49.4569444444444,
-        .longitude = 5.41138888888889,
-        .elevation = 909,
-    },
-    {
-        .code = "LF5551",
-        .name = "Geville",
-        .latitude = 48.7688888888889,
-        .longitude = 5.68472222222222,
-        .elevation = 1115,
-    },
-    {
-        .code = "LF5552",
-        .name = "Billy-sous-Mangiennes",
-        .latitude = 49.3252777777778,
-        .longitude = 5.60972222222222,
-        .elevation = 895,
-    },
-    {
-        .code = "LF5553",
-        .name = "Mad'In Ulm",
-        .latitude = 48.9441666666667,
-        .longitude = 5.70222222222222,
-        .elevation = 768,
-    },
-    {
-        .code = "LF5554",
-        .name = "La Bertaucourt",
-        .latitude = 49.0733333333333,
-        .longitude = 5.75166666666667,
-        .elevation = 669,
-    },
-    {
-        .code = "LF5653",
-        .name = "La Bochet",
-        .latitude = 47.5316666666667,
-        .longitude = -2.11444444444444,
-        .elevation = 144,
-    },
-    {
-        .code = "LF5654",
-        .name = "Quily",
-        .latitude = 47.8833333333333,
-        .longitude = -2.48694444444444,
-        .elevation = 436,
-    },
-    {
-        .code = "LF5657",
-        .name = "Courant d'ailes",
-        .latitude = 47.5780555555556,
-        .longitude = -2.64916666666667,
-        .elevation = 40,
-    },
-    {
-        .code = "LF5710",
-        .name = "Bambi Air Club",
-        .latitude = 49.1161111111111,
-        .longitude = 6.60777777777778,
-        .elevation = 1320,
-    },
-    {
-        .code = "LF5721",
-        .name = "Denting",
-        .latitude = 49.188889,
-        .longitude = 6.555556,
-        .elevation = 0,
-    },
-    {
-        .code = "LF5722",
-        .name = "Fresnes",
-        .latitude = 48.8566666666667,
-        .longitude = 6.435,
-        .elevation = 958,
-    },
-    {
-        .code = "LF5723",
-        .name = "Saint Avold",
-        .latitude = 49.1022222222222,
-        .longitude = 6.735,
-        .elevation = 1010,
-    },
-    {
-        .code = "LF5726",
-        .name = "Bining",
-        .latitude = 49.0416666666667,
-        .longitude = 7.24222222222222,
-        .elevation = 1200,
-    },
-    {
-        .code = "LF5728",
-        .name = "Falstrof",
-        .latitude = 49.3925,
-        .longitude = 6.54388888888889,
-        .elevation = 951,
-    },
-    {
-        .code = "LF5730",
-        .name = "Gros Rederching",
-        .latitude = 49.0625,
-        .longitude = 7.23972222222222,
-        .elevation = 1132,
-    },
-    {
-        .code = "LF5751",
-        .name = "L'oiseau Blanc Achen",
-        .latitude = 49.0475,
-        .longitude = 7.16166666666667,
-        .elevation = 980,
-    },
-    {
-        .code = "LF5752",
-        .name = "Hargarten aux Mines",
-        .latitude = 49.2194444444444,
-        .longitude = 6.58694444444444,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF5753",
-        .name = "Remeling",
-        .latitude = 49.4119444444444,
-        .longitude = 6.47694444444444,
-        .elevation = 1017,
-    },
-    {
-        .code = "LF5754",
-        .name = "Folschviller",
-        .latitude = 49.0744444444444,
-        .longitude = 6.66638888888889,
-        .elevation = 1160,
-    },
-    {
-        .code = "LF5755",
-        .name = "Zoufftgen",
-        .latitude = 49.4491666666667,
-        .longitude = 6.12555555555555,
-        .elevation = 750,
-    },
-    {
-        .code = "LF5757",
-        .name = "Cappel",
-        .latitude = 49.0736111111111,
-        .longitude = 6.84111111111111,
-        .elevation = 985,
-    },
-    {
-        .code = "LF5758",
-        .name = "Mosailes",
-        .latitude = 49.0358333333333,
-        .longitude = 6.86416666666667,
-        .elevation = 836,
-    },
-    {
-        .code = "LF5759",
-        .name = "Les ailes de Rohrbach",
-        .latitude = 49.0452777777778,
-        .longitude = 7.25444444444444,
-        .elevation = 1223,
-    },
-    {
-        .code = "LF5760",
-        .name = "Cann'Air",
-        .latitude = 49.3447222222222,
-        .longitude = 6.28777777777778,
-        .elevation = 852,
-    },
-    {
-        .code = "LF5761",
-        .name = "Arc-En-Ciel Paramoteurs",
-        .latitude = 49.3763888888889,
-        .longitude = 6.03527777777778,
-        .elevation = 1214,
-    },
-    {
-        .code = "LF5762",
-        .name = "Langatte ULM",
-        .latitude = 48.7488888888889,
-        .longitude = 6.95944444444444,
-        .elevation = 850,
-    },
-    {
-        .code = "LF5763",
-        .name = "Langatte paramoteur",
-        .latitude = 48.7494444444444,
-        .longitude = 6.95944444444444,
-        .elevation = 850,
-    },
-    {
-        .code = "LF5764",
-        .name = "Saint Georges",
-        .latitude = 48.6519444444444,
-        .longitude = 6.93555555555556,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF5765",
-        .name = "ULM HIGHLANDER",
-        .latitude = 49.1216666666667,
-        .longitude = 6.99166666666667,
-        .elevation = 1033,
-    },
-    {
-        .code = "LF5825",
-        .name = "Ville Langy",
-        .latitude = 46.9475,
-        .longitude = 3.49027777777778,
-        .elevation = 902,
-    },
-    {
-        .code = "LF5826",
-        .name = "Champlemy Varzy",
-        .latitude = 47.2908333333333,
-        .longitude = 3.36333333333333,
-        .elevation = 1020,
-    },
-    {
-        .code = "LF5827",
-        .name = "Luzy",
-        .latitude = 46.7791666666667,
-        .longitude = 3.98333333333333,
-        .elevation = 920,
-    },
-    {
-        .code = "LF5852",
-        .name = "La Collancelle",
-        .latitude = 47.1911111111111,
-        .longitude = 3.64416666666667,
-        .elevation = 985,
-    },
-    {
-        .code = "LF5854",
-        .name = "Beard",
-        .latitude = 46.8647222222222,
-        .longitude = 3.33583333333333,
-        .elevation = 770,
-    },
-    {
-        .code = "LF5855",
-        .name = "Le Charmois",
-        .latitude = 47.0197222222222,
-        .longitude = 3.77944444444444,
-        .elevation = 919,
-    },
-    {
-        .code = "LF5930",
-        .name = "Herlies",
-        .latitude = 50.5852777777778,
-        .longitude = 2.83888888888889,
-        .elevation = 102,
-    },
-    {
-        .code = "LF5953",
-        .name = "Ferme de Bonavis",
-        .latitude = 50.0841666666667,
-        .longitude = 3.19611111111111,
-        .elevation = 403,
-    },
-    {
-        .code = "LF6021",
-        .name = "Bonneuil en Valois",
-        .latitude = 49.2780555555556,
-        .longitude = 2.99055555555556,
-        .elevation = 394,
-    },
-    {
-        .code = "LF6023",
-        .name = "Fretoy le Chateau",
-        .latitude = 49.6675,
-        .longitude = 2.96805555555556,
-        .elevation = 270,
-    },
-    {
-        .code = "LF6025",
-        .name = "St Thibault - Menantissard",
-        .latitude = 49.6933333333333,
-        .longitude = 1.81222222222222,
-        .elevation = 660,
-    },
-    {
-        .code = "LF6026",
-        .name = "Flavacourt",
-        .latitude = 49.3508333333333,
-        .longitude = 1.81333333333333,
-        .elevation = 456,
-    },
-    {
-        .code = "LF6051",
-        .name = "Mouy",
-        .latitude = 49.3147222222222,
-        .longitude = 2.30138888888889,
-        .elevation = 371,
-    },
-    {
-        .code = "LF6151",
-        .name = "Val Preaux",
-        .latitude = 48.320035912179,
-        .longitude = 0.717565322753899,
-        .elevation = 360,
-    },
-    {
-        .code = "LF6152",
-        .name = "Saint Germain de la Coudre",
-        .latitude = 48.3005555555556,
-        .longitude = 0.581111111111111,
-        .elevation = 520,
-    },
-    {
-        .code = "LF6153",
-        .name = "Le Cerisier",
-        .latitude = 48.4858333333333,
-        .longitude = -0.773611111111111,
-        .elevation = 630,
-    },
-    {
-        .code = "LF6224",
-        .name = "Frevent",
-        .latitude = 50.2780555555556,
-        .longitude = 2.30277777777778,
-        .elevation = 438,
-    },
-    {
-        .code = "LF6251",
-        .name = "Boulogne sur Mer",
-        .latitude = 50.6952777777778,
-        .longitude = 1.56861111111111,
-        .elevation = 190,
-    },
-    {
-        .code = "LF6252",
-        .name = "Verchocq",
-        .latitude = 50.5416666666667,
-        .longitude = 2.035,
-        .elevation = 574,
-    },
-    {
-        .code = "LF6321",
-        .name = "Saint Priest des Champs",
-        .latitude = 45.9588888888889,
-        .longitude = 2.74888888888889,
-        .elevation = 2250,
-    },
-    {
-        .code = "LF6322",
-        .name = "La Banne d'Ordanche",
-        .latitude = 45.630556,
-        .longitude = 2.79166699999996,
-        .elevation = 4820,
-    },
-    {
-        .code = "LF6323",
-        .name = "La Rochette Sauvagnat",
-        .latitude = 45.7680555555556,
-        .longitude = 2.60277777777778,
-        .elevation = 2350,
-    },
-    {
-        .code = "LF6324",
-        .name = "Charbonnieres les Vieilles",
-        .latitude = 46.0136111111111,
-        .longitude = 3.02388888888889,
-        .elevation = 2067,
-    },
-    {
-        .code = "LF6326",
-        .name = "Jayet Gannat",
-        .latitude = 46.0713888888889,
-        .longitude = 3.19944444444444,
-        .elevation = 1171,
-    },
-    {
-        .code = "LF6329",
-        .name = "Aubiat / Sardon ",
-        .latitude = 45.9797222222222,
-        .longitude = 3.2275,
-        .elevation = 1160,
-    },
-    {
-        .code = "LF6330",
-        .name = "St Gal sur Sioule Les Tabarias",
-        .latitude = 46.1108333333333,
-        .longitude = 2.99194444444444,
-        .elevation = 1640,
-    },
-    {
-        .code = "LF6352",
-        .name = "Grand Prouilhat - Maringues",
-        .latitude = 45.9338888888889,
-        .longitude = 3.31666666666667,
-        .elevation = 1010,
-    },
-    {
-        .code = "LF6353",
-        .name = "Thinlat Billom",
-        .latitude = 45.7297222222222,
-        .longitude = 3.29944444444444,
-        .elevation = 1170,
-    },
-    {
-        .code = "LF6354",
-        .name = "Verneugheol",
-        .latitude = 45.7680555555556,
-        .longitude = 2.50388888888889,
-        .elevation = 2395,
-    },
-    {
-        .code = "LF6355",
-        .name = "Le Vernet Ste Marguerite",
-        .latitude = 45.6113888888889,
-        .longitude = 2.94583333333333,
-        .elevation = 3428,
-    },
-    {
-        .code = "LF6356",
-        .name = "Saint-Julien Sancy",
-        .latitude = 45.6608333333333,
-        .longitude = 2.67444444444444,
-        .elevation = 3140,
-    },
-    {
-        .code = "LF6357",
-        .name = "Bort l'Etang",
-        .latitude = 45.7952777777778,
-        .longitude = 3.43638888888889,
-        .elevation = 1286,
-    },
-    {
-        .code = "LF6421",
-        .name = "Asson",
-        .latitude = 43.1691666666667,
-        .longitude = -0.258333333333333,
-        .elevation = 853,
-    },
-    {
-        .code = "LF6422",
-        .name = "Boeil Bezing",
-        .latitude = 43.245,
-        .longitude = -0.213333333333333,
-        .elevation = 1000,
-    },
-    {
-        .code = "LF6424",
-        .name = "Came",
-        .latitude = 43.5102777777778,
-        .longitude = -1.10388888888889,
-        .elevation = 223,
-    },
-    {
-        .code = "LF6425",
-        .name = "Gurmencon",
-        .latitude = 43.1597222222222,
-        .longitude = -0.606666666666667,
-        .elevation = 860,
-    },
-    {
-        .code = "LF6427",
-        .name = "Maslacq",
-        .latitude = 43.4466666666667,
-        .longitude = -0.695,
-        .elevation = 256,
-    },
-    {
-        .code = "LF6428",
-        .name = "Escary Aramits",
-        .latitude = 43.1205555555556,
-        .longitude = -0.741388888888889,
-        .elevation = 1050,
-    },
-    {
-        .code = "LF6429",
-        .name = "Claracq Villa les Palmiers",
-        .latitude = 43.4941666666667,
-        .longitude = -0.289722222222222,
-        .elevation = 787,
-    },
-    {
-        .code = "LF6431",
-        .name = "Navarrenx",
-        .latitude = 43.3405555555556,
-        .longitude = -0.710277777777778,
-        .elevation = 876,
-    },
-    {
-        .code = "LF6432",
-        .name = "Ozenx Montrestrucq",
-        .latitude = 43.4338888888889,
-        .longitude = -0.8,
-        .elevation = 295,
-    },
-    {
-        .code = "LF6451",
-        .name = "Andoins",
-        .latitude = 43.2975,
-        .longitude = -0.236111111111111,
-        .elevation = 919,
-    },
-    {
-        .code = "LF6452",
-        .name = "Sames ",
-        .latitude = 43.5380555555556,
-        .longitude = -1.18277777777778,
-        .elevation = 7,
-    },
-    {
-        .code = "LF6454",
-        .name = "Malaussanne",
-        .latitude = 43.5686111111111,
-        .longitude = -0.475555555555556,
-        .elevation = 490,
-    },
-    {
-        .code = "LF6455",
-        .name = "Ponson Dessus",
-        .latitude = 43.2952777777778,
-        .longitude = -0.0644444444444444,
-        .elevation = 1280,
-    },
-    {
-        .code = "LF6456",
-        .name = "Sevignacq",
-        .latitude = 43.4480555555556,
-        .longitude = -0.281388888888889,
-        .elevation = 650,
-    },
-    {
-        .code = "LF6457",
-        .name = "Saint Pee sur Nivelle",
-        .latitude = 43.3388888888889,
-        .longitude = -1.52944444444444,
-        .elevation = 302,
-    },
-    {
-        .code = "LF6521",
-        .name = "Cabaliros",
-        .latitude = 42.9525,
-        .longitude = -0.133333333333333,
-        .elevation = 5724,
-    },
-    {
-        .code = "LF6523",
-        .name = "Coumely",
-        .latitude = 42.7625,
-        .longitude = 0.0222222222222222,
-        .elevation = 6568,
-    },
-    {
-        .code = "LF6524",
-        .name = "Ferrere Batmale",
-        .latitude = 42.8883333333333,
-        .longitude = 0.498888888888889,
-        .elevation = 5749,
-    },
-    {
-        .code = "LF6525",
-        .name = "La Serre d'Aulon",
-        .latitude = 42.8361111111111,
-        .longitude = 0.272222222222222,
-        .elevation = 6562,
-    },
-    {
-        .code = "LF6526",
-        .name = "Quatre Veziaux",
-        .latitude = 42.8922222222222,
-        .longitude = 0.299722222222222,
-        .elevation = 5643,
-    },
-    {
-        .code = "LF6527",
-        .name = "Artigues",
-        .latitude = 43.0719444444444,
-        .longitude = -0.00333333333333333,
-        .elevation = 2550,
-    },
-    {
-        .code = "LF6528",
-        .name = "Castillon  de la Laquette",
-        .latitude = 42.8955555555556,
-        .longitude = 0.100555555555556,
-        .elevation = 5413,
-    },
-    {
-        .code = "LF6529",
-        .name = "Hautacam",
-        .latitude = 42.9925,
-        .longitude = -0.0119444444444444,
-        .elevation = 5512,
-    },
-    {
-        .code = "LF6530",
-        .name = "Sadournin",
-        .latitude = 43.3261111111111,
-        .longitude = 0.416666666666667,
-        .elevation = 918,
-    },
-    {
-        .code = "LF6532",
-        .name = "Sauveterre",
-        .latitude = 43.4744444444444,
-        .longitude = 0.0783333333333333,
-        .elevation = 587,
-    },
-    {
-        .code = "LF6534",
-        .name = "Sarriac Bigorre",
-        .latitude = 43.3825,
-        .longitude = 0.134166666666667,
-        .elevation = 718,
-    },
-    {
-        .code = "LF6536",
-        .name = "Vallon des Bergons",
-        .latitude = 43.0197222222222,
-        .longitude = -0.178055555555556,
-        .elevation = 3445,
-    },
-    {
-        .code = "LF6538",
-        .name = "Aneres",
-        .latitude = 43.0811111111111,
-        .longitude = 0.465555555555556,
-        .elevation = 1700,
-    },
-    {
-        .code = "LF6539",
-        .name = "Labatut Riviere",
-        .latitude = 43.5211111111111,
-        .longitude = 0.0347222222222222,
-        .elevation = 534,
-    },
-    {
-        .code = "LF6540",
-        .name = "Larreule",
-        .latitude = 43.4413888888889,
-        .longitude = 0.04,
-        .elevation = 606,
-    },
-    {
-        .code = "LF6551",
-        .name = "Luquet",
-        .latitude = 43.2419444444444,
-        .longitude = -0.1175,
-        .elevation = 1345,
-    },
-    {
-        .code = "LF6552",
-        .name = "Rabastens de Bigorre",
-        .latitude = 43.3777777777778,
-        .longitude = 0.161944444444444,
-        .elevation = 650,
-    },
-    {
-        .code = "LF6553",
-        .name = "Vic en Bigorre",
-        .latitude = 43.3933333333333,
-        .longitude = 0.101666666666667,
-        .elevation = 705,
-    },
-    {
-        .code = "LF6554",
-        .name = "Fontrailles",
-        .latitude = 43.3463888888889,
-        .longitude = 0.359444444444444,
-        .elevation = 900,
-    },
-    {
-        .code = "LF6555",
-        .name = "Plateau de Monhaillat",
-        .latitude = 42.9113888888889,
-        .longitude = 0.127777777777778,
-        .elevation = 6312,
-    },
-    {
-        .code = "LF6621",
-        .name = "Coste del Palm",
-        .latitude = 42.6083333333333,
-        .longitude = 2.01111111111111,
-        .elevation = 7710,
-    },
-    {
-        .code = "LF6622",
-        .name = "Col de la Marrano",
-        .latitude = 42.6625,
-        .longitude = 2.16666666666667,
-        .elevation = 6562,
-    },
-    {
-        .code = "LF6623",
-        .name = "Mont Llaret Pic d'Aude",
-        .latitude = 42.575,
-        .longitude = 2.03888888888889,
-        .elevation = 7628,
-    },
-    {
-        .code = "LF6624",
-        .name = "Clos de Legua",
-        .latitude = 42.6541666666667,
-        .longitude = 2.03888888888889,
-        .elevation = 7874,
-    },
-    {
-        .code = "LF6625",
-        .name = "Hippopotame",
-        .latitude = 42.4777777777778,
-        .longitude = 2.04722222222222,
-        .elevation = 4921,
-    },
-    {
-        .code = "LF6626",
-        .name = "Mont Llaret Roc d'Aude",
-        .latitude = 42.5805555555556,
-        .longitude = 2.025,
-        .elevation = 7710,
-    },
-    {
-        .code = "LF6627",
-        .name = "Plateau de la Calme",
-        .latitude = 42.5305555555556,
-        .longitude = 2.00416666666667,
-        .elevation = 6988,
-    },
-    {
-        .code = "LF6628",
-        .name = "Perpignan la Salanque",
-        .latitude = 42.7980555555556,
-        .longitude = 3.00166666666667,
-        .elevation = 30,
-    },
-    {
-        .code = "LF6631",
-        .name = "Corneilla de la Riviere",
-        .latitude = 42.6908333333333,
-        .longitude = 2.73027777777778,
-        .elevation = 230,
-    },
-    {
-        .code = "LF6632",
-        .name = "Saint Genis",
-        .latitude = 42.5463888888889,
-        .longitude = 2.90833333333333,
-        .elevation = 150,
-    },
-    {
-        .code = "LF6651",
-        .name = "Torreilles",
-        .latitude = 42.7475,
-        .longitude = 3.01611111111111,
-        .elevation = 10,
-    },
-    {
-        .code = "LF6652",
-        .name = "Saint Paul de Fenouillet",
-        .latitude = 42.8205555555556,
-        .longitude = 2.49638888888889,
-        .elevation = 860,
-    },
-    {
-        .code = "LF6654",
-        .name = "Llupia",
-        .latitude = 42.6238888888889,
-        .longitude = 2.78055555555556,
-        .elevation = 292,
-    },
-    {
-        .code = "LF6655",
-        .name = "Saint Jean Pla de Corts",
-        .latitude = 42.5197222222222,
-        .longitude = 2.81055555555556,
-        .elevation = 270,
-    },
-    {
-        .code = "LF6656",
-        .name = "Montescot",
-        .latitude = 42.6116666666667,
-        .longitude = 2.93888888888889,
-        .elevation = 55,
-    },
-    {
-        .code = "LF6658",
-        .name = "Llauro",
-        .latitude = 42.5502777777778,
-        .longitude = 2.73083333333333,
-        .elevation = 1411,
-    },
-    {
-        .code = "LF6659",
-        .name = "La Salanque Latecoere",
-        .latitude = 42.8166666666667,
-        .longitude = 3.0,
-        .elevation = 0,
-    },
-    {
-        .code = "LF6715",
-        .name = "Club Ulm Kogenheim",
-        .latitude = 48.3230555555556,
-        .longitude = 7.53472222222222,
-        .elevation = 528,
-    },
-    {
-        .code = "LF6721",
-        .name = "Albe - Val de Ville",
-        .latitude = 48.3491666666667,
-        .longitude = 7.32972222222222,
-        .elevation = 1247,
-    },
-    {
-        .code = "LF6723",
-        .name = "Salmbach",
-        .latitude = 48.9680555555556,
-        .longitude = 8.07083333333333,
-        .elevation = 508,
-    },
-    {
-        .code = "LF6724",
-        .name = "Wissembourg",
-        .latitude = 48.9925,
-        .longitude = 7.97583333333333,
-        .elevation = 574,
-    },
-    {
-        .code = "LF6751",
-        .name = "Batzendorf",
-        .latitude = 48.8030555555556,
-        .longitude = 7.72666666666667,
-        .elevation = 560,
-    },
-    {
-        .code = "LF6752",
-        .name = "Trimbach",
-        .latitude = 48.9380555555556,
-        .longitude = 8.00777777777778,
-        .elevation = 574,
-    },
-    {
-        .code = "LF6754",
-        .name = "Envol Ulm Alsace",
-        .latitude = 48.1511111111111,
-        .longitude = 7.53694444444444,
-        .elevation = 576,
-    },
-    {
-        .code = "LF6755",
-        .name = "Hanau-Airport-Schillersdorf",
-        .latitude = 48.8708333333333,
-        .longitude = 7.51694444444444,
-        .elevation = 676,
-    },
-    {
-        .code = "LF6757",
-        .name = "Les Cigognes d'Epfig",
-        .latitude = 48.3394444444444,
-        .longitude = 7.47222222222222,
-        .elevation = 173,
-    },
-    {
-        .code = "LF6821",
-        .name = "Masevaux",
-        .latitude = 47.8041666666667,
-        .longitude = 6.94638888888889,
-        .elevation = 1500,
-    },
-    {
-        .code = "LF6822",
-        .name = "Vieux Ferrette",
-        .latitude = 47.5158333333333,
-        .longitude = 7.30694444444444,
-        .elevation = 1499,
-    },
-    {
-        .code = "LF6851",
-        .name = "Valdieu Lutran",
-        .latitude = 47.6222222222222,
-        .longitude = 7.04583333333333,
-        .elevation = 1132,
-    },
-    {
-        .code = "LF6852",
-        .name = "Soppe",
-        .latitude = 47.7255555555556,
-        .longitude = 7.09694444444444,
-        .elevation = 1099,
-    },
-    {
-        .code = "LF6951",
-        .name = "Saint Jean d'Ardieres",
-        .latitude = 46.1294444444444,
-        .longitude = 4.74277777777778,
-        .elevation = 610,
-    },
-    {
-        .code = "LF6953",
-        .name = "Le Parasoir",
-        .latitude = 46.0319444444444,
-        .longitude = 4.55583333333333,
-        .elevation = 2110,
-    },
-    {
-        .code = "LF6954",
-        .name = "Base de Bibost",
-        .latitude = 45.7983333333333,
-        .longitude = 4.56138888888889,
-        .elevation = 400,
-    },
-    {
-        .code = "LF7021",
-        .name = "Bucey les Gy",
-        .latitude = 47.415,
-        .longitude = 5.87138888888889,
-        .elevation = 1260,
-    },
-    {
-        .code = "LF7022",
-        .name = "Francourt",
-        .latitude = 47.655,
-        .longitude = 5.73888888888889,
-        .elevation = 869,
-    },
-    {
-        .code = "LF7023",
-        .name = "Saulnot",
-        .latitude = 47.5677777777778,
-        .longitude = 6.64472222222222,
-        .elevation = 1269,
-    },
-    {
-        .code = "LF7025",
-        .name = "Tincey",
-        .latitude = 47.6063888888889,
-        .longitude = 5.78583333333333,
-        .elevation = 764,
-    },
-    {
-        .code = "LF7026",
-        .name = "Arc les Gray",
-        .latitude = 47.4755555555556,
-        .longitude = 5.56916666666667,
-        .elevation = 718,
-    },
-    {
-        .code = "LF7027",
-        .name = "Lambrey",
-        .latitude = 47.7677777777778,
-        .longitude = 5.93888888888889,
-        .elevation = 820,
-    },
-    {
-        .code = "LF7028",
-        .name = "Venisey",
-        .latitude = 47.8344444444444,
-        .longitude = 5.99888888888889,
-        .elevation = 804,
-    },
-    {
-        .code = "LF7029",
-        .name = "Senoncourt",
-        .latitude = 47.8322222222222,
-        .longitude = 6.05305555555555,
-        .elevation = 778,
-    },
-    {
-        .code = "LF7030",
-        .name = "Bay",
-        .latitude = 47.3013888888889,
-        .longitude = 5.70416666666667,
-        .elevation = 709,
-    },
-    {
-        .code = "LF7031",
-        .name = "Jasney",
-        .latitude = 47.8827777777778,
-        .longitude = 6.17,
-        .elevation = 919,
-    },
-    {
-        .code = "LF7032",
-        .name = "La Malachere",
-        .latitude = 47.4483333333333,
-        .longitude = 6.07027777777778,
-        .elevation = 0,
-    },
-    {
-        .code = "LF7033",
-        .name = "Gevigney",
-        .latitude = 47.7969444444444,
-        .longitude = 5.91305555555556,
-        .elevation = 720,
-    },
-    {
-        .code = "LF7034",
-        .name = "Lacs de Bonnal",
-        .latitude = 47.5177777777778,
-        .longitude = 6.36388888888889,
-        .elevation = 816,
-    },
-    {
-        .code = "LF7121",
-        .name = "Sagy",
-        .latitude = 46.6155555555556,
-        .longitude = 5.35277777777778,
-        .elevation = 640,
-    },
-    {
-        .code = "LF7124",
-        .name = "Le Creusot Le Gros Chaillot",
-        .latitude = 46.8166666666667,
-        .longitude = 4.40138888888889,
-        .elevation = 1530,
-    },
-    {
-        .code = "LF7151",
-        .name = "La Clayette",
-        .latitude = 46.3027777777778,
-        .longitude = 4.29722222222222,
-        .elevation = 1230,
-    },
-    {
-        .code = "LF7152",
-        .name = "Peronne Moulin Chevraut",
-        .latitude = 46.4330555555556,
-        .longitude = 4.80166666666667,
-        .elevation = 755,
-    },
-    {
-        .code = "LF7153",
-        .name = "Brancion",
-        .latitude = 46.54,
-        .longitude = 4.79222222222222,
-        .elevation = 1310,
-    },
-    {
-        .code = "LF7228",
-        .name = "Piace",
-        .latitude = 48.2711111111111,
-        .longitude = 0.103888888888889,
-        .elevation = 305,
-    },
-    {
-        .code = "LF7229",
-        .name = "Crosmieres",
-        .latitude = 47.7511111111111,
-        .longitude = -0.1475,
-        .elevation = 190,
-    },
-    {
-        .code = "LF7252",
-        .name = "Commerveil",
-        .latitude = 48.3155555555556,
-        .longitude = 0.355,
-        .elevation = 361,
-    },
-    {
-        .code = "LF7253",
-        .name = "Saint Pierre de Cheville ",
-        .latitude = 47.6333333333333,
-        .longitude = 0.452222222222222,
-        .elevation = 160,
-    },
-    {
-        .code = "LF7256",
-        .name = "Saint Cosme en Vairais",
-        .latitude = 48.2619444444444,
-        .longitude = 0.422222222222217,
-        .elevation = 250,
-    },
-    {
-        .code = "LF7258",
-        .name = "Asse le Riboul",
-        .latitude = 48.1952777777778,
-        .longitude = 0.0994444444444444,
-        .elevation = 300,
-    },
-    {
-        .code = "LF7259",
-        .name = "Sceaux sur Huisne",
-        .latitude = 48.1125,
-        .longitude = 0.604166666666667,
-        .elevation = 289,
-    },
-    {
-        .code = "LF7322",
-        .name = "Glacier de l'Etendard",
-        .latitude = 45.1625,
-        .longitude = 6.16666666666667,
-        .elevation = 9514,
-    },
-    {
-        .code = "LF7324",
-        .name = "Glacier de la Grande Motte",
-        .latitude = 45.425,
-        .longitude = 6.89444444444444,
-        .elevation = 9564,
-    },
-    {
-        .code = "LF7325",
-        .name = "La Toviere",
-        .latitude = 45.4655555555556,
-        .longitude = 6.93416666666667,
-        .elevation = 7350,
-    },
-    {
-        .code = "LF7327",
-        .name = "Val Thorens Alti",
-        .latitude = 45.2819444444444,
-        .longitude = 6.57361111111111,
-        .elevation = 8100,
-    },
-    {
-        .code = "LF7328",
-        .name = "Valmorel",
-        .latitude = 45.4416666666667,
-        .longitude = 6.41805555555556,
-        .elevation = 6332,
-    },
-    {
-        .code = "LF7329",
-        .name = "Vaugellaz",
-        .latitude = 45.6069444444444,
-        .longitude = 6.70944444444444,
-        .elevation = 6627,
-    },
-    {
-        .code = "LF7331",
-        .name = "Praz Sauge et Pre Vernay",
-        .latitude = 45.1888888888889,
-        .longitude = 6.25305555555556,
-        .elevation = 5950,
-    },
-    {
-        .code = "LF7332",
-        .name = "Valloire Bonnenuit",
-        .latitude = 45.1211111111111,
-        .longitude = 6.41944444444445,
-        .elevation = 5600,
-    },
-    {
-        .code = "LF7333",
-        .name = "Vers le col du Palet",
-        .latitude = 45.4505555555556,
-        .longitude = 6.88333333333333,
-        .elevation = 8005,
-    },
-    {
-        .code = "LF7340",
-        .name = "Chanaz",
-        .latitude = 45.8188888888889,
-        .longitude = 5.79,
-        .elevation = 764,
-    },
-    {
-        .code = "LF7351",
-        .name = "Yenne",
-        .latitude = 45.7133333333333,
-        .longitude = 5.77694444444444,
-        .elevation = 750,
-    },
-    {
-        .code = "LF7421",
-        .name = "Col de Cenise",
-        .latitude = 46.0208333333333,
-        .longitude = 6.45,
-        .elevation = 5656,
-    },
-    {
-        .code = "LF7422",
-        .name = "Glacier d'Argentiere",
-        .latitude = 45.9416666666667,
-        .longitude = 7.0,
-        .elevation = 9350,
-    },
-    {
-        .code = "LF7423",
-        .name = "Glacier de Talefre",
-        .latitude = 45.9083333333333,
-        .longitude = 6.98333333333333,
-        .elevation = 9121,
-    },
-    {
-        .code = "LF7424",
-        .name = "Glacier du Dome du Gouter",
-        .latitude = 45.8455555555556,
-        .longitude = 6.85027777777778,
-        .elevation = 13940,
-    },
-    {
-        .code = "LF7425",
-        .name = "Glacier du Tacul",
-        .latitude = 45.8916666666667,
-        .longitude = 6.93722222222222,
-        .elevation = 7380,
-    },
-    {
-        .code = "LF7426",
-        .name = "Glacier du Tour",
-        .latitude = 46.0,
-        .longitude = 7.0,
-        .elevation = 10170,
-    },
-    {
-        .code = "LF7427",
-        .name = "Morzine Avoriaz",
-        .latitude = 46.1966666666667,
-        .longitude = 6.75972222222222,
-        .elevation = 5709,
-    },
-    {
-        .code = "LF7430",
-        .name = "Saint Roch Mayeres",
-        .latitude = 45.95,
-        .longitude = 6.58611111111111,
-        .elevation = 5118,
-    },
-    {
-        .code = "LF7431",
-        .name = "Thollon les Memises",
-        .latitude = 46.3966666666667,
-        .longitude = 6.71666666666667,
-        .elevation = 2996,
-    },
-    {
-        .code = "LF7469",
-        .name = "Habere Poche",
-        .latitude = 46.2719444444444,
-        .longitude = 6.46388888888889,
-        .elevation = 3652,
-    },
-    {
-        .code = "LF7470",
-        .name = "Cervens",
-        .latitude = 46.2930555555556,
-        .longitude = 6.44666666666667,
-        .elevation = 2034,
-    },
-    {
-        .code = "LF7621",
-        .name = "Lammerville",
-        .latitude = 49.8055555555556,
-        .longitude = 0.973333333333333,
-        .elevation = 328,
-    },
-    {
-        .code = "LF7653",
-        .name = "Pavilly",
-        .latitude = 49.6011111111111,
-        .longitude = 0.9875,
-        .elevation = 499,
-    },
-    {
-        .code = "LF7654",
-        .name = "Bolleville",
-        .latitude = 49.6005555555556,
-        .longitude = 0.5525,
-        .elevation = 443,
-    },
-    {
-        .code = "LF7655",
-        .name = "Le Mont Dole",
-        .latitude = 49.8936111111111,
-        .longitude = 1.57916666666667,
-        .elevation = 450,
-    },
-    {
-        .code = "LF7752",
-        .name = "Mondreville",
-        .latitude = 48.1686111111111,
-        .longitude = 2.59777777777778,
-        .elevation = 351,
-    },
-    {
-        .code = "LF7753",
-        .name = "Bray sur Seine",
-        .latitude = 48.4319444444444,
-        .longitude = 3.27305555555556,
-        .elevation = 180,
-    },
-    {
-        .code = "LF7754",
-        .name = "Orgenoy",
-        .latitude = 48.4941666666667,
-        .longitude = 2.57638888888889,
-        .elevation = 262,
-    },
-    {
-        .code = "LF7756",
-        .name = "Bazoches les Bray",
-        .latitude = 48.383888888889,
-        .longitude = 3.19888888888886,
-        .elevation = 196,
-    },
-    {
-        .code = "LF7757",
-        .name = "Aeronel",
-        .latitude = 48.6786111111111,
-        .longitude = 2.87694444444444,
-        .elevation = 340,
-    },
-    {
-        .code = "LF7852",
-        .name = "La Fontaine au Berger",
-        .latitude = 48.5822222222222,
-        .longitude = 1.72888888888889,
-        .elevation = 476,
-    },
-    {
-        .code = "LF7853",
-        .name = "Buisson Defleuri",
-        .latitude = 48.8755555555556,
-        .longitude = 1.79388888888889,
-        .elevation = 380,
-    },
-    {
-        .code = "LF7854",
-        .name = "La Ferme des Pres",
-        .latitude = 48.8277777777778,
-        .longitude = 1.79055555555556,
-        .elevation = 296,
-    },
-    {
-        .code = "LF7921",
-        .name = "Gourge Les Grippeaux",
-        .latitude = 46.6955555555556,
-        .longitude = -0.161111111111111,
-        .elevation = 456,
-    },
-    {
-        .code = "LF7922",
-        .name = "Chenay",
-        .latitude = 46.3466666666667,
-        .longitude = -0.0155555555555556,
-        .elevation = 435,
-    },
-    {
-        .code = "LF7925",
-        .name = "Saint Amand sur Sevre",
-        .latitude = 46.9013888888889,
-        .longitude = -0.802777777777778,
-        .elevation = 607,
-    },
-    {
-        .code = "LF7926",
-        .name = "Verrines sous Celles La Jonche",
-        .latitude = 46.2263888888889,
-        .longitude = -0.203611111111111,
-        .elevation = 360,
-    },
-    {
-        .code = "LF7951",
-        .name = "Usseau",
-        .latitude = 46.175,
-        .longitude = -0.609722222222222,
-        .elevation = 115,
-    },
-    {
-        .code = "LF7952",
-        .name = "Secondigny",
-        .latitude = 46.6369444444444,
-        .longitude = -0.463611111111111,
-        .elevation = 710,
-    },
-    {
-        .code = "LF7953",
-        .name = "Le Grand Moire",
-        .latitude = 46.8588888888889,
-        .longitude = -0.181944444444444,
-        .elevation = 336,
-    },
-    {
-        .code = "LF8021",
-        .name = "La Boisselle",
-        .latitude = 50.0163888888889,
-        .longitude = 2.68861111111111,
-        .elevation = 279,
-    },
-    {
-        .code = "LF8022",
-        .name = "Jumel",
-        .latitude = 49.7580555555556,
-        .longitude = 2.30305555555556,
-        .elevation = 413,
-    },
-    {
-        .code = "LF8051",
-        .name = "Loeuilly",
-        .latitude = 49.7655555555556,
-        .longitude = 2.21527777777778,
-        .elevation = 502,
-    },
-    {
-        .code = "LF8052",
-        .name = "Poix de Picardie",
-        .latitude = 49.7802777777778,
-        .longitude = 2.00194444444444,
-        .elevation = 0,
-    },
-    {
-        .code = "LF8053",
-        .name = " Marquivillers",
-        .latitude = 49.6733333333333,
-        .longitude = 2.68416666666667,
-        .elevation = 360,
-    },
-    {
-        .code = "LF8123",
-        .name = "Saint Affrique les Montagnes",
-        .latitude = 43.5447222222222,
-        .longitude = 2.21138888888889,
-        .elevation = 590,
-    },
-    {
-        .code = "LF8151",
-        .name = "L'Isle sur Tarn - Saint Martin",
-        .latitude = 43.8569444444444,
-        .longitude = 1.82083333333333,
-        .elevation = 394,
-    },
-    {
-        .code = "LF8153",
-        .name = "La Ramiere",
-        .latitude = 43.7475,
-        .longitude = 1.81555555555556,
-        .elevation = 420,
-    },
-    {
-        .code = "LF8154",
-        .name = "Saint Lieux les Lavaur",
-        .latitude = 43.7613888888889,
-        .longitude = 1.74111111111111,
-        .elevation = 400,
-    },
-    {
-        .code = "LF8155",
-        .name = "Coufouleux",
-        .latitude = 43.8016666666667,
-        .longitude = 1.71861111111111,
-        .elevation = 406,
-    },
-    {
-        .code = "LF8156",
-        .name = "Albi Castelvert",
-        .latitude = 43.83,
-        .longitude = 2.12111111111111,
-        .elevation = 800,
-    },
-    {
-        .code = "LF8157",
-        .name = "Bouscatel ",
-        .latitude = 43.7280555555556,
-        .longitude = 2.39444444444444,
-        .elevation = 1919,
-    },
-    {
-        .code = "LF8159",
-        .name = "Roquemaure",
-        .latitude = 43.8216666666667,
-        .longitude = 1.60527777777778,
-        .elevation = 630,
-    },
-    {
-        .code = "LF8160",
-        .name = "Rivieres",
-        .latitude = 43.9016666666667,
-        .longitude = 1.97194444444444,
-        .elevation = 489,
-    },
-    {
-        .code = "LF8222",
-        .name = "Beaumont de Lomagne",
-        .latitude = 43.8763888888889,
-        .longitude = 0.983888888888889,
-        .elevation = 338,
-    },
-    {
-        .code = "LF8223",
-        .name = "Bouloc",
-        .latitude = 44.3077777777778,
-        .longitude = 1.08055555555556,
-        .elevation = 745,
-    },
-    {
-        .code = "LF8225",
-        .name = "Caussade Septfonds",
-        .latitude = 44.18,
-        .longitude = 1.59722222222222,
-        .elevation = 644,
-    },
-    {
-        .code = "LF8226",
-        .name = "Caylus",
-        .latitude = 44.2225,
-        .longitude = 1.7325,
-        .elevation = 1035,
-    },
-    {
-        .code = "LF8228",
-        .name = "Montaigu de Quercy Couloussac",
-        .latitude = 44.3641666666667,
-        .longitude = 1.08722222222222,
-        .elevation = 882,
-    },
-    {
-        .code = "LF8233",
-        .name = "Pommevic",
-        .latitude = 44.0841666666667,
-        .longitude = 0.925833333333333,
-        .elevation = 226,
-    },
-    {
-        .code = "LF8251",
-        .name = "Dunes - Aerodrome Leon Lemarti",
-        .latitude = 44.1077777777778,
-        .longitude = 0.775,
-        .elevation = 236,
-    },
-    {
-        .code = "LF8252",
-        .name = "Maubec Solomiac",
-        .latitude = 43.7883333333333,
-        .longitude = 0.911388888888889,
-        .elevation = 575,
-    },
-    {
-        .code = "LF8253",
-        .name = "Leguille",
-        .latitude = 43.9644444444444,
-        .longitude = 1.55527777777778,
-        .elevation = 432,
-    },
-    {
-        .code = "LF8254",
-        .name = "Les Gardios Negrepelisse",
-        .latitude = 44.0808333333333,
-        .longitude = 1.50083333333333,
-        .elevation = 328,
-    },
-    {
-        .code = "LF8255",
-        .name = "Banadets",
-        .latitude = 44.0483333333333,
-        .longitude = 1.28333333333333,
-        .elevation = 280,
-    },
-    {
-        .code = "LF8256",
-        .name = "Montbartier",
-        .latitude = 43.8997222222222,
-        .longitude = 1.27583333333333,
-        .elevation = 420,
-    },
-    {
-        .code = "LF8257",
-        .name = "Labastide Saint Pierre",
-        .latitude = 43.8983333333333,
-        .longitude = 1.36444444444444,
-        .elevation = 330,
-    },
-    {
-        .code = "LF8259",
-        .name = "Fabas",
-        .latitude = 43.8538888888889,
-        .longitude = 1.35888888888889,
-        .elevation = 486,
-    },
-    {
-        .code = "LF8261",
-        .name = "Nadesse",
-        .latitude = 43.8541666666667,
-        .longitude = 1.18694444444444,
-        .elevation = 390,
-    },
-    {
-        .code = "LF8262",
-        .name = "Boissay Ludovic",
-        .latitude = 44.1083333333333,
-        .longitude = 0.987777777777778,
-        .elevation = 312,
-    },
-    {
-        .code = "LF8324",
-        .name = "La Roquebrussanne",
-        .latitude = 43.3291666666667,
-        .longitude = 5.99694444444444,
-        .elevation = 1115,
-    },
-    {
-        .code = "LF8325",
-        .name = "Club Ulm de Themes",
-        .latitude = 43.3113888888889,
-        .longitude = 6.12694444444444,
-        .elevation = 1489,
-    },
-    {
-        .code = "LF8329",
-        .name = "Brue Auriac",
-        .latitude = 43.5055555555556,
-        .longitude = 5.91861111111111,
-        .elevation = 900,
-    },
-    {
-        .code = "LF8352",
-        .name = "Frejus",
-        .latitude = 43.4230555555555,
-        .longitude = 6.69777777777778,
-        .elevation = 15,
-    },
-    {
-        .code = "LF8353",
-        .name = "Cogolin Grimaud",
-        .latitude = 43.2577777777778,
-        .longitude = 6.54361111111111,
-        .elevation = 20,
-    },
-    {
-        .code = "LF8355",
-        .name = "Pourrieres",
-        .latitude = 43.48,
-        .longitude = 5.71027777777778,
-        .elevation = 787,
-    },
-    {
-        .code = "LF8356",
-        .name = "Basse Maure",
-        .latitude = 43.53,
-        .longitude = 6.31527777777778,
-        .elevation = 1100,
-    },
-    {
-        .code = "LF8357",
-        .name = "Pampelonne",
-        .latitude = 43.6841666666667,
-        .longitude = 6.13638888888889,
-        .elevation = 1900,
-    },
-    {
-        .code = "LF8358",
-        .name = "Les Ailes du Soleil",
-        .latitude = 43.4144444444444,
-        .longitude = 6.72388888888889,
-        .elevation = 19,
-    },
-    {
-        .code = "LF8359",
-        .name = "Golfe de Frejus",
-        .latitude = 43.3344444444444,
-        .longitude = 6.69861111111111,
-        .elevation = 0,
-    },
-    {
-        .code = "LF8360",
-        .name = "les Queyrons",
-        .latitude = 43.3463888888889,
-        .longitude = 6.31111111111111,
-        .elevation = 430,
-    },
-    {
-        .code = "LF8361",
-        .name = "Golfe de Saint Tropez",
-        .latitude = 43.2727777777778,
-        .longitude = 6.60888888888889,
-        .elevation = 0,
-    },
-    {
-        .code = "LF8362",
-        .name = "Liberty Duck",
-        .latitude = 43.4675,
-        .longitude = 6.74027777777778,
-        .elevation = 66,
-    },
-    {
-        .code = "LF8363",
-        .name = "La LIMATE",
-        .latitude = 43.2588888888889,
-        .longitude = 5.88277777777778,
-        .elevation = 2250,
-    },
-    {
-        .code = "LF8364",
-        .name = "Flayosc",
-        .latitude = 43.5372222222222,
-        .longitude = 6.31888888888889,
-        .elevation = 1200,
-    },
-    {
-        .code = "LF8421",
-        .name = "Saint Martin de Castillon",
-        .latitude = 43.8530555555556,
-        .longitude = 5.55027777777778,
-        .elevation = 1082,
-    },
-    {
-        .code = "LF8424",
-        .name = "Coustellet",
-        .latitude = 43.8691666666667,
-        .longitude = 5.15805555555556,
-        .elevation = 361,
-    },
-    {
-        .code = "LF8425",
-        .name = "Puget sur Durance",
-        .latitude = 43.7475,
-        .longitude = 5.27527777777778,
-        .elevation = 436,
-    },
-    {
-        .code = "LF8451",
-        .name = "Orange Plan de Dieu",
-        .latitude = 44.1816666666667,
-        .longitude = 4.92472222222222,
-        .elevation = 312,
-    },
-    {
-        .code = "LF8521",
-        .name = "Talmont Vendee Air Park",
-        .latitude = 46.4936111111111,
-        .longitude = -1.57638888888889,
-        .elevation = 150,
-    },
-    {
-        .code = "LF8522",
-        .name = "La Tranche sur Mer",
-        .latitude = 46.3636111111111,
-        .longitude = -1.42722222222222,
-        .elevation = 16,
-    },
-    {
-        .code = "LF8523",
-        .name = "Atlantic Air Park",
-        .latitude = 46.4619444444444,
-        .longitude = -1.24027777777778,
-        .elevation = 20,
-    },
-    {
-        .code = "LF8524",
-        .name = "Le Girouard",
-        .latitude = 46.5783333333333,
-        .longitude = -1.60666666666667,
-        .elevation = 150,
-    },
-    {
-        .code = "LF8528",
-        .name = "Lucon",
-        .latitude = 46.4247222222222,
-        .longitude = -1.19333333333333,
-        .elevation = 11,
-    },
-    {
-        .code = "LF8529",
-        .name = "Saint Laurent sur Sevre",
-        .latitude = 46.9380555555556,
-        .longitude = -0.915555555555556,
-        .elevation = 643,
-    },
-    {
-        .code = "LF8551",
-        .name = "Breuil Barret",
-        .latitude = 46.6605555555556,
-        .longitude = -0.663611111111111,
-        .elevation = 680,
-    },
-    {
-        .code = "LF8562",
-        .name = "St Philbert de Bouaine",
-        .latitude = 47.0211111111111,
-        .longitude = -1.49222222222222,
-        .elevation = 82,
-    },
-    {
-        .code = "LF8563",
-        .name = "Coex La Boissiere",
-        .latitude = 46.7236111111111,
-        .longitude = -1.75777777777778,
-        .elevation = 115,
-    },
-    {
-        .code = "LF8566",
-        .name = "Mouchamps",
-        .latitude = 46.8086111111111,
-        .longitude = -1.03055555555556,
-        .elevation = 330,
-    },
-    {
-        .code = "LF8567",
-        .name = "la brossette ",
-        .latitude = 46.8283333333333,
-        .longitude = -1.30555555555556,
-        .elevation = 250,
-    },
-    {
-        .code = "LF8568",
-        .name = "Les Fontenelles",
-        .latitude = 46.4452777777778,
-        .longitude = -1.44083333333333,
-        .elevation = 62,
-    },
-    {
-        .code = "LF8569",
-        .name = "Les Guifettes",
-        .latitude = 46.425,
-        .longitude = -1.18833333333333,
-        .elevation = 0,
-    },
-    {
-        .code = "LF8570",
-        .name = "Les Ailes de la Moriere",
-        .latitude = 46.6266666666667,
-        .longitude = -1.74388888888889,
-        .elevation = 164,
-    },
-    {
-        .code = "LF8571",
-        .name = "Saint Aubin la Plaine",
-        .latitude = 46.5186111111111,
-        .longitude = -1.05472222222222,
-        .elevation = 154,
-    },
-    {
-        .code = "LF8572",
-        .name = "Saint Martin des Fontaines",
-        .latitude = 46.5536111111111,
-        .longitude = -0.900555555555556,
-        .elevation = 200,
-    },
-    {
-        .code = "LF8573",
-        .name = "Coutigny- Serigne 85",
-        .latitude = 46.4894444444444,
-        .longitude = -0.870833333333333,
-        .elevation = 30,
-    },
-    {
-        .code = "LF8621",
-        .name = "Le Fort d'Aslonnes",
-        .latitude = 46.4377777777778,
-        .longitude = 0.341666666666667,
-        .elevation = 430,
-    },
-    {
-        .code = "LF8622",
-        .name = "Buxeuil Saint Remy sur Creuse",
-        .latitude = 46.95,
-        .longitude = 0.668611111111111,
-        .elevation = 370,
-    },
-    {
-        .code = "LF8623",
-        .name = "Genouille",
-        .latitude = 46.108056,
-        .longitude = 0.358056,
-        .elevation = 0,
-    },
-    {
-        .code = "LF8626",
-        .name = "St Secondin",
-        .latitude = 46.3466666666667,
-        .longitude = 0.518055555555556,
-        .elevation = 443,
-    },
-    {
-        .code = "LF8627",
-        .name = "Archigny Chenevelles",
-        .latitude = 46.6955555555556,
-        .longitude = 0.655555555555556,
-        .elevation = 446,
-    },
-    {
-        .code = "LF8651",
-        .name = "Montmorillon",
-        .latitude = 46.3908333333333,
-        .longitude = 0.948333333333333,
-        .elevation = 540,
-    },
-    {
-        .code = "LF8652",
-        .name = "Pouancay",
-        .latitude = 47.0961111111111,
-        .longitude = -0.0725,
-        .elevation = 133,
-    },
-    {
-        .code = "LF8653",
-        .name = "Availles Limouzine",
-        .latitude = 46.1286111111111,
-        .longitude = 0.695277777777778,
-        .elevation = 712,
-    },
-    {
-        .code = "LF8654",
-        .name = "Brigueil le Chantre",
-        .latitude = 46.3669444444444,
-        .longitude = 1.08083333333333,
-        .elevation = 623,
-    },
-    {
-        .code = "LF8655",
-        .name = "Poue",
-        .latitude = 46.7830555555556,
-        .longitude = 0.115277777777778,
-        .elevation = 361,
-    },
-    {
-        .code = "LF8723",
-        .name = "Les Salles",
-        .latitude = 45.7419444444444,
-        .longitude = 0.669722222222222,
-        .elevation = 900,
-    },
-    {
-        .code = "LF8726",
-        .name = "Bellac",
-        .latitude = 46.1302777777778,
-        .longitude = 1.07805555555556,
-        .elevation = 820,
-    },
-    {
-        .code = "LF8752",
-        .name = "Libarderie Blond",
-        .latitude = 46.0597222222222,
-        .longitude = 0.985833333333333,
-        .elevation = 918,
-    },
-    {
-        .code = "LF8753",
-        .name = "Gajoubert",
-        .latitude = 46.1222222222222,
-        .longitude = 0.858055555555556,
-        .elevation = 777,
-    },
-    {
-        .code = "LF8754",
-        .name = "La Geneytouse",
-        .latitude = 45.7838888888889,
-        .longitude = 1.46138888888889,
-        .elevation = 1350,
-    },
-    {
-        .code = "LF8755",
-        .name = "Azat le Ris",
-        .latitude = 46.3319444444444,
-        .longitude = 1.03444444444444,
-        .elevation = 657,
-    },
-    {
-        .code = "LF8756",
-        .name = "L'Age",
-        .latitude = 45.6027777777778,
-        .longitude = 1.51527777777778,
-        .elevation = 1411,
-    },
-    {
-        .code = "LF8757",
-        .name = "Bataillou",
-        .latitude = 45.7688888888889,
-        .longitude = 0.781111111111111,
-        .elevation = 961,
-    },
-    {
-        .code = "LF8758",
-        .name = "Berneuil",
-        .latitude = 46.0516666666667,
-        .longitude = 1.10166666666667,
-        .elevation = 975,
-    },
-    {
-        .code = "LF8759",
-        .name = "Saint Hilaire",
-        .latitude = 46.2547222222222,
-        .longitude = 1.3425,
-        .elevation = 919,
-    },
-    {
-        .code = "LF8821",
-        .name = "La Tete des Champs",
-        .latitude = 47.9166666666667,
-        .longitude = 6.83055555555556,
-        .elevation = 3182,
-    },
-    {
-        .code = "LF8851",
-        .name = "Ramonchamp",
-        .latitude = 47.8955555555556,
-        .longitude = 6.75472222222222,
-        .elevation = 1893,
-    },
-    {
-        .code = "LF8852",
-        .name = "Dropt",
-        .latitude = 47.9591666666667,
-        .longitude = 6.54222222222222,
-        .elevation = 2040,
-    },
-    {
-        .code = "LF8854",
-        .name = "Chateau d'eau",
-        .latitude = 48.1077777777778,
-        .longitude = 5.83416666666667,
-        .elevation = 1312,
-    },
-    {
-        .code = "LF8922",
-        .name = "Courgenay",
-        .latitude = 48.3147222222222,
-        .longitude = 3.55972222222222,
-        .elevation = 581,
-    },
-    {
-        .code = "LF8928",
-        .name = "Perreux",
-        .latitude = 47.875,
-        .longitude = 3.13555555555556,
-        .elevation = 610,
-    },
-    {
-        .code = "LF8929",
-        .name = "Treigny",
-        .latitude = 47.5508333333333,
-        .longitude = 3.19694444444444,
-        .elevation = 918,
-    },
-    {
-        .code = "LF8951",
-        .name = "Cravant Vincelles",
-        .latitude = 47.6905555555556,
-        .longitude = 3.66333333333333,
-        .elevation = 360,
-    },
-    {
-        .code = "LF8952",
-        .name = "Vaufoin",
-        .latitude = 48.1063888888889,
-        .longitude = 3.35666666666667,
-        .elevation = 590,
-    },
-    {
-        .code = "LF8953",
-        .name = "Egriselles-le-Bocage",
-        .latitude = 48.1169444444444,
-        .longitude = 3.16861111111111,
-        .elevation = 643,
-    },
-    {
-        .code = "LF8954",
-        .name = "Voisines",
-        .latitude = 48.2883333333333,
-        .longitude = 3.41305555555556,
-        .elevation = 660,
-    },
-    {
-        .code = "LF8955",
-        .name = "Saint Fargeau",
-        .latitude = 47.6219444444444,
-        .longitude = 3.10638888888889,
-        .elevation = 665,
-    },
-    {
-        .code = "LF8957",
-        .name = "Saint Martin des Champs",
-        .latitude = 47.6652777777778,
-        .longitude = 3.04416666666667,
-        .elevation = 665,
-    },
-    {
-        .code = "LF8959",
-        .name = "L'Aubepine",
-        .latitude = 47.6938888888889,
-        .longitude = 3.94444444444444,
-        .elevation = 850,
-    },
-    {
-        .code = "LF9151",
-        .name = "Genevrelle a Maisse",
-        .latitude = 48.3883333333333,
-        .longitude = 2.34916666666667,
-        .elevation = 420,
-    },
-    {
-        .code = "LF9152",
-        .name = "Boigny Mereville",
-        .latitude = 48.3294444444444,
-        .longitude = 2.08861111111111,
-        .elevation = 436,
-    },
-    {
-        .code = "LF9154",
-        .name = "le fond du lary blanc",
-        .latitude = 48.3522222222222,
-        .longitude = 2.35,
-        .elevation = 367,
-    },
-    {
-        .code = "LF9551",
-        .name = "Avernes",
-        .latitude = 49.1058333333333,
-        .longitude = 1.87888888888889,
-        .elevation = 456,
-    },
-    {
-        .code = "LFA010",
-        .name = "Clamensane",
-        .latitude = 44.3138888888889,
-        .longitude = 6.07444444444444,
-        .elevation = 2933,
-    },
-    {
-        .code = "LFA011",
-        .name = "Claveisolles",
-        .latitude = 46.0780555555556,
-        .longitude = 4.54722222222222,
-        .elevation = 2461,
-    },
-    {
-        .code = "LFA019",
-        .name = "Col Saint Jean",
-        .latitude = 44.4138888888889,
-        .longitude = 6.37305555555556,
-        .elevation = 6201,
-    },
-    {
-        .code = "LFA035",
-        .name = "Glacier Du Tour",
-        .latitude = 45.9833333333333,
-        .longitude = 7.0,
-        .elevation = 10170,
-    },
-    {
-        .code = "LFA037",
-        .name = "Hautacam",
-        .latitude = 42.9938888888889,
-        .longitude = -0.0291666666666667,
-        .elevation = 5512,
-    },
-    {
-        .code = "LFA042",
-        .name = "L'escoulin",
-        .latitude = 44.825,
-        .longitude = 5.23333333333333,
-        .elevation = 2165,
-    },
-    {
-        .code = "LFA049",
-        .name = "La Taillade",
-        .latitude = 44.8916666666667,
-        .longitude = 2.95694444444444,
-        .elevation = 2913,
-    },
-    {
-        .code = "LFA077",
-        .name = "Serre Mottaire",
-        .latitude = 44.7122222222222,
-        .longitude = 5.69166666666667,
-        .elevation = 5000,
-    },
-    {
-        .code = "LFA078",
-        .name = "Mont Gerbier De Jonc",
-        .latitude = 44.8419444444444,
-        .longitude = 4.195,
-        .elevation = 4460,
-    },
-    {
-        .code = "LFA082",
-        .name = "Tignes Le Palet",
-        .latitude = 45.4541666666667,
-        .longitude = 6.84861111111111,
-        .elevation = 8000,
-    },
-    {
-        .code = "LFAB",
-        .name = "Dieppe Saint Aubin",
-        .latitude = 49.8826333333333,
-        .longitude = 1.08533055555556,
-        .elevation = 344,
-    },
-    {
-        .code = "LFAC",
-        .name = "Calais Dunkerque",
-        .latitude = 50.9609333333333,
-        .longitude = 1.95143333333333,
-        .elevation = 12,
-    },
-    {
-        .code = "LFAD",
-        .name = "Compiegne Margny",
-        .latitude = 49.4336111111111,
-        .longitude = 2.80472222222222,
-        .elevation = 316,
-    },
-    {
-        .code = "LFAE",
-        .name = "Eu Mers Le Treport",
-        .latitude = 50.0691666666667,
-        .longitude = 1.42666666666667,
-        .elevation = 328,
-    },
-    {
-        .code = "LFAF",
-        .name = "Laon Chambry",
-        .latitude = 49.5947222222222,
-        .longitude = 3.63027777777778,
-        .elevation = 258,
-    },
-    {
-        .code = "LFAG",
-        .name = "Peronne Saint Quentin",
-        .latitude = 49.8688611111111,
-        .longitude = 3.0296,
-        .elevation = 295,
-    },
-    {
-        .code = "LFAI",
-        .name = "Nangis Les Loges",
-        .latitude = 48.5969444444444,
-        .longitude = 3.00805555555556,
-        .elevation = 428,
-    },
-    {
-        .code = "LFAJ",
-        .name = "Argentan",
-        .latitude = 48.7094444444445,
-        .longitude = 0.00277777777777778,
-        .elevation = 581,
-    },
-    {
-        .code = "LFAK",
-        .name = "Dunkerque Les Moeres",
-        .latitude = 51.0405555555556,
-        .longitude = 2.55027777777778,
-        .elevation = -3,
-    },
-    {
-        .code = "LFAL",
-        .name = "La Fleche Thoree Les Pins",
-        .latitude = 47.6927777777778,
-        .longitude = -0.00194444444444444,
-        .elevation = 120,
-    },
-    {
-        .code = "LFAM",
-        .name = "Berck Sur Mer",
-        .latitude = 50.4230555555555,
-        .longitude = 1.59194444444444,
-        .elevation = 32,
-    },
-    {
-        .code = "LFAO",
-        .name = "Bagnoles De L'orne Couterne",
-        .latitude = 48.5447222222222,
-        .longitude = -0.385,
-        .elevation = 714,
-    },
-    {
-        .code = "LFAP",
-        .name = "Rethel Perthes",
-        .latitude = 49.4811111111111,
-        .longitude = 4.36333333333333,
-        .elevation = 416,
-    },
-    {
-        .code = "LFAQ",
-        .name = "Albert Bray",
-        .latitude = 49.9700611111111,
-        .longitude = 2.69261666666667,
-        .elevation = 363,
-    },
-    {
-        .code = "LFAR",
-        .name = "Montdidier",
-        .latitude = 49.6730555555555,
-        .longitude = 2.56916666666667,
-        .elevation = 358,
-    },
-    {
-        .code = "LFAS",
-        .name = "Falaise Monts D'eraines",
-        .latitude = 48.9269444444444,
-        .longitude = -0.144722222222222,
-        .elevation = 513,
-    },
-    {
-        .code = "LFAT",
-        .name = "Le Touquet Cote D'opale",
-        .latitude = 50.5148472222222,
-        .longitude = 1.62757777777778,
-        .elevation = 21,
-    },
-    {
-        .code = "LFAU",
-        .name = "Vauville",
-        .latitude = 49.6227777777778,
-        .longitude = -1.83,
-        .elevation = 458,
-    },
-    {
-        .code = "LFAV",
-        .name = "Valenciennes Denain",
-        .latitude = 50.3247916666667,
-        .longitude = 3.46544444444444,
-        .elevation = 165,
-    },
-    {
-        .code = "LFAW",
-        .name = "Villerupt",
-        .latitude = 49.4105555555556,
-        .longitude = 5.88916666666667,
-        .elevation = 1303,
-    },
-    {
-        .code = "LFAX",
-        .name = "Mortagne Au Perche",
-        .latitude = 48.5397222222222,
-        .longitude = 0.534166666666667,
-        .elevation = 886,
-    },
-    {
-        .code = "LFAY",
-        .name = "Amiens-Glisy",
-        .latitude = 49.8731027777778,
-        .longitude = 2.38698611111111,
-        .elevation = 208,
-    },
-    {
-        .code = "LFBA",
-        .name = "Agen La Garenne",
-        .latitude = 44.1747138888889,
-        .longitude = 0.590619444444444,
-        .elevation = 204,
-    },
-    {
-        .code = "LFBC",
-        .name = "Cazaux",
-        .latitude = 44.5348861111111,
-        .longitude = -1.13145277777778,
-        .elevation = 85,
-    },
-    {
-        .code = "LFBD",
-        .name = "Bordeaux Merignac",
-        .latitude = 44.8286527777778,
-        .longitude = -0.715344444444444,
-        .elevation = 166,
-    },
-    {
-        .code = "LFBE",
-        .name = "Bergerac Dordogne Perigord",
-        .latitude = 44.8244305555556,
-        .longitude = 0.520525,
-        .elevation = 172,
-    },
-    {
-        .code = "LFBF",
-        .name = "Toulouse Francazal",
-        .latitude = 43.5490611111111,
-        .longitude = 1.35726111111111,
-        .elevation = 535,
-    },
-    {
-        .code = "LFBG",
-        .name = "Cognac Chateaubernard",
-        .latitude = 45.6582305555556,
-        .longitude = -0.317566666666667,
-        .elevation = 103,
-    },
-    {
-        .code = "LFBH",
-        .name = "La Rochelle Ile De Re",
-        .latitude = 46.1792111111111,
-        .longitude = -1.19523611111111,
-        .elevation = 74,
-    },
-    {
-        .code = "LFBI",
-        .name = "Poitiers Biard",
-        .latitude = 46.5873972222222,
-        .longitude = 0.306786111111111,
-        .elevation = 423,
-    },
-    {
-        .code = "LFBJ",
-        .name = "Saint Junien",
-        .latitude = 45.9025,
-        .longitude = 0.918888888888889,
-        .elevation = 903,
-    },
-    {
-        .code = "LFBK",
-        .name = "Montlucon Gueret",
-        .latitude = 46.2260944444444,
-        .longitude = 2.36281666666667,
-        .elevation = 1367,
-    },
-    {
-        .code = "LFBL",
-        .name = "Limoges Bellegarde",
-        .latitude = 45.8607638888889,
-        .longitude = 1.18030555555556,
-        .elevation = 1300,
-    },
-    {
-        .code = "LFBM",
-        .name = "Mont De Marsan",
-        .latitude = 43.9113888888889,
-        .longitude = -0.509444444444444,
-        .elevation = 203,
-    },
-    {
-        .code = "LFBN",
-        .name = "Niort Marais Poitevin",
-        .latitude = 46.3134222222222,
-        .longitude = -0.394433333333333,
-        .elevation = 201,
-    },
-    {
-        .code = "LFBO",
-        .name = "Toulouse Blagnac",
-        .latitude = 43.6351277777778,
-        .longitude = 1.36785555555556,
-        .elevation = 499,
-    },
-    {
-        .code = "LFBP",
-        .name = "Pau Pyrenees",
-        .latitude = 43.3799,
-        .longitude = -0.418511111111111,
-        .elevation = 616,
-    },
-    {
-        .code = "LFBR",
-        .name = "Muret Lherm",
-        .latitude = 43.4491555555555,
-        .longitude = 1.26369444444444,
-        .elevation = 623,
-    },
-    {
-        .code = "LFBS",
-        .name = "Biscarrosse Parentis",
-        .latitude = 44.3680555555556,
-        .longitude = -1.13222222222222,
-        .elevation = 100,
-    },
-    {
-        .code = "LFBT",
-        .name = "Tarbes Lourdes Pyrenees",
-        .latitude = 43.18545,
-        .longitude = -0.00289444444444444,
-        .elevation = 1260,
-    },
-    {
-        .code = "LFBU",
-        .name = "Angouleme Brie Champniers",
-        .latitude = 45.729475,
-        .longitude = 0.219152777777778,
-        .elevation = 436,
-    },
-    {
-        .code = "LFBX",
-        .name = "Perigueux Bassillac",
-        .latitude = 45.1974888888889,
-        .longitude = 0.815216666666667,
-        .elevation = 328,
-    },
-    {
-        .code = "LFBY",
-        .name = "Dax Seyresse",
-        .latitude = 43.6891666666667,
-        .longitude = -1.06888888888889,
-        .elevation = 108,
-    },
-    {
-        .code = "LFBZ",
-        .name = "Biarritz Pays Basque",
-        .latitude = 43.4683083333333,
-        .longitude = -1.53116111111111,
-        .elevation = 245,
-    },
-    {
-        .code = "LFCA",
-        .name = "Chatellerault Targe",
-        .latitude = 46.7802777777778,
-        .longitude = 0.550555555555556,
-        .elevation = 210,
-    },
-    {
-        .code = "LFCB",
-        .name = "Bagneres De Luchon",
-        .latitude = 42.8005555555556,
-        .longitude = 0.601111111111111,
-        .elevation = 2028,
-    },
-    {
-        .code = "LFCC",
-        .name = "Cahors Lalbenque",
-        .latitude = 44.3505416666667,
-        .longitude = 1.47858611111111,
-        .elevation = 912,
-    },
-    {
-        .code = "LFCD",
-        .name = "Andernos Les Bains",
-        .latitude = 44.755,
-        .longitude = -1.065,
-        .elevation = 64,
-    },
-    {
-        .code = "LFCE",
-        .name = "Gueret Saint Laurent",
-        .latitude = 46.1755555555556,
-        .longitude = 1.95305555555556,
-        .elevation = 1208,
-    },
-    {
-        .code = "LFCF",
-        .name = "Figeac Livernon",
-        .latitude = 44.6725,
-        .longitude = 1.78805555555556,
-        .elevation = 1085,
-    },
-    {
-        .code = "LFCG",
-        .name = "Saint Girons Antichan",
-        .latitude = 43.0077777777778,
-        .longitude = 1.10305555555556,
-        .elevation = 1376,
-    },
-    {
-        .code = "LFCH",
-        .name = "Arcachon La Teste De Buch",
-        .latitude = 44.5969444444444,
-        .longitude = -1.11388888888889,
-        .elevation = 52,
-    },
-    {
-        .code = "LFCI",
-        .name = "Albi Le Sequestre",
-        .latitude = 43.9132777777778,
-        .longitude = 2.11675,
-        .elevation = 565,
-    },
-    {
-        .code = "LFCJ",
-        .name = "Jonzac Neulles",
-        .latitude = 45.4830555555556,
-        .longitude = -0.423055555555556,
-        .elevation = 130,
-    },
-    {
-        .code = "LFCK",
-        .name = "Castres Mazamet",
-        .latitude = 43.5549611111111,
-        .longitude = 2.29059166666667,
-        .elevation = 785,
-    },
-    {
-        .code = "LFCL",
-        .name = "Toulouse Lasbordes",
-        .latitude = 43.5877777777778,
-        .longitude = 1.49861111111111,
-        .elevation = 460,
-    },
-    {
-        .code = "LFCM",
-        .name = "Millau Larzac",
-        .latitude = 43.9890583333333,
-        .longitude = 3.18330277777778,
-        .elevation = 2606,
-    },
-    {
-        .code = "LFCN",
-        .name = "Nogaro",
-        .latitude = 43.7688888888889,
-        .longitude = -0.0347222222222222,
-        .elevation = 304,
-    },
-    {
-        .code = "LFCO",
-        .name = "Oloron Herrere",
-        .latitude = 43.1647222222222,
-        .longitude = -0.560277777777778,
-        .elevation = 984,
-    },
-    {
-        .code = "LFCP",
-        .name = "Pons Avy",
-        .latitude = 45.5658333333333,
-        .longitude = -0.513611111111111,
-        .elevation = 117,
-    },
-    {
-        .code = "LFCQ",
-        .name = "Graulhet Montdragon",
-        .latitude = 43.7686111111111,
-        .longitude = 2.00777777777778,
-        .elevation = 583,
-    },
-    {
-        .code = "LFCR",
-        .name = "Rodez Aveyron",
-        .latitude = 44.4074888888889,
-        .longitude = 2.48331388888889,
-        .elevation = 1909,
-    },
-    {
-        .code = "LFCS",
-        .name = "Bordeaux Leognan Saucats",
-        .latitude = 44.6991666666667,
-        .longitude = -0.597222222222222,
-        .elevation = 192,
-    },
-    {
-        .code = "LFCT",
-        .name = "Thouars",
-        .latitude = 46.9619444444444,
-        .longitude = -0.152777777777778,
-        .elevation = 341,
-    },
-    {
-        .code = "LFCU",
-        .name = "Ussel Thalamy",
-        .latitude = 45.5358333333333,
-        .longitude = 2.42472222222222,
-        .elevation = 2427,
-    },
-    {
-        .code = "LFCV",
-        .name = "Villefranche De Rouergue",
-        .latitude = 44.3688888888889,
-        .longitude = 2.02694444444444,
-        .elevation = 1104,
-    },
-    {
-        .code = "LFCW",
-        .name = "Villeneuve Sur Lot",
-        .latitude = 44.3991777777778,
-        .longitude = 0.759533333333333,
-        .elevation = 193,
-    },
-    {
-        .code = "LFCX",
-        .name = "Castelsarrasin Moissac",
-        .latitude = 44.0858333333333,
-        .longitude = 1.12694444444444,
-        .elevation = 243,
-    },
-    {
-        .code = "LFCY",
-        .name = "Royan Medis",
-        .latitude = 45.6311611111111,
-        .longitude = -0.975488888888889,
-        .elevation = 72,
-    },
-    {
-        .code = "LFCZ",
-        .name = "Mimizan",
-        .latitude = 44.1458861111111,
-        .longitude = -1.16480277777778,
-        .elevation = 165,
-    },
-    {
-        .code = "LFDA",
-        .name = "Aire Sur L'adour",
-        .latitude = 43.7086111111111,
-        .longitude = -0.247222222222222,
-        .elevation = 266,
-    },
-    {
-        .code = "LFDB",
-        .name = "Montauban",
-        .latitude = 44.0266666666667,
-        .longitude = 1.37694444444444,
-        .elevation = 353,
-    },
-    {
-        .code = "LFDC",
-        .name = "Montendre Marcillac",
-        .latitude = 45.2736111111111,
-        .longitude = -0.453333333333333,
-        .elevation = 145,
-    },
-    {
-        .code = "LFDE",
-        .name = "Egletons",
-        .latitude = 45.4205555555556,
-        .longitude = 2.06777777777778,
-        .elevation = 1859,
-    },
-    {
-        .code = "LFDF",
-        .name = "Sainte Foy La Grande",
-        .latitude = 44.8525,
-        .longitude = 0.175555555555556,
-        .elevation = 282,
-    },
-    {
-        .code = "LFDG",
-        .name = "Gaillac Lisle Sur Tarn",
-        .latitude = 43.8830555555556,
-        .longitude = 1.87416666666667,
-        .elevation = 441,
-    },
-    {
-        .code = "LFDH",
-        .name = "Auch Gers",
-        .latitude = 43.6868388888889,
-        .longitude = 0.600047222222222,
-        .elevation = 411,
-    },
-    {
-        .code = "LFDI",
-        .name = "Libourne Artigues De Lussac",
-        .latitude = 44.985,
-        .longitude = -0.136111111111111,
-        .elevation = 157,
-    },
-    {
-        .code = "LFDJ",
-        .name = "Pamiers Les Pujols",
-        .latitude = 43.0906833333333,
-        .longitude = 1.69585277777778,
-        .elevation = 1114,
-    },
-    {
-        .code = "LFDK",
-        .name = "Soulac Sur Mer",
-        .latitude = 45.4938888888889,
-        .longitude = -1.08388888888889,
-        .elevation = 11,
-    },
-    {
-        .code = "LFDL",
-        .name = "Loudun",
-        .latitude = 47.0361111111111,
-        .longitude = 0.100833333333333,
-        .elevation = 313,
-    },
-    {
-        .code = "LFDM",
-        .name = "Marmande Virazeil",
-        .latitude = 44.4991666666667,
-        .longitude = 0.200277777777778,
-        .elevation = 110,
-    },
-    {
-        .code = "LFDN",
-        .name = "Rochefort Charente Maritime",
-        .latitude = 45.8895083333333,
-        .longitude = -0.982347222222222,
-        .elevation = 60,
-    },
-    {
-        .code = "LFDP",
-        .name = "Saint Pierre D'oleron",
-        .latitude = 45.9577777777778,
-        .longitude = -1.31138888888889,
-        .elevation = 22,
-    },
-    {
-        .code = "LFDQ",
-        .name = "Castelnau Magnoac",
-        .latitude = 43.2775,
-        .longitude = 0.519444444444444,
-        .elevation = 992,
-    },
-    {
-        .code = "LFDR",
-        .name = "La Reole Floudes",
-        .latitude = 44.5669472222222,
-        .longitude = -0.05725,
-        .elevation = 44,
-    },
-    {
-        .code = "LFDS",
-        .name = "Sarlat Domme",
-        .latitude = 44.7922222222222,
-        .longitude = 1.24361111111111,
-        .elevation = 979,
-    },
-    {
-        .code = "LFDT",
-        .name = "Tarbes Laloubere",
-        .latitude = 43.215,
-        .longitude = 0.0775,
-        .elevation = 1075,
-    },
-    {
-        .code = "LFDU",
-        .name = "Lesparre Saint Laurent Medoc",
-        .latitude = 45.1977777777778,
-        .longitude = -0.882222222222222,
-        .elevation = 105,
-    },
-    {
-        .code = "LFDV",
-        .name = "Couhe Verac",
-        .latitude = 46.2705555555556,
-        .longitude = 0.188333333333333,
-        .elevation = 500,
-    },
-    {
-        .code = "LFDW",
-        .name = "Chauvigny",
-        .latitude = 46.5833333333333,
-        .longitude = 0.642222222222222,
-        .elevation = 442,
-    },
-    {
-        .code = "LFDX",
-        .name = "Fumel Montayral",
-        .latitude = 44.4591666666667,
-        .longitude = 1.00722222222222,
-        .elevation = 692,
-    },
-    {
-        .code = "LFDY",
-        .name = "Bordeaux Yvrac",
-        .latitude = 44.8772222222222,
-        .longitude = -0.479166666666667,
-        .elevation = 240,
-    },
-    {
-        .code = "LFEA",
-        .name = "Belle Ile",
-        .latitude = 47.3261111111111,
-        .longitude = -3.19888888888889,
-        .elevation = 177,
-    },
-    {
-        .code = "LFEB",
-        .name = "Dinan Trelivan",
-        .latitude = 48.4433333333333,
-        .longitude = -2.10333333333333,
-        .elevation = 393,
-    },
-    {
-        .code = "LFEC",
-        .name = "Ouessant",
-        .latitude = 48.4632138888889,
-        .longitude = -5.06358333333333,
-        .elevation = 142,
-    },
-    {
-        .code = "LFED",
-        .name = "Pontivy",
-        .latitude = 48.0569444444444,
-        .longitude = -2.92333333333333,
-        .elevation = 406,
-    },
-    {
-        .code = "LFEF",
-        .name = "Amboise Dierre",
-        .latitude = 47.3405555555556,
-        .longitude = 0.941111111111111,
-        .elevation = 177,
-    },
-    {
-        .code = "LFEG",
-        .name = "Argenton Sur Creuse",
-        .latitude = 46.5958333333333,
-        .longitude = 1.60111111111111,
-        .elevation = 666,
-    },
-    {
-        .code = "LFEH",
-        .name = "Aubigny Sur Nere",
-        .latitude = 47.4805555555556,
-        .longitude = 2.39416666666667,
-        .elevation = 630,
-    },
-    {
-        .code = "LFEI",
-        .name = "Briare Chatillon",
-        .latitude = 47.6145805555556,
-        .longitude = 2.78185,
-        .elevation = 539,
-    },
-    {
-        .code = "LFEJ",
-        .name = "Chateauroux Villers",
-        .latitude = 46.8408333333333,
-        .longitude = 1.62,
-        .elevation = 542,
-    },
-    {
-        .code = "LFEK",
-        .name = "Issoudun Le Fay",
-        .latitude = 46.8886111111111,
-        .longitude = 2.04138888888889,
-        .elevation = 531,
-    },
-    {
-        .code = "LFEL",
-        .name = "Le Blanc",
-        .latitude = 46.62,
-        .longitude = 1.08583333333333,
-        .elevation = 382,
-    },
-    {
-        .code = "LFEM",
-        .name = "Montargis Vimory",
-        .latitude = 47.9605555555556,
-        .longitude = 2.68583333333333,
-        .elevation = 308,
-    },
-    {
-        .code = "LFEN",
-        .name = "Tours Sorigny",
-        .latitude = 47.2666666666667,
-        .longitude = 0.699444444444444,
-        .elevation = 299,
-    },
-    {
-        .code = "LFEP",
-        .name = "Pouilly Maconge",
-        .latitude = 47.2205555555556,
-        .longitude = 4.56027777777778,
-        .elevation = 1413,
-    },
-    {
-        .code = "LFEQ",
-        .name = "Quiberon",
-        .latitude = 47.4813888888889,
-        .longitude = -3.10166666666667,
-        .elevation = 38,
-    },
-    {
-        .code = "LFER",
-        .name = "Redon Bains Sur Oust",
-        .latitude = 47.6986111111111,
-        .longitude = -2.03805555555556,
-        .elevation = 225,
-    },
-    {
-        .code = "LFES",
-        .name = "Guiscriff Scaer",
-        .latitude = 48.0537361111111,
-        .longitude = -3.66403611111111,
-        .elevation = 574,
-    },
-    {
-        .code = "LFET",
-        .name = "Til Chatel",
-        .latitude = 47.5463888888889,
-        .longitude = 5.21083333333333,
-        .elevation = 939,
-    },
-    {
-        .code = "LFEU",
-        .name = "Bar Le Duc Les Hauts De Chee",
-        .latitude = 48.8677777777778,
-        .longitude = 5.18416666666667,
-        .elevation = 899,
-    },
-    {
-        .code = "LFEV",
-        .name = "Gray Saint Adrien",
-        .latitude = 47.4322222222222,
-        .longitude = 5.62138888888889,
-        .elevation = 678,
-    },
-    {
-        .code = "LFEW",
-        .name = "Saulieu Liernais",
-        .latitude = 47.2386111111111,
-        .longitude = 4.26444444444444,
-        .elevation = 1713,
-    },
-    {
-        .code = "LFEX",
-        .name = "Nancy Azelot",
-        .latitude = 48.5919444444444,
-        .longitude = 6.23972222222222,
-        .elevation = 958,
-    },
-    {
-        .code = "LFEY",
-        .name = "Ile D'yeu",
-        .latitude = 46.7175,
-        .longitude = -2.3925,
-        .elevation = 79,
-    },
-    {
-        .code = "LFEZ",
-        .name = "Nancy Malzeville",
-        .latitude = 48.7236111111111,
-        .longitude = 6.20638888888889,
-        .elevation = 1247,
-    },
-    {
-        .code = "LFFB",
-        .name = "Buno Bonnevaux",
-        .latitude = 48.3502777777778,
-        .longitude = 2.42444444444444,
-        .elevation = 419,
-    },
-    {
-        .code = "LFFC",
-        .name = "Mantes Cherence",
-        .latitude = 49.0788888888889,
-        .longitude = 1.68972222222222,
-        .elevation = 512,
-    },
-    {
-        .code = "LFFD",
-        .name = "Saint Andre De L'eure",
-        .latitude = 48.8975,
-        .longitude = 1.25083333333333,
-        .elevation = 491,
-    },
-    {
-        .code = "LFFE",
-        .name = "Enghien Moisselles",
-        .latitude = 49.0455555555556,
-        .longitude = 2.35194444444444,
-        .elevation = 337,
-    },
-    {
-        .code = "LFFG",
-        .name = "La Ferte Gaucher",
-        .latitude = 48.7575,
-        .longitude = 3.27888888888889,
-        .elevation = 536,
-    },
-    {
-        .code = "LFFH",
-        .name = "Chateau Thierry Belleau",
-        .latitude = 49.0666666666667,
-        .longitude = 3.35555555555556,
-        .elevation = 723,
-    },
-    {
-        .code = "LFFI",
-        .name = "Ancenis",
-        .latitude = 47.4072222222222,
-        .longitude = -1.17888888888889,
-        .elevation = 109,
-    },
-    {
-        .code = "LFFJ",
-        .name = "Joinville Mussey",
-        .latitude = 48.3852777777778,
-        .longitude = 5.14333333333333,
-        .elevation = 1030,
-    },
-    {
-        .code = "LFFK",
-        .name = "Fontenay Le Comte",
-        .latitude = 46.4408333333333,
-        .longitude = -0.793888888888889,
-        .elevation = 80,
-    },
-    {
-        .code = "LFFL",
-        .name = "Bailleau Armenonville",
-        .latitude = 48.5147222222222,
-        .longitude = 1.63861111111111,
-        .elevation = 508,
-    },
-    {
-        .code = "LFFN",
-        .name = "Brienne Le Chateau",
-        .latitude = 48.4297222222222,
-        .longitude = 4.48222222222222,
-        .elevation = 376,
-    },
-    {
-        .code = "LFFO",
-        .name = "Beauvoir Fromentine",
-        .latitude = 46.8905555555556,
-        .longitude = -2.08861111111111,
-        .elevation = 10,
-    },
-    {
-        .code = "LFFP",
-        .name = "Pithiviers",
-        .latitude = 48.1563888888889,
-        .longitude = 2.19111111111111,
-        .elevation = 391,
-    },
-    {
-        .code = "LFFQ",
-        .name = "La Ferte Alais",
-        .latitude = 48.4995277777778,
-        .longitude = 2.32996388888889,
-        .elevation = 454,
-    },
-    {
-        .code = "LFFR",
-        .name = "Bar Sur Seine",
-        .latitude = 48.0661111111111,
-        .longitude = 4.4125,
-        .elevation = 938,
-    },
-    {
-        .code = "LFFT",
-        .name = "Neufchateau",
-        .latitude = 48.3616666666667,
-        .longitude = 5.72027777777778,
-        .elevation = 1228,
-    },
-    {
-        .code = "LFFU",
-        .name = "Chateauneuf Sur Cher",
-        .latitude = 46.8711111111111,
-        .longitude = 2.37694444444444,
-        .elevation = 551,
-    },
-    {
-        .code = "LFFV",
-        .name = "Vierzon Mereau",
-        .latitude = 47.1947222222222,
-        .longitude = 2.06666666666667,
-        .elevation = 430,
-    },
-    {
-        .code = "LFFW",
-        .name = "Montaigu Saint Georges",
-        .latitude = 46.9322222222222,
-        .longitude = -1.32722222222222,
-        .elevation = 186,
-    },
-    {
-        .code = "LFFX",
-        .name = "Tournus Cuisery",
-        .latitude = 46.5613888888889,
-        .longitude = 4.97527777777778,
-        .elevation = 689,
-    },
-    {
-        .code = "LFFY",
-        .name = "Etrepagny",
-        .latitude = 49.3052777777778,
-        .longitude = 1.63777777777778,
-        .elevation = 308,
-    },
-    {
-        .code = "LFFZ",
-        .name = "Sezanne Saint Remy",
-        .latitude = 48.7094444444445,
-        .longitude = 3.76277777777778,
-        .elevation = 355,
-    },
-    {
-        .code = "LFGA",
-        .name = "Colmar Houssen",
-        .latitude = 48.11035,
-        .longitude = 7.35914722222222,
-        .elevation = 627,
-    },
-    {
-        .code = "LFGB",
-        .name = "Mulhouse Habsheim",
-        .latitude = 47.7372222222222,
-        .longitude = 7.42972222222222,
-        .elevation = 789,
-    },
-    {
-        .code = "LFGC",
-        .name = "Strasbourg Neuhof",
-        .latitude = 48.5536111111111,
-        .longitude = 7.7775,
-        .elevation = 459,
-    },
-    {
-        .code = "LFGE",
-        .name = "Avallon",
-        .latitude = 47.5019444444444,
-        .longitude = 3.89833333333333,
-        .elevation = 786,
-    },
-    {
-        .code = "LFGF",
-        .name = "Beaune Challanges",
-        .latitude = 47.0102777777778,
-        .longitude = 4.89638888888889,
-        .elevation = 656,
-    },
-    {
-        .code = "LFGG",
-        .name = "Belfort Chaux",
-        .latitude = 47.700975,
-        .longitude = 6.83083333333333,
-        .elevation = 1367,
-    },
-    {
-        .code = "LFGH",
-        .name = "Cosne Sur Loire",
-        .latitude = 47.3602777777778,
-        .longitude = 2.91833333333333,
-        .elevation = 580,
-    },
-    {
-        .code = "LFGI",
-        .name = "Dijon Darois",
-        .latitude = 47.3852777777778,
-        .longitude = 4.94694444444445,
-        .elevation = 1586,
-    },
-    {
-        .code = "LFGJ",
-        .name = "Dole Tavaux",
-        .latitude = 47.0426944444444,
-        .longitude = 5.43492777777778,
-        .elevation = 645,
-    },
-    {
-        .code = "LFGK",
-        .name = "Joigny",
-        .latitude = 47.9944444444444,
-        .longitude = 3.39083333333333,
-        .elevation = 732,
-    },
-    {
-        .code = "LFGL",
-        .name = "Lons Le Saunier Courlaoux",
-        .latitude = 46.675,
-        .longitude = 5.46916666666667,
-        .elevation = 762,
-    },
-    {
-        .code = "LFGM",
-        .name = "Montceau Les Mines Pouilloux",
-        .latitude = 46.6033333333333,
-        .longitude = 4.33277777777778,
-        .elevation = 1032,
-    },
-    {
-        .code = "LFGN",
-        .name = "Paray Le Monial",
-        .latitude = 46.4666666666667,
-        .longitude = 4.13305555555556,
-        .elevation = 1003,
-    },
-    {
-        .code = "LFGO",
-        .name = "Pont Sur Yonne",
-        .latitude = 48.2894444444444,
-        .longitude = 3.24888888888889,
-        .elevation = 232,
-    },
-    {
-        .code = "LFGP",
-        .name = "Saint Florentin Cheu",
-        .latitude = 47.9813888888889,
-        .longitude = 3.77694444444444,
-        .elevation = 355,
-    },
-    {
-        .code = "LFGQ",
-        .name = "Semur En Auxois",
-        .latitude = 47.4811111111111,
-        .longitude = 4.34305555555556,
-        .elevation = 1051,
-    },
-    {
-        .code = "LFGR",
-        .name = "Doncourt Les Conflans",
-        .latitude = 49.1519722222222,
-        .longitude = 5.93127777777778,
-        .elevation = 809,
-    },
-    {
-        .code = "LFGS",
-        .name = "Longuyon Villette",
-        .latitude = 49.4836111111111,
-        .longitude = 5.57194444444444,
-        .elevation = 1153,
-    },
-    {
-        .code = "LFGT",
-        .name = "Sarrebourg Buhl",
-        .latitude = 48.7183333333333,
-        .longitude = 7.08,
-        .elevation = 873,
-    },
-    {
-        .code = "LFGU",
-        .name = "Sarreguemines Neunkirch",
-        .latitude = 49.1275,
-        .longitude = 7.10666666666667,
-        .elevation = 863,
-    },
-    {
-        .code = "LFGW",
-        .name = "Verdun Sommedieue",
-        .latitude = 49.1221805555556,
-        .longitude = 5.47085277777778,
-        .elevation = 1236,
-    },
-    {
-        .code = "LFGX",
-        .name = "Champagnole Crotenay",
-        .latitude = 46.7633333333333,
-        .longitude = 5.81972222222222,
-        .elevation = 1745,
-    },
-    {
-        .code = "LFGY",
-        .name = "Saint Die Remomeix",
-        .latitude = 48.2663888888889,
-        .longitude = 7.0075,
-        .elevation = 1187,
-    },
-    {
-        .code = "LFGZ",
-        .name = "Nuits Saint Georges",
-        .latitude = 47.1422222222222,
-        .longitude = 4.96833333333333,
-        .elevation = 794,
-    },
-    {
-        .code = "LFH1",
-        .name = "Abbeville Centre Hospitalier",
-        .latitude = 50.1015388888889,
-        .longitude = 1.83131388888889,
-        .elevation = 82,
-    },
-    {
-        .code = "LFH10",
-        .name = "Angouleme Centre Hospitalier",
-        .latitude = 45.6341666666667,
-        .longitude = 0.117777777777778,
-        .elevation = 154,
-    },
-    {
-        .code = "LFH101",
-        .name = "Granville Centre Hospitalier J. Monod",
-        .latitude = 48.8269444444445,
-        .longitude = -1.56944444444444,
-        .elevation = 161,
-    },
-    {
-        .code = "LFH102",
-        .name = "Grenoble Hopital Nord",
-        .latitude = 45.2009361111111,
-        .longitude = 5.74527777777778,
-        .elevation = 716,
-    },
-    {
-        .code = "LFH103",
-        .name = "Grimaud Sarl R.C.E.",
-        .latitude = 43.2678055555556,
-        .longitude = 6.551925,
-        .elevation = 21,
-    },
-    {
-        .code = "LFH104",
-        .name = "Guyancourt Les Sangliers",
-        .latitude = 48.7833333333333,
-        .longitude = 2.07666666666667,
-        .elevation = 518,
-    },
-    {
-        .code = "LFH108",
-        .name = "Ile D'yeu Port Joinville",
-        .latitude = 46.7333333333333,
-        .longitude = -2.35,
-        .elevation = 10,
-    },
-    {
-        .code = "LFH11",
-        .name = "Carcassonne Montredon Centre Hospitalier",
-        .latitude = 43.2197222222222,
-        .longitude = 2.39444444444444,
-        .elevation = 352,
-    },
-    {
-        .code = "LFH110",
-        .name = "Istres S.E.P.",
-        .latitude = 43.5438888888889,
-        .longitude = 4.95194444444444,
-        .elevation = 72,
-    },
-    {
-        .code = "LFH116",
-        .name = "Lacanau Le Huga",
-        .latitude = 45.0069444444444,
-        .longitude = -1.16472222222222,
-        .elevation = 52,
-    },
-    {
-        .code = "LFH117",
-        .name = "La Roche Sur Yon Centre Hospitalier",
-        .latitude = 46.6680555555556,
-        .longitude = -1.41222222222222,
-        .elevation = 343,
-    },
-    {
-        .code = "LFH118",
-        .name = "Lannion Centre Hospitalier",
-        .latitude = 48.7227777777778,
-        .longitude = -3.46527777777778,
-        .elevation = 92,
-    },
-    {
-        .code = "LFH119",
-        .name = "Laon Centre Hospitalier",
-        .latitude = 49.5633333333333,
-        .longitude = 3.61166666666667,
-        .elevation = 607,
-    },
-    {
-        .code = "LFH12",
-        .name = "Annecy Centre Hospitalier",
-        .latitude = 45.9313888888889,
-        .longitude = 6.11833333333333,
-        .elevation = 1512,
-    },
-    {
-        .code = "LFH120",
-        .name = "Le Creusot Centre Hospitalier Hotel Dieu",
-        .latitude = 46.805,
-        .longitude = 4.44902222222222,
-        .elevation = 1180,
-    },
-    {
-        .code = "LFH123",
-        .name = "Lille Centre Hospitalier Regional",
-        .latitude = 50.6041666666667,
-        .longitude = 3.035,
-        .elevation = 110,
-    },
-    {
-        .code = "LFH124",
-        .name = "Limoges Centre Hospitalier",
-        .latitude = 45.8138638888889,
-        .longitude = 1.23781111111111,
-        .elevation = 899,
-    },
-    {
-        .code = "LFH127",
-        .name = "Saran Pole Sante Oreliance",
-        .latitude = 47.9383333333333,
-        .longitude = 1.87861111111111,
-        .elevation = 394,
-    },
-    {
-        .code = "LFH128",
-        .name = "Lyon Hopital Edouard Herriot",
-        .latitude = 45.7438888888889,
-        .longitude = 4.88305555555556,
-        .elevation = 658,
-    },
-    {
-        .code = "LFH129",
-        .name = "Lyon La Sauvegarde",
-        .latitude = 45.7888888888889,
-        .longitude = 4.78694444444444,
-        .elevation = 906,
-    },
-    {
-        .code = "LFH13",
-        .name = "Annonay Centre Hospitalier",
-        .latitude = 45.2417083333333,
-        .longitude = 4.66584444444444,
-        .elevation = 1364,
-    },
-    {
-        .code = "LFH133",
-        .name = "Mantes La Jolie Centre Hospitalier Francois Quesnay",
-        .latitude = 48.9990333333333,
-        .longitude = 1.67494166666667,
-        .elevation = 92,
-    },
-    {
-        .code = "LFH135",
-        .name = "Margaux Relais De Margaux",
-        .latitude = 45.0566666666667,
-        .longitude = -0.6575,
-        .elevation = 10,
-    },
-    {
-        .code = "LFH136",
-        .name = "Marseille Hopital Nord",
-        .latitude = 43.38,
-        .longitude = 5.36305555555556,
-        .elevation = 643,
-    },
-    {
-        .code = "LFH137",
-        .name = "Marseille Hopital De La Timone",
-        .latitude = 43.2897222222222,
-        .longitude = 5.4025,
-        .elevation = 205,
-    },
-    {
-        .code = "LFH138",
-        .name = "Martigues Centre De Secours",
-        .latitude = 43.422575,
-        .longitude = 5.04808888888889,
-        .elevation = 136,
-    },
-    {
-        .code = "LFH14",
-        .name = "Antibes Port Vauban",
-        .latitude = 43.5881944444444,
-        .longitude = 7.13234166666667,
-        .elevation = 22,
-    },
-    {
-        .code = "LFH143",
-        .name = "Mont De Lans Les Deux Alpes",
-        .latitude = 45.0102777777778,
-        .longitude = 6.14408333333333,
-        .elevation = 7152,
-    },
-    {
-        .code = "LFH144",
-        .name = "Mont De Marsan Centre Hospitalier",
-        .latitude = 43.8933333333333,
-        .longitude = -0.486111111111111,
-        .elevation = 197,
-    },
-    {
-        .code = "LFH146",
-        .name = "Montpellier Le Corum",
-        .latitude = 43.6135361111111,
-        .longitude = 3.88219722222222,
-        .elevation = 176,
-    },
-    {
-        .code = "LFH148",
-        .name = "Moutiers Centre Hospitalier",
-        .latitude = 45.4836111111111,
-        .longitude = 6.53555555555556,
-        .elevation = 1621,
-    },
-    {
-        .code = "LFH15",
-        .name = "Archamps Technopole",
-        .latitude = 46.1389722222222,
-        .longitude = 6.12533333333333,
-        .elevation = 1627,
-    },
-    {
-        .code = "LFH153",
-        .name = "Nice Hopital L'archet 2",
-        .latitude = 43.6973972222222,
-        .longitude = 7.22613333333333,
-        .elevation = 608,
-    },
-    {
-        .code = "LFH154",
-        .name = "Niort Centre Hospitalier",
-        .latitude = 46.3161111111111,
-        .longitude = -0.458333333333333,
-        .elevation = 108,
-    },
-    {
-        .code = "LFH157",
-        .name = "Paluel Centrale Nucleaire",
-        .latitude = 49.8583333333333,
-        .longitude = 0.627777777777778,
-        .elevation = 305,
-    },
-    {
-        .code = "LFH16",
-        .name = "Bourg Saint-Maurice Centre Hospitalier",
-        .latitude = 45.6166666666667,
-        .longitude = 6.765,
-        .elevation = 2838,
-    },
-    {
-        .code = "LFH162",
-        .name = "Pau Centre Hospitalier",
-        .latitude = 43.3280555555556,
-        .longitude = -0.350833333333333,
-        .elevation = 709,
-    },
-    {
-        .code = "LFH163",
-        .name = "Penly Centrale Nucleaire",
-        .latitude = 49.9722222222222,
-        .longitude = 1.21388888888889,
-        .elevation = 322,
-    },
-    {
-        .code = "LFH164",
-        .name = "Perigueux Centre Hospitalier",
-        .latitude = 45.1925,
-        .longitude = 0.732222222222222,
-        .elevation = 502,
-    },
-    {
-        .code = "LFH167",
-        .name = "Poitiers Centre Hospitalier",
-        .latitude = 46.5605555555556,
-        .longitude = 0.382777777777778,
-        .elevation = 400,
-    },
-    {
-        .code = "LFH168",
-        .name = "Pontarlier Centre Hospitalier",
-        .latitude = 46.9006722222222,
-        .longitude = 6.35970277777778,
-        .elevation = 2779,
-    },
-    {
-        .code = "LFH172",
-        .name = "Quimper Cornouailles",
-        .latitude = 47.9852777777778,
-        .longitude = -4.09583333333333,
-        .elevation = 182,
-    },
-    {
-        .code = "LFH173",
-        .name = "Rang Du Fliers Centre Hospitalier",
-        .latitude = 50.4145444444444,
-        .longitude = 1.66300555555556,
-        .elevation = 152,
-    },
-    {
-        .code = "LFH174",
-        .name = "Reims Centre Hospitalier Regional",
-        .latitude = 49.2257777777778,
-        .longitude = 4.01851111111111,
-        .elevation = 339,
-    },
-    {
-        .code = "LFH177",
-        .name = "Renneville",
-        .latitude = 43.3738888888889,
-        .longitude = 1.72555555555556,
-        .elevation = 623,
-    },
-    {
-        .code = "LFH178",
-        .name = "Romans Centre Hospitalier",
-        .latitude = 45.0420277777778,
-        .longitude = 5.02186388888889,
-        .elevation = 526,
-    },
-    {
-        .code = "LFH179",
-        .name = "Rouen Centre Hospitalier",
-        .latitude = 49.4404333333333,
-        .longitude = 1.11119722222222,
-        .elevation = 144,
-    },
-    {
-        .code = "LFH18",
-        .name = "Aubenas Centre Hospitalier",
-        .latitude = 44.6140583333333,
-        .longitude = 4.39750555555556,
-        .elevation = 731,
-    },
-    {
-        .code = "LFH181",
-        .name = "Saint Avold Centre Hospitalier",
-        .latitude = 49.1121222222222,
-        .longitude = 6.72178055555556,
-        .elevation = 853,
-    },
-    {
-        .code = "LFH182",
-        .name = "Saint Brieuc Centre Hospitalier",
-        .latitude = 48.4908333333333,
-        .longitude = -2.75111111111111,
-        .elevation = 354,
-    },
-    {
-        .code = "LFH183",
-        .name = "Saint Chamond Centre Hospitalier",
-        .latitude = 45.4760611111111,
-        .longitude = 4.51563333333333,
-        .elevation = 1249,
-    },
-    {
-        .code = "LFH184",
-        .name = "Saint Dizier Centre Hospitalier",
-        .latitude = 48.6549527777778,
-        .longitude = 4.96495,
-        .elevation = 528,
-    },
-    {
-        .code = "LFH19",
-        .name = "Avignon Centre Hospitalier",
-        .latitude = 43.9202666666667,
-        .longitude = 4.79897222222222,
-        .elevation = 69,
-    },
-    {
-        .code = "LFH190",
-        .name = "Saint Lo Hopital",
-        .latitude = 49.1052777777778,
-        .longitude = -1.10611111111111,
-        .elevation = 131,
-    },
-    {
-        .code = "LFH192",
-        .name = "Saint Malo Centre Hospitalier",
-        .latitude = 48.6388888888889,
-        .longitude = -2.00833333333333,
-        .elevation = 26,
-    },
-    {
-        .code = "LFH195",
-        .name = "Saint Nazaire Centre Hospitalier",
-        .latitude = 47.2672222222222,
-        .longitude = -2.25638888888889,
-        .elevation = 169,
-    },
-    {
-        .code = "LFH2",
-        .name = "Apt Centre Hospitalier",
-        .latitude = 43.8758333333333,
-        .longitude = 5.38194444444444,
-        .elevation = 869,
-    },
-    {
-        .code = "LFH20",
-        .name = "Avranches Centre Hospitalier",
-        .latitude = 48.6947222222222,
-        .longitude = -1.35111111111111,
-        .elevation = 26,
-    },
-    {
-        .code = "LFH201",
-        .name = "Saintes Centre Hospitalier",
-        .latitude = 45.7477777777778,
-        .longitude = -0.655,
-        .elevation = 135,
-    },
-    {
-        .code = "LFH202",
-        .name = "Sallanches Centre Hospitalier",
-        .latitude = 45.9355555555556,
-        .longitude = 6.64194444444444,
-        .elevation = 1812,
-    },
-    {
-        .code = "LFH208",
-        .name = "Strasbourg Hautepierre",
-        .latitude = 48.5933333333333,
-        .longitude = 7.705,
-        .elevation = 487,
-    },
-    {
-        .code = "LFH21",
-        .name = "Ayros-Arbouix",
-        .latitude = 43.0027777777778,
-        .longitude = -0.0833333333333333,
-        .elevation = 1312,
-    },
-    {
-        .code = "LFH218",
-        .name = "Val D'isere La Daille",
-        .latitude = 45.4572277777778,
-        .longitude = 6.96773611111111,
-        .elevation = 5912,
-    },
-    {
-        .code = "LFH219",
-        .name = "Val D'isere Tete De Solaise",
-        .latitude = 45.4327777777778,
-        .longitude = 6.99166666666667,
-        .elevation = 8366,
-    },
-    {
-        .code = "LFH22",
-        .name = "Bayonne Centre Hospitalier De La Cote Basque",
-        .latitude = 43.4825,
-        .longitude = -1.47972222222222,
-        .elevation = 150,
-    },
-    {
-        .code = "LFH221",
-        .name = "Valence Centre Hospitalier",
-        .latitude = 44.9144722222222,
-        .longitude = 4.9042,
-        .elevation = 486,
-    },
-    {
-        .code = "LFH222",
-        .name = "Vannes - Centre Hospitalier Bretagne Atlantique.",
-        .latitude = 47.6638888888889,
-        .longitude = -2.74722222222222,
-        .elevation = 33,
-    },
-    {
-        .code = "LFH223",
-        .name = "Varces Quartier Reynies",
-        .latitude = 45.1,
-        .longitude = 5.68333333333333,
-        .elevation = 722,
-    },
-    {
-        .code = "LFH226",
-        .name = "Villefranche Hopital Nord Ouest",
-        .latitude = 46.0055361111111,
-        .longitude = 4.69318888888889,
-        .elevation = 765,
-    },
-    {
-        .code = "LFH229",
-        .name = "Vonnas Hotel Georges Blanc",
-        .latitude = 46.2208333333333,
-        .longitude = 4.98888888888889,
-        .elevation = 653,
-    },
-    {
-        .code = "LFH231",
-        .name = "Nancy Hopital Central",
-        .latitude = 48.6853944444444,
-        .longitude = 6.192475,
-        .elevation = 749,
-    },
-    {
-        .code = "LFH233",
-        .name = "Amilly Centre Hospitalier",
-        .latitude = 47.9967194444444,
-        .longitude = 2.774425,
-        .elevation = 353,
-    },
-    {
-        .code = "LFH236",
-        .name = "Aix En Provence Centre Hospitalier",
-        .latitude = 43.5347166666667,
-        .longitude = 5.44223611111111,
-        .elevation = 721,
-    },
-    {
-        .code = "LFH237",
-        .name = "Dreux Centre Hospitalier",
-        .latitude = 48.727475,
-        .longitude = 1.38468611111111,
-        .elevation = 451,
-    },
-    {
-        .code = "LFH238",
-        .name = "Chatillon Sur Seine Centre Hospitalier",
-        .latitude = 47.8616666666667,
-        .longitude = 4.55888888888889,
-        .elevation = 792,
-    },
-    {
-        .code = "LFH24",
-        .name = "Berck Sur Mer Centre Hospitalier Helio-Marin",
-        .latitude = 50.4184611111111,
-        .longitude = 1.56428333333333,
-        .elevation = 42,
-    },
-    {
-        .code = "LFH240",
-        .name = "Aulnay Sous Bois Centre Hospitalier",
-        .latitude = 48.9544444444444,
-        .longitude = 2.52111111111111,
-        .elevation = 190,
-    },
-    {
-        .code = "LFH241",
-        .name = "Poissy Centre Hospitalier.",
-        .latitude = 48.9169444444444,
-        .longitude = 2.02333333333333,
-        .elevation = 233,
-    },
-    {
-        .code = "LFH244",
-        .name = "Saumur Centre Hospitalier",
-        .latitude = 47.2455555555556,
-        .longitude = -0.0594444444444444,
-        .elevation = 272,
-    },
-    {
-        .code = "LFH25",
-        .name = "Epinal Emile Durkheim Centre Hospitalier",
-        .latitude = 48.1811111111111,
-        .longitude = 6.45444444444444,
-        .elevation = 1295,
-    },
-    {
-        .code = "LFH250",
-        .name = "Sandouville Usine Renault",
-        .latitude = 49.4767777777778,
-        .longitude = 0.302594444444444,
-        .elevation = 17,
-    },
-    {
-        .code = "LFH251",
-        .name = "Saint Ouen L'aumone Heliport (Heli Industries)",
-        .latitude = 49.0577666666667,
-        .longitude = 2.14483611111111,
-        .elevation = 135,
-    },
-    {
-        .code = "LFH252",
-        .name = "Chateauroux Centre Hospitalier",
-        .latitude = 46.7994444444444,
-        .longitude = 1.6975,
-        .elevation = 558,
-    },
-    {
-        .code = "LFH253",
-        .name = "Toulouse Rangueil Pech David",
-        .latitude = 43.5612583333333,
-        .longitude = 1.44863055555556,
-        .elevation = 793,
-    },
-    {
-        .code = "LFH255",
-        .name = "Angers Centre Hospitalier",
-        .latitude = 47.4861111111111,
-        .longitude = -0.554166666666667,
-        .elevation = 138,
-    },
-    {
-        .code = "LFH257",
-        .name = "Boulogne Sur Mer Centre Hospitalier",
-        .latitude = 50.7229472222222,
-        .longitude = 1.62887777777778,
-        .elevation = 279,
-    },
-    {
-        .code = "LFH258",
-        .name = "Chartres Centre Hospitalier",
-        .latitude = 48.42,
-        .longitude = 1.50472222222222,
-        .elevation = 488,
-    },
-    {
-        .code = "LFH26",
-        .name = "Douai Centre Hospitalier",
-        .latitude = 50.3372777777778,
-        .longitude = 3.10125,
-        .elevation = 144,
-    },
-    {
-        .code = "LFH263",
-        .name = "Saint Denis Chd",
-        .latitude = -20.8910305555556,
-        .longitude = 55.444075,
-        .elevation = 390,
-    },
-    {
-        .code = "LFH264",
-        .name = "Saint Pierre Chu Sud",
-        .latitude = -21.3457111111111,
-        .longitude = 55.4933888888889,
-        .elevation = 269,
-    },
-    {
-        .code = "LFH266",
-        .name = "Challans",
-        .latitude = 46.8541666666667,
-        .longitude = -1.83055555555556,
-        .elevation = 130,
-    },
-    {
-        .code = "LFH267",
-        .name = "Fecamp Centre Hospitalier",
-        .latitude = 49.7430555555556,
-        .longitude = 0.385555555555556,
-        .elevation = 318,
-    },
-    {
-        .code = "LFH268",
-        .name = "Romorantin Centre Hospitalier",
-        .latitude = 47.3605555555556,
-        .longitude = 1.73194444444444,
-        .elevation = 293,
-    },
-    {
-        .code = "LFH27",
-        .name = "Beziers Hopital Montimaran",
-        .latitude = 43.3414277777778,
-        .longitude = 3.25497222222222,
-        .elevation = 176,
-    },
-    {
-        .code = "LFH270",
-        .name = "Saint Paul L'eperon",
-        .latitude = -21.0349083333333,
-        .longitude = 55.2602833333333,
-        .elevation = 834,
-    },
-    {
-        .code = "LFH271",
-        .name = "Bourges Centre Hospitalier",
-        .latitude = 47.0841666666667,
-        .longitude = 2.43527777777778,
-        .elevation = 445,
-    },
-    {
-        .code = "LFH272",
-        .name = "Saint Omer Centre Hospitalier",
-        .latitude = 50.7035833333333,
-        .longitude = 2.25480555555556,
-        .elevation = 276,
-    },
-    {
-        .code = "LFH273",
-        .name = "Grasse Hopital Clavary",
-        .latitude = 43.6196111111111,
-        .longitude = 6.92890277777778,
-        .elevation = 552,
-    },
-    {
-        .code = "LFH274",
-        .name = "Nice Hopital Lenval",
-        .latitude = 43.6893333333333,
-        .longitude = 7.24163333333333,
-        .elevation = 115,
-    },
-    {
-        .code = "LFH275",
-        .name = "Brignoles Hopital Jean Marcel",
-        .latitude = 43.4030527777778,
-        .longitude = 6.06630833333333,
-        .elevation = 753,
-    },
-    {
-        .code = "LFH276",
-        .name = "Frejus Hopital Bonnet",
-        .latitude = 43.4397416666667,
-        .longitude = 6.75155,
-        .elevation = 69,
-    },
-    {
-        .code = "LFH278",
-        .name = "Noumea Pointe De L'artillerie",
-        .latitude = -22.2830555555556,
-        .longitude = 166.433611111111,
-        .elevation = 158,
-    },
-    {
-        .code = "LFH279",
-        .name = "Noumea Caserne Normandie",
-        .latitude = -22.2263888888889,
-        .longitude = 166.486666666667,
-        .elevation = 99,
-    },
-    {
-        .code = "LFH28",
-        .name = "Vichy Centre Hospitalier",
-        .latitude = 46.1236111111111,
-        .longitude = 3.43722222222222,
-        .elevation = 956,
-    },
-    {
-        .code = "LFH288",
-        .name = "Argentan Centre Hospitalier",
-        .latitude = 48.7465277777778,
-        .longitude = -0.0178888888888889,
-        .elevation = 596,
-    },
-    {
-        .code = "LFH29",
-        .name = "Blois Centre Hospitalier",
-        .latitude = 47.604675,
-        .longitude = 1.34245277777778,
-        .elevation = 355,
-    },
-    {
-        .code = "LFH290",
-        .name = "Royan Centre Hospitalier",
-        .latitude = 45.6333333333333,
-        .longitude = -1.06083333333333,
-        .elevation = 81,
-    },
-    {
-        .code = "LFH291",
-        .name = "Auch Centre Hospitalier",
-        .latitude = 43.6313888888889,
-        .longitude = 0.573333333333333,
-        .elevation = 597,
-    },
-    {
-        .code = "LFH292",
-        .name = "Magny Cours Circuit Automobile",
-        .latitude = 46.8564111111111,
-        .longitude = 3.15426666666667,
-        .elevation = 751,
-    },
-    {
-        .code = "LFH293",
-        .name = "Paray Le Monial Centre Hospitalier",
-        .latitude = 46.465,
-        .longitude = 4.10972222222222,
-        .elevation = 824,
-    },
-    {
-        .code = "LFH294",
-        .name = "Auxerre Centre Hospitalier",
-        .latitude = 47.8044444444444,
-        .longitude = 3.55777777777778,
-        .elevation = 528,
-    },
-    {
-        .code = "LFH296",
-        .name = "Sens Centre De Secours Principal",
-        .latitude = 48.1919444444444,
-        .longitude = 3.30638888888889,
-        .elevation = 266,
-    },
-    {
-        .code = "LFH298",
-        .name = "Strasbourg N.H.C.",
-        .latitude = 48.5758333333333,
-        .longitude = 7.74055555555556,
-        .elevation = 540,
-    },
-    {
-        .code = "LFH299",
-        .name = "Creil Centre Hospitalier Laennec",
-        .latitude = 49.2472222222222,
-        .longitude = 2.45805555555556,
-        .elevation = 238,
-    },
-    {
-        .code = "LFH3",
-        .name = "Aix Les Bains Hotel Ariana",
-        .latitude = 45.6739638888889,
-        .longitude = 5.90888333333333,
-        .elevation = 810,
-    },
-    {
-        .code = "LFH300",
-        .name = "Dunkerque Centre Hospitalier",
-        .latitude = 51.0375,
-        .longitude = 2.39666666666667,
-        .elevation = 55,
-    },
-    {
-        .code = "LFH301",
-        .name = "Montceau Les Mines Centre Hospitalier",
-        .latitude = 46.65,
-        .longitude = 4.33388888888889,
-        .elevation = 958,
-    },
-    {
-        .code = "LFH302",
-        .name = "Bale Mulhouse",
-        .latitude = 47.59,
-        .longitude = 7.52916666666667,
-        .elevation = 885,
-    },
-    {
-        .code = "LFH303",
-        .name = "Bordeaux Merignac",
-        .latitude = 44.8286111111111,
-        .longitude = -0.715277777777778,
-        .elevation = 166,
-    },
-    {
-        .code = "LFH304",
-        .name = "Bordeaux Pellegrin Centre Hospitalier",
-        .latitude = 44.8275,
-        .longitude = -0.604722222222222,
-        .elevation = 257,
-    },
-    {
-        .code = "LFH305",
-        .name = "Bordeaux Robert Picque Hopital Militaire",
-        .latitude = 44.8,
-        .longitude = -0.574166666666667,
-        .elevation = 62,
-    },
-    {
-        .code = "LFH306",
-        .name = "Cannes Mandelieu",
-        .latitude = 43.5463888888889,
-        .longitude = 6.95416666666667,
-        .elevation = 14,
-    },
-    {
-        .code = "LFH307",
-        .name = "Cannes Quai Du Large",
-        .latitude = 43.545,
-        .longitude = 7.01722222222222,
-        .elevation = 10,
-    },
-    {
-        .code = "LFH308",
-        .name = "Chalon Sur Saone Centre Hospitalier W. Morey",
-        .latitude = 46.7775,
-        .longitude = 4.84194444444444,
-        .elevation = 665,
-    },
-    {
-        .code = "LFH309",
-        .name = "Chamonix Centre Hospitalier",
-        .latitude = 45.9144444444444,
-        .longitude = 6.86305555555556,
-        .elevation = 3399,
-    },
-    {
-        .code = "LFH31",
-        .name = "Val Thorens",
-        .latitude = 45.2963888888889,
-        .longitude = 6.56555555555556,
-        .elevation = 6907,
-    },
-    {
-        .code = "LFH312",
-        .name = "Chatellerault Centre Hospitalier",
-        .latitude = 46.8327777777778,
-        .longitude = 0.556666666666667,
-        .elevation = 277,
-    },
-    {
-        .code = "LFH313",
-        .name = "Chiva (Foix)Centre Hospitalier",
-        .latitude = 43.025325,
-        .longitude = 1.61761666666667,
-        .elevation = 1151,
-    },
-    {
-        .code = "LFH314",
-        .name = "Colmar Hopital Pasteur",
-        .latitude = 48.0738611111111,
-        .longitude = 7.33811111111111,
-        .elevation = 710,
-    },
-    {
-        .code = "LFH315",
-        .name = "Coquelles Eurotunnel",
-        .latitude = 50.9180416666667,
-        .longitude = 1.79501944444444,
-        .elevation = 31,
-    },
-    {
-        .code = "LFH32",
-        .name = "Montlucon Centre Hospitalier",
-        .latitude = 46.3416666666667,
-        .longitude = 2.60944444444444,
-        .elevation = 802,
-    },
-    {
-        .code = "LFH322",
-        .name = "L'aigle Centre Hospitalier",
-        .latitude = 48.7680555555556,
-        .longitude = 0.611666666666667,
-        .elevation = 764,
-    },
-    {
-        .code = "LFH323",
-        .name = "La Rochelle Centre Hospitalier",
-        .latitude = 46.1588888888889,
-        .longitude = -1.14305555555556,
-        .elevation = 49,
-    },
-    {
-        .code = "LFH326",
-        .name = "Le Havre Centre Hospitalier",
-        .latitude = 49.5247222222222,
-        .longitude = 0.184722222222222,
-        .elevation = 57,
-    },
-    {
-        .code = "LFH328",
-        .name = "Lorient Bretagne Sud Centre Hospitalier",
-        .latitude = 47.7536111111111,
-        .longitude = -3.35611111111111,
-        .elevation = 100,
-    },
-    {
-        .code = "LFH329",
-        .name = "Lyon Bron",
-        .latitude = 45.7294444444444,
-        .longitude = 4.93888888888889,
-        .elevation = 659,
-    },
-    {
-        .code = "LFH330",
-        .name = "Lyon Saint-Exupery",
-        .latitude = 45.7255555555556,
-        .longitude = 5.08111111111111,
-        .elevation = 821,
-    },
-    {
-        .code = "LFH331",
-        .name = "Marseille Provence",
-        .latitude = 43.4366666666667,
-        .longitude = 5.215,
-        .elevation = 70,
-    },
-    {
-        .code = "LFH333",
-        .name = "Montpellier Mediterranee",
-        .latitude = 43.5833333333333,
-        .longitude = 3.96138888888889,
-        .elevation = 17,
-    },
-    {
-        .code = "LFH334",
-        .name = "Nantes Atlantique",
-        .latitude = 47.1569444444444,
-        .longitude = -1.60777777777778,
-        .elevation = 90,
-    },
-    {
-        .code = "LFH335",
-        .name = "Nice Cote D'azur",
-        .latitude = 43.6652777777778,
-        .longitude = 7.215,
-        .elevation = 12,
-    },
-    {
-        .code = "LFH336",
-        .name = "Macon Centre Hospitalier",
-        .latitude = 46.31445,
-        .longitude = 4.81230555555556,
-        .elevation = 727,
-    },
-    {
-        .code = "LFH338",
-        .name = "Monaco Helistation",
-        .latitude = 43.7255555555556,
-        .longitude = 7.41916666666667,
-        .elevation = 19,
-    },
-    {
-        .code = "LFH34",
-        .name = "Hopital Nord Franche Comte",
-        .latitude = 47.5761111111111,
-        .longitude = 6.87305555555556,
-        .elevation = 1263,
-    },
-    {
-        .code = "LFH340",
-        .name = "Mulhouse Centre Hospitalier De Moenchsberg",
-        .latitude = 47.7253305555556,
-        .longitude = 7.34499166666667,
-        .elevation = 1081,
-    },
-    {
-        .code = "LFH341",
-        .name = "Nancy Brabois Centre Hospitalier",
-        .latitude = 48.6447222222222,
-        .longitude = 6.15138888888889,
-        .elevation = 1335,
-    },
-    {
-        .code = "LFH343",
-        .name = "Nevers Centre Hospitalier",
-        .latitude = 46.9813888888889,
-        .longitude = 3.12222222222222,
-        .elevation = 737,
-    },
-    {
-        .code = "LFH344",
-        .name = "Oloron Sainte Marie Centre Hospitalier",
-        .latitude = 43.1958333333333,
-        .longitude = -0.617777777777778,
-        .elevation = 758,
-    },
-    {
-        .code = "LFH345",
-        .name = "Orleans Centre Hospitalier",
-        .latitude = 47.8352777777778,
-        .longitude = 1.91944444444444,
-        .elevation = 424,
-    },
-    {
-        .code = "LFH346",
-        .name = "Paris Centre Hospitalier La Pitie Salpetriere",
-        .latitude = 48.8371444444444,
-        .longitude = 2.36132777777778,
-        .elevation = 255,
-    },
-    {
-        .code = "LFH347",
-        .name = "Paris Centre Hospitalier Lariboisiere",
-        .latitude = 48.8826388888889,
-        .longitude = 2.35442777777778,
-        .elevation = 262,
-    },
-    {
-        .code = "LFH348",
-        .name = "Paris Issy Les Moulineaux",
-        .latitude = 48.8333,
-        .longitude = 2.27281666666667,
-        .elevation = 105,
-    },
-    {
-        .code = "LFH349",
-        .name = "Paris Charles De Gaulle",
-        .latitude = 49.0097222222222,
-        .longitude = 2.54777777777778,
-        .elevation = 392,
-    },
-    {
-        .code = "LFH350",
-        .name = "Paris Le Bourget",
-        .latitude = 48.9694444444444,
-        .longitude = 2.44138888888889,
-        .elevation = 220,
-    },
-    {
-        .code = "LFH352",
-        .name = "Pau Pyrenees",
-        .latitude = 43.38,
-        .longitude = -0.418611111111111,
-        .elevation = 616,
-    },
-    {
-        .code = "LFH353",
-        .name = "Pontoise Centre Hospitalier Rene Dubos",
-        .latitude = 49.0657027777778,
-        .longitude = 2.09776944444444,
-        .elevation = 266,
-    },
-    {
-        .code = "LFH354",
-        .name = "Rennes Pont Chaillou Centre Hospitalier",
-        .latitude = 48.1230555555556,
-        .longitude = -1.69611111111111,
-        .elevation = 148,
-    },
-    {
-        .code = "LFH355",
-        .name = "Rodez Bourran Centre Hospitalier",
-        .latitude = 44.3588888888889,
-        .longitude = 2.55194444444444,
-        .elevation = 1951,
-    },
-    {
-        .code = "LFH358",
-        .name = "Saint Etienne Malacussy",
-        .latitude = 45.4240305555556,
-        .longitude = 4.37138333333333,
-        .elevation = 2148,
-    },
-    {
-        .code = "LFH359",
-        .name = "Saint Pol Sur Ternoise Polyclinique Du Ternois",
-        .latitude = 50.3877777777778,
-        .longitude = 2.33555555555556,
-        .elevation = 417,
-    },
-    {
-        .code = "LFH36",
-        .name = "Brest Amiraute",
-        .latitude = 48.3805555555556,
-        .longitude = -4.49166666666667,
-        .elevation = 0,
-    },
-    {
-        .code = "LFH360",
-        .name = "Sarlat La Caneda Centre Hospitalier",
-        .latitude = 44.9000027777778,
-        .longitude = 1.22295555555556,
-        .elevation = 662,
-    },
-    {
-        .code = "LFH361",
-        .name = "Semur En Auxois Centre Hospitalier",
-        .latitude = 47.4956416666667,
-        .longitude = 4.34453333333333,
-        .elevation = 957,
-    },
-    {
-        .code = "LFH362",
-        .name = "Toulouse Purpan",
-        .latitude = 43.6130555555556,
-        .longitude = 1.4,
-        .elevation = 531,
-    },
-    {
-        .code = "LFH363",
-        .name = "Toulouse Blagnac",
-        .latitude = 43.635,
-        .longitude = 1.36777777777778,
-        .elevation = 499,
-    },
-    {
-        .code = "LFH364",
-        .name = "Toussus Le Noble",
-        .latitude = 48.7497222222222,
-        .longitude = 2.11111111111111,
-        .elevation = 538,
-    },
-    {
-        .code = "LFH365",
-        .name = "Villacoublay Velizy",
-        .latitude = 48.7741666666667,
-        .longitude = 2.19166666666667,
-        .elevation = 585,
-    },
-    {
-        .code = "LFH366",
-        .name = "Tours Trousseau Chu",
-        .latitude = 47.3489694444444,
-        .longitude = 0.709205555555556,
-        .elevation = 274,
-    },
-    {
-        .code = "LFH368",
-        .name = "Dax Azur",
-        .latitude = 43.8069444444444,
-        .longitude = -1.25555555555556,
-        .elevation = 121,
-    },
-    {
-        .code = "LFH369",
-        .name = "Dax Castets",
-        .latitude = 43.9166666666667,
-        .longitude = -1.15694444444444,
-        .elevation = 184,
-    },
-    {
-        .code = "LFH37",
-        .name = "Brest Centre Hospitalier La Cavale Blanche",
-        .latitude = 48.4033333333333,
-        .longitude = -4.52944444444444,
-        .elevation = 121,
-    },
-    {
-        .code = "LFH370",
-        .name = "Dax Herm",
-        .latitude = 43.8222222222222,
-        .longitude = -1.11111111111111,
-        .elevation = 253,
-    },
-    {
-        .code = "LFH371",
-        .name = "Dax Pontonx",
-        .latitude = 43.7777777777778,
-        .longitude = -0.919444444444444,
-        .elevation = 53,
-    },
-    {
-        .code = "LFH372",
-        .name = "Dax Tinon",
-        .latitude = 43.7333333333333,
-        .longitude = -1.17777777777778,
-        .elevation = 151,
-    },
-    {
-        .code = "LFH374",
-        .name = "Charleville Mezieres Centre Hospitalier",
-        .latitude = 49.7626083333333,
-        .longitude = 4.69758333333333,
-        .elevation = 577,
-    },
-    {
-        .code = "LFH375",
-        .name = "Nantes Quai Moncousu Centre Hospitalier",
-        .latitude = 47.2088888888889,
-        .longitude = -1.55444444444444,
-        .elevation = 77,
-    },
-    {
-        .code = "LFH376",
-        .name = "Roanne Centre Hospitalier",
-        .latitude = 46.0426388888889,
-        .longitude = 4.07965277777778,
-        .elevation = 963,
-    },
-    {
-        .code = "LFH377",
-        .name = "Toulon Sainte Anne Hopital Militaire",
-        .latitude = 43.1334555555556,
-        .longitude = 5.93019166666667,
-        .elevation = 226,
-    },
-    {
-        .code = "LFH379",
-        .name = "Blaye Centre Hospitalier Saint Nicolas De Blaye",
-        .latitude = 45.1356944444444,
-        .longitude = -0.658916666666667,
-        .elevation = 81,
-    },
-    {
-        .code = "LFH38",
-        .name = "Briancon",
-        .latitude = 44.906275,
-        .longitude = 6.63283333333333,
-        .elevation = 4372,
-    },
-    {
-        .code = "LFH385",
-        .name = "Dole Centre Hospitalier",
-        .latitude = 47.0833333333333,
-        .longitude = 5.47277777777778,
-        .elevation = 868,
-    },
-    {
-        .code = "LFH387",
-        .name = "Lons Le Saunier Centre Hospitalier",
-        .latitude = 46.6761111111111,
-        .longitude = 5.55,
-        .elevation = 896,
-    },
-    {
-        .code = "LFH388",
-        .name = "Verneuil Sur Avre Centre Hospitalier",
-        .latitude = 48.7444444444444,
-        .longitude = 0.891666666666667,
-        .elevation = 597,
-    },
-    {
-        .code = "LFH39",
-        .name = "Marseille Laveran Hopital Militaire",
-        .latitude = 43.3277777777778,
-        .longitude = 5.41555555555556,
-        .elevation = 353,
-    },
-    {
-        .code = "LFH390",
-        .name = "Vendome Centre Hospitalier",
-        .latitude = 47.7941666666667,
-        .longitude = 1.06277777777778,
-        .elevation = 304,
-    },
-    {
-        .code = "LFH391",
-        .name = "Nimes Caremeau Centre Hospitalier",
-        .latitude = 43.8238888888889,
-        .longitude = 4.32305555555556,
-        .elevation = 310,
-    },
-    {
-        .code = "LFH393",
-        .name = "Selestat Centre Hospitalier",
-        .latitude = 48.2616666666667,
-        .longitude = 7.43222222222222,
-        .elevation = 587,
-    },
-    {
-        .code = "LFH395",
-        .name = "Valenciennes Centre Hospitalier",
-        .latitude = 50.3608333333333,
-        .longitude = 3.49916666666667,
-        .elevation = 259,
-    },
-    {
-        .code = "LFH396",
-        .name = "Arras Centre Hospitalier",
-        .latitude = 50.2962055555556,
-        .longitude = 2.75920833333333,
-        .elevation = 254,
-    },
-    {
-        .code = "LFH397",
-        .name = "Bordeaux Haut Leveque Centre Hospitalier",
-        .latitude = 44.7852777777778,
-        .longitude = -0.660833333333333,
-        .elevation = 275,
-    },
-    {
-        .code = "LFH398",
-        .name = "Issoudun Centre Hospitalier",
-        .latitude = 46.9594444444445,
-        .longitude = 1.99472222222222,
-        .elevation = 465,
-    },
-    {
-        .code = "LFH399",
-        .name = "Gueret Centre Hospitalier",
-        .latitude = 46.1615555555556,
-        .longitude = 1.86866666666667,
-        .elevation = 1752,
-    },
-    {
-        .code = "LFH4",
-        .name = "Albertville Centre Hospitalier",
-        .latitude = 45.6694388888889,
-        .longitude = 6.37,
-        .elevation = 1143,
-    },
-    {
-        .code = "LFH40",
-        .name = "Caen Centre Hospitalier",
-        .latitude = 49.2036111111111,
-        .longitude = -0.3575,
-        .elevation = 283,
-    },
-    {
-        .code = "LFH400",
-        .name = "Le Plessis Robinson Centre Chirurgical Marie Lannelongue",
-        .latitude = 48.7847222222222,
-        .longitude = 2.27416666666667,
-        .elevation = 382,
-    },
-    {
-        .code = "LFH401",
-        .name = "Vesoul Centre Hospitalier",
-        .latitude = 47.6369444444444,
-        .longitude = 6.13722222222222,
-        .elevation = 741,
-    },
-    {
-        .code = "LFH402",
-        .name = "Amboise Centre Hospitalier",
-        .latitude = 47.4080555555556,
-        .longitude = 0.981111111111111,
-        .elevation = 308,
-    },
-    {
-        .code = "LFH403",
-        .name = "Loches Centre Hospitalier",
-        .latitude = 47.1305555555556,
-        .longitude = 1.00305555555556,
-        .elevation = 231,
-    },
-    {
-        .code = "LFH404",
-        .name = "Bastia Centre Hospitalier",
-        .latitude = 42.6822222222222,
-        .longitude = 9.42833333333333,
-        .elevation = 443,
-    },
-    {
-        .code = "LFH405",
-        .name = "Calvi Centre Hospitalier",
-        .latitude = 42.5497222222222,
-        .longitude = 8.76388888888889,
-        .elevation = 48,
-    },
-    {
-        .code = "LFH406",
-        .name = "Porto-Vecchio",
-        .latitude = 41.58,
-        .longitude = 9.27694444444445,
-        .elevation = 30,
-    },
-    {
-        .code = "LFH408",
-        .name = "Evreux Centre Hospitalier",
-        .latitude = 49.0311111111111,
-        .longitude = 1.11416666666667,
-        .elevation = 390,
-    },
-    {
-        .code = "LFH409",
-        .name = "Langon Centre Hospitalier",
-        .latitude = 44.5447222222222,
-        .longitude = -0.243611111111111,
-        .elevation = 121,
-    },
-    {
-        .code = "LFH410",
-        .name = "Gien Centre Hospitalier",
-        .latitude = 47.6902777777778,
-        .longitude = 2.63472222222222,
-        .elevation = 556,
-    },
-    {
-        .code = "LFH411",
-        .name = "Saint Cyr L'ecole",
-        .latitude = 48.815,
-        .longitude = 2.06527777777778,
-        .elevation = 373,
-    },
-    {
-        .code = "LFH412",
-        .name = "Digne Les Bains H1 Centre Hospitalier",
-        .latitude = 44.0705555555556,
-        .longitude = 6.16833333333333,
-        .elevation = 1975,
-    },
-    {
-        .code = "LFH413",
-        .name = "Digne Les Bains H2 Centre Hospitalier",
-        .latitude = 44.0711111111111,
-        .longitude = 6.17194444444444,
-        .elevation = 1867,
-    },
-    {
-        .code = "LFH414",
-        .name = "Saint Paul L'ermitage",
-        .latitude = -21.0678888888889,
-        .longitude = 55.2497222222222,
-        .elevation = 826,
-    },
-    {
-        .code = "LFH416",
-        .name = "Lagny Sur Marne Centre Hospitalier",
-        .latitude = 48.8738888888889,
-        .longitude = 2.6975,
-        .elevation = 179,
-    },
-    {
-        .code = "LFH417",
-        .name = "Lyon Groupement Hospitalier Est",
-        .latitude = 45.7477777777778,
-        .longitude = 4.9025,
-        .elevation = 818,
-    },
-    {
-        .code = "LFH418",
-        .name = "Lyon Centre Hospitalier Sud",
-        .latitude = 45.7025,
-        .longitude = 4.8075,
-        .elevation = 753,
-    },
-    {
-        .code = "LFH419",
-        .name = "Bourgoin Jallieu Centre Hospitalier Oudot",
-        .latitude = 45.5961111111111,
-        .longitude = 5.245,
-        .elevation = 822,
-    },
-    {
-        .code = "LFH420",
-        .name = "Tignes Helistation Les Boisses",
-        .latitude = 45.4941666666667,
-        .longitude = 6.92972222222222,
-        .elevation = 5961,
-    },
-    {
-        .code = "LFH421",
-        .name = "Saint Etienne Hopital Nord",
-        .latitude = 45.4822222222222,
-        .longitude = 4.36333333333333,
-        .elevation = 1507,
-    },
-    {
-        .code = "LFH422",
-        .name = "Castres Hauterive Centre Hospitalier",
-        .latitude = 43.565,
-        .longitude = 2.26,
-        .elevation = 610,
-    },
-    {
-        .code = "LFH423",
-        .name = "Eaubonne Hopital Simone Veil",
-        .latitude = 48.9999333333333,
-        .longitude = 2.27218333333333,
-        .elevation = 223,
-    },
-    {
-        .code = "LFH424",
-        .name = "Narbonne Saint Crescent Centre Hospitalier",
-        .latitude = 43.1727888888889,
-        .longitude = 2.99456111111111,
-        .elevation = 30,
-    },
-    {
-        .code = "LFH425",
-        .name = "Carpentras Centre Hospitalier",
-        .latitude = 44.0466666666667,
-        .longitude = 5.02583333333333,
-        .elevation = 285,
-    },
-    {
-        .code = "LFH426",
-        .name = "Manosque Centre Hospitalier",
-        .latitude = 43.8280555555556,
-        .longitude = 5.80611111111111,
-        .elevation = 1081,
-    },
-    {
-        .code = "LFH427",
-        .name = "Clermont Ferrand Saint Jacques",
-        .latitude = 45.7569833333333,
-        .longitude = 3.09186111111111,
-        .elevation = 1366,
-    },
-    {
-        .code = "LFH428",
-        .name = "Clermont Ferrand Estaing",
-        .latitude = 45.7855555555556,
-        .longitude = 3.10972222222222,
-        .elevation = 1203,
-    },
-    {
-        .code = "LFH430",
-        .name = "Martigues Centre Hospitalier",
-        .latitude = 43.4130555555556,
-        .longitude = 5.03888888888889,
-        .elevation = 178,
-    },
-    {
-        .code = "LFH432",
-        .name = "Cannes Broussailles Hopital",
-        .latitude = 43.5641666666667,
-        .longitude = 7.00527777777778,
-        .elevation = 375,
-    },
-    {
-        .code = "LFH433",
-        .name = "Alpes Leman Centre Hospitalier",
-        .latitude = 46.1419444444444,
-        .longitude = 6.32,
-        .elevation = 1532,
-    },
-    {
-        .code = "LFH434",
-        .name = "Ales Centre Hospitalier",
-        .latitude = 44.1477777777778,
-        .longitude = 4.09555555555556,
-        .elevation = 552,
-    },
-    {
-        .code = "LFH435",
-        .name = "Ger",
-        .latitude = 43.0508333333333,
-        .longitude = -0.0413888888888889,
-        .elevation = 1310,
-    },
-    {
-        .code = "LFH436",
-        .name = "Montpellier Lapeyronie Chr",
-        .latitude = 43.6300055555556,
-        .longitude = 3.84965277777778,
-        .elevation = 150,
-    },
-    {
-        .code = "LFH437",
-        .name = "Saint Quentin Centre Hospitalier",
-        .latitude = 49.8605555555556,
-        .longitude = 3.27166666666667,
-        .elevation = 380,
-    },
-    {
-        .code = "LFH438",
-        .name = "Dijon Bocage Centre Hospitalier Universitaire",
-        .latitude = 47.3212833333333,
-        .longitude = 5.069075,
-        .elevation = 972,
-    },
-    {
-        .code = "LFH439",
-        .name = "Amiens Centre Hospitalier Universitaire Nord",
-        .latitude = 49.9066666666667,
-        .longitude = 2.29583333333333,
-        .elevation = 161,
-    },
-    {
-        .code = "LFH441",
-        .name = "Orange Centre Hospitalier",
-        .latitude = 44.1480555555556,
-        .longitude = 4.82194444444444,
-        .elevation = 155,
-    },
-    {
-        .code = "LFH442",
-        .name = "Kremlin Bicetre Centre Hospitalier",
-        .latitude = 48.8094444444444,
-        .longitude = 2.35611111111111,
-        .elevation = 270,
-    },
-    {
-        .code = "LFH443",
-        .name = "Besancon Chu Jean Minjoz",
-        .latitude = 47.2255694444444,
-        .longitude = 5.96447222222222,
-        .elevation = 940,
-    },
-    {
-        .code = "LFH444",
-        .name = "Mende Centre Hospitalier",
-        .latitude = 44.5222222222222,
-        .longitude = 3.48916666666667,
-        .elevation = 2540,
-    },
-    {
-        .code = "LFH445",
-        .name = "Perpignan Centre Hospitalier",
-        .latitude = 42.7261944444444,
-        .longitude = 2.8886,
-        .elevation = 190,
-    },
-    {
-        .code = "LFH446",
-        .name = "Beauvais Centre Hospitalier",
-        .latitude = 49.4491666666667,
-        .longitude = 2.06833333333333,
-        .elevation = 304,
-    },
-    {
-        .code = "LFH447",
-        .name = "Corbeil-Essonnes Centre Hospitalier Sud Francilien",
-        .latitude = 48.6202777777778,
-        .longitude = 2.45722222222222,
-        .elevation = 338,
-    },
-    {
-        .code = "LFH448",
-        .name = "Biarritz Pays Basque",
-        .latitude = 43.4683333333333,
-        .longitude = -1.53111111111111,
-        .elevation = 245,
-    },
-    {
-        .code = "LFH449",
-        .name = "Toulon Sainte Musse Hopital",
-        .latitude = 43.1244027777778,
-        .longitude = 5.97496111111111,
-        .elevation = 165,
-    },
-    {
-        .code = "LFH45",
-        .name = "Castres Centre Hospitalier",
-        .latitude = 43.6038444444444,
-        .longitude = 2.23920277777778,
-        .elevation = 642,
-    },
-    {
-        .code = "LFH450",
-        .name = "Tonnerre Centre Hospitalier",
-        .latitude = 47.8555555555556,
-        .longitude = 3.97944444444444,
-        .elevation = 456,
-    },
-    {
-        .code = "LFH451",
-        .name = "Versailles Centre Hospitalier",
-        .latitude = 48.8308333333333,
-        .longitude = 2.12777777777778,
-        .elevation = 492,
-    },
-    {
-        .code = "LFH452",
-        .name = "Dieppe Centre Hospitalier",
-        .latitude = 49.9177777777778,
-        .longitude = 1.08055555555556,
-        .elevation = 69,
-    },
-    {
-        .code = "LFH453",
-        .name = "Metz Mercy Centre Hospitalier",
-        .latitude = 49.0841666666667,
-        .longitude = 6.24222222222222,
-        .elevation = 868,
-    },
-    {
-        .code = "LFH454",
-        .name = "Arcachon Pole Sante",
-        .latitude = 44.6125,
-        .longitude = -1.11388888888889,
-        .elevation = 46,
-    },
-    {
-        .code = "LFH455",
-        .name = "Melun Centre Hospitalier Marc Jacquet",
-        .latitude = 48.5575,
-        .longitude = 2.64166666666667,
-        .elevation = 338,
-    },
-    {
-        .code = "LFH456",
-        .name = "Sete Helistation Des Hopitaux Du Bassin De Thau",
-        .latitude = 43.4077777777778,
-        .longitude = 3.66972222222222,
-        .elevation = 136,
-    },
-    {
-        .code = "LFH457",
-        .name = "Bagnols Sur Ceze Centre Hospitalier",
-        .latitude = 44.1583333333333,
-        .longitude = 4.61555555555555,
-        .elevation = 285,
-    },
-    {
-        .code = "LFH458",
-        .name = "Marne La Vallee Centre Hospitalier",
-        .latitude = 48.8486111111111,
-        .longitude = 2.76972222222222,
-        .elevation = 412,
-    },
-    {
-        .code = "LFH459",
-        .name = "Calais Centre Hospitalier",
-        .latitude = 50.9412833333333,
-        .longitude = 1.88948055555556,
-        .elevation = 11,
-    },
-    {
-        .code = "LFH46",
-        .name = "Cerbere",
-        .latitude = 42.4589083333333,
-        .longitude = 3.15991666666667,
-        .elevation = 50,
-    },
-    {
-        .code = "LFH460",
-        .name = "Le Blanc Centre Hospitalier",
-        .latitude = 46.6338888888889,
-        .longitude = 1.05861111111111,
-        .elevation = 302,
-    },
-    {
-        .code = "LFH461",
-        .name = "Nice Hopital Pasteur 2",
-        .latitude = 43.7247222222222,
-        .longitude = 7.2825,
-        .elevation = 258,
-    },
-    {
-        .code = "LFH462",
-        .name = "Aurillac Centre Hospitalier",
-        .latitude = 44.9266666666667,
-        .longitude = 2.43805555555556,
-        .elevation = 2146,
-    },
-    {
-        .code = "LFH463",
-        .name = "Bourg En Bresse Centre Hospitalier",
-        .latitude = 46.2247222222222,
-        .longitude = 5.20972222222222,
-        .elevation = 814,
-    },
-    {
-        .code = "LFH464",
-        .name = "Le Mans Centre Hospitalier",
-        .latitude = 48.0167333333333,
-        .longitude = 0.173277777777778,
-        .elevation = 225,
-    },
-    {
-        .code = "LFH465",
-        .name = "Ambert Centre Hospitalier",
-        .latitude = 45.5538888888889,
-        .longitude = 3.74138888888889,
-        .elevation = 1762,
-    },
-    {
-        .code = "LFH466",
-        .name = "Savoie Helicopteres",
-        .latitude = 46.0711111111111,
-        .longitude = 6.51777777777778,
-        .elevation = 1535,
-    },
-    {
-        .code = "LFH467",
-        .name = "Laon Semilly Centre Hospitalier",
-        .latitude = 49.55,
-        .longitude = 3.59722222222222,
-        .elevation = 233,
-    },
-    {
-        .code = "LFH468",
-        .name = "Monaco Centre Hospitalier Princesse Grace",
-        .latitude = 43.7293861111111,
-        .longitude = 7.41018611111111,
-        .elevation = 259,
-    },
-    {
-        .code = "LFH469",
-        .name = "Nord Deux-Sevres Centre Hospitalier",
-        .latitude = 46.8315138888889,
-        .longitude = -0.386,
-        .elevation = 567,
-    },
-    {
-        .code = "LFH470",
-        .name = "Metz Frescaty",
-        .latitude = 49.0705555555556,
-        .longitude = 6.12611111111111,
-        .elevation = 630,
-    },
-    {
-        .code = "LFH471",
-        .name = "Colmar Meyenheim",
-        .latitude = 47.9191666666667,
-        .longitude = 7.4025,
-        .elevation = 660,
-    },
-    {
-        .code = "LFH5",
-        .name = "Albertville Crs Alpes",
-        .latitude = 45.6568944444444,
-        .longitude = 6.37603611111111,
-        .elevation = 1084,
-    },
-    {
-        .code = "LFH52",
-        .name = "Chambery Centre Hospitalier",
-        .latitude = 45.5630555555556,
-        .longitude = 5.91194444444444,
-        .elevation = 1020,
-    },
-    {
-        .code = "LFH53",
-        .name = "Chamonix Croix De Lognan",
-        .latitude = 45.97,
-        .longitude = 6.94444444444444,
-        .elevation = 6368,
-    },
-    {
-        .code = "LFH56",
-        .name = "Chamonix Securite",
-        .latitude = 45.9389194444444,
-        .longitude = 6.89581111111111,
-        .elevation = 3532,
-    },
-    {
-        .code = "LFH6",
-        .name = "Echirolles Clinique Des Cedres",
-        .latitude = 45.1475,
-        .longitude = 5.72333333333333,
-        .elevation = 799,
-    },
-    {
-        .code = "LFH60",
-        .name = "Chauny Centre Hospitalier",
-        .latitude = 49.6261111111111,
-        .longitude = 3.2375,
-        .elevation = 180,
-    },
-    {
-        .code = "LFH62",
-        .name = "Cherbourg Arsenal-Premar",
-        .latitude = 49.6538888888889,
-        .longitude = -1.64,
-        .elevation = 26,
-    },
-    {
-        .code = "LFH64",
-        .name = "Cholet Centre Hospitalier",
-        .latitude = 47.0414138888889,
-        .longitude = -0.897361111111111,
-        .elevation = 352,
-    },
-    {
-        .code = "LFH66",
-        .name = "Clamart Hopital D'instruction Des Armees De Percy",
-        .latitude = 48.8142972222222,
-        .longitude = 2.25393333333333,
-        .elevation = 333,
-    },
-    {
-        .code = "LFH69",
-        .name = "Compiegne Centre Hospitalier",
-        .latitude = 49.3897222222222,
-        .longitude = 2.79555555555556,
-        .elevation = 108,
-    },
-    {
-        .code = "LFH7",
-        .name = "Alencon Centre Hospitalier",
-        .latitude = 48.4241666666667,
-        .longitude = 0.0825,
-        .elevation = 435,
-    },
-    {
-        .code = "LFH75",
-        .name = "Creteil Centre Hospitalier Henri Mondor",
-        .latitude = 48.7987583333333,
-        .longitude = 2.45348333333333,
-        .elevation = 160,
-    },
-    {
-        .code = "LFH78",
-        .name = "Dax Centre Hospitalier",
-        .latitude = 43.7125,
-        .longitude = -1.04027777777778,
-        .elevation = 31,
-    },
-    {
-        .code = "LFH8",
-        .name = "Amiens Centre Hospitalier Universitaire Sud",
-        .latitude = 49.8761111111111,
-        .longitude = 2.2575,
-        .elevation = 250,
-    },
-    {
-        .code = "LFH81",
-        .name = "Divonne Hotel Du Chateau",
-        .latitude = 46.3580083333333,
-        .longitude = 6.13258333333333,
-        .elevation = 1678,
-    },
-    {
-        .code = "LFH84",
-        .name = "Douai Usine Renault",
-        .latitude = 50.3616666666667,
-        .longitude = 3.03666666666667,
-        .elevation = 95,
-    },
-    {
-        .code = "LFH9",
-        .name = "Saint Flour Centre Hospitalier",
-        .latitude = 45.0336111111111,
-        .longitude = 3.08666666666667,
-        .elevation = 2963,
-    },
-    {
-        .code = "LFH94",
-        .name = "Flamanville",
-        .latitude = 49.5333333333333,
-        .longitude = -1.88333333333333,
-        .elevation = 269,
-    },
-    {
-        .code = "LFH95",
-        .name = "Flins",
-        .latitude = 48.9819444444444,
-        .longitude = 1.86388888888889,
-        .elevation = 82,
-    },
-    {
-        .code = "LFH98",
-        .name = "Gap Hopital",
-        .latitude = 44.5572222222222,
-        .longitude = 6.07333611111111,
-        .elevation = 2503,
-    },
-    {
-        .code = "LFH99",
-        .name = "Garches Hopital Raymond Poincare",
-        .latitude = 48.8393222222222,
-        .longitude = 2.17036666666667,
-        .elevation = 446,
-    },
-    {
-        .code = "LFHA",
-        .name = "Issoire Le Broc",
-        .latitude = 45.5138888888889,
-        .longitude = 3.26611111111111,
-        .elevation = 1240,
-    },
-    {
-        .code = "LFHC",
-        .name = "Perouges Meximieux",
-        .latitude = 45.8686111111111,
-        .longitude = 5.18611111111111,
-        .elevation = 703,
-    },
-    {
-        .code = "LFHD",
-        .name = "Pierrelatte",
-        .latitude = 44.3977777777778,
-        .longitude = 4.71694444444444,
-        .elevation = 195,
-    },
-    {
-        .code = "LFHE",
-        .name = "Romans Saint Paul",
-        .latitude = 45.0647222222222,
-        .longitude = 5.10138888888889,
-        .elevation = 595,
-    },
-    {
-        .code = "LFHF",
-        .name = "Ruoms",
-        .latitude = 44.4447222222222,
-        .longitude = 4.33277777777778,
-        .elevation = 353,
-    },
-    {
-        .code = "LFHG",
-        .name = "Saint Chamond L'horme",
-        .latitude = 45.4919444444444,
-        .longitude = 4.53444444444444,
-        .elevation = 1307,
-    },
-    {
-        .code = "LFHH",
-        .name = "Vienne Reventin",
-        .latitude = 45.4627777777778,
-        .longitude = 4.82777777777778,
-        .elevation = 720,
-    },
-    {
-        .code = "LFHI",
-        .name = "Morestel",
-        .latitude = 45.6869444444444,
-        .longitude = 5.4525,
-        .elevation = 803,
-    },
-    {
-        .code = "LFHJ",
-        .name = "Lyon Corbas",
-        .latitude = 45.6527777777778,
-        .longitude = 4.91222222222222,
-        .elevation = 652,
-    },
-    {
-        .code = "LFHL",
-        .name = "Langogne Lesperon",
-        .latitude = 44.7055555555556,
-        .longitude = 3.88722222222222,
-        .elevation = 3339,
-    },
-    {
-        .code = "LFHM",
-        .name = "Megeve",
-        .latitude = 45.8244444444444,
-        .longitude = 6.64833333333333,
-        .elevation = 4830,
-    },
-    {
-        .code = "LFHN",
-        .name = "Bellegarde Vouvray",
-        .latitude = 46.1233333333333,
-        .longitude = 5.80472222222222,
-        .elevation = 1626,
-    },
-    {
-        .code = "LFHO",
-        .name = "Aubenas Ardeche Meridionale",
-        .latitude = 44.5394194444444,
-        .longitude = 4.37173333333333,
-        .elevation = 923,
-    },
-    {
-        .code = "LFHP",
-        .name = "Le Puy Loudes",
-        .latitude = 45.0796555555556,
-        .longitude = 3.76344166666667,
-        .elevation = 2731,
-    },
-    {
-        .code = "LFHQ",
-        .name = "Saint Flour Coltines",
-        .latitude = 45.0749194444444,
-        .longitude = 2.99263611111111,
-        .elevation = 3218,
-    },
-    {
-        .code = "LFHR",
-        .name = "Brioude Beaumont",
-        .latitude = 45.3238888888889,
-        .longitude = 3.35833333333333,
-        .elevation = 1487,
-    },
-    {
-        .code = "LFHS",
-        .name = "Bourg Ceyzeriat",
-        .latitude = 46.2056194444444,
-        .longitude = 5.29179444444444,
-        .elevation = 857,
-    },
-    {
-        .code = "LFHT",
-        .name = "Ambert Le Poyet",
-        .latitude = 45.5155555555556,
-        .longitude = 3.745,
-        .elevation = 1848,
-    },
-    {
-        .code = "LFHU",
-        .name = "L'alpe D'huez",
-        .latitude = 45.0875,
-        .longitude = 6.08361111111111,
-        .elevation = 6103,
-    },
-    {
-        .code = "LFHV",
-        .name = "Villefranche Tarare",
-        .latitude = 45.9199833333333,
-        .longitude = 4.63493055555556,
-        .elevation = 1076,
-    },
-    {
-        .code = "LFHW",
-        .name = "Belleville Villie Morgon",
-        .latitude = 46.1411111111111,
-        .longitude = 4.71388888888889,
-        .elevation = 705,
-    },
-    {
-        .code = "LFHX",
-        .name = "Lapalisse Perigny",
-        .latitude = 46.2530555555556,
-        .longitude = 3.5875,
-        .elevation = 1045,
-    },
-    {
-        .code = "LFHY",
-        .name = "Moulins Montbeugny",
-        .latitude = 46.5343833333333,
-        .longitude = 3.42160555555556,
-        .elevation = 915,
-    },
-    {
-        .code = "LFHZ",
-        .name = "Sallanches Mont Blanc",
-        .latitude = 45.95,
-        .longitude = 6.63888888888889,
-        .elevation = 1756,
-    },
-    {
-        .code = "LFIB",
-        .name = "Belves Saint Pardoux",
-        .latitude = 44.7825,
-        .longitude = 0.958888888888889,
-        .elevation = 791,
-    },
-    {
-        .code = "LFID",
-        .name = "Condom Valence Sur Baise",
-        .latitude = 43.9091666666667,
-        .longitude = 0.386111111111111,
-        .elevation = 444,
-    },
-    {
-        .code = "LFIF",
-        .name = "Saint Affrique Belmont",
-        .latitude = 43.8227777777778,
-        .longitude = 2.74722222222222,
-        .elevation = 1686,
-    },
-    {
-        .code = "LFIG",
-        .name = "Cassagnes Begonhes",
-        .latitude = 44.1783333333333,
-        .longitude = 2.51777777777778,
-        .elevation = 2025,
-    },
-    {
-        .code = "LFIH",
-        .name = "Chalais",
-        .latitude = 45.2670777777778,
-        .longitude = 0.0158333333333333,
-        .elevation = 299,
-    },
-    {
-        .code = "LFIK",
-        .name = "Riberac-Tourette",
-        .latitude = 45.2394444444444,
-        .longitude = 0.265833333333333,
-        .elevation = 353,
-    },
-    {
-        .code = "LFIL",
-        .name = "Rion Des Landes",
-        .latitude = 43.9158333333333,
-        .longitude = -0.949166666666667,
-        .elevation = 256,
-    },
-    {
-        .code = "LFIM",
-        .name = "Saint Gaudens Montrejeau",
-        .latitude = 43.1075,
-        .longitude = 0.619166666666667,
-        .elevation = 1320,
-    },
-    {
-        .code = "LFIP",
-        .name = "Peyresourde Balestas",
-        .latitude = 42.7969444444444,
-        .longitude = 0.433888888888889,
-        .elevation = 5193,
-    },
-    {
-        .code = "LFIR",
-        .name = "Revel Montgey",
-        .latitude = 43.4802777777778,
-        .longitude = 1.97888888888889,
-        .elevation = 643,
-    },
-    {
-        .code = "LFIS",
-        .name = "Saint Inglevert Les Deux Caps",
-        .latitude = 50.8825,
-        .longitude = 1.73611111111111,
-        .elevation = 443,
-    },
-    {
-        .code = "LFIT",
-        .name = "Toulouse Bourg Saint Bernard",
-        .latitude = 43.6111111111111,
-        .longitude = 1.72416666666667,
-        .elevation = 526,
-    },
-    {
-        .code = "LFIV",
-        .name = "Vendays Montalivet",
-        .latitude = 45.3805555555556,
-        .longitude = -1.11583333333333,
-        .elevation = 16,
-    },
-    {
-        .code = "LFIX",
-        .name = "Itxassou",
-        .latitude = 43.3375,
-        .longitude = -1.42222222222222,
-        .elevation = 607,
-    },
-    {
-        .code = "LFIY",
-        .name = "Saint Jean D'angely Saint Denis Du Pin",
-        .latitude = 45.9652027777778,
-        .longitude = -0.524358333333333,
-        .elevation = 245,
-    },
-    {
-        .code = "LFJA",
-        .name = "Chaumont Semoutiers",
-        .latitude = 48.0916666666667,
-        .longitude = 5.05,
-        .elevation = 1001,
-    },
-    {
-        .code = "LFJB",
-        .name = "Mauleon",
-        .latitude = 46.9030555555556,
-        .longitude = -0.6975,
-        .elevation = 568,
-    },
-    {
-        .code = "LFJC",
-        .name = "Clamecy",
-        .latitude = 47.4375,
-        .longitude = 3.5075,
-        .elevation = 714,
-    },
-    {
-        .code = "LFJD",
-        .name = "Corlier",
-        .latitude = 46.0397222222222,
-        .longitude = 5.49611111111111,
-        .elevation = 2770,
-    },
-    {
-        .code = "LFJE",
-        .name = "La Motte Chalancon",
-        .latitude = 44.4966666666667,
-        .longitude = 5.40333333333333,
-        .elevation = 2883,
-    },
-    {
-        .code = "LFJF",
-        .name = "Aubenasson",
-        .latitude = 44.6952777777778,
-        .longitude = 5.15388888888889,
-        .elevation = 807,
-    },
-    {
-        .code = "LFJH",
-        .name = "Cazeres Palaminy",
-        .latitude = 43.2008333333333,
-        .longitude = 1.05,
-        .elevation = 816,
-    },
-    {
-        .code = "LFJI",
-        .name = "Marennes",
-        .latitude = 45.8238888888889,
-        .longitude = -1.07722222222222,
-        .elevation = 29,
-    },
-    {
-        .code = "LFJL",
-        .name = "Metz Nancy Lorraine",
-        .latitude = 48.9782805555556,
-        .longitude = 6.24653055555556,
-        .elevation = 870,
-    },
-    {
-        .code = "LFJR",
-        .name = "Angers Marce",
-        .latitude = 47.5602111111111,
-        .longitude = -0.312127777777778,
-        .elevation = 194,
-    },
-    {
-        .code = "LFJS",
-        .name = "Soissons Courmelles",
-        .latitude = 49.345,
-        .longitude = 3.28305555555556,
-        .elevation = 518,
-    },
-    {
-        .code = "LFJT",
-        .name = "Tours Le Louroux",
-        .latitude = 47.15,
-        .longitude = 0.712777777777778,
-        .elevation = 413,
-    },
-    {
-        .code = "LFJU",
-        .name = "Lurcy Levis",
-        .latitude = 46.7122222222222,
-        .longitude = 2.94472222222222,
-        .elevation = 747,
-    },
-    {
-        .code = "LFJV",
-        .name = "Lasclaveries",
-        .latitude = 43.4252777777778,
-        .longitude = -0.286944444444444,
-        .elevation = 843,
-    },
-    {
-        .code = "LFJY",
-        .name = "Chambley",
-        .latitude = 49.0254694444444,
-        .longitude = 5.87609166666667,
-        .elevation = 866,
-    },
-    {
-        .code = "LFKA",
-        .name = "Albertville",
-        .latitude = 45.6263888888889,
-        .longitude = 6.32888888888889,
-        .elevation = 1035,
-    },
-    {
-        .code = "LFKB",
-        .name = "Bastia Poretta",
-        .latitude = 42.55,
-        .longitude = 9.48484722222222,
-        .elevation = 26,
-    },
-    {
-        .code = "LFKC",
-        .name = "Calvi Sainte Catherine",
-        .latitude = 42.5243555555556,
-        .longitude = 8.79301111111111,
-        .elevation = 210,
-    },
-    {
-        .code = "LFKD",
-        .name = "Sollieres Sardieres",
-        .latitude = 45.2538888888889,
-        .longitude = 6.80111111111111,
-        .elevation = 4255,
-    },
-    {
-        .code = "LFKE",
-        .name = "Saint Jean En Royans",
-        .latitude = 45.0263888888889,
-        .longitude = 5.30916666666667,
-        .elevation = 872,
-    },
-    {
-        .code = "LFKF",
-        .name = "Figari Sud Corse",
-        .latitude = 41.5021083333333,
-        .longitude = 9.09674722222222,
-        .elevation = 87,
-    },
-    {
-        .code = "LFKG",
-        .name = "Ghisonaccia Alzitone",
-        .latitude = 42.0544444444444,
-        .longitude = 9.40027777777778,
-        .elevation = 177,
-    },
-    {
-        .code = "LFKH",
-        .name = "Saint Jean D'avelanne",
-        .latitude = 45.5158333333333,
-        .longitude = 5.67944444444444,
-        .elevation = 964,
-    },
-    {
-        .code = "LFKJ",
-        .name = "Ajaccio Napoleon Bonaparte",
-        .latitude = 41.9238972222222,
-        .longitude = 8.80243611111111,
-        .elevation = 19,
-    },
-    {
-        .code = "LFKK",
-        .name = "Montmeilleur",
-        .latitude = 44.7936111111111,
-        .longitude = 5.76166666666667,
-        .elevation = 2992,
-    },
-    {
-        .code = "LFKL",
-        .name = "Lyon Brindas",
-        .latitude = 45.71065,
-        .longitude = 4.69665,
-        .elevation = 1040,
-    },
-    {
-        .code = "LFKM",
-        .name = "Saint Galmier",
-        .latitude = 45.6063888888889,
-        .longitude = 4.305,
-        .elevation = 1269,
-    },
-    {
-        .code = "LFKO",
-        .name = "Propriano",
-        .latitude = 41.6602777777778,
-        .longitude = 8.89388888888889,
-        .elevation = 16,
-    },
-    {
-        .code = "LFKP",
-        .name = "La Tour Du Pin Cessieu",
-        .latitude = 45.5588888888889,
-        .longitude = 5.38388888888889,
-        .elevation = 1053,
-    },
-    {
-        .code = "LFKR",
-        .name = "Saint Remy De Maurienne",
-        .latitude = 45.3750333333333,
-        .longitude = 6.27781388888889,
-        .elevation = 1399,
-    },
-    {
-        .code = "LFKS",
-        .name = "Solenzara",
-        .latitude = 41.9262888888889,
-        .longitude = 9.40530277777778,
-        .elevation = 29,
-    },
-    {
-        .code = "LFKT",
-        .name = "Corte",
-        .latitude = 42.2902777777778,
-        .longitude = 9.1925,
-        .elevation = 1130,
-    },
-    {
-        .code = "LFKX",
-        .name = "Meribel Robert Merloz",
-        .latitude = 45.4075,
-        .longitude = 6.5775,
-        .elevation = 5639,
-    },
-    {
-        .code = "LFKY",
-        .name = "Belley-Peyrieu",
-        .latitude = 45.6938888888889,
-        .longitude = 5.69166666666667,
-        .elevation = 739,
-    },
-    {
-        .code = "LFLA",
-        .name = "Auxerre Branches",
-        .latitude = 47.8463277777778,
-        .longitude = 3.49657777777778,
-        .elevation = 523,
-    },
-    {
-        .code = "LFLB",
-        .name = "Chambery Aix Les Bains",
-        .latitude = 45.6392722222222,
-        .longitude = 5.88012222222222,
-        .elevation = 779,
-    },
-    {
-        .code = "LFLC",
-        .name = "Clermont Ferrand Auvergne",
-        .latitude = 45.7859722222222,
-        .longitude = 3.16245,
-        .elevation = 1092,
-    },
-    {
-        .code = "LFLD",
-        .name = "Bourges",
-        .latitude = 47.0607861111111,
-        .longitude = 2.37008333333333,
-        .elevation = 529,
-    },
-    {
-        .code = "LFLE",
-        .name = "Chambery Challes Les Eaux",
-        .latitude = 45.5605555555556,
-        .longitude = 5.97583333333333,
-        .elevation = 973,
-    },
-    {
-        .code = "LFLG",
-        .name = "Grenoble Le Versoud",
-        .latitude = 45.2180555555556,
-        .longitude = 5.84861111111111,
-        .elevation = 724,
-    },
-    {
-        .code = "LFLH",
-        .name = "Chalon Champforgeuil",
-        .latitude = 46.828275,
-        .longitude = 4.81705833333333,
-        .elevation = 623,
-    },
-    {
-        .code = "LFLI",
-        .name = "Annemasse",
-        .latitude = 46.1919444444444,
-        .longitude = 6.26833333333333,
-        .elevation = 1620,
-    },
-    {
-        .code = "LFLJ",
-        .name = "Courchevel",
-        .latitude = 45.3958333333333,
-        .longitude = 6.6325,
-        .elevation = 6583,
-    },
-    {
-        .code = "LFLK",
-        .name = "Oyonnax Arbent",
-        .latitude = 46.2786111111111,
-        .longitude = 5.66638888888889,
-        .elevation = 1755,
-    },
-    {
-        .code = "LFLL",
-        .name = "Lyon Saint Exupery",
-        .latitude = 45.7256388888889,
-        .longitude = 5.08110555555556,
-        .elevation = 821,
-    },
-    {
-        .code = "LFLM",
-        .name = "Macon Charnay",
-        .latitude = 46.2959222222222,
-        .longitude = 4.79585833333333,
-        .elevation = 729,
-    },
-    {
-        .code = "LFLN",
-        .name = "Saint Yan",
-        .latitude = 46.4064916666667,
-        .longitude = 4.02109722222222,
-        .elevation = 796,
-    },
-    {
-        .code = "LFLO",
-        .name = "Roanne",
-        .latitude = 46.0527777777778,
-        .longitude = 3.99972222222222,
-        .elevation = 1106,
-    },
-    {
-        .code = "LFLP",
-        .name = "Annecy Meythet",
-        .latitude = 45.930775,
-        .longitude = 6.10628888888889,
-        .elevation = 1521,
-    },
-    {
-        .code = "LFLQ",
-        .name = "Montelimar Ancone",
-        .latitude = 44.5802777777778,
-        .longitude = 4.73916666666667,
-        .elevation = 241,
-    },
-    {
-        .code = "LFLR",
-        .name = "Saint Rambert D'albon",
-        .latitude = 45.255,
-        .longitude = 4.82472222222222,
-        .elevation = 509,
-    },
-    {
-        .code = "LFLS",
-        .name = "Grenoble Isere",
-        .latitude = 45.3629361111111,
-        .longitude = 5.33266388888889,
-        .elevation = 1302,
-    },
-    {
-        .code = "LFLT",
-        .name = "Montlucon Domerat",
-        .latitude = 46.3527777777778,
-        .longitude = 2.57055555555556,
-        .elevation = 771,
-    },
-    {
-        .code = "LFLU",
-        .name = "Valence Chabeuil",
-        .latitude = 44.9155583333333,
-        .longitude = 4.96874444444444,
-        .elevation = 525,
-    },
-    {
-        .code = "LFLV",
-        .name = "Vichy Charmeil",
-        .latitude = 46.1717833333333,
-        .longitude = 3.40403333333333,
-        .elevation = 817,
-    },
-    {
-        .code = "LFLW",
-        .name = "Aurillac",
-        .latitude = 44.8975833333333,
-        .longitude = 2.41671944444444,
-        .elevation = 2096,
-    },
-    {
-        .code = "LFLX",
-        .name = "Chateauroux Deols",
-        .latitude = 46.8603138888889,
-        .longitude = 1.721125,
-        .elevation = 529,
-    },
-    {
-        .code = "LFLY",
-        .name = "Lyon Bron",
-        .latitude = 45.7295194444444,
-        .longitude = 4.93884444444444,
-        .elevation = 659,
-    },
-    {
-        .code = "LFLZ",
-        .name = "Feurs Chambeon",
-        .latitude = 45.7066666666667,
-        .longitude = 4.19694444444445,
-        .elevation = 1095,
-    },
-    {
-        .code = "LFMA",
-        .name = "Aix Les Milles",
-        .latitude = 43.5052777777778,
-        .longitude = 5.36722222222222,
-        .elevation = 368,
-    },
-    {
-        .code = "LFMC",
-        .name = "Le Luc Le Cannet",
-        .latitude = 43.3847222222222,
-        .longitude = 6.38694444444444,
-        .elevation = 265,
-    },
-    {
-        .code = "LFMD",
-        .name = "Cannes Mandelieu",
-        .latitude = 43.5463888888889,
-        .longitude = 6.95416666666667,
-        .elevation = 14,
-    },
-    {
-        .code = "LFME",
-        .name = "Nimes Courbessac",
-        .latitude = 43.8530555555556,
-        .longitude = 4.41444444444444,
-        .elevation = 197,
-    },
-    {
-        .code = "LFMF",
-        .name = "Fayence",
-        .latitude = 43.6080555555556,
-        .longitude = 6.70166666666667,
-        .elevation = 738,
-    },
-    {
-        .code = "LFMG",
-        .name = "Montagne Noire",
-        .latitude = 43.4063888888889,
-        .longitude = 1.98916666666667,
-        .elevation = 1468,
-    },
-    {
-        .code = "LFMH",
-        .name = "Saint Etienne Loire",
-        .latitude = 45.53405,
-        .longitude = 4.29731111111111,
-        .elevation = 1325,
-    },
-    {
-        .code = "LFMI",
-        .name = "Istres Le Tube",
-        .latitude = 43.5223944444444,
-        .longitude = 4.92423611111111,
-        .elevation = 82,
-    },
-    {
-        .code = "LFMK",
-        .name = "Carcassonne Salvaza",
-        .latitude = 43.2158166666667,
-        .longitude = 2.30854444444444,
-        .elevation = 434,
-    },
-    {
-        .code = "LFML",
-        .name = "Marseille Provence",
-        .latitude = 43.4366333333333,
-        .longitude = 5.21511944444444,
-        .elevation = 70,
-    },
-    {
-        .code = "LFMN",
-        .name = "Nice Cote D'azur",
-        .latitude = 43.6654055555556,
-        .longitude = 7.21498333333333,
-        .elevation = 12,
-    },
-    {
-        .code = "LFMO",
-        .name = "Orange Caritat",
-        .latitude = 44.1400888888889,
-        .longitude = 4.86858055555556,
-        .elevation = 197,
-    },
-    {
-        .code = "LFMP",
-        .name = "Perpignan Rivesaltes",
-        .latitude = 42.7408333333333,
-        .longitude = 2.86972222222222,
-        .elevation = 144,
-    },
-    {
-        .code = "LFMQ",
-        .name = "Le Castellet",
-        .latitude = 43.2522222222222,
-        .longitude = 5.78611111111111,
-        .elevation = 1391,
-    },
-    {
-        .code = "LFMR",
-        .name = "Barcelonnette Saint Pons",
-        .latitude = 44.3872222222222,
-        .longitude = 6.60916666666667,
-        .elevation = 3714,
-    },
-    {
-        .code = "LFMS",
-        .name = "Ales Cevennes",
-        .latitude = 44.0727333333333,
-        .longitude = 4.14291944444444,
-        .elevation = 668,
-    },
-    {
-        .code = "LFMT",
-        .name = "Montpellier Mediterranee",
-        .latitude = 43.5832611111111,
-        .longitude = 3.96137777777778,
-        .elevation = 17,
-    },
-    {
-        .code = "LFMU",
-        .name = "Beziers Vias",
-        .latitude = 43.3234277777778,
-        .longitude = 3.35339722222222,
-        .elevation = 56,
-    },
-    {
-        .code = "LFMV",
-        .name = "Avignon Caumont",
-        .latitude = 43.9065805555556,
-        .longitude = 4.90202777777778,
-        .elevation = 124,
-    },
-    {
-        .code = "LFMW",
-        .name = "Castelnaudary Villeneuve",
-        .latitude = 43.3111111111111,
-        .longitude = 1.92,
-        .elevation = 553,
-    },
-    {
-        .code = "LFMX",
-        .name = "Chateau Arnoux Saint Auban",
-        .latitude = 44.0586111111111,
-        .longitude = 5.99083333333333,
-        .elevation = 1507,
-    },
-    {
-        .code = "LFMY",
-        .name = "Salon De Provence",
-        .latitude = 43.6029083333333,
-        .longitude = 5.10816666666667,
-        .elevation = 197,
-    },
-    {
-        .code = "LFMZ",
-        .name = "Lezignan Corbieres",
-        .latitude = 43.175,
-        .longitude = 2.73277777777778,
-        .elevation = 204,
-    },
-    {
-        .code = "LFNA",
-        .name = "Gap Tallard",
-        .latitude = 44.4538888888889,
-        .longitude = 6.03666666666667,
-        .elevation = 1966,
-    },
-    {
-        .code = "LFNB",
-        .name = "Mende Brenoux",
-        .latitude = 44.5040805555556,
-        .longitude = 3.52763333333333,
-        .elevation = 3362,
-    },
-    {
-        .code = "LFNC",
-        .name = "Mont Dauphin Saint Crepin",
-        .latitude = 44.7005555555556,
-        .longitude = 6.59916666666667,
-        .elevation = 2963,
-    },
-    {
-        .code = "LFNE",
-        .name = "Salon Eyguieres",
-        .latitude = 43.6575,
-        .longitude = 5.01277777777778,
-        .elevation = 247,
-    },
-    {
-        .code = "LFNF",
-        .name = "Vinon",
-        .latitude = 43.7363888888889,
-        .longitude = 5.78305555555556,
-        .elevation = 903,
-    },
-    {
-        .code = "LFNG",
-        .name = "Montpellier Candillargues",
-        .latitude = 43.6101722222222,
-        .longitude = 4.07016111111111,
-        .elevation = 5,
-    },
-    {
-        .code = "LFNH",
-        .name = "Carpentras",
-        .latitude = 44.0225,
-        .longitude = 5.09,
-        .elevation = 388,
-    },
-    {
-        .code = "LFNJ",
-        .name = "Aspres Sur Buech",
-        .latitude = 44.5177777777778,
-        .longitude = 5.73611111111111,
-        .elevation = 2727,
-    },
-    {
-        .code = "LFNL",
-        .name = "Saint Martin De Londres",
-        .latitude = 43.8002777777778,
-        .longitude = 3.78166666666667,
-        .elevation = 602,
-    },
-    {
-        .code = "LFNN",
-        .name = "Narbonne",
-        .latitude = 43.1941666666667,
-        .longitude = 3.05166666666667,
-        .elevation = 10,
-    },
-    {
-        .code = "LFNO",
-        .name = "Florac Sainte Enimie",
-        .latitude = 44.2855555555556,
-        .longitude = 3.46555555555556,
-        .elevation = 3055,
-    },
-    {
-        .code = "LFNQ",
-        .name = "La Llagonne La Quillane",
-        .latitude = 42.5434611111111,
-        .longitude = 2.12002222222222,
-        .elevation = 5612,
-    },
-    {
-        .code = "LFNR",
-        .name = "Berre La Fare",
-        .latitude = 43.5366666666667,
-        .longitude = 5.1775,
-        .elevation = 108,
-    },
-    {
-        .code = "LFNS",
-        .name = "Sisteron Vaumeilh",
-        .latitude = 44.2866666666667,
-        .longitude = 5.92916666666667,
-        .elevation = 1778,
-    },
-    {
-        .code = "LFNT",
-        .name = "Avignon Pujaut",
-        .latitude = 43.9961111111111,
-        .longitude = 4.75444444444444,
-        .elevation = 146,
-    },
-    {
-        .code = "LFNU",
-        .name = "Uzes",
-        .latitude = 44.0834722222222,
-        .longitude = 4.39383333333333,
-        .elevation = 884,
-    },
-    {
-        .code = "LFNV",
-        .name = "Valreas Visan",
-        .latitude = 44.3358333333333,
-        .longitude = 4.90694444444444,
-        .elevation = 472,
-    },
-    {
-        .code = "LFNW",
-        .name = "Puivert",
-        .latitude = 42.9102777777778,
-        .longitude = 2.05472222222222,
-        .elevation = 1610,
-    },
-    {
-        .code = "LFNX",
-        .name = "Bedarieux La Tour Sur Orb",
-        .latitude = 43.6397222222222,
-        .longitude = 3.14472222222222,
-        .elevation = 1247,
-    },
-    {
-        .code = "LFNZ",
-        .name = "Le Mazet De Romanin",
-        .latitude = 43.7708333333333,
-        .longitude = 4.89444444444444,
-        .elevation = 395,
-    },
-    {
-        .code = "LFOA",
-        .name = "Avord",
-        .latitude = 47.0569444444444,
-        .longitude = 2.63888888888889,
-        .elevation = 578,
-    },
-    {
-        .code = "LFOB",
-        .name = "Beauvais Tille",
-        .latitude = 49.4544222222222,
-        .longitude = 2.11281388888889,
-        .elevation = 359,
-    },
-    {
-        .code = "LFOC",
-        .name = "Chateaudun",
-        .latitude = 48.057875,
-        .longitude = 1.37944166666667,
-        .elevation = 433,
-    },
-    {
-        .code = "LFOD",
-        .name = "Saumur Saint Florent",
-        .latitude = 47.2567305555556,
-        .longitude = -0.113552777777778,
-        .elevation = 269,
-    },
-    {
-        .code = "LFOE",
-        .name = "Evreux Fauville",
-        .latitude = 49.0286111111111,
-        .longitude = 1.22,
-        .elevation = 464,
-    },
-    {
-        .code = "LFOF",
-        .name = "Alencon Valframbert",
-        .latitude = 48.4466666666667,
-        .longitude = 0.108333333333333,
-        .elevation = 476,
-    },
-    {
-        .code = "LFOG",
-        .name = "Flers Saint Paul",
-        .latitude = 48.7497222222222,
-        .longitude = -0.594722222222222,
-        .elevation = 663,
-    },
-    {
-        .code = "LFOH",
-        .name = "Le Havre Octeville",
-        .latitude = 49.5338472222222,
-        .longitude = 0.0881194444444444,
-        .elevation = 313,
-    },
-    {
-        .code = "LFOI",
-        .name = "Abbeville",
-        .latitude = 50.1422222222222,
-        .longitude = 1.83111111111111,
-        .elevation = 220,
-    },
-    {
-        .code = "LFOJ",
-        .name = "Orleans Bricy",
-        .latitude = 47.9877777777778,
-        .longitude = 1.76055555555556,
-        .elevation = 412,
-    },
-    {
-        .code = "LFOK",
-        .name = "Chalons Vatry",
-        .latitude = 48.773325,
-        .longitude = 4.20615555555556,
-        .elevation = 586,
-    },
-    {
-        .code = "LFOL",
-        .name = "L'aigle Saint Michel",
-        .latitude = 48.7588888888889,
-        .longitude = 0.657777777777778,
-        .elevation = 787,
-    },
-    {
-        .code = "LFOM",
-        .name = "Lessay",
-        .latitude = 49.2033333333333,
-        .longitude = -1.50472222222222,
-        .elevation = 96,
-    },
-    {
-        .code = "LFON",
-        .name = "Dreux Vernouillet",
-        .latitude = 48.7058333333333,
-        .longitude = 1.36138888888889,
-        .elevation = 445,
-    },
-    {
-        .code = "LFOO",
-        .name = "Les Sables D'olonne Talmont",
-        .latitude = 46.4755555555556,
-        .longitude = -1.725,
-        .elevation = 104,
-    },
-    {
-        .code = "LFOP",
-        .name = "Rouen Vallee De Seine",
-        .latitude = 49.3909527777778,
-        .longitude = 1.18393611111111,
-        .elevation = 512,
-    },
-    {
-        .code = "LFOQ",
-        .name = "Blois Le Breuil",
-        .latitude = 47.6798333333333,
-        .longitude = 1.205775,
-        .elevation = 398,
-    },
-    {
-        .code = "LFOR",
-        .name = "Chartres Metropole",
-        .latitude = 48.4588888888889,
-        .longitude = 1.52388888888889,
-        .elevation = 509,
-    },
-    {
-        .code = "LFOS",
-        .name = "Saint Valery Vittefleur",
-        .latitude = 49.8352777777778,
-        .longitude = 0.655555555555556,
-        .elevation = 269,
-    },
-    {
-        .code = "LFOT",
-        .name = "Tours Val De Loire",
-        .latitude = 47.4319444444444,
-        .longitude = 0.723055555555556,
-        .elevation = 357,
-    },
-    {
-        .code = "LFOU",
-        .name = "Cholet Le Pontreau",
-        .latitude = 47.0819055555556,
-        .longitude = -0.877216666666667,
-        .elevation = 443,
-    },
-    {
-        .code = "LFOV",
-        .name = "Laval Entrammes",
-        .latitude = 48.03225,
-        .longitude = -0.742780555555556,
-        .elevation = 330,
-    },
-    {
-        .code = "LFOW",
-        .name = "Saint Quentin Roupy",
-        .latitude = 49.8169444444444,
-        .longitude = 3.20666666666667,
-        .elevation = 325,
-    },
-    {
-        .code = "LFOX",
-        .name = "Etampes Mondesir",
-        .latitude = 48.3811111111111,
-        .longitude = 2.07388888888889,
-        .elevation = 494,
-    },
-    {
-        .code = "LFOY",
-        .name = "Le Havre Saint Romain",
-        .latitude = 49.5438888888889,
-        .longitude = 0.359722222222222,
-        .elevation = 423,
-    },
-    {
-        .code = "LFOZ",
-        .name = "Orleans Saint Denis De L'hotel",
-        .latitude = 47.8976166666667,
-        .longitude = 2.16420833333333,
-        .elevation = 397,
-    },
-    {
-        .code = "LFPA",
-        .name = "Persan Beaumont",
-        .latitude = 49.165,
-        .longitude = 2.31166666666667,
-        .elevation = 149,
-    },
-    {
-        .code = "LFPB",
-        .name = "Paris Le Bourget",
-        .latitude = 48.969525,
-        .longitude = 2.44149166666667,
-        .elevation = 220,
-    },
-    {
-        .code = "LFPD",
-        .name = "Bernay Saint Martin",
-        .latitude = 49.1025,
-        .longitude = 0.565555555555556,
-        .elevation = 555,
-    },
-    {
-        .code = "LFPE",
-        .name = "Meaux Esbly",
-        .latitude = 48.9269444444444,
-        .longitude = 2.83388888888889,
-        .elevation = 220,
-    },
-    {
-        .code = "LFPF",
-        .name = "Beynes Thiverval",
-        .latitude = 48.8436111111111,
-        .longitude = 1.90888888888889,
-        .elevation = 371,
-    },
-    {
-        .code = "LFPG",
-        .name = "Paris Charles De Gaulle",
-        .latitude = 49.0097472222222,
-        .longitude = 2.54781944444444,
-        .elevation = 392,
-    },
-    {
-        .code = "LFPH",
-        .name = "Chelles Le Pin",
-        .latitude = 48.8966666666667,
-        .longitude = 2.60611111111111,
-        .elevation = 208,
-    },
-    {
-        .code = "LFPK",
-        .name = "Coulommiers Voisins",
-        .latitude = 48.8375,
-        .longitude = 3.01444444444444,
-        .elevation = 470,
-    },
-    {
-        .code = "LFPL",
-        .name = "Lognes Emerainville",
-        .latitude = 48.8219444444444,
-        .longitude = 2.62277777777778,
-        .elevation = 359,
-    },
-    {
-        .code = "LFPM",
-        .name = "Melun Villaroche",
-        .latitude = 48.6052833333333,
-        .longitude = 2.67078055555556,
-        .elevation = 304,
-    },
-    {
-        .code = "LFPN",
-        .name = "Toussus Le Noble",
-        .latitude = 48.7497555555556,
-        .longitude = 2.11117777777778,
-        .elevation = 538,
-    },
-    {
-        .code = "LFPO",
-        .name = "Paris Orly",
-        .latitude = 48.7232805555556,
-        .longitude = 2.37957777777778,
-        .elevation = 291,
-    },
-    {
-        .code = "LFPP",
-        .name = "Le Plessis Belleville",
-        .latitude = 49.1091666666667,
-        .longitude = 2.73694444444444,
-        .elevation = 387,
-    },
-    {
-        .code = "LFPQ",
-        .name = "Fontenay Tresigny",
-        .latitude = 48.7061111111111,
-        .longitude = 2.90277777777778,
-        .elevation = 371,
-    },
-    {
-        .code = "LFPT",
-        .name = "Pontoise Cormeilles En Vexin",
-        .latitude = 49.0966277777778,
-        .longitude = 2.04072222222222,
-        .elevation = 325,
-    },
-    {
-        .code = "LFPU",
-        .name = "Moret Episy",
-        .latitude = 48.3408333333333,
-        .longitude = 2.79777777777778,
-        .elevation = 253,
-    },
-    {
-        .code = "LFPV",
-        .name = "Villacoublay Velizy",
-        .latitude = 48.7741722222222,
-        .longitude = 2.19138888888889,
-        .elevation = 585,
-    },
-    {
-        .code = "LFPX",
-        .name = "Chavenay Villepreux",
-        .latitude = 48.8422222222222,
-        .longitude = 1.98027777777778,
-        .elevation = 424,
-    },
-    {
-        .code = "LFPZ",
-        .name = "Saint Cyr L'ecole",
-        .latitude = 48.8102777777778,
-        .longitude = 2.07333333333333,
-        .elevation = 373,
-    },
-    {
-        .code = "LFQA",
-        .name = "Reims Prunay",
-        .latitude = 49.2086888888889,
-        .longitude = 4.15658055555556,
-        .elevation = 313,
-    },
-    {
-        .code = "LFQB",
-        .name = "Troyes Barberey",
-        .latitude = 48.3216194444445,
-        .longitude = 4.01662222222222,
-        .elevation = 389,
-    },
-    {
-        .code = "LFQC",
-        .name = "Luneville Croismare",
-        .latitude = 48.5936111111111,
-        .longitude = 6.54222222222222,
-        .elevation = 790,
-    },
-    {
-        .code = "LFQD",
-        .name = "Arras Roclincourt",
-        .latitude = 50.3238888888889,
-        .longitude = 2.80277777777778,
-        .elevation = 337,
-    },
-    {
-        .code = "LFQE",
-        .name = "Etain Rouvres",
-        .latitude = 49.2290888888889,
-        .longitude = 5.67603888888889,
-        .elevation = 760,
-    },
-    {
-        .code = "LFQF",
-        .name = "Autun Bellevue",
-        .latitude = 46.9711111111111,
-        .longitude = 4.26111111111111,
-        .elevation = 1001,
-    },
-    {
-        .code = "LFQG",
-        .name = "Nevers Fourchambault",
-        .latitude = 47.0037305555556,
-        .longitude = 3.11074166666667,
-        .elevation = 602,
-    },
-    {
-        .code = "LFQH",
-        .name = "Chatillon Sur Seine",
-        .latitude = 47.8452777777778,
-        .longitude = 4.57944444444444,
-        .elevation = 906,
-    },
-    {
-        .code = "LFQJ",
-        .name = "Maubeuge Elesmes",
-        .latitude = 50.3083333333333,
-        .longitude = 4.03,
-        .elevation = 452,
-    },
-    {
-        .code = "LFQK",
-        .name = "Chalons Ecury Sur Coole",
-        .latitude = 48.9055555555556,
-        .longitude = 4.35277777777778,
-        .elevation = 321,
-    },
-    {
-        .code = "LFQL",
-        .name = "Lens Benifontaine",
-        .latitude = 50.4663888888889,
-        .longitude = 2.81972222222222,
-        .elevation = 170,
-    },
-    {
-        .code = "LFQM",
-        .name = "Besancon La Veze",
-        .latitude = 47.2053083333333,
-        .longitude = 6.08055,
-        .elevation = 1270,
-    },
-    {
-        .code = "LFQN",
-        .name = "Saint Omer Wizernes",
-        .latitude = 50.7288888888889,
-        .longitude = 2.23444444444444,
-        .elevation = 249,
-    },
-    {
-        .code = "LFQO",
-        .name = "Lille Marcq En Baroeul",
-        .latitude = 50.6872222222222,
-        .longitude = 3.07555555555556,
-        .elevation = 70,
-    },
-    {
-        .code = "LFQP",
-        .name = "Phalsbourg Bourscheid",
-        .latitude = 48.7681527777778,
-        .longitude = 7.20513055555556,
-        .elevation = 1018,
-    },
-    {
-        .code = "LFQQ",
-        .name = "Lille Lesquin",
-        .latitude = 50.563425,
-        .longitude = 3.08682222222222,
-        .elevation = 157,
-    },
-    {
-        .code = "LFQS",
-        .name = "Vitry En Artois",
-        .latitude = 50.3375,
-        .longitude = 2.99194444444444,
-        .elevation = 174,
-    },
-    {
-        .code = "LFQT",
-        .name = "Merville Calonne",
-        .latitude = 50.6166,
-        .longitude = 2.64009444444444,
-        .elevation = 61,
-    },
-    {
-        .code = "LFQU",
-        .name = "Sarre Union",
-        .latitude = 48.9508333333333,
-        .longitude = 7.07638888888889,
-        .elevation = 842,
-    },
-    {
-        .code = "LFQV",
-        .name = "Charleville Mezieres",
-        .latitude = 49.7850527777778,
-        .longitude = 4.64280833333333,
-        .elevation = 492,
-    },
-    {
-        .code = "LFQW",
-        .name = "Vesoul Frotey",
-        .latitude = 47.6386111111111,
-        .longitude = 6.20416666666667,
-        .elevation = 1249,
-    },
-    {
-        .code = "LFQX",
-        .name = "Juvancourt",
-        .latitude = 48.1138888888889,
-        .longitude = 4.81944444444444,
-        .elevation = 1147,
-    },
-    {
-        .code = "LFQY",
-        .name = "Saverne Steinbourg",
-        .latitude = 48.7533333333333,
-        .longitude = 7.42583333333333,
-        .elevation = 623,
-    },
-    {
-        .code = "LFQZ",
-        .name = "Dieuze Gueblange",
-        .latitude = 48.7744444444444,
-        .longitude = 6.71416666666667,
-        .elevation = 718,
-    },
-    {
-        .code = "LFRB",
-        .name = "Brest Bretagne",
-        .latitude = 48.4471305555556,
-        .longitude = -4.42175277777778,
-        .elevation = 325,
-    },
-    {
-        .code = "LFRC",
-        .name = "Cherbourg Maupertus",
-        .latitude = 49.650775,
-        .longitude = -1.4753,
-        .elevation = 459,
-    },
-    {
-        .code = "LFRD",
-        .name = "Dinard Pleurtuit Saint Malo",
-        .latitude = 48.5877055555556,
-        .longitude = -2.07995,
-        .elevation = 219,
-    },
-    {
-        .code = "LFRE",
-        .name = "La Baule Escoublac",
-        .latitude = 47.2883333333333,
-        .longitude = -2.34694444444444,
-        .elevation = 106,
-    },
-    {
-        .code = "LFRF",
-        .name = "Granville-Mont Saint Michel",
-        .latitude = 48.882875,
-        .longitude = -1.56383333333333,
-        .elevation = 45,
-    },
-    {
-        .code = "LFRG",
-        .name = "Deauville Normandie",
-        .latitude = 49.3633944444444,
-        .longitude = 0.159997222222222,
-        .elevation = 479,
-    },
-    {
-        .code = "LFRH",
-        .name = "Lorient Lann Bihoue",
-        .latitude = 47.7605555555556,
-        .longitude = -3.44,
-        .elevation = 159,
-    },
-    {
-        .code = "LFRI",
-        .name = "La Roche Sur Yon Les Ajoncs",
-        .latitude = 46.7023833333333,
-        .longitude = -1.38175833333333,
-        .elevation = 299,
-    },
-    {
-        .code = "LFRJ",
-        .name = "Landivisiau",
-        .latitude = 48.5302583333333,
-        .longitude = -4.15164166666667,
-        .elevation = 348,
-    },
-    {
-        .code = "LFRK",
-        .name = "Caen Carpiquet",
-        .latitude = 49.1732805555556,
-        .longitude = -0.449875,
-        .elevation = 256,
-    },
-    {
-        .code = "LFRL",
-        .name = "Lanveoc Poulmic",
-        .latitude = 48.2825305555556,
-        .longitude = -4.44369166666667,
-        .elevation = 287,
-    },
-    {
-        .code = "LFRM",
-        .name = "Le Mans Arnage",
-        .latitude = 47.9484916666667,
-        .longitude = 0.201647222222222,
-        .elevation = 194,
-    },
-    {
-        .code = "LFRN",
-        .name = "Rennes Saint Jacques",
-        .latitude = 48.0719333333333,
-        .longitude = -1.73223333333333,
-        .elevation = 124,
-    },
-    {
-        .code = "LFRO",
-        .name = "Lannion",
-        .latitude = 48.7544444444444,
-        .longitude = -3.47194444444444,
-        .elevation = 290,
-    },
-    {
-        .code = "LFRP",
-        .name = "Ploermel Loyat",
-        .latitude = 48.0018555555556,
-        .longitude = -2.37871944444444,
-        .elevation = 237,
-    },
-    {
-        .code = "LFRQ",
-        .name = "Quimper Pluguffan",
-        .latitude = 47.9749472222222,
-        .longitude = -4.167875,
-        .elevation = 293,
-    },
-    {
-        .code = "LFRS",
-        .name = "Nantes Atlantique",
-        .latitude = 47.1570194444444,
-        .longitude = -1.60780833333333,
-        .elevation = 90,
-    },
-    {
-        .code = "LFRT",
-        .name = "Saint Brieuc Armor",
-        .latitude = 48.5374916666667,
-        .longitude = -2.85654166666667,
-        .elevation = 452,
-    },
-    {
-        .code = "LFRU",
-        .name = "Morlaix Ploujean",
-        .latitude = 48.6007472222222,
-        .longitude = -3.81666944444444,
-        .elevation = 277,
-    },
-    {
-        .code = "LFRV",
-        .name = "Vannes Meucon",
-        .latitude = 47.7192444444444,
-        .longitude = -2.72337777777778,
-        .elevation = 440,
-    },
-    {
-        .code = "LFRW",
-        .name = "Avranches Le Val Saint Pere",
-        .latitude = 48.6608333333333,
-        .longitude = -1.40583333333333,
-        .elevation = 25,
-    },
-    {
-        .code = "LFRZ",
-        .name = "Saint Nazaire Montoir",
-        .latitude = 47.31065,
-        .longitude = -2.15680277777778,
-        .elevation = 13,
-    },
-    {
-        .code = "LFSA",
-        .name = "Besancon Thise",
-        .latitude = 47.2736111111111,
-        .longitude = 6.08305555555556,
-        .elevation = 807,
-    },
-    {
-        .code = "LFSB",
-        .name = "Bale-Mulhouse",
-        .latitude = 47.5898777777778,
-        .longitude = 7.52922222222222,
-        .elevation = 885,
-    },
-    {
-        .code = "LFSD",
-        .name = "Dijon-Longvic",
-        .latitude = 47.2658166666667,
-        .longitude = 5.09497777777778,
-        .elevation = 728,
-    },
-    {
-        .code = "LFSE",
-        .name = "Epinal Dogneville",
-        .latitude = 48.2113888888889,
-        .longitude = 6.44833333333333,
-        .elevation = 1041,
-    },
-    {
-        .code = "LFSF",
-        .name = "Metz Frescaty",
-        .latitude = 49.0763888888889,
-        .longitude = 6.13388888888889,
-        .elevation = 629,
-    },
-    {
-        .code = "LFSG",
-        .name = "Epinal Mirecourt",
-        .latitude = 48.3250055555556,
-        .longitude = 6.06674166666667,
-        .elevation = 1084,
-    },
-    {
-        .code = "LFSH",
-        .name = "Haguenau",
-        .latitude = 48.7969444444444,
-        .longitude = 7.81916666666667,
-        .elevation = 491,
-    },
-    {
-        .code = "LFSI",
-        .name = "Saint Dizier Robinson",
-        .latitude = 48.6335361111111,
-        .longitude = 4.90818888888889,
-        .elevation = 459,
-    },
-    {
-        .code = "LFSJ",
-        .name = "Sedan Douzy",
-        .latitude = 49.6588888888889,
-        .longitude = 5.03666666666667,
-        .elevation = 513,
-    },
-    {
-        .code = "LFSK",
-        .name = "Vitry Le Francois Vauclerc",
-        .latitude = 48.7022222222222,
-        .longitude = 4.68333333333333,
-        .elevation = 411,
-    },
-    {
-        .code = "LFSL",
-        .name = "Brive Souillac",
-        .latitude = 45.0396388888889,
-        .longitude = 1.48566666666667,
-        .elevation = 1016,
-    },
-    {
-        .code = "LFSM",
-        .name = "Montbeliard Courcelles",
-        .latitude = 47.4866611111111,
-        .longitude = 6.79146944444444,
-        .elevation = 1041,
-    },
-    {
-        .code = "LFSN",
-        .name = "Nancy Essey",
-        .latitude = 48.6920861111111,
-        .longitude = 6.22605,
-        .elevation = 757,
-    },
-    {
-        .code = "LFSO",
-        .name = "Nancy Ochey",
-        .latitude = 48.5831861111111,
-        .longitude = 5.954525,
-        .elevation = 1106,
-    },
-    {
-        .code = "LFSP",
-        .name = "Pontarlier",
-        .latitude = 46.9083333333333,
-        .longitude = 6.32916666666667,
-        .elevation = 2683,
-    },
-    {
-        .code = "LFSS",
-        .name = "Saint Sulpice Des Landes",
-        .latitude = 47.7916666666667,
-        .longitude = -1.64361111111111,
-        .elevation = 312,
-    },
-    {
-        .code = "LFST",
-        .name = "Strasbourg Entzheim",
-        .latitude = 48.5419444444444,
-        .longitude = 7.63444444444444,
-        .elevation = 505,
-    },
-    {
-        .code = "LFSU",
-        .name = "Langres Rolampont",
-        .latitude = 47.9641666666667,
-        .longitude = 5.29361111111111,
-        .elevation = 1375,
-    },
-    {
-        .code = "LFSV",
-        .name = "Pont Saint Vincent",
-        .latitude = 48.6,
-        .longitude = 6.05638888888889,
-        .elevation = 1339,
-    },
-    {
-        .code = "LFSW",
-        .name = "Epernay Plivot",
-        .latitude = 49.0044444444444,
-        .longitude = 4.08527777777778,
-        .elevation = 291,
-    },
-    {
-        .code = "LFSX",
-        .name = "Luxeuil Saint Sauveur",
-        .latitude = 47.7872222222222,
-        .longitude = 6.365,
-        .elevation = 886,
-    },
-    {
-        .code = "LFSY",
-        .name = "Cessey Baigneux Les Juifs",
-        .latitude = 47.6097222222222,
-        .longitude = 4.6175,
-        .elevation = 1175,
-    },
-    {
-        .code = "LFTB",
-        .name = "Marignane Berre",
-        .latitude = 43.45,
-        .longitude = 5.21666666666667,
-        .elevation = 0,
-    },
-    {
-        .code = "LFTF",
-        .name = "Cuers Pierrefeu",
-        .latitude = 43.2475888888889,
-        .longitude = 6.12729444444444,
-        .elevation = 269,
-    },
-    {
-        .code = "LFTH",
-        .name = "Hyeres Le Palyvestre",
-        .latitude = 43.0973444444444,
-        .longitude = 6.14603055555556,
-        .elevation = 13,
-    },
-    {
-        .code = "LFTM",
-        .name = "Serres La Batie Montsaleon",
-        .latitude = 44.4572222222222,
-        .longitude = 5.72722222222222,
-        .elevation = 2328,
-    },
-    {
-        .code = "LFTN",
-        .name = "La Grand'combe",
-        .latitude = 44.2430555555556,
-        .longitude = 4.01111111111111,
-        .elevation = 1623,
-    },
-    {
-        .code = "LFTP",
-        .name = "Puimoisson",
-        .latitude = 43.8688888888889,
-        .longitude = 6.16277777777778,
-        .elevation = 2469,
-    },
-    {
-        .code = "LFTQ",
-        .name = "Chateaubriant Pouance",
-        .latitude = 47.7405555555556,
-        .longitude = -1.18805555555556,
-        .elevation = 322,
-    },
-    {
-        .code = "LFTW",
-        .name = "Nimes Garons",
-        .latitude = 43.7574277777778,
-        .longitude = 4.41634444444444,
-        .elevation = 309,
-    },
-    {
-        .code = "LFTZ",
-        .name = "La Mole",
-        .latitude = 43.2052777777778,
-        .longitude = 6.48194444444444,
-        .elevation = 59,
-    },
-    {
-        .code = "LFXA",
-        .name = "Amberieu",
-        .latitude = 45.9797222222222,
-        .longitude = 5.33777777777778,
-        .elevation = 823,
-    },
-    {
-        .code = "LFXB",
-        .name = "Saintes Thenac",
-        .latitude = 45.7019444444445,
-        .longitude = -0.636111111111111,
-        .elevation = 118,
-    },
-    {
-        .code = "LFXG",
-        .name = "Bitche",
-        .latitude = 49.0666666666667,
-        .longitude = 7.45,
-        .elevation = 985,
-    },
-    {
-        .code = "LFXH",
-        .name = "Le Valdahon",
-        .latitude = 47.1666666666667,
-        .longitude = 6.35,
-        .elevation = 2067,
-    },
-    {
-        .code = "LFXQ",
-        .name = "Coetquidan",
-        .latitude = 47.9438888888889,
-        .longitude = -2.18194444444444,
-        .elevation = 499,
-    },
-    {
-        .code = "LFXU",
-        .name = "Les Mureaux",
-        .latitude = 48.9986111111111,
-        .longitude = 1.94166666666667,
-        .elevation = 91,
-    },
-    {
-        .code = "LFYG",
-        .name = "Cambrai Niergnies",
-        .latitude = 50.1425,
-        .longitude = 3.265,
-        .elevation = 312,
-    },
-    {
-        .code = "LFYR",
-        .name = "Romorantin Pruniers",
-        .latitude = 47.3208333333333,
-        .longitude = 1.68888888888889,
-        .elevation = 289,
-    },
-    {
-        .code = "LFYS",
-        .name = "Sainte Leocadie",
-        .latitude = 42.4472222222222,
-        .longitude = 2.01083333333333,
-        .elevation = 4331,
-    },
-    {
-        .code = "LFYV",
-        .name = "Yvetot-Baons Le Comte",
-        .latitude = 49.6386111111111,
-        .longitude = 0.7325,
-        .elevation = 463,
-    }
-};
-static size_t nfrench_airports = sizeof(french_airports) / sizeof(french_airports[0]);
-#endif /* AIRPORT_H */
@@ -5,7 +5,6 @@
  *
  * SPDX-License-Identifier: GPL-2.0-only
  */
-#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -13,11 +12,16 @@
 #include "misc.h"
 #include "list-box.h"
 #include "airports-list-model.h"
-#include "dialogs/airport.h"
 
 static AirportListModel *airport_list_model_dispose(AirportListModel *self);
+static size_t airport_list_model_get_row_count(AirportListModel *self);
+static const char *airport_list_model_get_row_label(AirportListModel *self, size_t row, size_t *len);
+static void *airport_list_model_get_row_key(AirportListModel *self, size_t row);
 static ListModelOps airport_list_model_ops = {
-    .dispose = (DisposeFunc)airport_list_model_dispose
+    .dispose = (DisposeFunc)airport_list_model_dispose,
+    .get_row_count = (ListModelRowCountFunc)airport_list_model_get_row_count,
+    .get_row_label = (ListModelRowLabelFunc)airport_list_model_get_row_label,
+    .get_row_key = (ListModelRowKeyFunc)airport_list_model_get_row_key
 };
 
 AirportListModel *airport_list_model_new()
@@ -34,55 +38,19 @@ AirportListModel *airport_list_model_new()
 
 AirportListModel *airport_list_model_init(AirportListModel *self)
 {
-    if(!list_model_init(LIST_MODEL(self), &airport_list_model_ops, nfrench_airports))
-        return NULL;
+    const SearchIndex *index;
 
-    self->nfullnames = nfrench_airports;
-    self->fullnames = malloc(sizeof(char *) * self->nfullnames);
-    if(!self->fullnames)
+    if(!list_model_init(LIST_MODEL(self), &airport_list_model_ops, 0))
         return NULL;
-#if 1
-    size_t binsize = 0;
-    for(int i = 0; i < nfrench_airports; i++){
-        binsize += strlen(french_airports[i].code);
-        binsize += 3; /* strlen(" - ") */
-        binsize += strlen(french_airports[i].name);
-        binsize += 1; /*final \0 byte */
-    }
 
-    self->namestash = malloc(sizeof(char)*binsize);
-    if(!self->namestash)
+    index = nav_db_search_index();
+    if(index && !search_index_init_from(&self->index, index))
         return NULL;
 
-    char *stashptr = self->namestash;
-    for(int i = 0; i < nfrench_airports; i++){
-        self->fullnames[i] = stashptr;
-        strcpy(stashptr, french_airports[i].code);
-        strcat(stashptr, " - ");
-        strcat(stashptr, french_airports[i].name);
-        while(*stashptr != '\0') stashptr++;
-        stashptr++;
-    }
-#else
-     for(int i = 0; i < nfrench_airports; i++){
-         asprintf(&self->fullnames[i],
-            "%s - %s",
-            french_airports[i].code,
-            french_airports[i].name
-        );
-    }
-#endif
-    LIST_MODEL(self)->maxlen = 0;
-    for(int i = 0; i < self->nfullnames; i++){
-        LIST_MODEL(self)->rows[i].key = &french_airports[i];
-        LIST_MODEL(self)->rows[i].label = self->fullnames[i];
-        LIST_MODEL(self)->row_lenghts[i] = strlen(self->fullnames[i]);
-        LIST_MODEL(self)->maxlen = MAX(
-            LIST_MODEL(self)->maxlen,
-            LIST_MODEL(self)->row_lenghts[i]
-        );
-    }
-    LIST_MODEL(self)->nrows = self->nfullnames;
+    /*The list scrolls as wide as the widest label, known by the database*/
+    LIST_MODEL(self)->maxlen = nav_db_max_label_len();
+
+    airport_list_model_filter(self, NULL);
 
     return self;
 }
@@ -90,33 +58,43 @@ AirportListModel *airport_list_model_init(AirportListModel *self)
 static AirportListModel *airport_list_model_dispose(AirportListModel *self)
 {
     list_model_dispose(LIST_MODEL(self));
-    if(self->fullnames){
-#if 0
-        for(int i = 0; i < nfrench_airports; i++){
-            if(self->fullnames[i])
-                free(self->fullnames[i]);
-        }
-#endif
-        free(self->fullnames);
-    }
-    if(self->namestash)
-        free(self->namestash);
+    search_index_dispose(&self->index);
     return self;
 }
 
+/**
+ * @brief Keeps only the airports whose "CODE - Name" contains @p filter
+ * (case-insensitive). Airports having a word starting with @p filter
+ * (e.g. the code) are listed first.
+ *
+ * Meant to be called on each keystroke: appending characters to the
+ * previous filter only goes through the previous results.
+ *
+ * @param self an AirportListModel
+ * @param filter The text to look for, NULL for all airports
+ */
 void airport_list_model_filter(AirportListModel *self, const char *filter)
 {
-    ListModel *lself = LIST_MODEL(self);
-
-    lself->nrows = 0;
-    for(int i = 0; i < self->nfullnames; i++){
-        if(!filter || strcasestr(self->fullnames[i], filter)){
-            lself->rows[lself->nrows].key = &french_airports[i];
-            lself->rows[lself->nrows].label = self->fullnames[i];
-            lself->row_lenghts[lself->nrows] = strlen(self->fullnames[i]);
-            lself->nrows++;
-        }
-    }
-    list_box_model_changed(lself->listbox);
+    self->nids = self->index.nentries ? search_index_query(&self->index, filter, &self->ids) : 0;
+    if(LIST_MODEL(self)->listbox)
+        list_box_model_changed(LIST_MODEL(self)->listbox);
+}
+
+static size_t airport_list_model_get_row_count(AirportListModel *self)
+{
+    return self->nids;
+}
+
+static const char *airport_list_model_get_row_label(AirportListModel *self, size_t row, size_t *len)
+{
+    const NavAirport *airport;
+
+    airport = nav_db_airport(self->ids[row]);
+    *len = airport->label_len;
+    return nav_db_string(airport->label);
 }
 
+static void *airport_list_model_get_row_key(AirportListModel *self, size_t row)
+{
+    return (void*)nav_db_airport(self->ids[row]);
+}
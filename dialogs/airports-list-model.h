@@ -8,15 +8,22 @@
 #ifndef AIRPORTS_LIST_MODEL_H
 #define AIRPORTS_LIST_MODEL_H
 #include "list-model.h"
-#include "airport.h"
+#include "nav-db.h"
+#include "search-index.h"
 
+/* Airports of the navigation database (see nav-db.h), listed as
+ * "CODE - Name". Row keys are const NavAirport*. Labels and the search
+ * index are used in place from the database, they must not be
+ * modified.
+ *
+ * This is a virtual model (see ListModelOps): rows are the search
+ * results, only read when the list shows them.*/
 typedef struct{
     ListModel super;
 
-    char *namestash;
-
-    char **fullnames;
-    size_t nfullnames;
+    SearchIndex index;
+    const uint32_t *ids; /*Search results, owned by the index*/
+    size_t nids;
 }AirportListModel;
 
 
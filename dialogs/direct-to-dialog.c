@@ -15,22 +15,25 @@
 #include "base-gauge.h"
 #include "base-widget.h"
 #include "sdl-colors.h"
-#include "dialogs/airports-list-model.h"
 #include "text-box.h"
 #include "text-gauge.h"
 #include "misc.h"
 #include "data-source.h"
+#include "nav-engine.h"
 
 static void direct_to_dialog_render(DirectToDialog *self, Uint32 dt, RenderContext *ctx);
+static DirectToDialog *direct_to_dialog_dispose(DirectToDialog *self);
+static void show_model(DirectToDialog *self, ListModel *model);
 static bool direct_to_dialog_handle_event(DirectToDialog *self, SDL_KeyboardEvent *event);
 static void update_list_content(TextBox *txtbx, DirectToDialog *self);
 static void selection_changed(DirectToDialog *self, ListBox *sender);
 static void button_pressed(DirectToDialog *self, Button *sender);
+static void nav_changed(DirectToDialog *self, NavData *newv);
 
 static BaseWidgetOps direct_to_dialog_ops = {
    .super.render = (RenderFunc)direct_to_dialog_render,
    .super.update_state = (StateUpdateFunc)NULL,
-   .super.dispose = (DisposeFunc)NULL,
+   .super.dispose = (DisposeFunc)direct_to_dialog_dispose,
    .handle_event = (EventHandlerFunc)direct_to_dialog_handle_event
 };
 
@@ -199,16 +202,69 @@ DirectToDialog *direct_to_dialog_init(DirectToDialog *self)
         SDLExt_RectLastY(&BASE_GAUGE(self->distance_lbl)->frame)+2
     );
 
-    list_box_set_model(self->list, LIST_MODEL(airport_list_model_new()));
+    self->airports = airport_list_model_new();
+    self->nearest = nearest_list_model_new();
+    if(!self->airports || !self->nearest)
+        return NULL;
+    show_model(self, LIST_MODEL(self->nearest));
+
+    /* Keeps bearing and distance up to date as the aircraft moves: the
+     * nav engine publishes on each location sample*/
+    self->ds = data_source_get_instance();
+    if(self->ds){
+        data_source_add_listener(self->ds, NAV_DATA, &(ValueListener){
+            .callback = (ValueListenerFunc)nav_changed,
+            .target = self
+        });
+    }
 
     self->visible = true;
     return self;
 }
 
+/*Children, the list included, are gone by now*/
+static DirectToDialog *direct_to_dialog_dispose(DirectToDialog *self)
+{
+    if(self->ds){
+        data_source_remove_listener(self->ds, NAV_DATA, &(ValueListener){
+            .callback = (ValueListenerFunc)nav_changed,
+            .target = self
+        });
+    }
+    if(self->airports && LIST_MODEL(self->airports) != self->shown)
+        list_model_free(LIST_MODEL(self->airports));
+    if(self->nearest && LIST_MODEL(self->nearest) != self->shown)
+        list_model_free(LIST_MODEL(self->nearest));
+    return self;
+}
+
+static void show_model(DirectToDialog *self, ListModel *model)
+{
+    if(self->shown == model)
+        return;
+    list_box_set_model(self->list, model);
+    self->shown = model;
+}
+
+static void show_nearest(DirectToDialog *self)
+{
+    DataSource *ds;
+
+    show_model(self, LIST_MODEL(self->nearest));
+    ds = data_source_get_instance();
+    if(ds)
+        nearest_list_model_update(self->nearest,
+            ds->location.super.latitude,
+            ds->location.super.longitude
+        );
+    else
+        list_box_model_changed(self->list);
+}
+
 void direct_to_dialog_reset(DirectToDialog *self)
 {
     text_box_set_text(self->text, NULL);
-    airport_list_model_filter((AirportListModel*)self->list->model, NULL);
+    show_nearest(self);
     self->focused->has_focus = false;
     self->focused = BASE_WIDGET(self->text);
     self->focused->has_focus = true;
@@ -244,7 +300,12 @@ static bool direct_to_dialog_handle_event(DirectToDialog *self, SDL_KeyboardEven
 
 static void update_list_content(TextBox *txtbx, DirectToDialog *self)
 {
-    airport_list_model_filter((AirportListModel*)self->list->model, txtbx->text);
+    if(!txtbx->text || !*txtbx->text){
+        show_nearest(self);
+        return;
+    }
+    show_model(self, LIST_MODEL(self->airports));
+    airport_list_model_filter(self->airports, txtbx->text);
 }
 
 static void clear_values(DirectToDialog *self)
@@ -255,16 +316,44 @@ static void clear_values(DirectToDialog *self)
     text_gauge_set_value(self->distance_value, "");
 }
 
-static void selection_changed(DirectToDialog *self, ListBox *sender)
+/* Bearing and distance to the selection. Those of the destination of
+ * the active leg are already known by the nav engine (@p nav), others
+ * are computed from the position @p nav was computed at: DataSource's
+ * location isn't updated yet when NAV_DATA listeners are called*/
+static void update_values(DirectToDialog *self, NavData *nav)
 {
-    DataSource *ds;
-    GeoLocation me, ap;
+    NavData data;
+
+    if(nav->active
+       && self->ds->route.to.latitude == self->selection.latitude
+       && self->ds->route.to.longitude == self->selection.longitude){
+        data = *nav;
+    }else{
+        nav_leg_compute(&self->selection_leg,
+            nav->position.latitude,
+            nav->position.longitude,
+            &data
+        );
+    }
+    /* 4-digits are enough to represent the longest NM distance
+     * between two points on earth */
+    text_gauge_set_value_formatn(self->distance_value, 4, "%d", (int)round(data.distance));
+    text_gauge_set_value_formatn(self->bearing_value, 4, "%d\x8f", (int)round(data.bearing));
+}
 
-    ListModelRow *row = list_box_get_selected(sender);
-    if(!row){
+static void nav_changed(DirectToDialog *self, NavData *newv)
+{
+    if(self->visible && self->has_selection)
+        update_values(self, newv);
+}
+
+static void selection_changed(DirectToDialog *self, ListBox *sender)
+{
+    const NavAirport *airport = list_box_get_selected(sender);
+    if(!airport){
+        self->has_selection = false;
         return clear_values(self);
     }
-    Airport *airport = (Airport*)row->key;
 
     geo_location_latitude_to_dms(airport->latitude, self->latitude->value);
     self->latitude->len = strlen(self->latitude->value);
@@ -275,26 +364,17 @@ static void selection_changed(DirectToDialog *self, ListBox *sender)
     self->longitude->len = strlen(self->longitude->value);
     BASE_GAUGE(self->longitude)->dirty = true;
 
-    ds = data_source_get_instance();
-    if(!ds) return;
-
-    me = *(GeoLocation*)&ds->location;
-    ap = (GeoLocation){airport->latitude, airport->longitude};
-
-    double distance = geo_location_distance_to(&me, &ap);
-    distance /= 1852; /*convert to NM*/
-    /* 4-digits are enough to represent the longest NM distance
-     * between two points on earth */
-    text_gauge_set_value_formatn(self->distance_value, 4, "%d", (int)round(distance));
-
-    double bearing = geo_location_bearing(&me, &ap);
-    text_gauge_set_value_formatn(self->bearing_value, 4, "%d\x8f", (int)round(bearing));
+    self->has_selection = true;
+    self->selection = (GeoLocation){airport->latitude, airport->longitude};
+    nav_leg_init(&self->selection_leg, &self->selection, &self->selection);
+    if(self->ds)
+        update_values(self, &self->ds->nav);
 
 #if 0
     printf("Current selection: code: %s name: %s latitude: %f "
         "longitude: %f elevation: %d\n",
-        airport->code,
-        airport->name,
+        nav_db_string(airport->code),
+        nav_db_string(airport->name),
         airport->latitude,
         airport->longitude,
         airport->elevation
@@ -305,19 +385,18 @@ static void selection_changed(DirectToDialog *self, ListBox *sender)
 
 static void button_pressed(DirectToDialog *self, Button *sender)
 {
-    ListModelRow *row = list_box_get_selected(self->list);
-    if(!row){
+    const NavAirport *airport = list_box_get_selected(self->list);
+    if(!airport){
         return clear_values(self);
     }
-    Airport *airport = (Airport*)row->key;
 
     DataSource *ds = data_source_get_instance();
     if(!ds) return;
 
     printf("Current selection: code: %s name: %s latitude: %f "
         "longitude: %f elevation: %d\n",
-        airport->code,
-        airport->name,
+        nav_db_string(airport->code),
+        nav_db_string(airport->name),
         airport->latitude,
         airport->longitude,
         airport->elevation
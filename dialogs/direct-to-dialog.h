@@ -12,6 +12,9 @@
 #include "list-box.h"
 #include "text-box.h"
 #include "text-gauge.h"
+#include "dialogs/airports-list-model.h"
+#include "dialogs/nearest-list-model.h"
+#include "nav-engine.h"
 
 typedef struct{
     BaseWidget super;
@@ -19,6 +22,11 @@ typedef struct{
 
     TextBox *text;
     ListBox *list;
+    /* Nearest airports until something is typed, then the search
+     * results. The list owns the one it shows, the dialog the other.*/
+    AirportListModel *airports;
+    NearestListModel *nearest;
+    ListModel *shown;
 
     TextGauge *bearing_lbl;
     TextGauge *distance_lbl;
@@ -32,6 +40,12 @@ typedef struct{
 
     Button *validate_button;
 
+    bool has_selection;
+    GeoLocation selection;
+    NavLeg selection_leg;
+
+    DataSource *ds; /*listened to for NAV_DATA*/
+
     BaseWidget *focused;
 }DirectToDialog;
 
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "misc.h"
+#include "list-box.h"
+#include "nearest-list-model.h"
+
+static NearestListModel *nearest_list_model_dispose(NearestListModel *self);
+static ListModelOps nearest_list_model_ops = {
+    .dispose = (DisposeFunc)nearest_list_model_dispose
+};
+
+NearestListModel *nearest_list_model_new()
+{
+    NearestListModel *self;
+
+    self = calloc(1, sizeof(NearestListModel));
+    if(self){
+        if(!nearest_list_model_init(self))
+            return (NearestListModel*)list_model_free(LIST_MODEL(self));
+    }
+    return self;
+}
+
+NearestListModel *nearest_list_model_init(NearestListModel *self)
+{
+    if(!list_model_init(LIST_MODEL(self), &nearest_list_model_ops, NEAREST_LIST_SIZE))
+        return NULL;
+    LIST_MODEL(self)->nrows = 0;
+    LIST_MODEL(self)->maxlen = 0;
+
+    return self;
+}
+
+static void nearest_list_model_clear(NearestListModel *self)
+{
+    for(int i = 0; i < NEAREST_LIST_SIZE; i++){
+        if(self->labels[i]){
+            free(self->labels[i]);
+            self->labels[i] = NULL;
+        }
+    }
+    LIST_MODEL(self)->nrows = 0;
+    LIST_MODEL(self)->maxlen = 0;
+}
+
+static NearestListModel *nearest_list_model_dispose(NearestListModel *self)
+{
+    nearest_list_model_clear(self);
+    list_model_dispose(LIST_MODEL(self));
+    return self;
+}
+
+/**
+ * @brief Lists the airports closest to a position, using the spatial
+ * index of the navigation database.
+ *
+ * @param self a NearestListModel
+ * @param latitude Latitude of the position, in degrees
+ * @param longitude Longitude of the position, in degrees
+ */
+void nearest_list_model_update(NearestListModel *self, double latitude, double longitude)
+{
+    ListModel *lself = LIST_MODEL(self);
+    const NavAirport *airport;
+    size_t nfound;
+    int len;
+
+    nearest_list_model_clear(self);
+    nfound = nav_db_find_nearest(latitude, longitude, NEAREST_LIST_SIZE, self->neighbors);
+    for(size_t i = 0; i < nfound; i++){
+        airport = nav_db_airport(self->neighbors[i].id);
+        len = asprintf(&self->labels[lself->nrows], "%4dNM %s",
+            (int)round(self->neighbors[i].distance / 1852), /*NM*/
+            nav_db_string(airport->label)
+        );
+        if(len < 0){
+            self->labels[lself->nrows] = NULL;
+            break;
+        }
+        lself->rows[lself->nrows].key = (void*)airport;
+        lself->rows[lself->nrows].label = self->labels[lself->nrows];
+        lself->row_lenghts[lself->nrows] = len;
+        lself->maxlen = MAX(lself->maxlen, len);
+        lself->nrows++;
+    }
+    if(lself->listbox)
+        list_box_model_changed(lself->listbox);
+}
@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef NEAREST_LIST_MODEL_H
+#define NEAREST_LIST_MODEL_H
+#include "list-model.h"
+#include "nav-db.h"
+
+#define NEAREST_LIST_SIZE 25
+
+/* Airports of the navigation database closest to a position, nearest
+ * first, listed as "DISTNM CODE - Name". Row keys are const
+ * NavAirport*, like AirportListModel.*/
+typedef struct{
+    ListModel super;
+
+    NavDbNeighbor neighbors[NEAREST_LIST_SIZE];
+    char *labels[NEAREST_LIST_SIZE];
+}NearestListModel;
+
+NearestListModel *nearest_list_model_new();
+NearestListModel *nearest_list_model_init(NearestListModel *self);
+
+void nearest_list_model_update(NearestListModel *self, double latitude, double longitude);
+#endif /* NEAREST_LIST_MODEL_H */
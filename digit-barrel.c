@@ -13,6 +13,7 @@
 #include "digit-barrel.h"
 #include "sdl-colors.h"
 #include "misc.h"
+#include "raster.h"
 
 
 DigitBarrel *digit_barrel_new(PCF_Font *font, float start, float end, float step)
@@ -218,15 +219,12 @@ void digit_barrel_draw_etch_marks(DigitBarrel *self)
 
     generic_layer_lock(layer);
 
-    Uint32 *pixels = layer->canvas->pixels;
     Uint32 color = SDL_UYELLOW(layer->canvas);
     float count = 0;
     for(float y = self->fei; round(y) < generic_layer_h(layer); y += self->symbol_h/2.0){
         iy = round(y);
 //        printf("%0.2f y = %d\n",count,iy);
-        for(int x = 0; x < generic_layer_w(layer); x++){
-            pixels[iy * generic_layer_w(layer) + x] = color;
-        }
+        raster_hspan(layer->canvas, 0, generic_layer_w(layer) - 1, iy, color);
         count += 5.0;
     }
     generic_layer_unlock(layer);
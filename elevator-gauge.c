@@ -16,6 +16,7 @@
 
 #include "elevator-gauge.h"
 #include "misc.h"
+#include "raster.h"
 #include "res-dirs.h"
 
 static void elevator_gauge_render(ElevatorGauge *self, Uint32 dt, RenderContext *ctx);
@@ -231,11 +232,11 @@ static bool elevator_gauge_build_elevator(ElevatorGauge *self, Uint32 color)
            ? 4
            : self->elevator->canvas->w;
     generic_layer_lock(self->elevator);
-    Uint32 *pixels = self->elevator->canvas->pixels;
-    for(int y = 4; y < self->elevator->canvas->h; y++){
-        for(int x = startx; x < endx; x++)
-            pixels[y * self->elevator->canvas->w + x] = color;
-    }
+    raster_fill_rect(self->elevator->canvas,
+        startx, 4,
+        endx - 1, self->elevator->canvas->h - 1,
+        color
+    );
     generic_layer_unlock(self->elevator);
 
     generic_layer_build_texture(self->elevator);
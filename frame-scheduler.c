@@ -0,0 +1,304 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "frame-scheduler.h"
+
+#define NS_PER_MS 1000000ull
+#define NS_PER_S 1000000000ull
+
+/* Load shedding thresholds, in percent of the period. Enter (or deepen)
+ * skipping after OVER_FRAMES consecutive frames above OVER_PCT, back off
+ * one level after UNDER_FRAMES consecutive frames under UNDER_PCT.
+ */
+#define OVER_PCT 90
+#define OVER_FRAMES 3
+#define UNDER_PCT 50
+#define UNDER_FRAMES 50
+
+static Uint32 wake_event = (Uint32)-1;
+
+static inline uint64_t frame_scheduler_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_S + ts.tv_nsec;
+}
+
+static void frame_scheduler_sleep_until(uint64_t when)
+{
+    struct timespec ts = {
+        .tv_sec = when / NS_PER_S,
+        .tv_nsec = when % NS_PER_S
+    };
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+}
+
+/**
+ * @brief Sets up a scheduler
+ *
+ * @param self a FrameScheduler
+ * @param fps The target frame rate
+ * @param vsync true if the swap is synchronized to the display, in which
+ * case the scheduler will only account for frames and let the flip pace
+ * the loop.
+ * @return self on success, NULL on failure
+ */
+FrameScheduler *frame_scheduler_init(FrameScheduler *self, uint32_t fps, bool vsync)
+{
+    if(!fps) return NULL;
+
+    memset(self, 0, sizeof(FrameScheduler));
+    self->period = NS_PER_S / fps;
+    self->vsync = vsync;
+    if(wake_event == (Uint32)-1)
+        wake_event = SDL_RegisterEvents(1);
+
+    return self;
+}
+
+void frame_scheduler_dispose(FrameScheduler *self)
+{
+    /*Nothing to free for now*/
+}
+
+/**
+ * @brief Marks the beginning of a frame.
+ *
+ * @param self a FrameScheduler
+ * @return The time elapsed since the beginning of the previous frame,
+ * in milliseconds. Sub-millisecond parts are carried over to the
+ * next frame so that animations don't drift.
+ */
+Uint32 frame_scheduler_begin(FrameScheduler *self)
+{
+    uint64_t now;
+    uint64_t dt;
+
+    now = frame_scheduler_now();
+    if(!self->frame_start){ /*First frame*/
+        self->frame_start = now;
+        self->deadline = now + self->period;
+        return 0;
+    }
+
+    dt = now - self->frame_start + self->dt_carry;
+    self->dt_carry = dt % NS_PER_MS;
+    self->frame_start = now;
+    self->work_end = 0;
+
+    /* Deadlines are kept on a fixed grid to avoid accumulating
+     * drift. If we fell behind by more than a period, re-anchor
+     * instead of rushing through frames to catch up.*/
+    self->deadline += self->period;
+    if(self->deadline < now)
+        self->deadline = now + self->period;
+
+    return dt / NS_PER_MS;
+}
+
+static void frame_scheduler_adapt(FrameScheduler *self)
+{
+    if(self->last_work * 100 > self->period * OVER_PCT){
+        self->under_streak = 0;
+        if(++self->over_streak >= OVER_FRAMES && self->skip_level < FRAME_SCHEDULER_MAX_SKIP){
+            self->skip_level++;
+            self->over_streak = 0;
+        }
+    }else if(self->last_work * 100 < self->period * UNDER_PCT){
+        self->over_streak = 0;
+        if(++self->under_streak >= UNDER_FRAMES && self->skip_level > 0){
+            self->skip_level--;
+            self->under_streak = 0;
+        }
+    }else{
+        self->over_streak = 0;
+        self->under_streak = 0;
+    }
+}
+
+/**
+ * @brief Marks the end of the frame's rendering, to be called right
+ * before the flip. With vsync the flip blocks until the vertical blank:
+ * counting it as work would make every frame look over budget.
+ *
+ * @param self a FrameScheduler
+ */
+void frame_scheduler_work_done(FrameScheduler *self)
+{
+    self->work_end = frame_scheduler_now();
+}
+
+/**
+ * @brief Marks the end of the frame and sleeps until the next frame is
+ * due, unless vsync already paces the loop. The frame's work ends at
+ * frame_scheduler_work_done, or now if it hasn't been called.
+ */
+void frame_scheduler_end(FrameScheduler *self)
+{
+    uint64_t now;
+
+    now = frame_scheduler_now();
+    if(!self->work_end)
+        self->work_end = now;
+    self->last_work = self->work_end - self->frame_start;
+    self->nframes++;
+
+    if(self->work_end > self->deadline){
+        uint64_t overrun = self->work_end - self->deadline;
+        self->missed++;
+        if(overrun > self->worst_overrun)
+            self->worst_overrun = overrun;
+    }
+    frame_scheduler_adapt(self);
+
+    if(!self->vsync && now < self->deadline)
+        frame_scheduler_sleep_until(self->deadline);
+}
+
+/**
+ * @brief Ends a frame that has not been rendered because it would have
+ * been identical to the previous one. Instead of sleeping, waits on the
+ * SDL event queue until the next deadline so that input (or a
+ * frame_scheduler_wake from another thread) starts the next frame
+ * right away.
+ *
+ * Idle frames don't count as rendered frames nor as missed deadlines.
+ */
+void frame_scheduler_idle(FrameScheduler *self)
+{
+    uint64_t now;
+
+    now = frame_scheduler_now();
+    self->idle++;
+    if(now >= self->deadline)
+        return;
+
+    SDL_WaitEventTimeout(NULL, (self->deadline - now + NS_PER_MS - 1) / NS_PER_MS);
+}
+
+/**
+ * @brief Wakes up the main loop if it is waiting in frame_scheduler_idle.
+ * Thread-safe, meant to be used by threads producing data.
+ */
+void frame_scheduler_wake(void)
+{
+    SDL_Event event;
+
+    if(wake_event == (Uint32)-1)
+        return;
+
+    SDL_zero(event);
+    event.type = wake_event;
+    SDL_PushEvent(&event);
+}
+
+static bool scheduled_gauge_ensure_cache(ScheduledGauge *self)
+{
+    if(self->cache) return true;
+
+    self->cache = generic_layer_new(base_gauge_w(self->gauge), base_gauge_h(self->gauge));
+    if(!self->cache) return false;
+#if USE_SDL_GPU
+    if(!generic_layer_build_texture(self->cache))
+        goto fail;
+    self->cache_target = GPU_LoadTarget(self->cache->texture);
+    if(!self->cache_target)
+        goto fail;
+#endif
+    return true;
+#if USE_SDL_GPU
+fail:
+    generic_layer_free(self->cache);
+    self->cache = NULL;
+    return false;
+#endif
+}
+
+static void scheduled_gauge_render_cache(ScheduledGauge *self, Uint32 dt)
+{
+    SDL_Rect whole = {0, 0, base_gauge_w(self->gauge), base_gauge_h(self->gauge)};
+    RenderTarget target;
+
+#if USE_SDL_GPU
+    GPU_Clear(self->cache_target);
+    target.target = self->cache_target;
+#else
+    SDL_FillRect(self->cache->canvas, NULL, 0x00000000);
+    target.surface = self->cache->canvas;
+#endif
+    base_gauge_render(self->gauge, dt, &(RenderContext){target, &whole, NULL});
+    self->cache_valid = true;
+}
+
+/**
+ * @brief Renders a top-level gauge according to its priority and the
+ * current load.
+ *
+ * Critical gauges are always rendered. When the scheduler is shedding
+ * load, skippable gauges are rendered once every 2^skip_level frames
+ * into an offscreen cache that gets blitted on the other frames.
+ * Time elapsed during skipped frames is handed to the gauge on the next
+ * real render so animations stay on schedule.
+ */
+void frame_scheduler_render(FrameScheduler *self, ScheduledGauge *sg, Uint32 dt, RenderContext *ctx)
+{
+    bool render;
+
+    dt += sg->pending_dt;
+    sg->pending_dt = 0;
+
+    if(sg->priority == FRAME_CRITICAL || !self->skip_level){
+        sg->cache_valid = false;
+        base_gauge_render(sg->gauge, dt, ctx);
+        return;
+    }
+
+    if(!scheduled_gauge_ensure_cache(sg)){
+        base_gauge_render(sg->gauge, dt, ctx);
+        return;
+    }
+
+    render = !sg->cache_valid || (self->nframes % (1 << self->skip_level)) == 0;
+    if(render){
+        scheduled_gauge_render_cache(sg, dt);
+    }else{
+        sg->pending_dt = dt;
+        self->skipped++;
+    }
+    base_gauge_blit_layer(sg->gauge, ctx, sg->cache, NULL, NULL);
+}
+
+void scheduled_gauge_dispose(ScheduledGauge *self)
+{
+    if(self->cache){
+#if USE_SDL_GPU
+        if(self->cache_target)
+            GPU_FreeTarget(self->cache_target);
+#endif
+        generic_layer_free(self->cache);
+    }
+    self->cache = NULL;
+}
+
+void frame_scheduler_print_stats(FrameScheduler *self)
+{
+    printf("Frame scheduler: %lu frames, %lu idle, %lu missed deadlines (%.2f%%), worst overrun %.2f ms, %lu skipped gauge renders\n",
+        (unsigned long)self->nframes,
+        (unsigned long)self->idle,
+        (unsigned long)self->missed,
+        self->nframes ? self->missed * 100.0 / self->nframes : 0.0,
+        self->worst_overrun / (double)NS_PER_MS,
+        (unsigned long)self->skipped
+    );
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "base-gauge.h"
+#include "generic-layer.h"
+#include "misc.h"
+
+#define FRAME_SCHEDULER_DEFAULT_FPS 50
+#define FRAME_SCHEDULER_MAX_SKIP 3 /*skippable gauges render 1 frame out of 2^level*/
+
+typedef enum{
+    FRAME_CRITICAL, /*Always rendered: PFD*/
+    FRAME_SKIPPABLE /*Can be rendered at a lower rate when over budget*/
+}FramePriority;
+
+/* A top-level gauge as seen by the scheduler. Skippable gauges
+ * are rendered into @cache while the scheduler is shedding load
+ * so that skipped frames only cost a single blit.
+ */
+typedef struct{
+    BaseGauge *gauge;
+    FramePriority priority;
+
+    GenericLayer *cache;
+#if USE_SDL_GPU
+    GPU_Target *cache_target;
+#endif
+    bool cache_valid;
+    Uint32 pending_dt; /*dt accumulated over skipped frames*/
+}ScheduledGauge;
+
+typedef struct{
+    uint64_t period; /*nanoseconds*/
+    bool vsync; /*The flip blocks, don't sleep*/
+
+    uint64_t frame_start; /*CLOCK_MONOTONIC, nanoseconds*/
+    uint64_t deadline; /*end of the current frame*/
+    uint64_t work_end; /*see frame_scheduler_work_done, 0 until then*/
+    uint64_t last_work; /*duration of the last frame, excluding sleep and flip*/
+    uint64_t dt_carry; /*sub-millisecond remainder of dt*/
+
+    uintf8_t skip_level;
+    uint32_t over_streak;
+    uint32_t under_streak;
+
+    /*stats*/
+    uint64_t nframes;
+    uint64_t missed; /*frames whose work ended past the deadline*/
+    uint64_t skipped; /*gauge renders replaced by a cached blit*/
+    uint64_t worst_overrun;
+    uint64_t idle; /*frames not rendered because nothing changed*/
+}FrameScheduler;
+
+FrameScheduler *frame_scheduler_init(FrameScheduler *self, uint32_t fps, bool vsync);
+void frame_scheduler_dispose(FrameScheduler *self);
+
+Uint32 frame_scheduler_begin(FrameScheduler *self);
+void frame_scheduler_work_done(FrameScheduler *self);
+void frame_scheduler_end(FrameScheduler *self);
+void frame_scheduler_idle(FrameScheduler *self);
+void frame_scheduler_wake(void);
+
+void frame_scheduler_render(FrameScheduler *self, ScheduledGauge *sg, Uint32 dt, RenderContext *ctx);
+void scheduled_gauge_dispose(ScheduledGauge *self);
+
+void frame_scheduler_print_stats(FrameScheduler *self);
+#endif /* FRAME_SCHEDULER_H */
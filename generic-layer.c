@@ -11,6 +11,7 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 
+#include "asset-blob.h"
 #include "generic-layer.h"
 
 #include "SDL_gpu.h"
@@ -204,6 +205,10 @@ void generic_layer_unref(GenericLayer *self)
  * @p self is assumed to be non-inited: No checks are made, no resources
  * are freed.
  *
+ * A baked copy of the file (see asset-blob.h) is used instead if there
+ * is an up-to-date one. The canvas is then RGBA32, whatever the format
+ * of the file.
+ *
  * @param self a GenericLayer
  * @param filename The file to read from.
  * @return true on success, false otherwise. The error - as set by SDL_Image -
@@ -211,13 +216,44 @@ void generic_layer_unref(GenericLayer *self)
  */
 bool generic_layer_init_from_file(GenericLayer *self, const char *filename)
 {
-    self->canvas = IMG_Load(filename);
+    self->canvas = asset_blob_get_surface(filename, filename);
+    if(!self->canvas){
+        self->canvas = IMG_Load(filename);
+        asset_blob_record(filename, self->canvas, filename);
+    }
 #if USE_SDL_GPU
     self->texture = NULL;
 #endif
     return self->canvas != NULL;
 }
 
+/**
+ * @brief Converts the canvas to the given pixel format, if it isn't
+ * already in it. Must be called before the texture is built.
+ *
+ * @param self a GenericLayer with a canvas
+ * @param format a SDL_PixelFormatEnum value
+ * @return true on success, false otherwise. On failure the canvas is
+ * left untouched.
+ */
+bool generic_layer_convert(GenericLayer *self, Uint32 format)
+{
+    SDL_Surface *tmp;
+
+    if(self->canvas->format->format == format)
+        return true;
+
+    tmp = SDL_ConvertSurfaceFormat(self->canvas, format, 0);
+    if(!tmp){
+        printf("Couldn't convert layer canvas: %s\n", SDL_GetError());
+        return false;
+    }
+    SDL_FreeSurface(self->canvas);
+    self->canvas = tmp;
+
+    return true;
+}
+
 
 /**
  * @brief Creates a texture from the canvas.
@@ -227,7 +263,9 @@ bool generic_layer_init_from_file(GenericLayer *self, const char *filename)
  *
  * @note If no texture support is built, this
  * funtion will always return true.
- * TODO: Get rid of the surface ?
+ *
+ * @see generic_layer_release_canvas for layers that won't
+ * change afterwards.
  */
 bool generic_layer_build_texture(GenericLayer *self)
 {
@@ -249,15 +287,91 @@ bool generic_layer_build_texture(GenericLayer *self)
  * @param self a GenericLayer
  *
  * @see generic_layer_build_texture
+ * @see generic_layer_update_texture_rect
  */
 void generic_layer_update_texture(GenericLayer *self)
+{
+    generic_layer_update_texture_rect(self, NULL);
+}
+
+/**
+ * @brief Updates the part of the texture covered by @p rect from the
+ * content of the canvas. Meant for layers that are redrawn often:
+ * only the changed area is sent to the GPU and, as GenericLayer
+ * canvases are RGBA32, pixels are uploaded straight from the surface
+ * without the intermediate conversion GPU_UpdateImage may do.
+ *
+ * @param self a GenericLayer
+ * @param rect The area to update, in canvas coordinates. NULL for
+ * the whole layer.
+ */
+void generic_layer_update_texture_rect(GenericLayer *self, SDL_Rect *rect)
 {
 #if USE_SDL_GPU
-    if(self->texture)
-        GPU_UpdateImage(self->texture, NULL, self->canvas, NULL);
-    else
+    SDL_Rect area;
+    GPU_Rect garea;
+    Uint8 *bytes;
+
+    if(!self->canvas) return; /*Released, immutable*/
+    if(!self->texture){
         generic_layer_build_texture(self);
+        return;
+    }
+
+    area = rect ? *rect : (SDL_Rect){0, 0, self->canvas->w, self->canvas->h};
+    garea = (GPU_Rect){area.x, area.y, area.w, area.h};
+    if(self->canvas->format->format == SDL_PIXELFORMAT_RGBA32
+       && self->texture->format == GPU_FORMAT_RGBA){
+        bytes = (Uint8*)self->canvas->pixels
+              + area.y * self->canvas->pitch
+              + area.x * self->canvas->format->BytesPerPixel;
+        GPU_UpdateImageBytes(self->texture, &garea, bytes, self->canvas->pitch);
+    }else{
+        GPU_UpdateImage(self->texture, &garea, self->canvas, &garea);
+    }
 #endif
 }
 
+static size_t released_bytes = 0;
+
+/**
+ * @brief Frees the canvas of a layer that won't be drawn on anymore,
+ * keeping only the texture. Halves the memory used by immutable
+ * layers (map tiles, ladder pages, markers).
+ *
+ * Once released, the canvas is NULL and must not be accessed. The
+ * layer can only be blitted. generic_layer_w/h still work.
+ *
+ * Does nothing on the software rendering path or if the texture
+ * couldn't be built, as the canvas is then the only copy.
+ *
+ * @param self a GenericLayer with a texture
+ * @return The number of bytes released
+ */
+size_t generic_layer_release_canvas(GenericLayer *self)
+{
+#if USE_SDL_GPU
+    size_t rv;
+
+    if(!self->canvas || !self->texture)
+        return 0;
+
+    rv = self->canvas->h * self->canvas->pitch;
+    SDL_FreeSurface(self->canvas);
+    self->canvas = NULL;
 
+    released_bytes += rv;
+    return rv;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Total number of bytes released through generic_layer_release_canvas
+ * since startup.
+ */
+size_t generic_layer_get_released_bytes(void)
+{
+    return released_bytes;
+}
@@ -28,8 +28,17 @@ typedef struct{
 #define generic_layer_lock(self) SDL_LockSurface((self)->canvas)
 #define generic_layer_unlock(self) SDL_UnlockSurface((self)->canvas)
 
+/* Immutable layers can drop their canvas once the texture has been
+ * built (see generic_layer_release_canvas), dimensions then come from
+ * the texture.
+ */
+#if USE_SDL_GPU
+#define generic_layer_w(self) ((self)->canvas ? (self)->canvas->w : (self)->texture->w)
+#define generic_layer_h(self) ((self)->canvas ? (self)->canvas->h : (self)->texture->h)
+#else
 #define generic_layer_w(self) ((self)->canvas->w)
 #define generic_layer_h(self) ((self)->canvas->h)
+#endif
 
 GenericLayer *generic_layer_new(int width, int height);
 GenericLayer *generic_layer_new_from_file(const char *filename);
@@ -37,6 +46,7 @@ GenericLayer *generic_layer_new_from_file(const char *filename);
 bool generic_layer_init(GenericLayer *self, int width, int height);
 bool generic_layer_init_with_masks(GenericLayer *self, int width, int height, Uint32 Rmask, Uint32 Gmask, Uint32 Bmask, Uint32 Amask);
 bool generic_layer_init_from_file(GenericLayer *self, const char *filename);
+bool generic_layer_convert(GenericLayer *self, Uint32 format);
 
 void generic_layer_dispose(GenericLayer *self);
 void generic_layer_free(GenericLayer *self);
@@ -46,4 +56,8 @@ void generic_layer_unref(GenericLayer *self);
 
 bool generic_layer_build_texture(GenericLayer *self);
 void generic_layer_update_texture(GenericLayer *self);
+void generic_layer_update_texture_rect(GenericLayer *self, SDL_Rect *rect);
+size_t generic_layer_release_canvas(GenericLayer *self);
+
+size_t generic_layer_get_released_bytes(void);
 #endif /* GENERIC_LAYER_H */
@@ -13,6 +13,7 @@
 #include "SDL_surface.h"
 #include "generic-layer.h"
 #include "misc.h"
+#include "raster.h"
 #include "view.h"
 
 #define TEXT_SPACE 4
@@ -351,7 +352,6 @@ bool generic_ruler_draw_zones(GenericRuler *self, Location spine_location, int n
     /* Colored areas, if any are assumed to be sorted
      * */
     SDL_LockSurface(GENERIC_LAYER(self)->canvas);
-    Uint32 *pixels = GENERIC_LAYER(self)->canvas->pixels;
     for(int i = 0; i < nzones; i++){
         begin = generic_ruler_get_pixel_increment_for(self, zones[i].from);
         end = generic_ruler_get_pixel_increment_for(self, zones[i].to);
@@ -368,30 +368,32 @@ bool generic_ruler_draw_zones(GenericRuler *self, Location spine_location, int n
             zones[i].color.a
         );
         if(self->orientation == RulerHorizontal){
-            for(int y = start_y; y <= end_y; y++){
-                if(self->direction == RulerGrowAlongAxis){
-                    for(int x = self->ruler_area.x + begin; x <= self->ruler_area.x + end; x++){
-                        pixels[y * GENERIC_LAYER(self)->canvas->w + x] = bcolor;
-                    }
-                }else{
-                    for(int x = SDLExt_RectLastX(&self->ruler_area) - end; x <= SDLExt_RectLastX(&self->ruler_area) - begin; x++){
-                        pixels[y * GENERIC_LAYER(self)->canvas->w + x] = bcolor;
-                    }
-                }
+            if(self->direction == RulerGrowAlongAxis){
+                raster_fill_rect(GENERIC_LAYER(self)->canvas,
+                    self->ruler_area.x + begin, start_y,
+                    self->ruler_area.x + end, end_y,
+                    bcolor
+                );
+            }else{
+                raster_fill_rect(GENERIC_LAYER(self)->canvas,
+                    SDLExt_RectLastX(&self->ruler_area) - end, start_y,
+                    SDLExt_RectLastX(&self->ruler_area) - begin, end_y,
+                    bcolor
+                );
             }
         }else if(self->orientation == RulerVertical){
             if(self->direction == RulerGrowAlongAxis){
-                for(int y = self->ruler_area.y + begin; y <= self->ruler_area.y + end; y++){
-                    for(int x = start_x; x <= end_x; x++){
-                        pixels[y * GENERIC_LAYER(self)->canvas->w + x] = bcolor;
-                    }
-                }
+                raster_fill_rect(GENERIC_LAYER(self)->canvas,
+                    start_x, self->ruler_area.y + begin,
+                    end_x, self->ruler_area.y + end,
+                    bcolor
+                );
             }else{
-                for(int y = SDLExt_RectLastY(&self->ruler_area) - end; y <= SDLExt_RectLastY(&self->ruler_area) - begin; y++){
-                    for(int x = start_x; x <= end_x; x++){
-                        pixels[y * GENERIC_LAYER(self)->canvas->w + x] = bcolor;
-                    }
-                }
+                raster_fill_rect(GENERIC_LAYER(self)->canvas,
+                    start_x, SDLExt_RectLastY(&self->ruler_area) - end,
+                    end_x, SDLExt_RectLastY(&self->ruler_area) - begin,
+                    bcolor
+                );
             }
         }
     }
@@ -417,12 +419,14 @@ bool generic_ruler_draw_zones(GenericRuler *self, Location spine_location, int n
  */
 bool generic_ruler_etch_hatches(GenericRuler *self, Uint32 color, bool etch_spine, bool etch_hatches, Location spine_location)
 {
-    Uint32 *pixels;
+    SDL_Surface *canvas;
     int pcursor; /*Pixel index cursor*/
     int increment;
+    bool rv;
 
+    rv = true;
     generic_layer_lock(GENERIC_LAYER(self));
-    pixels = GENERIC_LAYER(self)->canvas->pixels;
+    canvas = GENERIC_LAYER(self)->canvas;
     if(self->orientation == RulerHorizontal){
         /*Spine (main line)*/
         if(etch_spine){
@@ -435,10 +439,11 @@ bool generic_ruler_etch_hatches(GenericRuler *self, Uint32 color, bool etch_spin
                 y = self->ruler_area.y;
             else
                 printf("Unsupported line position for Horizontal orientation\n");
-            if(y < 0)
-                return false; //TODO:Unlock pixels
-            for(int x = self->ruler_area.x; x <= SDLExt_RectLastX(&self->ruler_area); x++)
-                pixels[y * GENERIC_LAYER(self)->canvas->w + x] = color;
+            if(y < 0){
+                rv = false;
+                goto out;
+            }
+            raster_hspan(canvas, self->ruler_area.x, SDLExt_RectLastX(&self->ruler_area), y, color);
         }
         /*Hatch marks*/
         if(etch_hatches){
@@ -447,9 +452,7 @@ bool generic_ruler_etch_hatches(GenericRuler *self, Uint32 color, bool etch_spin
                 pcursor = (self->direction == RulerGrowAlongAxis)
                           ? self->ruler_area.x + increment
                           : SDLExt_RectLastX(&self->ruler_area) - increment;
-                printf("Etching value %d at x=%d (increment was %d)\n", (int)i, pcursor, increment);
-                for(int y = self->ruler_area.y; y <= SDLExt_RectLastY(&self->ruler_area); y++)
-                    pixels[y * GENERIC_LAYER(self)->canvas->w + pcursor] = color;
+                raster_vspan(canvas, pcursor, self->ruler_area.y, SDLExt_RectLastY(&self->ruler_area), color);
             }
         }
     }else if(self->orientation == RulerVertical) {
@@ -464,10 +467,11 @@ bool generic_ruler_etch_hatches(GenericRuler *self, Uint32 color, bool etch_spin
                 x = SDLExt_RectLastX(&self->ruler_area);
             else
                 printf("Unsupported line position for Vertical orientation\n");
-            if(x < 0)
-                return false; //TODO:Unlock pixels
-            for(int y = self->ruler_area.y; y <= SDLExt_RectLastY(&self->ruler_area); y++)
-                pixels[y * GENERIC_LAYER(self)->canvas->w + x] = color;
+            if(x < 0){
+                rv = false;
+                goto out;
+            }
+            raster_vspan(canvas, x, self->ruler_area.y, SDLExt_RectLastY(&self->ruler_area), color);
         }
         /*Hatch marks*/
         if(etch_hatches){
@@ -476,18 +480,16 @@ bool generic_ruler_etch_hatches(GenericRuler *self, Uint32 color, bool etch_spin
                 pcursor = (self->direction == RulerGrowAlongAxis)
                           ? self->ruler_area.y + increment
                           : SDLExt_RectLastY(&self->ruler_area) - increment;
-                printf("Drawing %f hatch at y = %d\n",i, pcursor);
-                for(int x = self->ruler_area.x; x < self->ruler_area.x + self->ruler_area.w; x++){
-                    pixels[pcursor * GENERIC_LAYER(self)->canvas->w + x] = color;
-                }
+                raster_hspan(canvas, self->ruler_area.x, SDLExt_RectLastX(&self->ruler_area), pcursor, color);
             }
         }
     }else{
         printf("Unsupported orientation\n");
-        return false; //TODO:Unlock pixels
+        rv = false;
     }
+out:
     generic_layer_unlock(GENERIC_LAYER(self));
-    return true;
+    return rv;
 }
 
 /**
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glyph-run-cache.h"
+#include "misc.h"
+
+static GlyphRunCache cache = {0};
+
+/*FNV-1a over the string and the layout parameters*/
+static uint32_t glyph_run_hash(PCF_StaticFont *font, const char *str, size_t len,
+                               bool flag, SDL_Rect *area, uint8_t alignment)
+{
+    uint32_t rv = 2166136261u;
+    uintptr_t f = (uintptr_t)font;
+    int32_t params[] = {area->x, area->y, area->w, area->h, alignment, flag};
+
+    for(size_t i = 0; i < sizeof(f); i++, f >>= 8)
+        rv = (rv ^ (f & 0xff)) * 16777619u;
+    for(size_t i = 0; i < sizeof(params)/sizeof(params[0]); i++)
+        rv = (rv ^ (uint32_t)params[i]) * 16777619u;
+    for(size_t i = 0; i < len; i++)
+        rv = (rv ^ (uint8_t)str[i]) * 16777619u;
+    return rv;
+}
+
+static inline bool glyph_run_match(GlyphRun *self, uint32_t hash,
+                                   PCF_StaticFont *font, const char *str, size_t len,
+                                   bool flag, SDL_Rect *area, uint8_t alignment)
+{
+    return self->font == font
+        && self->hash == hash
+        && self->len == len
+        && self->flag == flag
+        && self->alignment == alignment
+        && SDL_RectEquals(&self->area, area)
+        && !memcmp(self->str, str, len);
+}
+
+/*Uncached layout: same steps a TextGauge used to do on each update.
+ * A failed layout has nothing to draw: 0 patches instead of -1*/
+static int glyph_run_layout(PCF_StaticFont *font, const char *str, size_t len,
+                            bool flag, SDL_Rect *area, uint8_t alignment,
+                            PCF_StaticFontPatch *patches, size_t apatches)
+{
+    SDL_Rect cursor;
+    int rv;
+
+    PCF_StaticFontGetSizeRequestRect(font, str, flag, &cursor);
+    SDLExt_RectAlign(&cursor, area, alignment);
+    rv = PCF_StaticFontPreWriteString(font,
+        len, str,
+        flag, &cursor,
+        apatches, patches
+    );
+    return rv < 0 ? 0 : rv;
+}
+
+/**
+ * @brief Lays out @p str aligned within @p area, reusing a previous
+ * layout of the same string at the same place when possible.
+ *
+ * @param font The font to use
+ * @param str The string to lay out, must be NULL-terminated
+ * @param len Length of @p str
+ * @param flag Forwarded to PCF_StaticFontGetSizeRequestRect and
+ * PCF_StaticFontPreWriteString
+ * @param area The area (gauge coordinates) to align the text in
+ * @param alignment The alignment within @p area, see SDLExt_RectAlign
+ * @param patches Where to write the resulting patches
+ * @param apatches Number of available slots in @p patches
+ * @return The number of patches written to @p patches, 0 if the layout
+ * failed
+ */
+int glyph_run_cache_layout(PCF_StaticFont *font, const char *str, size_t len,
+                           bool flag, SDL_Rect *area, uint8_t alignment,
+                           PCF_StaticFontPatch *patches, size_t apatches)
+{
+    GlyphRun *run;
+    uint32_t hash;
+    int set, way;
+    int rv;
+
+    if(len > GLYPH_RUN_MAX_LEN || apatches < len)
+        return glyph_run_layout(font, str, len, flag, area, alignment, patches, apatches);
+
+    hash = glyph_run_hash(font, str, len, flag, area, alignment);
+    set = hash & (GLYPH_RUN_CACHE_SETS - 1);
+    for(way = 0; way < 2; way++){
+        run = &cache.runs[set][way];
+        if(glyph_run_match(run, hash, font, str, len, flag, area, alignment)){
+            memcpy(patches, run->patches, run->npatches * sizeof(PCF_StaticFontPatch));
+            cache.mru[set] = way;
+            cache.hits++;
+            return run->npatches;
+        }
+    }
+    cache.misses++;
+
+    rv = glyph_run_layout(font, str, len, flag, area, alignment, patches, apatches);
+    if(rv > GLYPH_RUN_MAX_LEN)
+        return rv;
+
+    /*Evict the least recently used way*/
+    way = !cache.mru[set];
+    run = &cache.runs[set][way];
+    *run = (GlyphRun){
+        .font = font,
+        .area = *area,
+        .alignment = alignment,
+        .flag = flag,
+        .hash = hash,
+        .len = len,
+        .npatches = rv
+    };
+    memcpy(run->str, str, len);
+    memcpy(run->patches, patches, rv * sizeof(PCF_StaticFontPatch));
+    cache.mru[set] = way;
+
+    return rv;
+}
+
+/**
+ * @brief Drops all cached layouts. Must be called when static fonts
+ * are freed, as runs are keyed on the font address.
+ */
+void glyph_run_cache_clear(void)
+{
+    memset(&cache, 0, sizeof(GlyphRunCache));
+}
+
+void glyph_run_cache_get_stats(size_t *hits, size_t *misses)
+{
+    if(hits) *hits = cache.hits;
+    if(misses) *misses = cache.misses;
+}
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef GLYPH_RUN_CACHE_H
+#define GLYPH_RUN_CACHE_H
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+#include "SDL_pcf.h"
+
+/* Laid-out strings (patches into a static font raster), keyed on the
+ * font, the string and where it is aligned. Gauges showing numbers
+ * cycle through the same few values, which then don't go through
+ * glyph lookups again.
+ *
+ * Fixed size, 2-way set associative: no allocation after startup.
+ * Longer strings bypass the cache.
+ */
+#define GLYPH_RUN_MAX_LEN 24
+#define GLYPH_RUN_CACHE_SETS 64 /*power of 2*/
+
+typedef struct{
+    PCF_StaticFont *font;
+    SDL_Rect area;
+    uint8_t alignment;
+    bool flag;
+    uint32_t hash;
+
+    uint8_t len;
+    char str[GLYPH_RUN_MAX_LEN];
+
+    uint8_t npatches;
+    PCF_StaticFontPatch patches[GLYPH_RUN_MAX_LEN];
+}GlyphRun;
+
+typedef struct{
+    GlyphRun runs[GLYPH_RUN_CACHE_SETS][2];
+    uint8_t mru[GLYPH_RUN_CACHE_SETS]; /*most recently used way*/
+
+    /*Lookup statistics, since startup or last clear*/
+    size_t hits;
+    size_t misses;
+}GlyphRunCache;
+
+int glyph_run_cache_layout(PCF_StaticFont *font, const char *str, size_t len,
+                           bool flag, SDL_Rect *area, uint8_t alignment,
+                           PCF_StaticFontPatch *patches, size_t apatches);
+void glyph_run_cache_clear(void);
+void glyph_run_cache_get_stats(size_t *hits, size_t *misses);
+#endif /* GLYPH_RUN_CACHE_H */
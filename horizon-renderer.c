@@ -0,0 +1,881 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <SDL2/SDL.h>
+
+#include "horizon-renderer.h"
+#include "sdl-colors.h"
+
+#define LADDER_STEP 2.5 /*degrees between two marks*/
+#define LADDER_LABEL_GAP 4 /*pixels between the 10s marks and their labels*/
+
+/*Mark widths, cycling every 10 degrees: 0, 2.5, 5, 7.5*/
+static const int mark_sizes[] = {57, 11, 25, 11};
+#define N_MARK_SIZES (sizeof(mark_sizes)/sizeof(mark_sizes[0]))
+
+typedef enum{
+    LADDER_COLOR,
+    CENTER_COLOR
+}HorizonColorRole;
+
+#if USE_SDL_GPU
+static bool horizon_renderer_init_shader(HorizonRenderer *self);
+static bool horizon_renderer_init_glyphs(HorizonRenderer *self, PCF_Font *font);
+#endif
+
+/* Where the horizon is being drawn: the actual target and the
+ * gauge origin within it.
+ */
+typedef struct{
+#if USE_SDL_GPU
+    GPU_Target *target;
+#else
+    SDL_Surface *surface;
+    SDL_Rect clip; /*gauge area within the surface, target coordinates*/
+#endif
+    int x, y; /*gauge origin, target coordinates*/
+}HorizonCanvas;
+
+/**
+ * @brief Sets up a horizon of the given size.
+ *
+ * @param self a HorizonRenderer
+ * @param w gauge width
+ * @param h gauge height
+ * @param pivot the point around which the horizon rotates and that the
+ * horizon crosses at 0 pitch, in gauge coordinates.
+ * @param ppd Pixels per degree of pitch
+ * @param size The pitch ladder extent in tens of degrees, both ways.
+ * @param gradient The height (in pixels) of the sky gradient above the
+ * horizon line
+ * @param font The font used to draw the ladder labels
+ * @return self on success, NULL on failure. In case of failure
+ * horizon_renderer_dispose must be called.
+ */
+HorizonRenderer *horizon_renderer_init(HorizonRenderer *self, int w, int h,
+                                       SDL_Point *pivot, float ppd, int size,
+                                       int gradient, PCF_Font *font)
+{
+#if !USE_SDL_GPU
+    char buffer[8];
+    SDL_Rect rect;
+    Uint32 color;
+#endif
+
+    self->w = w;
+    self->h = h;
+    self->pivot = *pivot;
+    self->ppd = ppd;
+    self->size = size;
+    self->gradient = gradient > 0 ? gradient : 1;
+
+    self->sky = (SDL_Color){0x00, 0x50, 0xff, SDL_ALPHA_OPAQUE};
+    self->sky_down = (SDL_Color){0x52, 0x6c, 0xd0, SDL_ALPHA_OPAQUE};
+    self->earth = (SDL_Color){0x58, 0x34, 0x0a, SDL_ALPHA_OPAQUE};
+    self->ladder = SDL_WHITE;
+    self->center = SDL_RED;
+
+#if USE_SDL_GPU
+    if(!horizon_renderer_init_shader(self))
+        return NULL;
+    if(!horizon_renderer_init_glyphs(self, font))
+        return NULL;
+#else
+    /* Labels are the only pre-rendered part: a handful of tiny
+     * layers that get rotated along with the ladder*/
+    self->labels = calloc(size, sizeof(GenericLayer));
+    if(!self->labels)
+        return NULL;
+    for(int i = 0; i < size; i++){
+        snprintf(buffer, sizeof(buffer), "%d", (i+1)*10);
+        PCF_FontGetSizeRequestRect(font, buffer, false, &rect);
+        if(!generic_layer_init(&self->labels[i], rect.w, rect.h))
+            return NULL;
+        self->nlabels++;
+
+        rect.x = 0;
+        rect.y = 0;
+        color = SDL_MapRGB(self->labels[i].canvas->format,
+            self->ladder.r, self->ladder.g, self->ladder.b
+        );
+        PCF_FontWrite(font, buffer, color, false, self->labels[i].canvas, &rect);
+    }
+    self->lut = calloc(self->gradient, sizeof(Uint32));
+    if(!self->lut)
+        return NULL;
+#endif
+    horizon_renderer_set_attitude(self, 0, 0);
+
+    return self;
+}
+
+void horizon_renderer_dispose(HorizonRenderer *self)
+{
+#if USE_SDL_GPU
+    if(self->program)
+        GPU_FreeShaderProgram(self->program);
+    self->program = 0;
+    generic_layer_dispose(&self->glyphs);
+    if(self->glyph_rects)
+        free(self->glyph_rects);
+    self->glyph_rects = NULL;
+    if(self->values)
+        free(self->values);
+    self->values = NULL;
+    if(self->indices)
+        free(self->indices);
+    self->indices = NULL;
+#else
+    for(int i = 0; i < self->nlabels; i++)
+        generic_layer_dispose(&self->labels[i]);
+    if(self->labels)
+        free(self->labels);
+    self->labels = NULL;
+    self->nlabels = 0;
+    if(self->lut)
+        free(self->lut);
+    self->lut = NULL;
+    if(self->scratch)
+        SDL_FreeSurface(self->scratch);
+    self->scratch = NULL;
+#endif
+}
+
+/**
+ * @brief Sets the attitude to draw on the next render.
+ *
+ * @param self a HorizonRenderer
+ * @param angle The horizon rotation in degrees, clockwise on screen.
+ * @param pitch The pitch in degrees, positive values moving the
+ * horizon down.
+ */
+void horizon_renderer_set_attitude(HorizonRenderer *self, float angle, float pitch)
+{
+    self->angle = angle;
+    self->c = cosf(angle * M_PI / 180.0);
+    self->s = sinf(angle * M_PI / 180.0);
+    self->offset = pitch * self->ppd;
+}
+
+/*Ball (u,v) to gauge coordinates*/
+static inline void horizon_renderer_to_gauge(HorizonRenderer *self, float u, float v, float *x, float *y)
+{
+    *x = self->pivot.x + u*self->c - v*self->s;
+    *y = self->pivot.y + u*self->s + v*self->c;
+}
+
+/*Signed distance from a gauge point to the horizon, positive below*/
+static inline float horizon_renderer_distance(HorizonRenderer *self, float x, float y)
+{
+    return -(x - self->pivot.x)*self->s + (y - self->pivot.y)*self->c - self->offset;
+}
+
+/*Range of v (ball coordinates) covered by the gauge area*/
+static void horizon_renderer_visible_range(HorizonRenderer *self, float *vmin, float *vmax)
+{
+    float v;
+    int corners[4][2] = {{0,0}, {self->w,0}, {0,self->h}, {self->w,self->h}};
+
+    *vmin = INFINITY;
+    *vmax = -INFINITY;
+    for(int i = 0; i < 4; i++){
+        v = horizon_renderer_distance(self, corners[i][0], corners[i][1]) + self->offset;
+        if(v < *vmin) *vmin = v;
+        if(v > *vmax) *vmax = v;
+    }
+}
+
+#if USE_SDL_GPU
+/* Shader dialects: desktop GLSL 1.20 (GL2 renderers), 1.30 (GL3+
+ * renderers, including Mesa's llvmpipe core profile) and GLSL ES 1.00.
+ * The sources below only use the common subset, through these macros.
+ */
+static const char *horizon_shader_headers[][2] = {
+    { /*GLSL 1.20*/
+        "#version 120\n"
+        "#define VERT_IN attribute\n"
+        "#define VARYING_OUT varying\n",
+        "#version 120\n"
+        "#define VARYING_IN varying\n"
+        "#define FRAG_COLOR gl_FragColor\n"
+    },
+    { /*GLSL 1.30*/
+        "#version 130\n"
+        "#define VERT_IN in\n"
+        "#define VARYING_OUT out\n",
+        "#version 130\n"
+        "#define VARYING_IN in\n"
+        "#define FRAG_COLOR frag_color\n"
+        "out vec4 frag_color;\n"
+    },
+    { /*GLSL ES 1.00*/
+        "#version 100\n"
+        "precision highp float;\n"
+        "#define VERT_IN attribute\n"
+        "#define VARYING_OUT varying\n",
+        "#version 100\n"
+        "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+        "precision highp float;\n"
+        "#else\n"
+        "precision mediump float;\n"
+        "#endif\n"
+        "#define VARYING_IN varying\n"
+        "#define FRAG_COLOR gl_FragColor\n"
+    }
+};
+
+/*Passes target coordinates through, the fragment shader works in pixels*/
+static const char *horizon_vertex_source =
+    "VERT_IN vec2 gpu_Vertex;\n"
+    "uniform mat4 gpu_ModelViewProjectionMatrix;\n"
+    "VARYING_OUT vec2 position;\n"
+    "void main(void)\n"
+    "{\n"
+    "    position = gpu_Vertex;\n"
+    "    gl_Position = gpu_ModelViewProjectionMatrix * vec4(gpu_Vertex, 0.0, 1.0);\n"
+    "}\n";
+
+/* Same function as horizon_renderer_distance and horizon_renderer_color_at,
+ * evaluated per pixel. Pixel centers are at +0.5 in target coordinates
+ * while gauge coordinates address pixels directly, hence the offset.
+ */
+static const char *horizon_fragment_source =
+    "VARYING_IN vec2 position;\n"
+    "uniform vec2 pivot;\n"
+    "uniform vec2 rotation;\n"
+    "uniform float pitch_offset;\n"
+    "uniform float gradient;\n"
+    "uniform vec4 sky_color;\n"
+    "uniform vec4 sky_down_color;\n"
+    "uniform vec4 earth_color;\n"
+    "uniform vec4 line_color;\n"
+    "void main(void)\n"
+    "{\n"
+    "    vec2 p = position - vec2(0.5) - pivot;\n"
+    "    float d = -p.x*rotation.y + p.y*rotation.x - pitch_offset;\n"
+    "    vec4 color = mix(sky_down_color, sky_color, clamp(-d/gradient, 0.0, 1.0));\n"
+    "    if(d >= 0.0)\n"
+    "        color = earth_color;\n"
+    "    if(abs(d) < 0.5)\n"
+    "        color = line_color;\n"
+    "    FRAG_COLOR = color;\n"
+    "}\n";
+
+static Uint32 horizon_shader_compile(GPU_ShaderEnum type, const char *body)
+{
+    GPU_Renderer *renderer;
+    char source[2048];
+    int dialect;
+    Uint32 rv;
+
+    renderer = GPU_GetCurrentRenderer();
+    if(renderer->shader_language == GPU_LANGUAGE_GLSLES)
+        dialect = 2;
+    else if(renderer->max_shader_version >= 130)
+        dialect = 1;
+    else
+        dialect = 0;
+
+    snprintf(source, sizeof(source), "%s%s",
+        horizon_shader_headers[dialect][type == GPU_VERTEX_SHADER ? 0 : 1],
+        body
+    );
+    rv = GPU_CompileShader(type, source);
+    if(!rv)
+        printf("Couldn't compile horizon shader: %s\n", GPU_GetShaderMessage());
+    return rv;
+}
+
+static bool horizon_renderer_init_shader(HorizonRenderer *self)
+{
+    Uint32 vertex, fragment;
+
+    vertex = horizon_shader_compile(GPU_VERTEX_SHADER, horizon_vertex_source);
+    if(!vertex)
+        return false;
+    fragment = horizon_shader_compile(GPU_FRAGMENT_SHADER, horizon_fragment_source);
+    if(!fragment){
+        GPU_FreeShader(vertex);
+        return false;
+    }
+    self->program = GPU_LinkShaders(vertex, fragment);
+    GPU_FreeShader(vertex);
+    GPU_FreeShader(fragment);
+    if(!self->program){
+        printf("Couldn't link horizon shader: %s\n", GPU_GetShaderMessage());
+        return false;
+    }
+
+    self->block = GPU_LoadShaderBlock(self->program,
+        "gpu_Vertex", NULL, NULL,
+        "gpu_ModelViewProjectionMatrix"
+    );
+    self->uniforms.pivot = GPU_GetUniformLocation(self->program, "pivot");
+    self->uniforms.rotation = GPU_GetUniformLocation(self->program, "rotation");
+    self->uniforms.offset = GPU_GetUniformLocation(self->program, "pitch_offset");
+    self->uniforms.gradient = GPU_GetUniformLocation(self->program, "gradient");
+    self->uniforms.sky = GPU_GetUniformLocation(self->program, "sky_color");
+    self->uniforms.sky_down = GPU_GetUniformLocation(self->program, "sky_down_color");
+    self->uniforms.earth = GPU_GetUniformLocation(self->program, "earth_color");
+    self->uniforms.line = GPU_GetUniformLocation(self->program, "line_color");
+
+    return true;
+}
+
+/* The ladder is made of a few distinct shapes only: 4 mark widths and
+ * @size labels. They are all rendered once in a small atlas, stacked
+ * with a transparent pixel around each of them so that filtering doesn't
+ * bleed from one to another.
+ */
+static bool horizon_renderer_init_glyphs(HorizonRenderer *self, PCF_Font *font)
+{
+    char buffer[8];
+    SDL_Rect *rect;
+    SDL_Surface *canvas;
+    Uint32 ladder, center;
+    int aw, ah;
+    int nmarks;
+
+    self->nglyphs = N_MARK_SIZES + self->size;
+    self->glyph_rects = calloc(self->nglyphs, sizeof(SDL_Rect));
+    if(!self->glyph_rects)
+        return false;
+
+    aw = 0;
+    ah = 1;
+    for(int i = 0; i < self->nglyphs; i++){
+        rect = &self->glyph_rects[i];
+        if(i < N_MARK_SIZES){
+            *rect = (SDL_Rect){0, 0, mark_sizes[i], 1};
+        }else{
+            snprintf(buffer, sizeof(buffer), "%d", (int)(i - N_MARK_SIZES + 1)*10);
+            PCF_FontGetSizeRequestRect(font, buffer, false, rect);
+        }
+        rect->x = 1;
+        rect->y = ah;
+        ah += rect->h + 1;
+        if(rect->w + 2 > aw)
+            aw = rect->w + 2;
+    }
+
+    if(!generic_layer_init(&self->glyphs, aw, ah))
+        return false;
+    canvas = self->glyphs.canvas;
+    ladder = SDL_MapRGB(canvas->format, self->ladder.r, self->ladder.g, self->ladder.b);
+    center = SDL_MapRGB(canvas->format, self->center.r, self->center.g, self->center.b);
+    for(int i = 0; i < self->nglyphs; i++){
+        rect = &self->glyph_rects[i];
+        if(i < N_MARK_SIZES){
+            SDL_FillRect(canvas, rect, ladder);
+            SDL_FillRect(canvas, &(SDL_Rect){rect->x + rect->w/2, rect->y, 1, 1}, center);
+        }else{
+            snprintf(buffer, sizeof(buffer), "%d", (int)(i - N_MARK_SIZES + 1)*10);
+            PCF_FontWrite(font, buffer, ladder, false, canvas, &(SDL_Rect){rect->x, rect->y, rect->w, rect->h});
+        }
+    }
+    if(!generic_layer_build_texture(&self->glyphs))
+        return false;
+    generic_layer_release_canvas(&self->glyphs);
+
+    /*Every mark, plus two labels every 10 degrees*/
+    nmarks = round(self->size * 10 / LADDER_STEP);
+    self->max_quads = (2*nmarks + 1) + 4*self->size;
+    self->values = calloc(self->max_quads * 4 * 4, sizeof(float));
+    self->indices = calloc(self->max_quads * 6, sizeof(unsigned short));
+    if(!self->values || !self->indices)
+        return false;
+    for(int i = 0; i < self->max_quads; i++){
+        self->indices[i*6 + 0] = i*4 + 0;
+        self->indices[i*6 + 1] = i*4 + 1;
+        self->indices[i*6 + 2] = i*4 + 2;
+        self->indices[i*6 + 3] = i*4 + 0;
+        self->indices[i*6 + 4] = i*4 + 2;
+        self->indices[i*6 + 5] = i*4 + 3;
+    }
+
+    return true;
+}
+
+static inline void horizon_uniform_color(int location, SDL_Color *color)
+{
+    GPU_SetUniformfv(location, 4, 1, (float[]){
+        color->r / 255.0f, color->g / 255.0f, color->b / 255.0f, color->a / 255.0f
+    });
+}
+
+/* Sky, gradient, earth and the horizon line are a function of the
+ * distance to the horizon: a single quad covering the gauge, colored
+ * by the fragment shader. Gauge size has no influence on the cost
+ * besides fill rate.
+ */
+static void horizon_renderer_fill(HorizonRenderer *self, HorizonCanvas *canvas)
+{
+    float x0, y0, x1, y1;
+
+    x0 = canvas->x;
+    y0 = canvas->y;
+    x1 = x0 + self->w;
+    y1 = y0 + self->h;
+
+    GPU_ActivateShaderProgram(self->program, &self->block);
+    GPU_SetUniformfv(self->uniforms.pivot, 2, 1, (float[]){
+        self->pivot.x + canvas->x, self->pivot.y + canvas->y
+    });
+    GPU_SetUniformfv(self->uniforms.rotation, 2, 1, (float[]){self->c, self->s});
+    GPU_SetUniformf(self->uniforms.offset, self->offset);
+    GPU_SetUniformf(self->uniforms.gradient, self->gradient);
+    horizon_uniform_color(self->uniforms.sky, &self->sky);
+    horizon_uniform_color(self->uniforms.sky_down, &self->sky_down);
+    horizon_uniform_color(self->uniforms.earth, &self->earth);
+    horizon_uniform_color(self->uniforms.line, &self->ladder);
+
+    GPU_TriangleBatch(NULL, canvas->target,
+        4, (float[]){x0, y0, x1, y0, x1, y1, x0, y1},
+        6, (unsigned short[]){0, 1, 2, 0, 2, 3},
+        GPU_BATCH_XY
+    );
+    GPU_DeactivateShaderProgram();
+}
+
+/*Adds a glyph centered on (u,v) in ball coordinates, rotated with the ball*/
+static int horizon_renderer_add_glyph(HorizonRenderer *self, HorizonCanvas *canvas,
+                                      int nquads, SDL_Rect *glyph, float u, float v)
+{
+    float hw = glyph->w / 2.0f;
+    float hh = glyph->h / 2.0f;
+    float aw = generic_layer_w(&self->glyphs);
+    float ah = generic_layer_h(&self->glyphs);
+    float x, y;
+    float *q;
+    /*Ball offsets and atlas coordinates of each corner*/
+    const float corners[4][4] = {
+        {-hw, -hh, glyph->x,            glyph->y},
+        { hw, -hh, glyph->x + glyph->w, glyph->y},
+        { hw,  hh, glyph->x + glyph->w, glyph->y + glyph->h},
+        {-hw,  hh, glyph->x,            glyph->y + glyph->h}
+    };
+
+    q = &self->values[nquads * 16];
+    for(int i = 0; i < 4; i++){
+        horizon_renderer_to_gauge(self, u + corners[i][0], v + corners[i][1], &x, &y);
+        q[i*4 + 0] = x + canvas->x + 0.5f;
+        q[i*4 + 1] = y + canvas->y + 0.5f;
+        q[i*4 + 2] = corners[i][2] / aw;
+        q[i*4 + 3] = corners[i][3] / ah;
+    }
+    return nquads + 1;
+}
+
+/* Pitch ladder: every visible mark and label is a quad sampling the
+ * glyph atlas, all of them submitted as a single textured batch.
+ */
+static void horizon_renderer_draw_ladder(HorizonRenderer *self, HorizonCanvas *canvas)
+{
+    SDL_Rect *mark, *label;
+    float vmin, vmax;
+    float margin;
+    float v, uoff;
+    int nmarks, nquads;
+
+    horizon_renderer_visible_range(self, &vmin, &vmax);
+
+    nquads = 0;
+    margin = self->size ? self->glyph_rects[N_MARK_SIZES].h : 0;
+    nmarks = round(self->size * 10 / LADDER_STEP);
+    for(int i = -nmarks; i <= nmarks; i++){
+        v = self->offset - i * LADDER_STEP * self->ppd;
+        if(v < vmin - margin || v > vmax + margin)
+            continue;
+
+        mark = &self->glyph_rects[abs(i) % N_MARK_SIZES];
+        nquads = horizon_renderer_add_glyph(self, canvas, nquads, mark, 0, v);
+
+        if(i == 0 || abs(i) % 4 != 0)
+            continue;
+        label = &self->glyph_rects[N_MARK_SIZES + abs(i)/4 - 1];
+        uoff = (mark->w - 1) / 2.0 + LADDER_LABEL_GAP + label->w / 2.0;
+        nquads = horizon_renderer_add_glyph(self, canvas, nquads, label, -uoff, v);
+        nquads = horizon_renderer_add_glyph(self, canvas, nquads, label, uoff, v);
+    }
+    if(!nquads)
+        return;
+
+    GPU_TriangleBatch(self->glyphs.texture, canvas->target,
+        nquads * 4, self->values,
+        nquads * 6, self->indices,
+        GPU_BATCH_XY_ST
+    );
+}
+#else
+static SDL_Color horizon_renderer_color_at(HorizonRenderer *self, float d)
+{
+    float progress;
+
+    if(d >= 0)
+        return self->earth;
+    if(d <= -self->gradient)
+        return self->sky;
+
+    progress = -d / self->gradient;
+    return (SDL_Color){
+        self->sky_down.r + round((self->sky.r - self->sky_down.r) * progress),
+        self->sky_down.g + round((self->sky.g - self->sky_down.g) * progress),
+        self->sky_down.b + round((self->sky.b - self->sky_down.b) * progress),
+        SDL_ALPHA_OPAQUE
+    };
+}
+
+/**
+ * Clips a segment (gauge coordinates) to the gauge area, Liang-Barsky
+ * style.
+ *
+ * @return false if nothing remains of the segment
+ */
+static bool horizon_renderer_clip_segment(HorizonRenderer *self, float *x0, float *y0, float *x1, float *y1)
+{
+    float t0 = 0, t1 = 1;
+    float dx = *x1 - *x0;
+    float dy = *y1 - *y0;
+    float p[4] = {-dx, dx, -dy, dy};
+    float q[4] = {*x0, self->w - 1 - *x0, *y0, self->h - 1 - *y0};
+
+    for(int i = 0; i < 4; i++){
+        if(p[i] == 0){
+            if(q[i] < 0) return false;
+            continue;
+        }
+        float r = q[i] / p[i];
+        if(p[i] < 0){
+            if(r > t1) return false;
+            if(r > t0) t0 = r;
+        }else{
+            if(r < t0) return false;
+            if(r < t1) t1 = r;
+        }
+    }
+    *x1 = *x0 + t1*dx;
+    *y1 = *y0 + t1*dy;
+    *x0 = *x0 + t0*dx;
+    *y0 = *y0 + t0*dy;
+    return true;
+}
+
+static void horizon_renderer_map_colors(HorizonRenderer *self, SDL_PixelFormat *format)
+{
+    SDL_Color color;
+
+    if(self->mapped_format == format->format)
+        return;
+
+    for(int i = 0; i < self->gradient; i++){
+        color = horizon_renderer_color_at(self, -i);
+        self->lut[i] = SDL_MapRGB(format, color.r, color.g, color.b);
+    }
+    self->usky = SDL_MapRGB(format, self->sky.r, self->sky.g, self->sky.b);
+    self->uearth = SDL_MapRGB(format, self->earth.r, self->earth.g, self->earth.b);
+    self->uladder = SDL_MapRGB(format, self->ladder.r, self->ladder.g, self->ladder.b);
+    self->ucenter = SDL_MapRGB(format, self->center.r, self->center.g, self->center.b);
+    self->mapped_format = format->format;
+}
+
+static inline int clampi(float v, int lo, int hi)
+{
+    if(v <= lo) return lo;
+    if(v >= hi) return hi;
+    return v;
+}
+
+/* Software counterpart of the horizon fragment shader. Each row
+ * crosses the (straight) sky/gradient/earth boundaries at most once,
+ * so a row is at most three spans. Flat spans are plain 32 bit fills,
+ * the gradient band steps the distance to the horizon in 16.16 fixed
+ * point and looks colors up in a table.
+ */
+static void horizon_renderer_fill(HorizonRenderer *self, HorizonCanvas *canvas)
+{
+    SDL_Surface *surface;
+    Uint32 *row;
+    float k, d0;
+    int x0, x1;
+    int xa, xb; /*gradient band: [xa, xb[*/
+    Uint32 left, right; /*colors on each side of the band*/
+    int32_t fd, fstep;
+    int idx;
+
+    surface = canvas->surface;
+    k = -self->s; /*distance increment along x*/
+    x0 = canvas->clip.x;
+    x1 = canvas->clip.x + canvas->clip.w;
+    fstep = -k * 65536;
+
+    if(k >= 0){
+        left = self->usky;
+        right = self->uearth;
+    }else{
+        left = self->uearth;
+        right = self->usky;
+    }
+
+    for(int y = canvas->clip.y; y < canvas->clip.y + canvas->clip.h; y++){
+        row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        d0 = horizon_renderer_distance(self, x0 - canvas->x, y - canvas->y);
+
+        if(k > 0){
+            xa = clampi(floorf(x0 + (-self->gradient - d0) / k) + 1, x0, x1);
+            xb = clampi(ceilf(x0 + (0 - d0) / k), xa, x1);
+        }else if(k < 0){
+            xa = clampi(floorf(x0 + (0 - d0) / k) + 1, x0, x1);
+            xb = clampi(ceilf(x0 + (-self->gradient - d0) / k), xa, x1);
+        }else{
+            if(d0 >= 0){
+                xa = xb = x0;
+            }else if(d0 <= -self->gradient){
+                xa = xb = x1;
+            }else{
+                xa = x0;
+                xb = x1;
+            }
+        }
+
+        if(xa > x0)
+            SDL_memset4(row + x0, left, xa - x0);
+        if(xb > xa){
+            fd = -(d0 + (xa - x0) * k) * 65536;
+            for(int x = xa; x < xb; x++, fd += fstep){
+                idx = fd >> 16;
+                idx = idx < 0 ? 0 : (idx >= self->gradient ? self->gradient - 1 : idx);
+                row[x] = self->lut[idx];
+            }
+        }
+        if(x1 > xb)
+            SDL_memset4(row + xb, right, x1 - xb);
+    }
+}
+
+static inline void horizon_canvas_put(HorizonCanvas *canvas, int x, int y, Uint32 color)
+{
+    if(x < canvas->clip.x || x >= canvas->clip.x + canvas->clip.w)
+        return;
+    if(y < canvas->clip.y || y >= canvas->clip.y + canvas->clip.h)
+        return;
+    ((Uint32 *)((Uint8 *)canvas->surface->pixels + y * canvas->surface->pitch))[x] = color;
+}
+
+static inline Uint32 horizon_renderer_ucolor(HorizonRenderer *self, HorizonColorRole role)
+{
+    return role == CENTER_COLOR ? self->ucenter : self->uladder;
+}
+
+static void horizon_canvas_line(HorizonRenderer *self, HorizonCanvas *canvas,
+                                float x0, float y0, float x1, float y1,
+                                HorizonColorRole role)
+{
+    float dx, dy, x, y;
+    Uint32 color;
+    int n;
+
+    color = horizon_renderer_ucolor(self, role);
+    dx = x1 - x0;
+    dy = y1 - y0;
+    n = ceilf(fmaxf(fabsf(dx), fabsf(dy)));
+    x = x0 + canvas->x + 0.5f;
+    y = y0 + canvas->y + 0.5f;
+    if(n == 0){
+        horizon_canvas_put(canvas, floorf(x), floorf(y), color);
+        return;
+    }
+    dx /= n;
+    dy /= n;
+    for(int i = 0; i <= n; i++, x += dx, y += dy)
+        horizon_canvas_put(canvas, floorf(x), floorf(y), color);
+}
+
+static inline void horizon_canvas_pixel(HorizonRenderer *self, HorizonCanvas *canvas,
+                                        float x, float y, HorizonColorRole role)
+{
+    horizon_canvas_put(canvas,
+        floorf(x + canvas->x + 0.5f), floorf(y + canvas->y + 0.5f),
+        horizon_renderer_ucolor(self, role)
+    );
+}
+
+/* Nearest-neighbour inverse mapping of the (tiny) label over its
+ * rotated bounding box. Labels are monochrome: any non-transparent
+ * pixel gets the ladder color.
+ */
+static void horizon_canvas_label(HorizonRenderer *self, HorizonCanvas *canvas,
+                                 GenericLayer *label, float x, float y)
+{
+    SDL_Surface *src;
+    Uint32 *row;
+    Uint32 pixel;
+    float hw, hh, ex, ey;
+    float dx, dy;
+    int sx, sy;
+    int xs, xe, ys, ye;
+
+    src = label->canvas;
+    hw = src->w / 2.0f;
+    hh = src->h / 2.0f;
+    ex = fabsf(self->c)*hw + fabsf(self->s)*hh;
+    ey = fabsf(self->s)*hw + fabsf(self->c)*hh;
+    x += canvas->x;
+    y += canvas->y;
+
+    xs = clampi(floorf(x - ex), canvas->clip.x, canvas->clip.x + canvas->clip.w);
+    xe = clampi(ceilf(x + ex), xs, canvas->clip.x + canvas->clip.w);
+    ys = clampi(floorf(y - ey), canvas->clip.y, canvas->clip.y + canvas->clip.h);
+    ye = clampi(ceilf(y + ey), ys, canvas->clip.y + canvas->clip.h);
+
+    for(int py = ys; py < ye; py++){
+        row = (Uint32 *)((Uint8 *)canvas->surface->pixels + py * canvas->surface->pitch);
+        dy = py + 0.5f - y;
+        for(int px = xs; px < xe; px++){
+            dx = px + 0.5f - x;
+            sx = floorf(dx*self->c + dy*self->s + hw);
+            sy = floorf(-dx*self->s + dy*self->c + hh);
+            if(sx < 0 || sy < 0 || sx >= src->w || sy >= src->h)
+                continue;
+            pixel = ((Uint32 *)((Uint8 *)src->pixels + sy * src->pitch))[sx];
+            if(pixel & src->format->Amask)
+                row[px] = self->uladder;
+        }
+    }
+}
+
+static void horizon_renderer_draw_line(HorizonRenderer *self, HorizonCanvas *canvas,
+                                       float u0, float v0, float u1, float v1,
+                                       HorizonColorRole role)
+{
+    float x0, y0, x1, y1;
+
+    horizon_renderer_to_gauge(self, u0, v0, &x0, &y0);
+    horizon_renderer_to_gauge(self, u1, v1, &x1, &y1);
+    if(horizon_renderer_clip_segment(self, &x0, &y0, &x1, &y1))
+        horizon_canvas_line(self, canvas, x0, y0, x1, y1, role);
+}
+
+/* Horizon line and pitch ladder. Marks are placed in ball coordinates
+ * and only the ones that can intersect the gauge area are drawn.
+ */
+static void horizon_renderer_draw_ladder(HorizonRenderer *self, HorizonCanvas *canvas)
+{
+    GenericLayer *label;
+    float vmin, vmax;
+    float margin;
+    float v, half;
+    float x, y, uoff;
+    int nmarks;
+
+    horizon_renderer_visible_range(self, &vmin, &vmax);
+
+    if(self->offset >= vmin && self->offset <= vmax){
+        half = hypotf(self->w, self->h);
+        horizon_renderer_draw_line(self, canvas, -half, self->offset, half, self->offset, LADDER_COLOR);
+    }
+
+    margin = self->nlabels ? generic_layer_h(&self->labels[0]) : 0;
+    nmarks = round(self->size * 10 / LADDER_STEP);
+    for(int i = -nmarks; i <= nmarks; i++){
+        v = self->offset - i * LADDER_STEP * self->ppd;
+        if(v < vmin - margin || v > vmax + margin)
+            continue;
+
+        half = (mark_sizes[abs(i) % 4] - 1) / 2.0;
+        horizon_renderer_draw_line(self, canvas, -half, v, half, v, LADDER_COLOR);
+        horizon_renderer_to_gauge(self, 0, v, &x, &y);
+        horizon_canvas_pixel(self, canvas, x, y, CENTER_COLOR);
+
+        if(i == 0 || abs(i) % 4 != 0)
+            continue;
+        label = &self->labels[abs(i)/4 - 1];
+        uoff = half + LADDER_LABEL_GAP + generic_layer_w(label) / 2.0;
+
+        horizon_renderer_to_gauge(self, -uoff, v, &x, &y);
+        horizon_canvas_label(self, canvas, label, x, y);
+        horizon_renderer_to_gauge(self, uoff, v, &x, &y);
+        horizon_canvas_label(self, canvas, label, x, y);
+    }
+}
+
+static void horizon_renderer_render_surface(HorizonRenderer *self, SDL_Surface *surface, int x, int y)
+{
+    HorizonCanvas canvas;
+    SDL_Rect area;
+
+    area = (SDL_Rect){x, y, self->w, self->h};
+    canvas.surface = surface;
+    canvas.x = x;
+    canvas.y = y;
+    if(!SDL_IntersectRect(&area, &surface->clip_rect, &canvas.clip))
+        return;
+
+    horizon_renderer_map_colors(self, surface->format);
+    if(SDL_MUSTLOCK(surface))
+        SDL_LockSurface(surface);
+    horizon_renderer_fill(self, &canvas);
+    horizon_renderer_draw_ladder(self, &canvas);
+    if(SDL_MUSTLOCK(surface))
+        SDL_UnlockSurface(surface);
+}
+#endif
+
+/**
+ * @brief Draws the horizon covering the whole gauge area.
+ *
+ * @param self a HorizonRenderer
+ * @param ctx The gauge's render context
+ */
+void horizon_renderer_render(HorizonRenderer *self, RenderContext *ctx)
+{
+#if USE_SDL_GPU
+    HorizonCanvas canvas;
+    GPU_Rect old_clip;
+    bool had_clip;
+
+    canvas.target = ctx->target.target;
+    canvas.x = ctx->location->x;
+    canvas.y = ctx->location->y;
+
+    horizon_renderer_fill(self, &canvas);
+
+    /*Labels can overflow the gauge when rolled*/
+    had_clip = canvas.target->use_clip_rect;
+    old_clip = canvas.target->clip_rect;
+    GPU_SetClip(canvas.target, canvas.x, canvas.y, self->w, self->h);
+    horizon_renderer_draw_ladder(self, &canvas);
+    if(had_clip)
+        GPU_SetClipRect(canvas.target, old_clip);
+    else
+        GPU_UnsetClip(canvas.target);
+#else
+    SDL_Surface *surface;
+
+    surface = ctx->target.surface;
+    if(surface->format->BytesPerPixel == 4){
+        horizon_renderer_render_surface(self, surface, ctx->location->x, ctx->location->y);
+        return;
+    }
+
+    /*The rasterizer only writes 32bpp pixels, go through a buffer*/
+    if(!self->scratch){
+        self->scratch = SDL_CreateRGBSurfaceWithFormat(0, self->w, self->h, 32, SDL_PIXELFORMAT_RGBA32);
+        if(!self->scratch){
+            printf("Couldn't create horizon buffer: %s\n", SDL_GetError());
+            return;
+        }
+    }
+    horizon_renderer_render_surface(self, self->scratch, 0, 0);
+    SDL_BlitSurface(self->scratch, NULL, surface,
+        &(SDL_Rect){ctx->location->x, ctx->location->y, self->w, self->h}
+    );
+#endif
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef HORIZON_RENDERER_H
+#define HORIZON_RENDERER_H
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "SDL_pcf.h"
+#include "base-gauge.h"
+#include "generic-layer.h"
+
+/* Procedural artificial horizon: sky, sky gradient and earth are
+ * computed from the current attitude each frame instead of being cut
+ * out of a pre-rendered (and pre-rotated) bitmap. Only what falls
+ * inside the gauge is drawn.
+ *
+ * With SDL_gpu, the background is a fragment shader fed with the
+ * attitude as uniforms and the pitch ladder is a batch of quads
+ * sampling a small glyph atlas. Without it, both are rasterized
+ * in software.
+ *
+ * Coordinates follow the screen: x right, y down. The "ball" frame
+ * (u,v) is the screen frame rotated by @angle about @pivot, v > 0
+ * being below the pivot.
+ */
+#if USE_SDL_GPU
+typedef struct{
+    int pivot, rotation, offset, gradient;
+    int sky, sky_down, earth, line;
+}HorizonUniforms; /*shader uniform locations*/
+#endif
+
+typedef struct{
+    int w, h;
+    SDL_Point pivot; /*rotation center, gauge coordinates*/
+    float ppd; /*pixels per degree of pitch*/
+    int size; /*ladder extent, in tens of degrees (both ways)*/
+    int gradient; /*height of the sky gradient above the horizon, in pixels*/
+
+    SDL_Color sky;
+    SDL_Color sky_down; /*sky color right above the horizon*/
+    SDL_Color earth;
+    SDL_Color ladder;
+    SDL_Color center; /*ladder marks centers*/
+
+    /*Current attitude*/
+    float angle; /*degrees, clockwise*/
+    float offset; /*horizon to pivot, in pixels along v*/
+    float c, s; /*cos/sin of angle*/
+
+#if USE_SDL_GPU
+    Uint32 program;
+    GPU_ShaderBlock block;
+    HorizonUniforms uniforms;
+
+    GenericLayer glyphs; /*ladder atlas: marks then labels*/
+    SDL_Rect *glyph_rects;
+    int nglyphs;
+    float *values; /*ladder batch: x, y, s, t per vertex*/
+    unsigned short *indices;
+    int max_quads;
+#else
+    GenericLayer *labels; /*10, 20, ... size*10*/
+    int nlabels;
+
+    Uint32 mapped_format; /*SDL_PixelFormatEnum of the colors below*/
+    Uint32 *lut; /*sky gradient, indexed by distance to the horizon*/
+    Uint32 usky, uearth, uladder, ucenter;
+    SDL_Surface *scratch; /*used when the target isn't 32bpp*/
+#endif
+}HorizonRenderer;
+
+HorizonRenderer *horizon_renderer_init(HorizonRenderer *self, int w, int h,
+                                       SDL_Point *pivot, float ppd, int size,
+                                       int gradient, PCF_Font *font);
+void horizon_renderer_dispose(HorizonRenderer *self);
+
+void horizon_renderer_set_attitude(HorizonRenderer *self, float angle, float pitch);
+void horizon_renderer_render(HorizonRenderer *self, RenderContext *ctx);
+#endif /* HORIZON_RENDERER_H */
@@ -7,8 +7,10 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ladder-gauge.h"
+#include "ladder-page-cache.h"
 #include "generic-layer.h"
 #include "sdl-colors.h"
 #include "misc.h"
@@ -40,7 +42,8 @@ LadderGauge *ladder_gauge_init(LadderGauge *self, int w, int h, LadderPageDescri
 {
     base_gauge_init(BASE_GAUGE(self), &ladder_gauge_ops, w, h);
 
-    self->descriptor = descriptor;
+    /*Identical tapes share their pages*/
+    self->descriptor = ladder_page_cache_register(descriptor);
     if(rubis > 0)
         self->rubis = rubis;
     else
@@ -52,12 +55,12 @@ static void *ladder_gauge_dispose(LadderGauge *self)
 {
     for(int i = 0; i < N_PAGES; i++){
         if(self->pages[i]){
-            ladder_page_free(self->pages[i]);
+            ladder_page_cache_release(self->pages[i]);
             self->pages[i] = NULL;
         }
     }
     if(self->descriptor)
-        free(self->descriptor); /*No need for virtual dispose ATM*/
+        ladder_page_cache_unregister(self->descriptor);
 
     return self;
 }
@@ -88,7 +91,7 @@ LadderPage *ladder_gauge_get_page(LadderGauge *self, uintf8_t idx)
 //            printf("j = %d - %d = %d\n",i,offset,j);
             if( j < 0 ){
                 if(self->pages[i]){
-                    ladder_page_free(self->pages[i]);
+                    ladder_page_cache_release(self->pages[i]);
                     self->pages[i] = NULL;
                 }
             }else{
@@ -103,7 +106,7 @@ LadderPage *ladder_gauge_get_page(LadderGauge *self, uintf8_t idx)
             j = i + offset;
             if( j > N_PAGES-1){
                 if(self->pages[i]){
-                    ladder_page_free(self->pages[i]);
+                    ladder_page_cache_release(self->pages[i]);
                     self->pages[i] = NULL;
                 }
             }else{
@@ -116,7 +119,7 @@ LadderPage *ladder_gauge_get_page(LadderGauge *self, uintf8_t idx)
 
     a_idx = idx - self->base;
     if(!self->pages[a_idx])
-        self->pages[a_idx] = ladder_page_descriptor_create_page(self->descriptor, idx);
+        self->pages[a_idx] = ladder_page_cache_get_page(self->descriptor, idx);
 
     return self->pages[a_idx];
 }
@@ -141,8 +144,26 @@ static void ladder_gauge_update_state(LadderGauge *self, Uint32 dt)
 
     SFV_GAUGE(self)->value = SFV_GAUGE(self)->value >= 0 ? SFV_GAUGE(self)->value : 0.0f;
 
+    /*Upload pages drawn in the background since last time*/
+    ladder_page_cache_collect(self->descriptor);
+
     page = ladder_gauge_get_page_for(self, SFV_GAUGE(self)->value);
 
+    /* Pages on the way get drawn ahead of time, so that going through a
+     * page boundary doesn't hitch. Two in the direction of travel, one
+     * in the other.*/
+    int pidx = ladder_page_get_index(page);
+    if(SFV_GAUGE(self)->value > self->last_value){
+        ladder_page_cache_prefetch(self->descriptor, pidx + 1);
+        ladder_page_cache_prefetch(self->descriptor, pidx + 2);
+        ladder_page_cache_prefetch(self->descriptor, pidx - 1);
+    }else if(SFV_GAUGE(self)->value < self->last_value){
+        ladder_page_cache_prefetch(self->descriptor, pidx - 1);
+        ladder_page_cache_prefetch(self->descriptor, pidx - 2);
+        ladder_page_cache_prefetch(self->descriptor, pidx + 1);
+    }
+    self->last_value = SFV_GAUGE(self)->value;
+
     y = ladder_page_resolve_value(page, SFV_GAUGE(self)->value);
 //    printf("y = %f for value = %f\n",y,value);
     rubis = (self->rubis < 0) ? base_gauge_h(BASE_GAUGE(self)) / 2.0 : self->rubis;
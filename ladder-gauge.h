@@ -36,6 +36,7 @@ typedef struct{
 
     LadderPage *pages[N_PAGES];
     uintf8_t base;
+    float last_value; /*Value trend, to draw pages ahead*/
 
     LadderPageDescriptor *descriptor;
 
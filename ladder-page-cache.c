@@ -0,0 +1,361 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder-page-cache.h"
+#include "ladder-page-renderer.h"
+#include "generic-layer.h"
+
+/* Bucket heads and chain links are entry index + 1, so that a zeroed
+ * cache is an empty one.*/
+static LadderPageCache cache = {0};
+
+static uint32_t ladder_page_cache_hash_key(const char *key)
+{
+    uint32_t rv = 2166136261u;
+
+    for(; *key; key++)
+        rv = (rv ^ (uint8_t)*key) * 16777619u;
+    return rv;
+}
+
+static inline int ladder_page_cache_bucket(LadderPageDescriptor *descriptor, int index)
+{
+    uint32_t h;
+
+    h = ((uintptr_t)descriptor >> 4) * 2654435761u;
+    h ^= index * 16777619u;
+    return (h ^ (h >> 16)) & (LADDER_CACHE_BUCKETS - 1);
+}
+
+static int ladder_page_cache_find(LadderPageDescriptor *descriptor, int index)
+{
+    LadderPageEntry *entry;
+
+    for(int i = cache.buckets[ladder_page_cache_bucket(descriptor, index)] - 1; i >= 0; i = entry->next - 1){
+        entry = &cache.entries[i];
+        if(entry->descriptor == descriptor && entry->index == index)
+            return i;
+    }
+    return -1;
+}
+
+static bool ladder_page_cache_insert(LadderPageDescriptor *descriptor, int index, LadderPage *page)
+{
+    LadderPageEntry *entry;
+    void *tmp;
+    size_t i;
+    int bucket;
+
+    for(i = 0; i < cache.n_entries && cache.entries[i].page; i++);
+    if(i == cache.n_entries){
+        tmp = realloc(cache.entries, sizeof(LadderPageEntry) * (cache.n_entries + 8));
+        if(!tmp)
+            return false;
+        cache.entries = tmp;
+        memset(&cache.entries[cache.n_entries], 0, sizeof(LadderPageEntry) * 8);
+        cache.n_entries += 8;
+    }
+
+    bucket = ladder_page_cache_bucket(descriptor, index);
+    entry = &cache.entries[i];
+    *entry = (LadderPageEntry){
+        .descriptor = descriptor,
+        .index = index,
+        .page = page,
+        .last_use = ++cache.clock,
+        .next = cache.buckets[bucket]
+    };
+    cache.buckets[bucket] = i + 1;
+    if(GENERIC_LAYER(page)->refcount == 0)
+        cache.nspare++;
+
+    return true;
+}
+
+/*Takes an entry out of the cache, returns its page*/
+static LadderPage *ladder_page_cache_remove(int i)
+{
+    LadderPageEntry *entry;
+    LadderPage *rv;
+    int *link;
+
+    entry = &cache.entries[i];
+    link = &cache.buckets[ladder_page_cache_bucket(entry->descriptor, entry->index)];
+    while(*link != i + 1)
+        link = &cache.entries[*link - 1].next;
+    *link = entry->next;
+
+    rv = entry->page;
+    if(GENERIC_LAYER(rv)->refcount == 0)
+        cache.nspare--;
+    *entry = (LadderPageEntry){0};
+
+    return rv;
+}
+
+/**
+ * Least recently used page nobody holds. Of @p descriptor, or of any
+ * descriptor if NULL. -1 if there is none.
+ */
+static int ladder_page_cache_find_spare(LadderPageDescriptor *descriptor)
+{
+    LadderPageEntry *entry;
+    int rv;
+
+    rv = -1;
+    for(size_t i = 0; i < cache.n_entries; i++){
+        entry = &cache.entries[i];
+        if(!entry->page || GENERIC_LAYER(entry->page)->refcount)
+            continue;
+        if(descriptor && entry->descriptor != descriptor)
+            continue;
+        if(rv < 0 || entry->last_use < cache.entries[rv].last_use)
+            rv = i;
+    }
+    return rv;
+}
+
+static void ladder_page_cache_trim(void)
+{
+    int i;
+
+    while(cache.nspare > LADDER_CACHE_SPARE){
+        i = ladder_page_cache_find_spare(NULL);
+        if(i < 0)
+            break;
+        ladder_page_free(ladder_page_cache_remove(i));
+    }
+}
+
+/**
+ * @brief Registers a descriptor with the cache. If an identical one
+ * (same bake_key) is already registered, @p descriptor is freed and
+ * the registered one is returned instead.
+ *
+ * Descriptors without a bake_key are never merged.
+ *
+ * @param descriptor A heap-allocated descriptor. Owned by the cache
+ * after this call.
+ * @return The descriptor to use, release it with
+ * ladder_page_cache_unregister.
+ */
+LadderPageDescriptor *ladder_page_cache_register(LadderPageDescriptor *descriptor)
+{
+    LadderDescriptorEntry *entry;
+    uint32_t hash;
+    void *tmp;
+
+    if(!descriptor)
+        return NULL;
+
+    hash = ladder_page_cache_hash_key(descriptor->bake_key);
+    if(descriptor->bake_key[0]){
+        for(size_t i = 0; i < cache.n_descriptors; i++){
+            entry = &cache.descriptors[i];
+            if(entry->hash == hash && !strcmp(entry->descriptor->bake_key, descriptor->bake_key)){
+                if(entry->descriptor != descriptor)
+                    free(descriptor); /*No need for virtual dispose ATM*/
+                entry->refcount++;
+                return entry->descriptor;
+            }
+        }
+    }
+
+    tmp = realloc(cache.descriptors, sizeof(LadderDescriptorEntry) * (cache.n_descriptors + 1));
+    if(!tmp)
+        return descriptor; /*Works, unshared*/
+    cache.descriptors = tmp;
+    cache.descriptors[cache.n_descriptors++] = (LadderDescriptorEntry){
+        .descriptor = descriptor,
+        .hash = hash,
+        .refcount = 1
+    };
+
+    return descriptor;
+}
+
+/**
+ * @brief Matching call to ladder_page_cache_register. When the last
+ * user of @p descriptor is gone, frees it along with its cached pages.
+ * All pages of @p descriptor must have been released beforehand.
+ *
+ * @param descriptor A descriptor returned by ladder_page_cache_register
+ */
+void ladder_page_cache_unregister(LadderPageDescriptor *descriptor)
+{
+    LadderDescriptorEntry *entry;
+    LadderPage *page;
+    size_t i;
+
+    for(i = 0; i < cache.n_descriptors && cache.descriptors[i].descriptor != descriptor; i++);
+    if(i == cache.n_descriptors){ /*Registration failed*/
+        ladder_page_renderer_cancel(descriptor);
+        free(descriptor);
+        return;
+    }
+    entry = &cache.descriptors[i];
+    if(--entry->refcount > 0)
+        return;
+
+    ladder_page_renderer_cancel(descriptor);
+    for(size_t j = 0; j < cache.n_entries; j++){
+        if(cache.entries[j].page && cache.entries[j].descriptor == descriptor){
+            page = ladder_page_cache_remove(j);
+            if(GENERIC_LAYER(page)->refcount)
+                printf("%s: page %d still in use, freeing it anyway\n", __FUNCTION__, ladder_page_get_index(page));
+            ladder_page_free(page);
+        }
+    }
+    free(descriptor);
+
+    cache.descriptors[i] = cache.descriptors[--cache.n_descriptors];
+    if(!cache.n_descriptors){
+        free(cache.descriptors);
+        free(cache.entries);
+        cache = (LadderPageCache){0};
+    }
+}
+
+/**
+ * @brief Gets page @p index of @p descriptor, ready to be displayed. By
+ * order of preference: from the cache, from the background renderer,
+ * by redrawing a spare page, by creating a new one.
+ *
+ * @param descriptor A registered descriptor
+ * @param index The page index within the strip
+ * @return The page, with a reference taken on it. Must be given back
+ * with ladder_page_cache_release. NULL on failure.
+ */
+LadderPage *ladder_page_cache_get_page(LadderPageDescriptor *descriptor, int index)
+{
+    LadderPageEntry *entry;
+    LadderPage *rv;
+    int i;
+
+    i = ladder_page_cache_find(descriptor, index);
+    if(i >= 0){
+        entry = &cache.entries[i];
+        if(GENERIC_LAYER(entry->page)->refcount == 0)
+            cache.nspare--;
+        generic_layer_ref(GENERIC_LAYER(entry->page));
+        entry->last_use = ++cache.clock;
+        return entry->page;
+    }
+
+    rv = ladder_page_renderer_collect(descriptor, index);
+    if(!rv){
+        i = ladder_page_cache_find_spare(descriptor);
+        if(i < 0){
+            rv = ladder_page_descriptor_create_page(descriptor, index);
+            if(!rv)
+                return NULL;
+        }else{
+            rv = ladder_page_cache_remove(i);
+            if(!ladder_page_descriptor_draw_page(descriptor, rv, index)){
+                ladder_page_free(rv);
+                return NULL;
+            }
+            ladder_page_finish(rv);
+        }
+    }else{
+        ladder_page_finish(rv);
+    }
+
+    generic_layer_ref(GENERIC_LAYER(rv));
+    if(!ladder_page_cache_insert(descriptor, index, rv))
+        printf("%s: Couldn't cache page %d, it won't be shared\n", __FUNCTION__, index);
+    return rv;
+}
+
+/**
+ * @brief Gives back a page obtained with ladder_page_cache_get_page. The
+ * page stays in the cache as a spare once nobody uses it.
+ *
+ * @param page The page to release
+ */
+void ladder_page_cache_release(LadderPage *page)
+{
+    int i;
+
+    i = ladder_page_cache_find(page->descriptor, ladder_page_get_index(page));
+    if(i < 0 || cache.entries[i].page != page){
+        /*Not cached, see ladder_page_cache_get_page failure case*/
+        generic_layer_unref(GENERIC_LAYER(page));
+        return;
+    }
+    if(--GENERIC_LAYER(page)->refcount == 0){
+        cache.nspare++;
+        ladder_page_cache_trim();
+    }
+}
+
+bool ladder_page_cache_has_page(LadderPageDescriptor *descriptor, int index)
+{
+    return ladder_page_cache_find(descriptor, index) >= 0;
+}
+
+/**
+ * @brief Has page @p index of @p descriptor drawn in the background, if
+ * it's not already cached or on its way. A spare page is redrawn if
+ * there is one.
+ *
+ * @param descriptor A registered descriptor
+ * @param index The page index within the strip
+ */
+void ladder_page_cache_prefetch(LadderPageDescriptor *descriptor, int index)
+{
+    LadderPage *page;
+    int i;
+
+    if(index < 0)
+        return;
+    if(ladder_page_cache_has_page(descriptor, index) || ladder_page_renderer_pending(descriptor, index))
+        return;
+
+    i = ladder_page_cache_find_spare(descriptor);
+    if(i >= 0)
+        page = ladder_page_cache_remove(i);
+    else
+        page = ladder_page_new(index * descriptor->page_size, descriptor);
+    if(!page)
+        return;
+
+    if(!ladder_page_renderer_request(descriptor, page, index)){
+        if(i >= 0) /*Untouched, still good*/
+            ladder_page_cache_insert(descriptor, ladder_page_get_index(page), page);
+        else
+            ladder_page_free(page);
+    }
+}
+
+/**
+ * @brief Uploads the pages of @p descriptor that have been drawn in the
+ * background and adds them to the cache. Main thread only.
+ *
+ * @param descriptor A registered descriptor
+ */
+void ladder_page_cache_collect(LadderPageDescriptor *descriptor)
+{
+    LadderPage *page;
+    int index;
+
+    while((page = ladder_page_renderer_collect_any(descriptor))){
+        index = ladder_page_get_index(page);
+        if(ladder_page_cache_has_page(descriptor, index)){
+            ladder_page_free(page);
+            continue;
+        }
+        ladder_page_finish(page);
+        if(!ladder_page_cache_insert(descriptor, index, page))
+            ladder_page_free(page);
+    }
+    ladder_page_cache_trim();
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef LADDER_PAGE_CACHE_H
+#define LADDER_PAGE_CACHE_H
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder-page.h"
+
+/* Process-wide LadderPage cache. Descriptors with the same bake_key
+ * draw the same pages: they are merged into a single one when
+ * registered, and the pages of that descriptor, keyed on the page
+ * index, are shared (refcounted) between all gauges using it. Each
+ * page is then drawn and uploaded once, whatever the number of tapes
+ * showing it.
+ *
+ * Pages no gauge uses anymore are kept around, up to
+ * LADDER_CACHE_SPARE, to be handed back as they are or redrawn as
+ * another page of the same descriptor.
+ */
+#define LADDER_CACHE_BUCKETS 32 /*power of 2*/
+#define LADDER_CACHE_SPARE 8
+
+typedef struct{
+    LadderPageDescriptor *descriptor;
+    uint32_t hash; /*bake_key hash*/
+    int refcount;
+}LadderDescriptorEntry;
+
+typedef struct{
+    LadderPageDescriptor *descriptor;
+    int index;
+    LadderPage *page; /*NULL for free entries*/
+
+    uint32_t last_use;
+    int next; /*Next entry in the bucket + 1, 0 for none*/
+}LadderPageEntry;
+
+typedef struct{
+    LadderDescriptorEntry *descriptors;
+    size_t n_descriptors;
+
+    LadderPageEntry *entries;
+    size_t n_entries;
+    int buckets[LADDER_CACHE_BUCKETS]; /*First entry + 1, 0 for none*/
+
+    uint32_t clock; /*Incremented on each use, for LRU*/
+    size_t nspare;
+}LadderPageCache;
+
+LadderPageDescriptor *ladder_page_cache_register(LadderPageDescriptor *descriptor);
+void ladder_page_cache_unregister(LadderPageDescriptor *descriptor);
+
+LadderPage *ladder_page_cache_get_page(LadderPageDescriptor *descriptor, int index);
+void ladder_page_cache_release(LadderPage *page);
+bool ladder_page_cache_has_page(LadderPageDescriptor *descriptor, int index);
+void ladder_page_cache_prefetch(LadderPageDescriptor *descriptor, int index);
+void ladder_page_cache_collect(LadderPageDescriptor *descriptor);
+#endif /* LADDER_PAGE_CACHE_H */
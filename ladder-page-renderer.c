@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ladder-page-renderer.h"
+
+static LadderPageRenderer renderer = {
+    .mtx = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER
+};
+
+static void *ladder_page_renderer_worker(void *arg)
+{
+    LadderPageJob *job;
+
+    pthread_mutex_lock(&renderer.mtx);
+    while(!renderer.quit){
+        job = NULL;
+        for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+            if(renderer.jobs[i].state == JOB_PENDING){
+                job = &renderer.jobs[i];
+                break;
+            }
+        }
+        if(!job){
+            pthread_cond_wait(&renderer.cond, &renderer.mtx);
+            continue;
+        }
+
+        job->state = JOB_RUNNING;
+        pthread_mutex_unlock(&renderer.mtx);
+        ladder_page_descriptor_draw_page(job->descriptor, job->page, job->index);
+        pthread_mutex_lock(&renderer.mtx);
+        job->state = JOB_DONE;
+        pthread_cond_broadcast(&renderer.cond);
+    }
+    pthread_mutex_unlock(&renderer.mtx);
+
+    return NULL;
+}
+
+/*Must be called with the lock held*/
+static LadderPageJob *ladder_page_renderer_find(LadderPageDescriptor *descriptor, int index)
+{
+    for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+        if(renderer.jobs[i].state != JOB_FREE
+           && renderer.jobs[i].descriptor == descriptor
+           && renderer.jobs[i].index == index)
+            return &renderer.jobs[i];
+    }
+    return NULL;
+}
+
+/*Must be called with the lock held. Releases the job slot.*/
+static LadderPage *ladder_page_renderer_take(LadderPageJob *job)
+{
+    LadderPage *rv;
+
+    rv = job->page;
+    *job = (LadderPageJob){0};
+    return rv;
+}
+
+/**
+ * @brief Queues page @p index of @p descriptor to be drawn in the
+ * background.
+ *
+ * The descriptor's init_page will run on the worker thread: it must
+ * only draw on the page canvas and use fonts that have already been
+ * loaded. Pages are not drawn before the first one of each strip has
+ * been created synchronously, which takes care of that for the
+ * existing descriptors.
+ *
+ * @param descriptor The strip descriptor
+ * @param page A page to draw on: either new (ladder_page_new) or
+ * recycled from the same descriptor. Owned by the renderer until
+ * collected.
+ * @param index The page index within the strip
+ * @return true if the page has been queued, false otherwise (queue
+ * full, or page already queued). The caller keeps @p page on failure.
+ */
+bool ladder_page_renderer_request(LadderPageDescriptor *descriptor, LadderPage *page, int index)
+{
+    LadderPageJob *job;
+    bool rv;
+
+    pthread_mutex_lock(&renderer.mtx);
+    if(!renderer.started){
+        if(pthread_create(&renderer.tid, NULL, ladder_page_renderer_worker, NULL) != 0){
+            pthread_mutex_unlock(&renderer.mtx);
+            printf("Couldn't start the ladder page renderer, drawing pages synchronously\n");
+            return false;
+        }
+        renderer.started = true;
+    }
+
+    rv = false;
+    if(!ladder_page_renderer_find(descriptor, index)){
+        for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+            job = &renderer.jobs[i];
+            if(job->state == JOB_FREE){
+                *job = (LadderPageJob){
+                    .descriptor = descriptor,
+                    .page = page,
+                    .index = index,
+                    .state = JOB_PENDING
+                };
+                pthread_cond_broadcast(&renderer.cond);
+                rv = true;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&renderer.mtx);
+
+    return rv;
+}
+
+/**
+ * @brief Tells whether page @p index of @p descriptor has been queued
+ * and not collected yet.
+ */
+bool ladder_page_renderer_pending(LadderPageDescriptor *descriptor, int index)
+{
+    bool rv;
+
+    pthread_mutex_lock(&renderer.mtx);
+    rv = ladder_page_renderer_find(descriptor, index) != NULL;
+    pthread_mutex_unlock(&renderer.mtx);
+
+    return rv;
+}
+
+/**
+ * @brief Gets page @p index of @p descriptor, that is needed right now.
+ *
+ * If the worker is drawing it, waits for it to be done. If the worker
+ * hasn't started on it, draws it on the calling thread instead.
+ *
+ * @param descriptor The strip descriptor
+ * @param index The page index within the strip
+ * @return The drawn page, to be finished with ladder_page_finish. NULL
+ * if the page hasn't been requested.
+ */
+LadderPage *ladder_page_renderer_collect(LadderPageDescriptor *descriptor, int index)
+{
+    LadderPageJob *job;
+    LadderPage *rv;
+    bool draw;
+
+    pthread_mutex_lock(&renderer.mtx);
+    job = ladder_page_renderer_find(descriptor, index);
+    if(!job){
+        pthread_mutex_unlock(&renderer.mtx);
+        return NULL;
+    }
+    while(job->state == JOB_RUNNING)
+        pthread_cond_wait(&renderer.cond, &renderer.mtx);
+    draw = job->state == JOB_PENDING;
+    rv = ladder_page_renderer_take(job);
+    pthread_mutex_unlock(&renderer.mtx);
+
+    if(draw)
+        ladder_page_descriptor_draw_page(descriptor, rv, index);
+    return rv;
+}
+
+/**
+ * @brief Gets any page of @p descriptor that the worker is done with.
+ * Never blocks.
+ *
+ * @param descriptor The strip descriptor
+ * @return A drawn page, to be finished with ladder_page_finish. NULL if
+ * none is ready.
+ */
+LadderPage *ladder_page_renderer_collect_any(LadderPageDescriptor *descriptor)
+{
+    LadderPage *rv;
+
+    rv = NULL;
+    pthread_mutex_lock(&renderer.mtx);
+    for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+        if(renderer.jobs[i].state == JOB_DONE && renderer.jobs[i].descriptor == descriptor){
+            rv = ladder_page_renderer_take(&renderer.jobs[i]);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&renderer.mtx);
+
+    return rv;
+}
+
+/**
+ * @brief Drops all jobs of @p descriptor, freeing their pages. Waits for
+ * the one being drawn, if any. Must be called before @p descriptor is
+ * freed.
+ *
+ * @param descriptor The strip descriptor
+ */
+void ladder_page_renderer_cancel(LadderPageDescriptor *descriptor)
+{
+    LadderPageJob *job;
+
+    pthread_mutex_lock(&renderer.mtx);
+    for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+        job = &renderer.jobs[i];
+        if(job->state == JOB_FREE || job->descriptor != descriptor)
+            continue;
+        while(job->state == JOB_RUNNING)
+            pthread_cond_wait(&renderer.cond, &renderer.mtx);
+        ladder_page_free(ladder_page_renderer_take(job));
+    }
+    pthread_mutex_unlock(&renderer.mtx);
+}
+
+/**
+ * @brief Stops the worker and frees the pages left over. Call once all
+ * LadderGauges have been freed.
+ */
+void ladder_page_renderer_shutdown(void)
+{
+    pthread_mutex_lock(&renderer.mtx);
+    if(!renderer.started){
+        pthread_mutex_unlock(&renderer.mtx);
+        return;
+    }
+    renderer.quit = true;
+    pthread_cond_broadcast(&renderer.cond);
+    pthread_mutex_unlock(&renderer.mtx);
+    pthread_join(renderer.tid, NULL);
+
+    for(int i = 0; i < LADDER_RENDERER_JOBS; i++){
+        if(renderer.jobs[i].state != JOB_FREE)
+            ladder_page_free(ladder_page_renderer_take(&renderer.jobs[i]));
+    }
+    renderer.started = false;
+    renderer.quit = false;
+}
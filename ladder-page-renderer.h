@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef LADDER_PAGE_RENDERER_H
+#define LADDER_PAGE_RENDERER_H
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "ladder-page.h"
+
+/* Draws LadderPages on a worker thread, ahead of the LadderGauges
+ * needing them. The worker only draws on page canvases: textures are
+ * built by the gauges, on the main thread, when they collect the
+ * pages (see ladder_page_finish).
+ *
+ * Shared by all gauges, started on the first request.
+ */
+#define LADDER_RENDERER_JOBS 8
+
+typedef enum{
+    JOB_FREE = 0,
+    JOB_PENDING,
+    JOB_RUNNING,
+    JOB_DONE
+}LadderPageJobState;
+
+typedef struct{
+    LadderPageDescriptor *descriptor;
+    LadderPage *page;
+    int index;
+    LadderPageJobState state;
+}LadderPageJob;
+
+typedef struct{
+    pthread_t tid;
+    pthread_mutex_t mtx;
+    pthread_cond_t cond; /*Signaled on new jobs and finished ones*/
+    bool started;
+    bool quit;
+
+    LadderPageJob jobs[LADDER_RENDERER_JOBS];
+}LadderPageRenderer;
+
+bool ladder_page_renderer_request(LadderPageDescriptor *descriptor, LadderPage *page, int index);
+bool ladder_page_renderer_pending(LadderPageDescriptor *descriptor, int index);
+LadderPage *ladder_page_renderer_collect(LadderPageDescriptor *descriptor, int index);
+LadderPage *ladder_page_renderer_collect_any(LadderPageDescriptor *descriptor);
+void ladder_page_renderer_cancel(LadderPageDescriptor *descriptor);
+void ladder_page_renderer_shutdown(void);
+#endif /* LADDER_PAGE_RENDERER_H */
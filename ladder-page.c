@@ -10,11 +10,14 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "asset-blob.h"
 #include "generic-layer.h"
 #include "ladder-page.h"
+#include "raster.h"
 #include "sdl-colors.h"
 #include "SDL_pcf.h"
 
+static void ladder_page_init_range(LadderPage *self);
 
 LadderPageDescriptor *ladder_page_descriptor_init(LadderPageDescriptor *self, int width, int height,
                                                   ScrollType direction, float page_size, float vstep,
@@ -28,6 +31,7 @@ LadderPageDescriptor *ladder_page_descriptor_init(LadderPageDescriptor *self, in
     self->vsubstep = vsubstep;
     self->offset = NAN;
     self->init_page = func;
+    self->bake_key[0] = '\0';
 
     return self;
 }
@@ -52,16 +56,86 @@ void ladder_page_descriptor_compute_offset(LadderPageDescriptor *self, float ppv
     }
 }
 
+/**
+ * @brief Creates page @p index of the strip described by @p self, ready
+ * to be displayed.
+ *
+ * @param self a LadderPageDescriptor
+ * @param index The page index within the strip
+ * @return a newly allocated LadderPage
+ *
+ * @see ladder_page_descriptor_draw_page
+ */
 LadderPage *ladder_page_descriptor_create_page(LadderPageDescriptor *self, int index)
 {
     LadderPage *rv;
-    float start;
 
-    start = index * self->page_size; /*'nominal' start, will be offsted by the init func */
+    rv = ladder_page_new(index * self->page_size, self);
+    if(!rv)
+        return NULL;
+
+    if(!ladder_page_descriptor_draw_page(self, rv, index)){
+        ladder_page_free(rv);
+        return NULL;
+    }
+    ladder_page_finish(rv);
+
+    return rv;
+}
+
+/**
+ * @brief Draws page @p index of the strip described by @p self on
+ * @p page. The page comes from the baked assets when they have it,
+ * otherwise it is drawn by the descriptor's init_page.
+ *
+ * Only touches the page canvas: safe to call from a worker thread (see
+ * ladder-page-renderer.h). The page must then be finished on the main
+ * thread with ladder_page_finish.
+ *
+ * @param self a LadderPageDescriptor
+ * @param page A page of @p self, either new or already drawn (recycled)
+ * @param index The page index within the strip
+ * @return @p page on success, NULL otherwise.
+ */
+LadderPage *ladder_page_descriptor_draw_page(LadderPageDescriptor *self, LadderPage *page, int index)
+{
+    LadderPage *rv;
+    SDL_Surface *baked;
+    char name[ASSET_NAME_MAX];
+
+    /*'nominal' start, will be offsted by the init func */
+    VERTICAL_STRIP(page)->start = index * self->page_size;
+    VERTICAL_STRIP(page)->end = NAN;
+    if(!self->bake_key[0])
+        return self->init_page(page);
+
+    snprintf(name, ASSET_NAME_MAX, "page/%s/%d", self->bake_key, index);
+    baked = asset_blob_get_surface(name, NULL);
+    if(baked){
+        if(GENERIC_LAYER(page)->canvas)
+            SDL_FreeSurface(GENERIC_LAYER(page)->canvas);
+        GENERIC_LAYER(page)->canvas = baked;
+        ladder_page_init_range(page);
+        return page;
+    }
 
-    rv = ladder_page_new(start, self);
+    rv = self->init_page(page);
+    if(rv)
+        asset_blob_record(name, GENERIC_LAYER(rv)->canvas, NULL);
+    return rv;
+}
 
-    return self->init_page(rv);
+/**
+ * @brief Makes a drawn page ready to be displayed: uploads it to its
+ * texture, reusing the one of a recycled page, and drops the canvas.
+ * Main thread only.
+ *
+ * @param self a LadderPage, drawn
+ */
+void ladder_page_finish(LadderPage *self)
+{
+    generic_layer_update_texture(GENERIC_LAYER(self));
+    generic_layer_release_canvas(GENERIC_LAYER(self));
 }
 
 LadderPage *ladder_page_new(float start, LadderPageDescriptor *descriptor)
@@ -78,25 +152,16 @@ LadderPage *ladder_page_new(float start, LadderPageDescriptor *descriptor)
 }
 
 
-LadderPage *ladder_page_init(LadderPage *self)
+/*Sets the page value range from its index and the descriptor*/
+static void ladder_page_init_range(LadderPage *self)
 {
     VerticalStrip *strip;
-    GenericLayer *layer;
     LadderPageDescriptor *descriptor;
 
     strip = VERTICAL_STRIP(self);
-    layer = GENERIC_LAYER(self);
     descriptor = LADDER_PAGE(self)->descriptor;
 
-    bool rv;
-
-
-    rv = generic_layer_init(GENERIC_LAYER(self), descriptor->width, descriptor->height);
-    if(!rv){
-        return NULL;
-    }
-
-    strip->ppv = generic_layer_h(layer)/(descriptor->page_size*1.0);
+    strip->ppv = descriptor->height/(descriptor->page_size*1.0);
 //    printf("LadderPageDescriptor ppv is %f\n",strip->ppv);
 //    printf("Page marking range is [%f, %f]\n", strip->start, strip->end);
 
@@ -111,6 +176,33 @@ LadderPage *ladder_page_init(LadderPage *self)
 
 //    int page_index = ladder_page_get_index(LADDER_PAGE(self));
 //    printf("Page %d real range is [%f, %f]\n",page_index, strip->start, strip->end);
+}
+
+LadderPage *ladder_page_init(LadderPage *self)
+{
+    GenericLayer *layer;
+    LadderPageDescriptor *descriptor;
+    bool rv;
+
+    layer = GENERIC_LAYER(self);
+    descriptor = LADDER_PAGE(self)->descriptor;
+
+    if(layer->canvas){ /*Recycled page, software path*/
+        SDL_FillRect(layer->canvas, NULL, 0);
+    }else{
+#if USE_SDL_GPU
+        /*Recycled pages keep their texture, to be updated in place*/
+        GPU_Image *texture = layer->texture;
+#endif
+        rv = generic_layer_init(layer, descriptor->width, descriptor->height);
+#if USE_SDL_GPU
+        layer->texture = texture;
+#endif
+        if(!rv){
+            return NULL;
+        }
+    }
+    ladder_page_init_range(self);
 
     return self;
 }
@@ -164,8 +256,7 @@ void ladder_page_draw_ruler(LadderPage *self, uint8_t base_unit_px, LadderPageRu
     SDL_Surface *surface;
     int x;
     Uint32 white;
-    Uint32 *pixels;
-    int firstx, lastx;
+    int width;
     int ticks_drawn;
 
     int n_steps;
@@ -207,31 +298,21 @@ void ladder_page_draw_ruler(LadderPage *self, uint8_t base_unit_px, LadderPageRu
     white = SDL_UWHITE(surface);
 
     SDL_LockSurface(surface);
-    pixels = surface->pixels;
+    /*Border, ticks are then drawn on top of it*/
+    x = location == LocationLeft ? 0 : (surface->w-1);
+    raster_vspan(surface, x, 0, surface->h-1, white);
     ticks_drawn = preload_ticks;
     for(int y = surface->h-1, cnt = 1; y >= 0; y--, cnt++){
-        lastx = location == LocationLeft ? 0 : (surface->w-1);
-        firstx = lastx;
-        if( (cnt + preload_px) % base_unit_px == 0){ /*tick mark*/
-            if(ticks_drawn % n_steps == 0){ /*big tick mark*/
-                if(location == LocationLeft)
-                    lastx = firstx + big_step_width;
-                else
-                    firstx = lastx - big_step_width;
-            }else{ /*small tick mark*/
-                if(location == LocationLeft)
-                    lastx = firstx + small_step_width;
-                else
-                    firstx = lastx - small_step_width;
-            }
-            ticks_drawn++;
-        }else{
-            firstx = lastx;
-        }
-        for(int j = firstx; j <= lastx; j++){
-            Uint32 idx = y * surface->w + j;
-            pixels[idx] = white;
-        }
+        if( (cnt + preload_px) % base_unit_px != 0) /*no tick mark*/
+            continue;
+        width = (ticks_drawn % n_steps == 0) /*big tick mark*/
+                ? big_step_width
+                : small_step_width;
+        if(location == LocationLeft)
+            raster_hspan(surface, x, x + width, y, white);
+        else
+            raster_hspan(surface, x - width, x, y, white);
+        ticks_drawn++;
     }
     SDL_UnlockSurface(surface);
 }
@@ -11,6 +11,8 @@
 #include "SDL_pcf.h"
 #include "vertical-strip.h"
 
+#define LADDER_BAKE_KEY_MAX 48
+
 typedef struct _LadderPage LadderPage;
 
 typedef enum {TOP_DOWN, BOTTUM_UP} ScrollType;
@@ -75,6 +77,10 @@ typedef struct{
     float offset; /*Trailing/leading pixels turned into value units*/
 
     LPInitFunc init_page;
+    /* Identifies the pages drawn by this descriptor in the baked
+     * assets (see asset-blob.h). Must change with anything that
+     * changes the pages. Empty if pages can't be baked.*/
+    char bake_key[LADDER_BAKE_KEY_MAX];
 }LadderPageDescriptor;
 
 
@@ -107,11 +113,13 @@ LadderPageDescriptor *ladder_page_descriptor_init(LadderPageDescriptor *self, in
                                                   float vsubstep, LPInitFunc func);
 void ladder_page_descriptor_compute_offset(LadderPageDescriptor *self, float ppv);
 LadderPage *ladder_page_descriptor_create_page(LadderPageDescriptor *self, int index);
+LadderPage *ladder_page_descriptor_draw_page(LadderPageDescriptor *self, LadderPage *page, int index);
 
 
 LadderPage *ladder_page_new(float start, LadderPageDescriptor *descriptor);
 LadderPage *ladder_page_init(LadderPage *self);
 void ladder_page_free(LadderPage *self);
+void ladder_page_finish(LadderPage *self);
 
 int ladder_page_get_index(LadderPage *self);
 float ladder_page_resolve_value(LadderPage *self, float value);
@@ -11,11 +11,18 @@
 
 #include <SDL2/SDL.h>
 
+#include "animation-scheduler.h"
+#include "asset-blob.h"
 #include "base-gauge.h"
 #include "basic-hud.h"
 #include "dialogs/direct-to-dialog.h"
+#include "frame-scheduler.h"
+#include "ladder-page-renderer.h"
 #include "side-panel.h"
 #include "map-gauge.h"
+#include "nav-db.h"
+#include "nav-engine.h"
+#include "perf-overlay.h"
 #include "resource-manager.h"
 #include "sdl-colors.h"
 #include "widgets/base-widget.h"
@@ -65,22 +72,35 @@ BasicHud *hud = NULL;
 SidePanel *panel = NULL;
 MapGauge *map = NULL;
 DirectToDialog *ddt = NULL;
+#if ENABLE_PERF_COUNTERS
+PerfOverlay *perf_overlay = NULL;
+bool g_show_perf = false;
+#define PERF_CSV_FILE "sofis-perf.csv"
+#endif
 
 bool g_show3d = false;
+bool g_idle_enabled = true;
+bool g_activity = false; /*Input received since last frame*/
+Uint32 g_input_ticks = 0; /*Oldest input not on screen yet, 0 if none*/
 DataSource *g_ds;
 RunningMode g_mode;
 
-/*Return true to quit the app*/
-bool handle_keyboard(SDL_KeyboardEvent *event, Uint32 elapsed)
-{
-    AttitudeData new_attitude;
-    LocationData new_location;
-    bool attitude_dirty = false;
-    bool location_dirty = false;
+/* What the keys of a frame change, applied once after all of them
+ * have been handled: a burst of keys fires the listeners (and moves
+ * the map) once instead of once per key.*/
+typedef struct{
+    AttitudeData attitude;
+    LocationData location;
+    bool attitude_dirty;
+    bool location_dirty;
 
-    new_attitude = g_ds->attitude;
-    new_location = g_ds->location;
+    int32_t viewport_dx;
+    int32_t viewport_dy;
+}InputChanges;
 
+/*Return true to quit the app*/
+bool handle_keyboard(SDL_KeyboardEvent *event, InputChanges *changes)
+{
     if(ddt && ddt->visible)
         base_widget_handle_event(BASE_WIDGET(ddt), event);
 
@@ -110,35 +130,48 @@ bool handle_keyboard(SDL_KeyboardEvent *event, Uint32 elapsed)
             }
             break;
 
+#if ENABLE_PERF_COUNTERS
+        case SDLK_F11:
+            if(event->state == SDL_PRESSED)
+                g_show_perf = !g_show_perf;
+            break;
+        case SDLK_F12:
+            if(event->state == SDL_PRESSED){
+                if(perf_counters_dump_csv(PERF_CSV_FILE))
+                    printf("Perf counters written to %s\n", PERF_CSV_FILE);
+            }
+            break;
+#endif
+
         /*MapGauge controls*/
         case SDLK_KP_8: /*keypad up arrows*/
             if(event->state == SDL_PRESSED){
-                map_gauge_manipulate_viewport(map, 0, -10, true);
+                changes->viewport_dy -= 10;
             }
             break;
         case SDLK_KP_2: /*keypad down arrows*/
             if(event->state == SDL_PRESSED){
-                map_gauge_manipulate_viewport(map, 0, 10, true);
+                changes->viewport_dy += 10;
             }
             break;
         case SDLK_KP_4: /*keypad left arrows*/
             if(event->state == SDL_PRESSED){
-                map_gauge_manipulate_viewport(map, -10, 0, true);
+                changes->viewport_dx -= 10;
             }
             break;
         case SDLK_KP_6: /*keypad right arrows*/
             if(event->state == SDL_PRESSED){
-                map_gauge_manipulate_viewport(map, 10, 0, true);
+                changes->viewport_dx += 10;
             }
             break;
         case SDLK_KP_PLUS:
             if(event->state == SDL_PRESSED){
-                map_gauge_set_level(map, map->level+1);
+                map_gauge_set_zoom(map, map->zoom_to + 1, true);
             }
             break;
         case SDLK_KP_MINUS:
             if(event->state == SDL_PRESSED){
-                map_gauge_set_level(map, map->level-1);
+                map_gauge_set_zoom(map, map->zoom_to - 1, true);
             }
             break;
         case SDLK_KP_DIVIDE:
@@ -146,6 +179,13 @@ bool handle_keyboard(SDL_KeyboardEvent *event, Uint32 elapsed)
                 map_gauge_center_on_marker(map, true);
             }
             break;
+        case SDLK_KP_MULTIPLY:
+            if(event->state == SDL_PRESSED){
+                map_gauge_set_orientation(map,
+                    map->orientation == MAP_NORTH_UP ? MAP_HEADING_UP : MAP_NORTH_UP
+                );
+            }
+            break;
 
         /*Go to dialog*/
         case SDLK_g:
@@ -161,59 +201,55 @@ bool handle_keyboard(SDL_KeyboardEvent *event, Uint32 elapsed)
         /*Manual camera/position control*/
         case SDLK_z:
             if(event->state == SDL_PRESSED){
-                new_attitude.pitch += 1.0;
-                attitude_dirty = true;
+                changes->attitude.pitch += 1.0;
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_s:
             if(event->state == SDL_PRESSED){
-                new_attitude.pitch -= 1.0;
-                attitude_dirty = true;
+                changes->attitude.pitch -= 1.0;
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_q:
             if(event->state == SDL_PRESSED){
-                new_attitude.roll -= 1.0;
-                attitude_dirty = true;
+                changes->attitude.roll -= 1.0;
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_d:
             if(event->state == SDL_PRESSED){
-                new_attitude.roll += 1.0;
-                attitude_dirty = true;
+                changes->attitude.roll += 1.0;
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_a:
             if(event->state == SDL_PRESSED){
-                new_attitude.heading -= 1.0;
-                new_attitude.heading = fmodf(new_attitude.heading, 360.0);
-                attitude_dirty = true;
+                changes->attitude.heading -= 1.0;
+                changes->attitude.heading = fmodf(changes->attitude.heading, 360.0);
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_e:
             if(event->state == SDL_PRESSED){
-                new_attitude.heading += 1.0;
-                new_attitude.heading = fmodf(new_attitude.heading, 360.0);
-                attitude_dirty = true;
+                changes->attitude.heading += 1.0;
+                changes->attitude.heading = fmodf(changes->attitude.heading, 360.0);
+                changes->attitude_dirty = true;
             }
             break;
         case SDLK_PAGEUP:
             if(event->state == SDL_PRESSED){
-                new_location.altitude += 10;
-                attitude_dirty = true;
+                changes->location.altitude += 10;
+                changes->location_dirty = true;
             }
             break;
         case SDLK_PAGEDOWN:
             if(event->state == SDL_PRESSED){
-                new_location.altitude -= 10;
-                attitude_dirty = true;
+                changes->location.altitude -= 10;
+                changes->location_dirty = true;
             }
             break;
     }
-    if(attitude_dirty)
-        data_source_set_attitude(g_ds, &new_attitude);
-    if(location_dirty)
-        data_source_set_location(g_ds, &new_location);
     return false;
 }
 
@@ -221,23 +257,43 @@ bool handle_keyboard(SDL_KeyboardEvent *event, Uint32 elapsed)
 bool handle_events(Uint32 elapsed)
 {
     SDL_Event event;
+    InputChanges changes;
+    bool done;
 
-    while(SDL_PollEvent(&event) == 1){
+    changes = (InputChanges){
+        .attitude = g_ds->attitude,
+        .location = g_ds->location
+    };
+    /* Drain the queue: all the events received since the previous
+     * frame are handled in this one, a fast burst from a rotary encoder
+     * doesn't get spread over as many frames as it has steps.*/
+    done = false;
+    while(!done && SDL_PollEvent(&event) == 1){
+        g_activity = true;
         switch(event.type){
             case SDL_QUIT:
-                return true;
+                done = true;
                 break;
         case SDL_WINDOWEVENT:
             if(event.window.event == SDL_WINDOWEVENT_CLOSE)
-                return true;
+                done = true;
             break;
             case SDL_KEYUP:
             case SDL_KEYDOWN:
-                return handle_keyboard(&(event.key), elapsed);
+                if(!g_input_ticks)
+                    g_input_ticks = event.key.timestamp ? event.key.timestamp : SDL_GetTicks();
+                done = handle_keyboard(&(event.key), &changes);
                 break;
         }
     }
-    return false;
+
+    if(changes.attitude_dirty)
+        data_source_set_attitude(g_ds, &changes.attitude);
+    if(changes.location_dirty)
+        data_source_set_location(g_ds, &changes.location);
+    if(changes.viewport_dx || changes.viewport_dy)
+        map_gauge_manipulate_viewport(map, changes.viewport_dx, changes.viewport_dy, true);
+    return done;
 }
 
 const char *pretty_mode(RunningMode mode)
@@ -285,19 +341,30 @@ int main(int argc, char **argv)
     float oldv[5] = {0,0,0,0,0};
     RenderTarget rtarget;
 
+    bool vsync = false;
+    uint32_t fps = FRAME_SCHEDULER_DEFAULT_FPS;
+
     g_mode = MODE_FGTAPE;
-    if(argc > 1){
-        if(!strcmp(argv[1], "--sensors"))
+    for(int a = 1; a < argc; a++){
+        if(!strcmp(argv[a], "--sensors"))
             g_mode = MODE_SENSORS;
-        else if(!strcmp(argv[1], "--fgtape"))
+        else if(!strcmp(argv[a], "--fgtape"))
             g_mode = MODE_FGTAPE;
-        else if(!strcmp(argv[1], "--fgremote"))
+        else if(!strcmp(argv[a], "--fgremote"))
             g_mode = MODE_FGREMOTE;
-        else if(!strcmp(argv[1], "--stratux"))
+        else if(!strcmp(argv[a], "--stratux"))
             g_mode = MODE_STRATUX;
-        else if(!strcmp(argv[1], "--mock"))
+        else if(!strcmp(argv[a], "--mock"))
             g_mode = MODE_MOCK;
+        else if(!strcmp(argv[a], "--vsync"))
+            vsync = true;
+        else if(!strcmp(argv[a], "--always-render"))
+            g_idle_enabled = false;
+        else if(!strncmp(argv[a], "--fps=", 6))
+            fps = strtoul(argv[a] + 6, NULL, 10);
     }
+    if(!fps)
+        fps = FRAME_SCHEDULER_DEFAULT_FPS;
 
     switch(g_mode){
         case MODE_SENSORS:
@@ -323,11 +390,13 @@ int main(int argc, char **argv)
         exit(EXIT_FAILURE);
     }
     data_source_set(g_ds);
+    g_ds->wake = frame_scheduler_wake;
 
 #if USE_SDL_GPU
     GPU_Target* gpu_screen = NULL;
 
 	GPU_SetRequiredFeatures(GPU_FEATURE_BASIC_SHADERS);
+    GPU_SetPreInitFlags(GPU_GetPreInitFlags() | (vsync ? GPU_INIT_ENABLE_VSYNC : GPU_INIT_DISABLE_VSYNC));
 #if USE_GLES
 	gpu_screen = GPU_InitRenderer(GPU_RENDERER_GLES_2, SCREEN_WIDTH, SCREEN_HEIGHT, GPU_DEFAULT_INIT_FLAGS);
 #else
@@ -363,6 +432,7 @@ int main(int argc, char **argv)
         exit(-1);
     }
     rtarget.surface = screenSurface;
+    vsync = false; /*Window surfaces aren't synchronized*/
 
     colors[0] = SDL_MapRGB(screenSurface->format, 0xFF, 0xFF, 0xFF);
     colors[1] = SDL_MapRGB(screenSurface->format, 0xFF, 0x00, 0x00);
@@ -372,13 +442,17 @@ int main(int argc, char **argv)
     SDL_ShowCursor(SDL_DISABLE);
 
     SDL_Rect whole = {0,0,640,480};
+    if(!asset_blob_open(BAKE_FILE))
+        printf("No usable baked assets, generating them (see make sofis-bake)\n");
+    if(!nav_db_open(NAVDATA_FILE))
+        printf("No navigation database, Direct-To will be empty (see make navdata)\n");
     hud = basic_hud_new();
 
     panel = side_panel_new(-1, -1);
     SDL_Rect sprect = {0,0, base_gauge_w(BASE_GAUGE(panel)),base_gauge_h(BASE_GAUGE(panel))};
 
     map = map_gauge_new(190,150);
-    map->level = 7;
+    map_gauge_set_level(map, 7);
     SDL_Rect maprect = {SCREEN_WIDTH-200,SCREEN_HEIGHT-160,base_gauge_w(BASE_GAUGE(map)),base_gauge_h(BASE_GAUGE(map))};
 
     SDL_Rect ddtrect ={
@@ -393,7 +467,23 @@ int main(int argc, char **argv)
     viewer = terrain_viewer_new(-0.2);
 #endif
 
+#if ENABLE_PERF_COUNTERS
+    perf_overlay = perf_overlay_new();
+    SDL_Rect perfrect = {
+        100, 20,
+        base_gauge_w(BASE_GAUGE(perf_overlay)),
+        base_gauge_h(BASE_GAUGE(perf_overlay))
+    };
+    /*Name the top-level gauges, others will show up using their address*/
+    perf_counters_set_name(perf_counters_get_type(BASE_GAUGE(hud)->ops), "BasicHud");
+    perf_counters_set_name(perf_counters_get_type(BASE_GAUGE(panel)->ops), "SidePanel");
+    perf_counters_set_name(perf_counters_get_type(BASE_GAUGE(map)->ops), "MapGauge");
+    perf_counters_set_name(perf_counters_get_type(BASE_GAUGE(hud->attitude)->ops), "AttitudeIndicator");
+    perf_counters_set_name(perf_counters_get_type(BASE_GAUGE(perf_overlay)->ops), "PerfOverlay");
+#endif
+
     done = false;
+    bool idle;
     Uint32 ticks;
     Uint32 last_ticks = 0;
     Uint32 elapsed = 0;
@@ -402,9 +492,20 @@ int main(int argc, char **argv)
 
     Uint32 startms, dtms, last_dtms;
     Uint32 nframes = 0;
+    Uint32 max_latency = 0; /*worst input lag of the last second*/
+#if ENABLE_PERF_COUNTERS
+    uint64_t render_start, render_end;
+    uint64_t total_render_time = 0;
+#else
     Uint32 render_start, render_end;
     Uint32 total_render_time = 0;
+#endif
     Uint32 nrender_calls = 0;
+    FrameScheduler scheduler;
+    ScheduledGauge panel_sg = {.gauge = BASE_GAUGE(panel), .priority = FRAME_SKIPPABLE};
+    ScheduledGauge map_sg = {.gauge = BASE_GAUGE(map), .priority = FRAME_SKIPPABLE};
+
+    frame_scheduler_init(&scheduler, fps, vsync);
 #if ENABLE_3D
     g_show3d = true;
 #endif
@@ -436,6 +537,8 @@ int main(int argc, char **argv)
         ATTITUDE_DATA, update_terrain_viewer_attitude
     );
 #endif
+    if(!nav_engine_start(g_ds))
+        printf("Couldn't start the nav engine, no DTK/XTK\n");
     data_source_print_listener_stats(g_ds);
 
     printf("Waiting for fix.");
@@ -451,12 +554,13 @@ int main(int argc, char **argv)
     last_dtms = 0;
     startms = SDL_GetTicks();
     do{
+        elapsed = frame_scheduler_begin(&scheduler);
         ticks = SDL_GetTicks();
-        elapsed = ticks - last_ticks;
         dtms = ticks - startms;
 
         done = handle_events(elapsed);
 
+        Uint32 generation = g_ds->generation;
         if(data_source_frame(DATA_SOURCE(g_ds), dtms - last_dtms)){
             last_dtms = dtms;
 
@@ -470,6 +574,24 @@ int main(int argc, char **argv)
             }
 #endif
         }
+        /*Marks gauges whose animated values have moved as dirty*/
+        animation_scheduler_step(elapsed);
+        /* Nothing new since the previous frame: the screen would be
+         * identical, skip rendering and flipping and wait for input,
+         * data or the next deadline.*/
+        idle = g_idle_enabled && !g_activity
+           && g_ds->generation == generation
+           && !base_gauge_needs_render(BASE_GAUGE(hud))
+           && !base_gauge_needs_render(BASE_GAUGE(panel))
+           && !base_gauge_needs_render(BASE_GAUGE(map))
+           && !(ddt && ddt->visible && base_gauge_needs_render(BASE_GAUGE(ddt)))
+#if ENABLE_PERF_COUNTERS
+           && !g_show_perf
+#endif
+           && scheduler.nframes > 0;
+        if(idle)
+            goto frame_end;
+        g_activity = false;
 #if USE_SDL_GPU
         GPU_ClearRGB(gpu_screen, 0x11, 0x56, 0xFF);
 #else
@@ -483,26 +605,41 @@ int main(int argc, char **argv)
             GPU_ResetRendererState(); /*end 3d*/
         }
 #endif
+#if ENABLE_PERF_COUNTERS
+        render_start = perf_counters_now();
+#else
         render_start = SDL_GetTicks();
+#endif
         base_gauge_render(BASE_GAUGE(hud), elapsed, &(RenderContext){rtarget, &whole, NULL});
-        base_gauge_render(BASE_GAUGE(panel), elapsed, &(RenderContext){rtarget, &sprect, NULL});
-        base_gauge_render(BASE_GAUGE(map), elapsed, &(RenderContext){rtarget, &maprect, NULL});
+        frame_scheduler_render(&scheduler, &panel_sg, elapsed, &(RenderContext){rtarget, &sprect, NULL});
+        frame_scheduler_render(&scheduler, &map_sg, elapsed, &(RenderContext){rtarget, &maprect, NULL});
         if(ddt && ddt->visible)
             base_gauge_render(BASE_GAUGE(ddt), elapsed, &(RenderContext){rtarget, &ddtrect, NULL});
+#if ENABLE_PERF_COUNTERS
+        render_end = perf_counters_now();
+        perf_counters_record_frame(render_end - render_start);
+        if(g_show_perf && perf_overlay)
+            base_gauge_render(BASE_GAUGE(perf_overlay), elapsed, &(RenderContext){rtarget, &perfrect, NULL});
+#else
         render_end = SDL_GetTicks();
+#endif
         total_render_time += render_end - render_start;
         nrender_calls++;
 
+        frame_scheduler_work_done(&scheduler);
 #if USE_SDL_GPU
 		GPU_Flip(gpu_screen);
 #else
         SDL_UpdateWindowSurface(window);
 #endif
+        if(g_input_ticks){ /*input-to-screen, up to the flip*/
+            if(SDL_GetTicks() - g_input_ticks > max_latency)
+                max_latency = SDL_GetTicks() - g_input_ticks;
+            g_input_ticks = 0;
+        }
         nframes++;
+frame_end:
         acc += elapsed;
-        if(elapsed < 20){
-            SDL_Delay(20 - elapsed);
-        }
         if(acc >= 1000){ /*1sec*/
             int h,m,s;
 
@@ -512,21 +649,56 @@ int main(int argc, char **argv)
             dtms -= 60000 * m;
             s = dtms / 1000;
 
-            printf("%02d:%02d:%02d Current FPS: %03d\r",h,m,s, (1000*nframes)/elapsed);
+            printf("%02d:%02d:%02d Current FPS: %03d Missed: %lu Skip level: %d Input lag: %03u ms\r",h,m,s,
+                (1000*nframes)/acc,
+                (unsigned long)scheduler.missed,
+                (int)scheduler.skip_level,
+                max_latency
+            );
             fflush(stdout);
             nframes = 0;
+            max_latency = 0;
             acc = 0;
         }
         i %= N_COLORS;
         last_ticks = ticks;
+        if(idle)
+            frame_scheduler_idle(&scheduler);
+        else
+            frame_scheduler_end(&scheduler);
     }while(!done);
 
+    printf("\n");
+    frame_scheduler_print_stats(&scheduler);
+    printf("Released %zu KiB of layer canvases kept on the GPU only\n",
+        generic_layer_get_released_bytes()/1024
+    );
+    size_t baked, live;
+    asset_blob_get_stats(&baked, &live);
+    printf("Assets: %zu from the bake, %zu generated live\n", baked, live);
+    scheduled_gauge_dispose(&panel_sg);
+    scheduled_gauge_dispose(&map_sg);
+    frame_scheduler_dispose(&scheduler);
+
+#if ENABLE_PERF_COUNTERS
+    printf("Average rendering time (%d samples): %f ms\n", nrender_calls, total_render_time/1000000.0/nrender_calls);
+    if(perf_overlay)
+        base_gauge_free(BASE_GAUGE(perf_overlay));
+#else
     printf("Average rendering time (%d samples): %f ticks\n", nrender_calls, total_render_time*1.0/nrender_calls);
+#endif
     base_gauge_free(BASE_GAUGE(hud));
     base_gauge_free(BASE_GAUGE(panel));
     base_gauge_free(BASE_GAUGE(map));
+#if ENABLE_PERF_COUNTERS
+    perf_counters_shutdown(); /*After all gauges are gone*/
+#endif
     data_source_free(DATA_SOURCE(g_ds));
+    ladder_page_renderer_shutdown();
+    animation_scheduler_shutdown();
     resource_manager_shutdown();
+    asset_blob_close(); /*After all gauges are gone*/
+    nav_db_close();
 #if ENABLE_3D
     terrain_viewer_free(viewer);
     texture_store_shutdown();
@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: GPL-2.0-only
  */
 #include <stdint.h>
+#include <string.h>
+#include <math.h>
 
 #include "base-gauge.h"
 #include "data-source.h"
@@ -48,10 +50,24 @@
     .h = base_gauge_h(BASE_GAUGE((self))) \
 }
 
+/* What is shown of the map at a given level and scale, the pivot staying
+ * put on the gauge: that of the current state, or of the level a zoom is
+ * going to*/
+typedef struct{
+    int32_t world_x;
+    int32_t world_y;
+    uintf8_t level;
+    float scale;
+    float rotation;
+    SDL_Point pivot;
+    int32_t radius;
+}MapGaugeView;
 
 static void map_gauge_render(MapGauge *self, Uint32 dt, RenderContext *ctx);
 static void map_gauge_update_state(MapGauge *self, Uint32 dt);
 static MapGauge *map_gauge_dispose(MapGauge *self);
+static SDL_Point map_gauge_pivot(MapGauge *self);
+static void map_gauge_prefetch(MapGauge *self, uintf8_t level);
 static BaseGaugeOps map_gauge_ops = {
    .render = (RenderFunc)map_gauge_render,
    .update_state = (StateUpdateFunc)map_gauge_update_state,
@@ -99,6 +115,7 @@ MapGauge *map_gauge_new(int w, int h)
 MapGauge *map_gauge_init(MapGauge *self, int w, int h)
 {
     int twidth, theight;
+    int radius;
     size_t cache_tiles;
 
     base_gauge_init(BASE_GAUGE(self),
@@ -114,6 +131,15 @@ MapGauge *map_gauge_init(MapGauge *self, int w, int h)
      */
     /*Keep in the tile stack 2 viewports worth of tiles*/
     cache_tiles = (MAX(twidth, 1) * MAX(twidth, 1)) * 4;
+    /* Heading-up, 2 times the tiles under the circle the viewport turns
+     * in. The marker it turns about can be anywhere in the viewport.
+     * Zooming, tiles are shown down to 1/sqrt(2) of their size, which
+     * widens the circle: the level shown and the one prefetched both fit.
+     * So do the previous and the new patch set, both held while the new
+     * one is built (the cache doesn't evict tiles in use while it can
+     * evict anything else)*/
+    radius = ceil(sqrt(w*w + h*h) * M_SQRT2);
+    cache_tiles = MAX(cache_tiles, (2*radius/TILE_SIZE + 2) * (2*radius/TILE_SIZE + 2) * 2);
     map_tile_cache_init(&self->tile_cache, cache_tiles);
 
     /*TODO: Runtime / GUI selection of maps*/
@@ -133,10 +159,24 @@ MapGauge *map_gauge_init(MapGauge *self, int w, int h)
     );
 #endif
 
+    self->airport_overlay = airport_map_provider_new();
+    if(!self->airport_overlay)
+        return NULL;
+
     self->route_overlay = route_map_provider_new();
     if(!self->route_overlay)
         return NULL;
 
+    self->zoom_animation = base_animation_new(TYPE_FLOAT, 1, &self->zoom);
+    if(!self->zoom_animation)
+        return NULL;
+    if(!base_gauge_add_animation(BASE_GAUGE(self), self->zoom_animation))
+        return NULL;
+
+    /*Labels of the tiles in the tile cache*/
+    if(!map_label_layer_init(&self->labels, self->airport_overlay, cache_tiles))
+        return NULL;
+
     qsort(self->tile_providers,
         self->ntile_providers,
         sizeof(MapProvider*), (__compar_fn_t)map_provider_compare_ptr
@@ -150,6 +190,7 @@ MapGauge *map_gauge_init(MapGauge *self, int w, int h)
     /*TODO: Scale the plane relative to the gauge's size*/
     generic_layer_init_from_file(&self->marker.layer, IMG_DIR"/plane32.png");
     generic_layer_build_texture(&self->marker.layer);
+    generic_layer_release_canvas(&self->marker.layer);
 
     return self;
 }
@@ -168,6 +209,13 @@ static MapGauge *map_gauge_dispose(MapGauge *self)
         generic_layer_unref(self->state.patches[i].layer);
     if(self->state.patches)
         free(self->state.patches);
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++){
+        if(self->state.labels[i].boxes)
+            free(self->state.labels[i].boxes);
+        if(self->state.labels[i].patches)
+            free(self->state.labels[i].patches);
+    }
+    map_label_layer_dispose(&self->labels);
 
     generic_layer_dispose(&self->marker.layer);
     for(int i = 0; i < self->ntile_providers; i++)
@@ -176,42 +224,102 @@ static MapGauge *map_gauge_dispose(MapGauge *self)
     for(int i = 0; i < self->noverlays; i++)
         map_provider_free(self->overlays[i]);
 
-    map_provider_free(MAP_PROVIDER(self->route_overlay));
+    if(self->airport_overlay)
+        map_provider_free(MAP_PROVIDER(self->airport_overlay));
+    if(self->route_overlay)
+        map_provider_free(MAP_PROVIDER(self->route_overlay));
     map_tile_cache_dispose(&self->tile_cache);
     return self;
 }
 
+/* Moves the world coordinates to @p level, the pivot staying where it is
+ * on the gauge (and the marker on its location)*/
+static void map_gauge_switch_level(MapGauge *self, uintf8_t level)
+{
+    double lat, lon;
+    int32_t new_x, new_y;
+    SDL_Point pivot;
+
+    /* TODO: There should be a way to do the same without having to go
+     * through geo coords transforms*/
+    pivot = map_gauge_pivot(self);
+    map_math_pixel_to_geo(self->world_x + pivot.x, self->world_y + pivot.y, self->level, &lat, &lon);
+    map_math_geo_to_pixel(lat, lon, level, &new_x, &new_y);
+    /* Same for the marker, set directly: following it from there would
+     * move the view away from the pivot*/
+    map_math_pixel_to_geo(self->marker.x, self->marker.y, self->level, &lat, &lon);
+    self->level = level;
+    map_math_geo_to_pixel(lat, lon, level, &self->marker.x, &self->marker.y);
+    map_gauge_set_viewport(self, new_x - pivot.x, new_y - pivot.y, false);
+}
+
 /**
  * @brief Sets the current zoom level show by the gauge. Valid levels are
- * 0 to MAP_GAUGE_MAX_LEVEL, owing to types internally used to store positions.
-
- * The current maximum level is 23 with ints (32 bits) which is more than
+ * 0 to MAP_GAUGE_MAX_ZOOM, owing to types internally used to store positions.
+ *
+ * The current maximum level is 15 as SDL_Rect uses ints, which is more than
  * sufficient for aviation purposes
  *
- * This function will try its best to keep the current area and zoom on it.
+ * This function will try its best to keep the current area and zoom on it:
+ * the marker (or the center of the gauge if the marker is out of view)
+ * stays where it is. Any zoom in progress is stopped.
  *
  * @param self a MapGauge
  * @param level the level to show
  * @return true on success, false on failure (level unsupported, ...)
+ *
+ * @see map_gauge_set_zoom
  */
 bool map_gauge_set_level(MapGauge *self, uintf8_t level)
 {
-    double lat, lon;
-    int32_t new_x, new_y;
+    if(level > MAP_GAUGE_MAX_ZOOM)
+        return false;
+    base_animation_stop(self->zoom_animation);
+    self->zoom = self->zoom_to = level;
+    if(level != self->level)
+        map_gauge_switch_level(self, level);
+    BASE_GAUGE(self)->dirty = true;
+    return true;
+}
 
-    if(level > 15)
+/**
+ * @brief Zooms to a fractional level. In between levels, the tiles of the
+ * nearest level are drawn scaled about the marker (or the center of the
+ * gauge if the marker is out of view).
+ *
+ * When animated, the zoom springs to @p zoom over a few frames, the
+ * tiles of the destination level being fetched beforehand so that
+ * none is missing on the way. Scaling needs SDL_gpu: without it, the
+ * zoom is rounded to the nearest level and never animated.
+ *
+ * @param self a MapGauge
+ * @param zoom The level to show, clamped to 0-MAP_GAUGE_MAX_ZOOM
+ * @param animated Whether to get there smoothly
+ * @return true if the zoom changed, false otherwise
+ *
+ * @see map_gauge_set_level
+ */
+bool map_gauge_set_zoom(MapGauge *self, float zoom, bool animated)
+{
+    zoom = fminf(fmaxf(zoom, 0), MAP_GAUGE_MAX_ZOOM);
+#if !USE_SDL_GPU
+    zoom = roundf(zoom);
+    animated = false;
+#endif
+    if(zoom == self->zoom_to)
         return false;
-    if(level != self->level){
-        /* Keep the view at the same place. TODO: There should be a way to do the
-         * same without having to go through geo coords transforms*/
-        map_math_pixel_to_geo(self->world_x, self->world_y, self->level, &lat, &lon);
-        map_math_geo_to_pixel(lat, lon, level, &new_x, &new_y);
-        /*Same for the marker*/
-        map_math_pixel_to_geo(self->marker.x, self->marker.y, self->level, &lat, &lon);
-        self->level = level;
-        map_gauge_set_viewport(self, new_x, new_y, false);
-        map_gauge_set_marker_position(self, lat, lon);
+    self->zoom_to = zoom;
+
+    if(!animated){
+        base_animation_stop(self->zoom_animation);
+        self->zoom = zoom;
+        if(lroundf(zoom) != self->level)
+            map_gauge_switch_level(self, lroundf(zoom));
+        BASE_GAUGE(self)->dirty = true;
+        return true;
     }
+    map_gauge_prefetch(self, lroundf(zoom));
+    base_animation_spring_to(self->zoom_animation, zoom);
     return true;
 }
 
@@ -268,12 +376,41 @@ bool map_gauge_set_marker_heading(MapGauge *self, float heading)
     heading = clampf(heading, 0, 360);
     if(heading != self->marker.heading){
         self->marker.heading = heading;
+        if(self->orientation == MAP_HEADING_UP)
+            self->rotation = -heading;
         BASE_GAUGE(self)->dirty = true;
         return true;
     }
     return false;
 }
 
+/**
+ * @brief Sets which way is up on the map: north, or the marker heading.
+ * Heading-up, the map is turned about the marker, which is kept at the
+ * center of the gauge, so that it always points up.
+ *
+ * @param self a MapGauge
+ * @param orientation The new orientation
+ * @return true on success, false on failure (heading-up needs SDL_gpu)
+ */
+bool map_gauge_set_orientation(MapGauge *self, MapOrientation orientation)
+{
+#if !USE_SDL_GPU
+    /*See base_gauge_begin_transform*/
+    if(orientation != MAP_NORTH_UP)
+        return false;
+#endif
+    if(orientation == self->orientation)
+        return true;
+
+    self->orientation = orientation;
+    self->rotation = (orientation == MAP_HEADING_UP) ? -self->marker.heading : 0;
+    if(!self->roaming)
+        map_gauge_center_on_marker(self, false);
+    BASE_GAUGE(self)->dirty = true;
+    return true;
+}
+
 /**
  * @brief Moves the viewport by the given increment while putting it in a
  * temporary 'roaming' mode. Roaming mode will last MANIPULATE_TIMEOUT ms
@@ -294,8 +431,20 @@ bool map_gauge_set_marker_heading(MapGauge *self, float heading)
  */
 bool map_gauge_manipulate_viewport(MapGauge *self, int32_t dx, int32_t dy, bool animated)
 {
+    double a, s;
+    int32_t tmp;
+
     self->last_manipulation = SDL_GetTicks();
     self->roaming = true;
+    /* Moves are given as seen on the gauge, which can be turned and,
+     * between two levels, scaled: back to pixels of the current level*/
+    s = exp2(self->zoom - self->level);
+    if(self->rotation != 0 || s != 1){
+        a = self->rotation * M_PI / 180.0;
+        tmp = lround((dx * cos(a) + dy * sin(a)) / s);
+        dy = lround((dy * cos(a) - dx * sin(a)) / s);
+        dx = tmp;
+    }
     return map_gauge_set_viewport(self,
             self->world_x + dx,
             self->world_y + dy,
@@ -339,6 +488,10 @@ bool map_gauge_follow_marker(MapGauge *self)
 {
     bool visible;
 
+    /*Heading-up, the map turns about the marker: keep it centered*/
+    if(self->orientation == MAP_HEADING_UP)
+        return map_gauge_center_on_marker(self, true);
+
     visible = SDL_IntersectRect(&map_gauge_viewport(self),
         &map_gauge_marker_worldbox(self),
         &self->state.marker_src
@@ -457,6 +610,16 @@ static GenericLayer *map_gauge_get_tile(MapGauge *self, uintf8_t level, int32_t
         generic_layer_free(tmp);
     }
 
+    /*Airports, under the route*/
+    tmp = map_provider_get_tile(MAP_PROVIDER(self->airport_overlay), level, x, y);
+    if(tmp){
+        SDL_BlitSurface(
+            tmp->canvas, NULL,
+            rv->canvas,NULL
+        );
+        generic_layer_free(tmp);
+    }
+
     /*Apply the route drawing, if any*/
     tmp = map_provider_get_tile(MAP_PROVIDER(self->route_overlay), level, x, y);
     if(tmp){
@@ -468,6 +631,8 @@ static GenericLayer *map_gauge_get_tile(MapGauge *self, uintf8_t level, int32_t
     }
 end:
     generic_layer_build_texture(rv);
+    /*Tiles are never drawn on once in the cache*/
+    generic_layer_release_canvas(rv);
     map_tile_cache_add(&self->tile_cache, rv, level, x, y);
     return rv;
 }
@@ -488,38 +653,287 @@ void map_gauge_route_changed(MapGauge *self, RouteData *newv)
         &newv->from, &newv->to
     );
     map_tile_cache_clear(&self->tile_cache);
+    map_label_layer_set_route(&self->labels, &newv->from, &newv->to);
     BASE_GAUGE(self)->dirty = true;
 }
 
-/*TODO: split up*/
+/*Room for the labels of @p ntiles tiles*/
+static bool map_gauge_reserve_labels(MapGauge *self, size_t ntiles)
+{
+    MapGaugeLabels *labels;
+    size_t alabels;
+    void *tmp;
+
+    alabels = ntiles * MAP_LABEL_MAX_LABELS;
+    if(alabels <= self->state.alabels)
+        return true;
+
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++){
+        labels = &self->state.labels[i];
+        tmp = realloc(labels->boxes, alabels * sizeof(SDL_Rect));
+        if(!tmp)
+            return false;
+        labels->boxes = tmp;
+        tmp = realloc(labels->patches, alabels * MAP_LABEL_MAX_LEN * sizeof(PCF_StaticFontPatch));
+        if(!tmp)
+            return false;
+        labels->patches = tmp;
+    }
+    self->state.alabels = alabels;
+    return true;
+}
+
+/* Gauge point the map is turned and scaled about: the marker, or the
+ * center of the gauge when the marker is out of view*/
+static SDL_Point map_gauge_pivot(MapGauge *self)
+{
+    int32_t px, py;
+
+    px = self->marker.x - self->world_x;
+    py = self->marker.y - self->world_y;
+    if(px >= 0 && px < base_gauge_w(BASE_GAUGE(self)) && py >= 0 && py < base_gauge_h(BASE_GAUGE(self)))
+        return (SDL_Point){px, py};
+    return (SDL_Point){base_gauge_center_x(BASE_GAUGE(self)), base_gauge_center_y(BASE_GAUGE(self))};
+}
+
+/**
+ * @brief Sets up a view of the map at @p level, shown with @p scale,
+ * the pivot staying where it is on the gauge.
+ *
+ * @param self a MapGauge
+ * @param view The view to set up
+ * @param level The level of the tiles
+ * @param scale The scale the tiles are drawn at
+ */
+static void map_gauge_view_init(MapGauge *self, MapGaugeView *view, uintf8_t level, float scale)
+{
+    double lat, lon;
+    int32_t px, py;
+
+    view->level = level;
+    view->scale = scale;
+    view->rotation = self->rotation;
+    view->pivot = map_gauge_pivot(self);
+    view->world_x = self->world_x;
+    view->world_y = self->world_y;
+    if(level != self->level){
+        map_math_pixel_to_geo(self->world_x + view->pivot.x, self->world_y + view->pivot.y,
+            self->level, &lat, &lon
+        );
+        map_math_geo_to_pixel(lat, lon, level, &px, &py);
+        view->world_x = px - view->pivot.x;
+        view->world_y = py - view->pivot.y;
+    }
+    /*Farthest corner of the gauge*/
+    px = MAX(view->pivot.x, base_gauge_w(BASE_GAUGE(self)) - view->pivot.x);
+    py = MAX(view->pivot.y, base_gauge_h(BASE_GAUGE(self)) - view->pivot.y);
+    view->radius = ceil(sqrt((double)px * px + (double)py * py));
+}
+
+/* World area to draw. North-up, the gauge seen through the scale.
+ * Turned, the bounding box of the circle the gauge turns in about the
+ * pivot: it doesn't depend on the angle, so turning doesn't fetch
+ * tiles*/
+static SDL_Rect map_gauge_covered_area(MapGauge *self, MapGaugeView *view)
+{
+    SDL_Rect rv, map;
+    int32_t cx, cy, r;
+    int32_t x0, y0, x1, y1;
+
+    cx = view->world_x + view->pivot.x;
+    cy = view->world_y + view->pivot.y;
+    if(view->rotation == 0){
+        x0 = cx + floor(-view->pivot.x / view->scale);
+        y0 = cy + floor(-view->pivot.y / view->scale);
+        x1 = cx + ceil((base_gauge_w(BASE_GAUGE(self)) - view->pivot.x) / view->scale);
+        y1 = cy + ceil((base_gauge_h(BASE_GAUGE(self)) - view->pivot.y) / view->scale);
+        rv = (SDL_Rect){x0, y0, x1 - x0, y1 - y0};
+    }else{
+        r = ceil(view->radius / view->scale);
+        rv = (SDL_Rect){cx - r, cy - r, 2 * r + 1, 2 * r + 1};
+    }
+    map = (SDL_Rect){0, 0, map_math_size(view->level), map_math_size(view->level)};
+    SDL_IntersectRect(&map, &rv, &rv);
+    return rv;
+}
+
+/* First and last tiles of a row of tiles to draw, within @p area. Turned,
+ * rows of the circle only go as wide as the circle is at that row*/
+static void map_gauge_row_span(MapGaugeView *view, SDL_Rect *area, int32_t tiley,
+                               int32_t *first, int32_t *last)
+{
+    int32_t cx, cy, y0, y1, dy, r, half;
+
+    *first = area->x / TILE_SIZE;
+    *last = (area->x + area->w - 1) / TILE_SIZE;
+    if(view->rotation == 0)
+        return;
+
+    cx = view->world_x + view->pivot.x;
+    cy = view->world_y + view->pivot.y;
+    r = ceil(view->radius / view->scale);
+    y0 = tiley * TILE_SIZE;
+    y1 = y0 + TILE_SIZE - 1;
+    dy = cy < y0 ? y0 - cy : (cy > y1 ? cy - y1 : 0);
+    if(dy > r){
+        *last = *first - 1;
+        return;
+    }
+    half = ceil(sqrt((double)r * r - (double)dy * dy));
+    *first = MAX(*first, MAX(cx - half, 0) / TILE_SIZE);
+    *last = MIN(*last, (cx + half) / TILE_SIZE);
+}
+
+/**
+ * @brief Gets the tiles (and their labels) of @p level into the caches
+ * before zooming to it, for the widest it will be shown: scaled by
+ * 1/sqrt(2) when it becomes the nearest level. Zooming then never waits
+ * for tiles.
+ *
+ * @param self a MapGauge
+ * @param level The level to prefetch
+ */
+static void map_gauge_prefetch(MapGauge *self, uintf8_t level)
+{
+    MapGaugeView view;
+    SDL_Rect area;
+    int32_t first, last;
+
+    map_gauge_view_init(self, &view, level, M_SQRT1_2);
+    area = map_gauge_covered_area(self, &view);
+    for(int tiley = area.y / TILE_SIZE; tiley <= (area.y + area.h - 1) / TILE_SIZE; tiley++){
+        map_gauge_row_span(&view, &area, tiley, &first, &last);
+        for(int tilex = first; tilex <= last; tilex++){
+            map_gauge_get_tile(self, level, tilex, tiley);
+            map_label_layer_get_tile(&self->labels, level, tilex, tiley);
+        }
+    }
+}
+
+/* Where a point of the map, in gauge coordinates, moves to once the map
+ * is turned and scaled about the pivot: @p x and @p y are offset
+ * accordingly*/
+static void map_gauge_transform_point(MapGauge *self, int32_t *x, int32_t *y)
+{
+    double a, rx, ry, s;
+
+    if(self->state.rotation == 0 && self->state.scale == 1)
+        return;
+    a = self->state.rotation * M_PI / 180.0;
+    s = self->state.scale;
+    rx = *x - self->state.pivot.x;
+    ry = *y - self->state.pivot.y;
+    *x = self->state.pivot.x + lround((rx * cos(a) - ry * sin(a)) * s);
+    *y = self->state.pivot.y + lround((rx * sin(a) + ry * cos(a)) * s);
+}
+
+/* Adds the labels of a tile to the state, clipped to the gauge. Labels
+ * are kept upright and at their size when the map is turned or scaled:
+ * they move with the point they are centered on*/
+static void map_gauge_add_labels(MapGauge *self, MapLabelTile *tile)
+{
+    MapLabel *label;
+    MapGaugeLabels *labels;
+    PCF_StaticFontPatch *patch;
+    PCF_StaticFont *font;
+    SDL_Rect gauge, area, clipped;
+    int32_t dx, dy, cx, cy;
+
+    gauge = (SDL_Rect){0, 0, base_gauge_w(BASE_GAUGE(self)), base_gauge_h(BASE_GAUGE(self))};
+    for(size_t i = 0; i < tile->nlabels; i++){
+        label = &tile->labels[i];
+        /*Tile to gauge coordinates*/
+        dx = tile->x * TILE_SIZE - self->world_x;
+        dy = tile->y * TILE_SIZE - self->world_y;
+        cx = label->box.x + dx + label->box.w / 2;
+        cy = label->box.y + dy + label->box.h / 2;
+        map_gauge_transform_point(self, &cx, &cy);
+        dx = cx - label->box.w / 2 - label->box.x;
+        dy = cy - label->box.h / 2 - label->box.y;
+
+        area = (SDL_Rect){label->box.x + dx, label->box.y + dy, label->box.w, label->box.h};
+        if(!SDL_IntersectRect(&gauge, &area, &clipped))
+            continue;
+        labels = &self->state.labels[label->style];
+        labels->boxes[labels->nboxes++] = clipped;
+
+        font = self->labels.fonts[label->style];
+        for(size_t j = 0; j < label->npatches; j++){
+            patch = &tile->patches[label->first + j];
+            area = (SDL_Rect){
+                .x = patch->dst.x + dx,
+                .y = patch->dst.y + dy,
+                .w = font->metrics.characterWidth,
+                .h = font->metrics.ascent + font->metrics.descent
+            };
+            if(!SDL_IntersectRect(&gauge, &area, &clipped))
+                continue;
+            labels->patches[labels->npatches++] = (PCF_StaticFontPatch){
+                .src = {
+                    .x = patch->src.x + clipped.x - area.x,
+                    .y = patch->src.y + clipped.y - area.y,
+                    .w = clipped.w,
+                    .h = clipped.h
+                },
+                .dst = clipped
+            };
+        }
+    }
+}
+
+/* Moves to the integer level nearest to the zoom, from which tiles are
+ * drawn scaled*/
+static void map_gauge_sync_level(MapGauge *self)
+{
+    long level;
+
+    level = lround(self->zoom);
+    level = clamp(level, 0, MAP_GAUGE_MAX_ZOOM);
+    if(level != self->level)
+        map_gauge_switch_level(self, level);
+}
+
 static void map_gauge_update_state(MapGauge *self, Uint32 dt)
 {
     /* We go up to level 23, which is 8388608 tiles
      * (from 0 to 8388607) in both directions*/
-    int32_t tl_tile_x, tl_tile_y; /*top left*/
-    int32_t br_tile_x, br_tile_y; /*bottom right*/
+    int32_t first_tile_x, last_tile_x;
+    int32_t tl_tile_y, br_tile_y;
+    int32_t px, py;
+    size_t tile_span, nprevious;
+    MapGaugeView view;
+    SDL_Rect area;
 
-    tl_tile_x = self->world_x / TILE_SIZE;
-    tl_tile_y = self->world_y / TILE_SIZE;
+    map_gauge_sync_level(self);
+    map_gauge_view_init(self, &view, self->level, exp2f(self->zoom - self->level));
+    self->state.rotation = view.rotation;
+    self->state.scale = view.scale;
+    self->state.pivot = view.pivot;
+    self->state.radius = view.radius;
 
-    int32_t lastx = self->world_x + base_gauge_w(BASE_GAUGE(self)) - 1;
-    int32_t lasty = self->world_y + base_gauge_h(BASE_GAUGE(self)) - 1;
-    br_tile_x = lastx / TILE_SIZE;
-    br_tile_y = lasty / TILE_SIZE;
-
-    int32_t x_tile_span = (br_tile_x - tl_tile_x) + 1;
-    int32_t y_tile_span = (br_tile_y - tl_tile_y) + 1;
-    int32_t tile_span = x_tile_span * y_tile_span;
+    area = map_gauge_covered_area(self, &view);
+    tl_tile_y = area.y / TILE_SIZE;
+    br_tile_y = (area.y + area.h - 1) / TILE_SIZE;
+    tile_span = 0;
+    for(int tiley = tl_tile_y; tiley <= br_tile_y; tiley++){
+        map_gauge_row_span(&view, &area, tiley, &first_tile_x, &last_tile_x);
+        if(last_tile_x >= first_tile_x)
+            tile_span += last_tile_x - first_tile_x + 1;
+    }
 
     /*There will be as many patches as tiles over which we are located*/
     /* Currently an X,Y tile is the fusion of all X,Y tiles
      * given by providers that can provide that tile.
+     * The new patches go after the previous ones, which keep their
+     * tiles referenced (and thus cached) until the new set is built:
+     * tiles fetched for the new set never evict tiles it still uses.
      */
-    if(tile_span > self->state.apatches){
+    nprevious = self->state.npatches;
+    if(nprevious + tile_span > self->state.apatches){
         void *tmp;
         size_t stmp;
         stmp = self->state.apatches;
-        self->state.apatches = tile_span;
+        self->state.apatches = nprevious + tile_span;
         tmp = realloc(self->state.patches, self->state.apatches*sizeof(MapPatch));
         if(!tmp){
             self->state.apatches = stmp;
@@ -528,14 +942,16 @@ static void map_gauge_update_state(MapGauge *self, Uint32 dt)
         self->state.patches = tmp;
     }
 
-    for(int i = 0; i < self->state.npatches; i++)
-        generic_layer_unref(self->state.patches[i].layer);
-    self->state.npatches = 0;
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++){
+        self->state.labels[i].nboxes = 0;
+        self->state.labels[i].npatches = 0;
+    }
+    bool has_labels = map_gauge_reserve_labels(self, tile_span);
 
     GenericLayer *layer;
-    SDL_Rect viewport = map_gauge_viewport(self);
     for(int tiley = tl_tile_y; tiley <= br_tile_y; tiley++){
-        for(int tilex = tl_tile_x; tilex <= br_tile_x; tilex++){
+        map_gauge_row_span(&view, &area, tiley, &first_tile_x, &last_tile_x);
+        for(int tilex = first_tile_x; tilex <= last_tile_x; tilex++){
             layer = map_gauge_get_tile(self, self->level, tilex, tiley);
             if(!layer)
                 printf("Couldn't get tile layer for tile x:%d y:%d zoom:%d\n",tilex,tiley, self->level);
@@ -548,8 +964,8 @@ static void map_gauge_update_state(MapGauge *self, Uint32 dt)
                 .w = TILE_SIZE,
                 .h = TILE_SIZE
             };
-            /*Get intersection of the tile with the viewport, in world coordinates*/
-            SDL_IntersectRect(&viewport,
+            /*Get intersection of the tile with the area, in world coordinates*/
+            SDL_IntersectRect(&area,
                 &tile,
                 &self->state.patches[self->state.npatches].src
             );
@@ -557,29 +973,51 @@ static void map_gauge_update_state(MapGauge *self, Uint32 dt)
             /*Change src to be in the tile's local coordinates (0-255)*/
             self->state.patches[self->state.npatches].src.x -= tile.x;
             self->state.patches[self->state.npatches].src.y -= tile.y;
-            /*Change dst to be in the viewport's local coordinates (0-(w-1),0-(h-1)*/
+            /* Change dst to be in the viewport's local coordinates (0-(w-1),0-(h-1),
+             * before turning and scaling*/
             self->state.patches[self->state.npatches].dst.x -= self->world_x;
             self->state.patches[self->state.npatches].dst.y -= self->world_y;
 
             self->state.patches[self->state.npatches].layer = layer;
             generic_layer_ref(layer);
             self->state.npatches++;
+
+            /*Placed once per tile, only moved around afterwards*/
+            if(has_labels)
+                map_gauge_add_labels(self, map_label_layer_get_tile(&self->labels, self->level, tilex, tiley));
         }
     }
 
-    /*Get intersection of the marker with the viewport, in world coordinates*/
-    bool marker_visible = SDL_IntersectRect(&viewport,
-        &map_gauge_marker_worldbox(self),
-        &self->state.marker_src
+    /*Drop the previous set*/
+    for(int i = 0; i < nprevious; i++)
+        generic_layer_unref(self->state.patches[i].layer);
+    self->state.npatches -= nprevious;
+    memmove(self->state.patches, self->state.patches + nprevious,
+        self->state.npatches * sizeof(MapPatch)
+    );
+
+    /* Marker box in gauge coordinates, moved along with its center when
+     * the map is turned or scaled about another point*/
+    SDL_Rect gauge = {0, 0, base_gauge_w(BASE_GAUGE(self)), base_gauge_h(BASE_GAUGE(self))};
+    SDL_Rect marker = map_gauge_marker_worldbox(self);
+    marker.x -= self->world_x;
+    marker.y -= self->world_y;
+    px = self->marker.x - self->world_x;
+    py = self->marker.y - self->world_y;
+    map_gauge_transform_point(self, &px, &py);
+    marker.x += px - (self->marker.x - self->world_x);
+    marker.y += py - (self->marker.y - self->world_y);
+
+    /*Get intersection of the marker with the gauge*/
+    bool marker_visible = SDL_IntersectRect(&gauge,
+        &marker,
+        &self->state.marker_dst
     );
     if(marker_visible){
-        self->state.marker_dst = self->state.marker_src;
-        /*Change src to be in the marker's local coordinates (0-(w-1),0-(h-1)*/
-        self->state.marker_src.x -= map_gauge_marker_left(self);
-        self->state.marker_src.y -= map_gauge_marker_top(self);
-        /*Change dst to be in the viewport's local coordinates (0-(w-1),0-(h-1)*/
-        self->state.marker_dst.x -= self->world_x;
-        self->state.marker_dst.y -= self->world_y;
+        /*src in the marker's local coordinates (0-(w-1),0-(h-1)*/
+        self->state.marker_src = self->state.marker_dst;
+        self->state.marker_src.x -= marker.x;
+        self->state.marker_src.y -= marker.y;
     }else{
         self->state.marker_dst = (SDL_Rect){-1,-1,-1,-1};
         self->state.marker_src = self->state.marker_dst;
@@ -589,15 +1027,44 @@ static void map_gauge_update_state(MapGauge *self, Uint32 dt)
 static void map_gauge_render(MapGauge *self, Uint32 dt, RenderContext *ctx)
 {
     MapPatch *patch;
+    MapGaugeLabels *labels;
+    RenderTransform transform;
 
+    /*Heading-up or zooming, all tiles are turned and scaled at once about the pivot*/
+    if((self->state.rotation != 0 || self->state.scale != 1)
+       && base_gauge_begin_transform(BASE_GAUGE(self), ctx,
+            self->state.rotation, self->state.scale,
+            &self->state.pivot, &transform)){
+        for(int i = 0; i < self->state.npatches; i++){
+            patch = &self->state.patches[i];
+            base_gauge_blit_layer_transformed(BASE_GAUGE(self), ctx, &transform,
+                patch->layer, &patch->src,
+                &patch->dst
+            );
+        }
+        base_gauge_end_transform(BASE_GAUGE(self), ctx, &transform);
+    }else{
+        for(int i = 0; i < self->state.npatches; i++){
+            patch = &self->state.patches[i];
+            base_gauge_blit_layer(BASE_GAUGE(self), ctx,
+                patch->layer, &patch->src,
+                &patch->dst
+            );
+        }
+    }
 
-    for(int i = 0; i < self->state.npatches; i++){
-        patch = &self->state.patches[i];
-        base_gauge_blit_layer(BASE_GAUGE(self), ctx,
-            patch->layer, &patch->src,
-            &patch->dst
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++){
+        labels = &self->state.labels[i];
+        for(int j = 0; j < labels->nboxes; j++){
+            base_gauge_fill(BASE_GAUGE(self), ctx,
+                &labels->boxes[j], &self->labels.backgrounds[i], false
+            );
+        }
+        base_gauge_draw_static_font_rect_patches(BASE_GAUGE(self), ctx,
+            self->labels.fonts[i], labels->patches, labels->npatches
         );
     }
+
     if(self->state.marker_src.x >= 0){
 #if 0
         base_gauge_blit_layer(BASE_GAUGE(self), ctx,
@@ -608,7 +1075,7 @@ static void map_gauge_render(MapGauge *self, Uint32 dt, RenderContext *ctx)
 #endif
         base_gauge_blit_rotated_texture(BASE_GAUGE(self), ctx,
             self->marker.layer.texture, &self->state.marker_src,
-            self->marker.heading,
+            self->marker.heading + self->state.rotation,
             NULL,
             &self->state.marker_dst,
             NULL);
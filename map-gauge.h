@@ -13,6 +13,8 @@
 #include "map-tile-cache.h"
 #include "map-provider.h"
 #include "route-map-provider.h"
+#include "airport-map-provider.h"
+#include "map-label-layer.h"
 #include "data-source.h"
 #include "misc.h"
 
@@ -21,6 +23,8 @@
  * of level 23
  */
 #define MAP_GAUGE_MAX_LEVEL 23
+/*Levels that can be shown, SDL_Rect ints only go up to level 15*/
+#define MAP_GAUGE_MAX_ZOOM 15
 
 typedef struct{
     /*TODO: Array of pointers to layers, as much as providers/overlays*/
@@ -29,13 +33,29 @@ typedef struct{
     SDL_Rect dst;
 }MapPatch;
 
+/*Labels of a given style, in gauge coordinates*/
+typedef struct{
+    SDL_Rect *boxes;
+    size_t nboxes;
+    PCF_StaticFontPatch *patches; /*clipped to the gauge*/
+    size_t npatches;
+}MapGaugeLabels;
+
 typedef struct{
     MapPatch *patches;
     size_t apatches;
     size_t npatches;
 
+    MapGaugeLabels labels[N_MAP_LABEL_STYLES];
+    size_t alabels; /*boxes, MAP_LABEL_MAX_LEN times that for patches*/
+
     SDL_Rect marker_src;
     SDL_Rect marker_dst;
+
+    float rotation;
+    float scale; /*level tiles are drawn at, while zooming*/
+    SDL_Point pivot; /*gauge coordinates the map is turned and scaled about*/
+    int32_t radius; /*of the circle the gauge turns in about the pivot*/
 }MapGaugeState;
 
 typedef struct{
@@ -52,12 +72,22 @@ typedef struct{
     float heading;
 }MapGaugeMarker;
 
+typedef enum{
+    MAP_NORTH_UP,
+    MAP_HEADING_UP
+}MapOrientation;
+
 typedef struct{
     BaseGauge super;
 
     MapTileCache tile_cache;
-    /*current zoom level*/
+    /*current zoom level, that of the tiles and world coordinates*/
     uintf8_t level;
+    /* Level shown: the tiles of the nearest integer level, scaled. Moves
+     * between levels when zooming, driven by zoom_animation*/
+    float zoom;
+    float zoom_to; /*where zoom is going*/
+    BaseAnimation *zoom_animation;
     /*Top-left coordinates of the viewport*/
     int32_t world_x;
     int32_t world_y;
@@ -65,6 +95,9 @@ typedef struct{
     /*The little plane on the map*/
     MapGaugeMarker marker;
 
+    MapOrientation orientation;
+    float rotation; /*degrees clockwise, -heading when heading-up*/
+
     bool roaming; /*The view is roaming around and not tied to the marker*/
     Uint32 last_manipulation;
 
@@ -74,7 +107,9 @@ typedef struct{
     MapProvider *overlays[1]; /*static for now*/
     size_t noverlays;
 
+    AirportMapProvider *airport_overlay;
     RouteMapProvider *route_overlay;
+    MapLabelLayer labels;
 
     MapGaugeState state;
 }MapGauge;
@@ -83,8 +118,10 @@ MapGauge *map_gauge_new(int w, int h);
 MapGauge *map_gauge_init(MapGauge *self, int w, int h);
 
 bool map_gauge_set_level(MapGauge *self, uintf8_t level);
+bool map_gauge_set_zoom(MapGauge *self, float zoom, bool animated);
 bool map_gauge_set_marker_position(MapGauge *self, double latitude, double longitude);
 bool map_gauge_set_marker_heading(MapGauge *self, float heading);
+bool map_gauge_set_orientation(MapGauge *self, MapOrientation orientation);
 bool map_gauge_manipulate_viewport(MapGauge *self, int32_t dx, int32_t dy, bool animated);
 bool map_gauge_center_on_marker(MapGauge *self, bool animated);
 
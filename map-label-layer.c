@@ -0,0 +1,393 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "map-label-layer.h"
+#include "map-math.h"
+#include "nav-db.h"
+#include "resource-manager.h"
+#include "sdl-colors.h"
+
+#define TILE_SIZE 256
+#define LABEL_PADDING 1
+/*Symbol of the ends of the route, labelled like airports*/
+#define ROUTE_MARK_RADIUS 2
+
+/*Airports get their labels in that order, the others are left out*/
+static const uint32_t airport_priorities[] = {
+    NAV_AIRPORT_LARGE,
+    NAV_AIRPORT_MEDIUM,
+    NAV_AIRPORT_SMALL,
+    NAV_AIRPORT_SEAPLANE,
+    NAV_AIRPORT_HELIPORT,
+    NAV_AIRPORT_UNKNOWN
+};
+#define N_AIRPORT_PRIORITIES (sizeof(airport_priorities)/sizeof(airport_priorities[0]))
+
+typedef struct{
+    uint64_t rows[MAP_LABEL_GRID]; /*bit n of a row is column n*/
+}MapLabelGrid;
+
+static void map_label_layer_place(MapLabelLayer *self, MapLabelTile *tile);
+
+/**
+ * @brief Inits a MapLabelLayer.
+ *
+ * This function must not be called twice on the same object
+ * without calling map_label_layer_dispose inbetween.
+ *
+ * @param self a MapLabelLayer
+ * @param airports The provider drawing the airport symbols, which
+ * labels must go around
+ * @param cache_size Number of tiles to keep placed
+ * @return @p self on success, NULL on failure.
+ */
+MapLabelLayer *map_label_layer_init(MapLabelLayer *self, AirportMapProvider *airports,
+                                    size_t cache_size)
+{
+    self->airports = airports;
+    self->has_route = false;
+
+    self->fonts[MAP_LABEL_AIRPORT] = resource_manager_get_static_font(TERMINUS_12,
+        &SDL_BLACK,
+        3, PCF_ALPHA, PCF_DIGITS, "-"
+    );
+    self->fonts[MAP_LABEL_ROUTE] = resource_manager_get_static_font(TERMINUS_12,
+        &SDL_WHITE,
+        3, PCF_ALPHA, PCF_DIGITS, "-"
+    );
+    if(!self->fonts[MAP_LABEL_AIRPORT] || !self->fonts[MAP_LABEL_ROUTE]){
+        self->fonts[MAP_LABEL_AIRPORT] = self->fonts[MAP_LABEL_ROUTE] = NULL;
+        return NULL;
+    }
+    /*Kept for the lifetime of the layer*/
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++)
+        PCF_StaticFontRef(self->fonts[i]);
+    self->backgrounds[MAP_LABEL_AIRPORT] = SDL_WHITE;
+    self->backgrounds[MAP_LABEL_ROUTE] = SDL_RED;
+
+    self->tiles = calloc(MAX(cache_size, 1), sizeof(MapLabelTile));
+    if(!self->tiles)
+        return NULL;
+    self->atiles = MAX(cache_size, 1);
+    self->ntiles = 0;
+
+    return self;
+}
+
+/**
+ * @brief Release any resources internally held by the MapLabelLayer
+ *
+ * @param self a MapLabelLayer
+ * @return @p self
+ */
+MapLabelLayer *map_label_layer_dispose(MapLabelLayer *self)
+{
+    for(int i = 0; i < N_MAP_LABEL_STYLES; i++){
+        if(self->fonts[i])
+            PCF_FreeStaticFont(self->fonts[i]);
+    }
+    if(self->tiles)
+        free(self->tiles);
+    return self;
+}
+
+/**
+ * @brief Sets the route whose ends are labelled. Placed tiles are
+ * dropped.
+ *
+ * @param self a MapLabelLayer
+ * @param from Start of the route, NaN coordinates for no route
+ * @param to End of the route, NaN coordinates for no route
+ */
+void map_label_layer_set_route(MapLabelLayer *self, GeoLocation *from, GeoLocation *to)
+{
+    self->has_route = !isnan(from->latitude) && !isnan(to->latitude);
+    self->route[0] = *from;
+    self->route[1] = *to;
+    map_label_layer_clear(self);
+}
+
+/**
+ * @brief Drops all placed tiles.
+ *
+ * @param self a MapLabelLayer
+ */
+void map_label_layer_clear(MapLabelLayer *self)
+{
+    self->ntiles = 0;
+}
+
+/**
+ * @brief Gets the labels of a tile, placing them if the tile isn't in
+ * the cache.
+ *
+ * @param self a MapLabelLayer
+ * @param level The tile's level
+ * @param x The tile's x coordinate (in tiles)
+ * @param y The tile's y coordinate (in tiles)
+ * @return The tile's labels, valid until the next call.
+ */
+MapLabelTile *map_label_layer_get_tile(MapLabelLayer *self,
+                                       uintf8_t level, int32_t x, int32_t y)
+{
+    MapLabelTile *rv;
+    Uint32 now;
+
+    now = SDL_GetTicks();
+    for(size_t i = 0; i < self->ntiles; i++){
+        rv = &self->tiles[i];
+        if(rv->level == level && rv->x == x && rv->y == y){
+            rv->atime = now;
+            self->hits++;
+            return rv;
+        }
+    }
+    self->misses++;
+
+    if(self->ntiles < self->atiles){
+        rv = &self->tiles[self->ntiles++];
+    }else{
+        /*Evict the least recently used tile*/
+        rv = &self->tiles[0];
+        for(size_t i = 1; i < self->ntiles; i++){
+            if(self->tiles[i].atime < rv->atime)
+                rv = &self->tiles[i];
+        }
+    }
+    rv->level = level;
+    rv->x = x;
+    rv->y = y;
+    rv->atime = now;
+    map_label_layer_place(self, rv);
+
+    return rv;
+}
+
+/*Columns c0 to c1 (included) of a grid row*/
+static inline uint64_t map_label_grid_span(int c0, int c1)
+{
+    uint64_t rv;
+
+    rv = c1 >= MAP_LABEL_GRID - 1 ? ~0ull : (1ull << (c1 + 1)) - 1;
+    return rv & ~((1ull << c0) - 1);
+}
+
+/*Marks the cells of @p area, which can go past the tile*/
+static void map_label_grid_mark(MapLabelGrid *self, SDL_Rect *area)
+{
+    int c0, c1, r0, r1;
+    uint64_t span;
+
+    c0 = MAX(area->x, 0) / MAP_LABEL_CELL;
+    c1 = MIN(area->x + area->w - 1, TILE_SIZE - 1) / MAP_LABEL_CELL;
+    r0 = MAX(area->y, 0) / MAP_LABEL_CELL;
+    r1 = MIN(area->y + area->h - 1, TILE_SIZE - 1) / MAP_LABEL_CELL;
+    if(area->x + area->w <= 0 || area->y + area->h <= 0 || c0 > c1 || r0 > r1)
+        return;
+
+    span = map_label_grid_span(c0, c1);
+    for(int r = r0; r <= r1; r++)
+        self->rows[r] |= span;
+}
+
+/*Whether none of the cells of @p area, which must be in the tile, are taken*/
+static bool map_label_grid_free(MapLabelGrid *self, SDL_Rect *area)
+{
+    uint64_t span;
+    int r1;
+
+    span = map_label_grid_span(area->x / MAP_LABEL_CELL,
+        (area->x + area->w - 1) / MAP_LABEL_CELL
+    );
+    r1 = (area->y + area->h - 1) / MAP_LABEL_CELL;
+    for(int r = area->y / MAP_LABEL_CELL; r <= r1; r++){
+        if(self->rows[r] & span)
+            return false;
+    }
+    return true;
+}
+
+static inline bool map_label_in_tile(SDL_Rect *area)
+{
+    return area->x >= 0 && area->y >= 0
+        && area->x + area->w <= TILE_SIZE
+        && area->y + area->h <= TILE_SIZE;
+}
+
+/**
+ * @brief Places the label of a symbol at the first free spot around
+ * it: right, left, above, below. There is one cell between the label
+ * and the symbol, so that the symbol's own cells never get in the way.
+ *
+ * @return true if the label was placed, false if it was left out
+ */
+static bool map_label_tile_add(MapLabelTile *self, MapLabelGrid *grid,
+                               PCF_StaticFont *font, MapLabelStyle style,
+                               int32_t px, int32_t py, int radius,
+                               const char *text)
+{
+    char buffer[MAP_LABEL_MAX_LEN + 1];
+    SDL_Rect candidates[4];
+    SDL_Rect cursor;
+    size_t len;
+    int w, h, gap;
+    int rv;
+
+    if(self->nlabels == MAP_LABEL_MAX_LABELS)
+        return false;
+
+    len = strlen(text);
+    if(len > MAP_LABEL_MAX_LEN)
+        len = MAP_LABEL_MAX_LEN;
+    memcpy(buffer, text, len);
+    buffer[len] = '\0';
+    if(!len)
+        return false;
+
+    w = len * font->metrics.characterWidth + 2 * LABEL_PADDING;
+    h = font->metrics.ascent + font->metrics.descent + 2 * LABEL_PADDING;
+    gap = radius + MAP_LABEL_CELL;
+    candidates[0] = (SDL_Rect){px + gap, py - h / 2, w, h};
+    candidates[1] = (SDL_Rect){px - gap - w + 1, py - h / 2, w, h};
+    candidates[2] = (SDL_Rect){px - w / 2, py - gap - h + 1, w, h};
+    candidates[3] = (SDL_Rect){px - w / 2, py + gap, w, h};
+
+    for(int i = 0; i < 4; i++){
+        if(!map_label_in_tile(&candidates[i]) || !map_label_grid_free(grid, &candidates[i]))
+            continue;
+
+        PCF_StaticFontGetSizeRequestRect(font, buffer, false, &cursor);
+        cursor.x = candidates[i].x + LABEL_PADDING;
+        cursor.y = candidates[i].y + LABEL_PADDING;
+        rv = PCF_StaticFontPreWriteString(font,
+            len, buffer,
+            false, &cursor,
+            MAP_LABEL_MAX_LEN, &self->patches[self->npatches]
+        );
+        if(rv < 0 || rv > MAP_LABEL_MAX_LEN)
+            return false;
+
+        self->labels[self->nlabels++] = (MapLabel){
+            .box = candidates[i],
+            .style = style,
+            .npatches = rv,
+            .first = self->npatches
+        };
+        self->npatches += rv;
+        map_label_grid_mark(grid, &candidates[i]);
+        return true;
+    }
+    return false;
+}
+
+static inline SDL_Rect map_label_symbol_box(int32_t px, int32_t py, int radius)
+{
+    return (SDL_Rect){px - radius, py - radius, 2 * radius + 1, 2 * radius + 1};
+}
+
+/**
+ * @brief Places the labels of a tile: ends of the route first, then
+ * airports, biggest first, each at the first free spot around its
+ * symbol. All symbols, labelled or not, are put in the grid beforehand
+ * so that no label hides one.
+ *
+ * @param self a MapLabelLayer
+ * @param tile The tile to fill, its level and coordinates set
+ */
+static void map_label_layer_place(MapLabelLayer *self, MapLabelTile *tile)
+{
+    MapLabelGrid grid = {0};
+    const NavAirport *airport;
+    const char *route_labels[2] = {"FROM", "TO"};
+    int32_t route_px[2], route_py[2];
+    int32_t px, py;
+    SDL_Rect box;
+    size_t nids;
+    bool done;
+
+    tile->nlabels = 0;
+    tile->npatches = 0;
+
+    nids = airport_map_provider_find(self->airports, tile->level, tile->x, tile->y);
+    for(size_t i = 0; i < nids; i++){
+        airport = nav_db_airport(self->airports->ids[i]);
+        if(!airport_map_provider_shows(airport->type, tile->level))
+            continue;
+        map_math_geo_to_pixel(airport->latitude, airport->longitude, tile->level, &px, &py);
+        box = map_label_symbol_box(px - tile->x * TILE_SIZE, py - tile->y * TILE_SIZE,
+            AIRPORT_MAP_SYMBOL_RADIUS
+        );
+        map_label_grid_mark(&grid, &box);
+        /*An airport at the end of the route names it*/
+        for(int j = 0; self->has_route && j < 2; j++){
+            if(airport->latitude == self->route[j].latitude
+               && airport->longitude == self->route[j].longitude)
+                route_labels[j] = nav_db_string(airport->code);
+        }
+    }
+
+    for(int j = 0; self->has_route && j < 2; j++){
+        map_math_geo_to_pixel(self->route[j].latitude, self->route[j].longitude,
+            tile->level, &route_px[j], &route_py[j]
+        );
+        route_px[j] -= tile->x * TILE_SIZE;
+        route_py[j] -= tile->y * TILE_SIZE;
+        box = map_label_symbol_box(route_px[j], route_py[j], ROUTE_MARK_RADIUS);
+        map_label_grid_mark(&grid, &box);
+    }
+
+    /*Each symbol is labelled by the tile holding its center*/
+    for(int j = 0; self->has_route && j < 2; j++){
+        if(route_px[j] < 0 || route_px[j] >= TILE_SIZE
+           || route_py[j] < 0 || route_py[j] >= TILE_SIZE
+           || tile->nlabels == MAP_LABEL_MAX_LABELS)
+            continue;
+        tile->labels[tile->nlabels++] = (MapLabel){
+            .box = map_label_symbol_box(route_px[j], route_py[j], ROUTE_MARK_RADIUS),
+            .style = MAP_LABEL_ROUTE
+        };
+        map_label_tile_add(tile, &grid, self->fonts[MAP_LABEL_ROUTE], MAP_LABEL_ROUTE,
+            route_px[j], route_py[j], ROUTE_MARK_RADIUS, route_labels[j]
+        );
+    }
+
+    done = false;
+    for(size_t p = 0; p < N_AIRPORT_PRIORITIES && !done; p++){
+        if(!airport_map_provider_shows(airport_priorities[p], tile->level))
+            continue;
+        for(size_t i = 0; i < nids; i++){
+            airport = nav_db_airport(self->airports->ids[i]);
+            if(airport->type != airport_priorities[p]
+               && !(airport_priorities[p] == NAV_AIRPORT_UNKNOWN && airport->type >= N_NAV_AIRPORT_TYPES))
+                continue;
+            map_math_geo_to_pixel(airport->latitude, airport->longitude, tile->level, &px, &py);
+            px -= tile->x * TILE_SIZE;
+            py -= tile->y * TILE_SIZE;
+            if(px < 0 || px >= TILE_SIZE || py < 0 || py >= TILE_SIZE)
+                continue;
+            if(self->has_route){
+                bool is_end = false;
+                for(int j = 0; j < 2; j++)
+                    is_end |= (px == route_px[j] && py == route_py[j]);
+                if(is_end)
+                    continue;
+            }
+            map_label_tile_add(tile, &grid, self->fonts[MAP_LABEL_AIRPORT], MAP_LABEL_AIRPORT,
+                px, py, AIRPORT_MAP_SYMBOL_RADIUS, nav_db_string(airport->code)
+            );
+            if(tile->nlabels == MAP_LABEL_MAX_LABELS){
+                done = true;
+                break;
+            }
+        }
+    }
+}
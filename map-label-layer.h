@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef MAP_LABEL_LAYER_H
+#define MAP_LABEL_LAYER_H
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+#include "SDL_pcf.h"
+#include "airport-map-provider.h"
+#include "geo-location.h"
+#include "misc.h"
+
+/* Labels of the map symbols (airports, ends of the route), drawn by the
+ * MapGauge over the tiles with a static font: labels baked into raster
+ * tiles are unreadable at the size of the gauge.
+ *
+ * Labels are placed greedily, most important first, on a grid of
+ * MAP_LABEL_CELL px cells: a label only goes where none of its cells
+ * are taken (by a symbol or another label), which bounds the number of
+ * labels whatever the number of airports around. Placement is done once
+ * per (level, tile) and kept in a small LRU cache, panning only moves
+ * the cached glyphs. Labels stay within their tile, so that a tile is
+ * placed without knowing about its neighbours' labels.
+ */
+#define MAP_LABEL_CELL 4
+#define MAP_LABEL_GRID (256 / MAP_LABEL_CELL) /*One uint64_t per row*/
+#define MAP_LABEL_MAX_LEN 8
+#define MAP_LABEL_MAX_LABELS 32 /*per tile*/
+
+typedef enum{
+    MAP_LABEL_AIRPORT,
+    MAP_LABEL_ROUTE,
+    N_MAP_LABEL_STYLES
+}MapLabelStyle;
+
+typedef struct{
+    SDL_Rect box; /*Background, in tile coordinates*/
+    uint8_t style; /*MapLabelStyle*/
+    uint8_t npatches; /*0 for a symbol*/
+    uint16_t first; /*in MapLabelTile patches*/
+}MapLabel;
+
+typedef struct{
+    Uint32 atime; /*last access time in SDL_Ticks*/
+    int32_t x;
+    int32_t y;
+    uintf8_t level;
+
+    MapLabel labels[MAP_LABEL_MAX_LABELS];
+    size_t nlabels;
+    /*Glyphs of all labels, in tile coordinates*/
+    PCF_StaticFontPatch patches[MAP_LABEL_MAX_LABELS * MAP_LABEL_MAX_LEN];
+    size_t npatches;
+}MapLabelTile;
+
+typedef struct{
+    AirportMapProvider *airports;
+    PCF_StaticFont *fonts[N_MAP_LABEL_STYLES];
+    SDL_Color backgrounds[N_MAP_LABEL_STYLES];
+
+    bool has_route;
+    GeoLocation route[2]; /*from, to*/
+
+    MapLabelTile *tiles;
+    size_t atiles;
+    size_t ntiles;
+
+    /*Lookup statistics, since init*/
+    size_t hits;
+    size_t misses;
+}MapLabelLayer;
+
+MapLabelLayer *map_label_layer_init(MapLabelLayer *self, AirportMapProvider *airports,
+                                    size_t cache_size);
+MapLabelLayer *map_label_layer_dispose(MapLabelLayer *self);
+
+void map_label_layer_set_route(MapLabelLayer *self, GeoLocation *from, GeoLocation *to);
+MapLabelTile *map_label_layer_get_tile(MapLabelLayer *self,
+                                       uintf8_t level, int32_t x, int32_t y);
+void map_label_layer_clear(MapLabelLayer *self);
+#endif /* MAP_LABEL_LAYER_H */
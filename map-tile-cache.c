@@ -67,9 +67,11 @@ GenericLayer *map_tile_cache_get(MapTileCache *self,
     for(int i = 0; i < self->ncached; i++){
         if(map_tile_descriptor_match(&self->tile_cache[i],level, x, y)){
             self->tile_cache[i].atime = SDL_GetTicks();
+            self->hits++;
             return self->tile_cache[i].layer;
         }
     }
+    self->misses++;
     return NULL;
 }
 
@@ -84,6 +86,7 @@ bool map_tile_cache_add(MapTileCache *self, GenericLayer *tile,
         generic_layer_unref(slot->layer);
 
         *slot = (MapTileDescriptor){
+            .atime = SDL_GetTicks(),
             .layer = tile,
             .level = level,
             .x = x,
@@ -91,6 +94,7 @@ bool map_tile_cache_add(MapTileCache *self, GenericLayer *tile,
         };
     }else{
         self->tile_cache[self->ncached++] = (MapTileDescriptor){
+            .atime = SDL_GetTicks(),
             .layer = tile,
             .level = level,
             .x = x,
@@ -105,6 +109,10 @@ bool map_tile_cache_add(MapTileCache *self, GenericLayer *tile,
  * @brief Returns the cache location used by the least used descriptor
  * (least recent last usage)
  *
+ * Tiles referenced outside of the cache (i.e. being drawn) are only
+ * given up when there is nothing else: evicting them would only have
+ * them fetched again on the next frame.
+ *
  * MapTileDescriptor internal usage, not meant to be used by client code
  *
  * @param self a MapTileCache
@@ -112,18 +120,24 @@ bool map_tile_cache_add(MapTileCache *self, GenericLayer *tile,
  */
 static MapTileDescriptor *map_tile_cache_oldest(MapTileCache *self)
 {
-    Uint32 now;
     MapTileDescriptor *rv;
-    int rv_idx;
-
-    now = SDL_GetTicks();
-    rv_idx = 0;
-    for(int i = 0; i < self->ncached; i++){
-        if(self->tile_cache[i].atime < now){
-            rv_idx = i;
-            now = self->tile_cache[i].atime;
+    MapTileDescriptor *current;
+    bool rv_used, current_used;
+
+    rv = &self->tile_cache[0];
+    rv_used = rv->layer->refcount > 1;
+    for(int i = 1; i < self->ncached; i++){
+        current = &self->tile_cache[i];
+        current_used = current->layer->refcount > 1;
+        if(current_used != rv_used){
+            if(!current_used){
+                rv = current;
+                rv_used = false;
+            }
+            continue;
         }
+        if(current->atime < rv->atime)
+            rv = current;
     }
-    return &self->tile_cache[rv_idx];
+    return rv;
 }
-
@@ -30,6 +30,10 @@ typedef struct{
     MapTileDescriptor *tile_cache;
     size_t acache; /*allocated size*/
     size_t ncached; /*currently holding*/
+
+    /*Lookup statistics, since init*/
+    size_t hits;
+    size_t misses;
 }MapTileCache;
 
 MapTileCache *map_tile_cache_init(MapTileCache *self, size_t cache_size);
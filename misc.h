@@ -60,6 +60,7 @@ int charcmp(const void *a, const void *b);
 #define SDLExt_RectLastY(rect) ((rect)->y + (rect)->h - 1)
 #define SDLExt_RectMidY(rect) ((rect)->y + roundf(((rect)->h-1)/2.0f))
 #define SDLExt_RectMidX(rect) ((rect)->x + roundf(((rect)->w-1)/2.0f))
+#define SDLExt_ColorEquals(c1, c2) ((c1)->r == (c2)->r && (c1)->g == (c2)->g && (c1)->b == (c2)->b && (c1)->a == (c2)->a)
 
 static inline int clamp(int x, int low, int high)
 {
@@ -0,0 +1,616 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "nav-db.h"
+#include "map-math.h"
+
+#define NAV_DB_ALIGN 8
+#define NAV_DB_NCELLS (NAV_DB_GRID_SIZE * NAV_DB_GRID_SIZE)
+#define EARTH_RADIUS 6371000.0 /*meters*/
+#define DEG2RAD(x) ((x) * M_PI / 180.0)
+/*Pixel width at NAV_DB_GRID_LEVEL on the equator, the widest*/
+#define NAV_DB_PIXEL_SIZE (2 * M_PI * EARTH_RADIUS / (256 << NAV_DB_GRID_LEVEL))
+
+typedef struct{
+    uint8_t *base;
+    size_t size;
+    NavDbHeader *header;
+
+    NavAirport *airports;
+    const char *strings;
+    size_t strings_size;
+
+    SearchIndex index; /*index data only, never queried*/
+
+    uint32_t *cell_starts;
+    uint32_t *cell_ids;
+}NavDb;
+
+static NavDb db = {0};
+
+/*Whether section @p id is in the file and has @p size bytes*/
+static bool nav_db_check_section(NavDbHeader *header, size_t fsize, NavDbSectionId id, uint64_t size)
+{
+    NavDbSection *section = &header->sections[id];
+
+    return section->offset % NAV_DB_ALIGN == 0
+        && section->offset <= fsize
+        && section->size <= fsize - section->offset
+        && section->size == size;
+}
+
+/*Whether the strings of @p section can't run past its end*/
+static bool nav_db_check_terminated(uint8_t *base, NavDbSection *section)
+{
+    return !section->size || base[section->offset + section->size - 1] == '\0';
+}
+
+/* Whether the @p n values of @p values are all below @p limit, and
+ * don't decrease if @p ascending*/
+static bool nav_db_check_indexes(const uint32_t *values, uint64_t n, uint64_t limit, bool ascending)
+{
+    for(uint64_t i = 0; i < n; i++){
+        if(values[i] >= limit)
+            return false;
+        if(ascending && i && values[i] < values[i-1])
+            return false;
+    }
+    return true;
+}
+
+/* Whether indexes found in the sections, which are used without further
+ * checks, point within the sections they index. Sizes have already been
+ * checked.*/
+static bool nav_db_check_contents(uint8_t *base, NavDbHeader *header)
+{
+    NavDbSection *sections = header->sections;
+    const NavAirport *airports;
+    const uint32_t *offsets, *gram_starts, *cell_starts;
+    uint64_t n, strings_size, text_size, nwords, npostings;
+
+#define SECTION(id) ((void*)(base + sections[id].offset))
+    n = header->nairports;
+    strings_size = sections[NAV_SECTION_STRINGS].size;
+    text_size = sections[NAV_SECTION_TEXT].size;
+    nwords = sections[NAV_SECTION_WORDS].size / sizeof(uint32_t);
+    npostings = sections[NAV_SECTION_POSTINGS].size / sizeof(uint32_t);
+
+    airports = SECTION(NAV_SECTION_AIRPORTS);
+    for(uint64_t i = 0; i < n; i++){
+        if(airports[i].code >= strings_size
+           || airports[i].name >= strings_size
+           || airports[i].label >= strings_size
+           || airports[i].label_len > strings_size - airports[i].label - 1
+           || airports[i].label_len > header->max_label_len)
+            return false;
+    }
+
+    /*Labels: starts within the text, the last one being its end*/
+    offsets = SECTION(NAV_SECTION_OFFSETS);
+    if(offsets[0] != 0 || offsets[n] != text_size
+       || !nav_db_check_indexes(offsets, n + 1, text_size + 1, true))
+        return false;
+
+    if(sections[NAV_SECTION_WORDS].size % sizeof(uint32_t)
+       || !nav_db_check_indexes(SECTION(NAV_SECTION_WORDS), nwords, text_size, false)
+       || !nav_db_check_indexes(SECTION(NAV_SECTION_WORD_OWNERS), nwords, n, false))
+        return false;
+
+    /*Posting lists: boundaries in order, covering all the postings*/
+    gram_starts = SECTION(NAV_SECTION_GRAM_STARTS);
+    if(sections[NAV_SECTION_POSTINGS].size % sizeof(uint32_t)
+       || gram_starts[0] != 0 || gram_starts[SEARCH_GRAMS] != npostings
+       || !nav_db_check_indexes(gram_starts, SEARCH_GRAMS + 1, npostings + 1, true)
+       || !nav_db_check_indexes(SECTION(NAV_SECTION_POSTINGS), npostings, n, false))
+        return false;
+
+    /*Same for the tiles of the spatial index*/
+    cell_starts = SECTION(NAV_SECTION_CELL_STARTS);
+    if(cell_starts[0] != 0 || cell_starts[NAV_DB_NCELLS] != n
+       || !nav_db_check_indexes(cell_starts, NAV_DB_NCELLS + 1, n + 1, true)
+       || !nav_db_check_indexes(SECTION(NAV_SECTION_CELL_IDS), n, n, false))
+        return false;
+#undef SECTION
+
+    return true;
+}
+
+static inline void *nav_db_section(NavDbSectionId id)
+{
+    return db.base + db.header->sections[id].offset;
+}
+
+/**
+ * @brief Maps a navigation database made by sofis-navdata. The
+ * database is empty if the file can't be used.
+ *
+ * Pointers returned by nav_db_* functions point into the mapping:
+ * nav_db_close must only be called once they are not used anymore.
+ *
+ * @param filename The file to map
+ * @return true on success, false otherwise.
+ */
+bool nav_db_open(const char *filename)
+{
+    struct stat st;
+    NavDbHeader *header;
+    NavDbSection *sections;
+    uint64_t n;
+    void *base;
+    int fd;
+
+    if(db.base)
+        nav_db_close();
+
+    fd = open(filename, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &st) < 0 || st.st_size < sizeof(NavDbHeader)){
+        close(fd);
+        return false;
+    }
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED){
+        printf("Couldn't map %s\n", filename);
+        return false;
+    }
+
+    header = base;
+    sections = header->sections;
+    n = header->nairports;
+    if(memcmp(header->magic, NAV_DB_MAGIC, sizeof(NAV_DB_MAGIC))
+       || header->version != NAV_DB_VERSION
+       || header->size != st.st_size
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_AIRPORTS, n * sizeof(NavAirport))
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_STRINGS, sections[NAV_SECTION_STRINGS].size)
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_TEXT, sections[NAV_SECTION_TEXT].size)
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_OFFSETS, (n + 1) * sizeof(uint32_t))
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_MASKS, n * sizeof(uint64_t))
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_WORDS, sections[NAV_SECTION_WORDS].size)
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_WORD_OWNERS, sections[NAV_SECTION_WORDS].size)
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_GRAM_STARTS, (SEARCH_GRAMS + 1) * sizeof(uint32_t))
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_POSTINGS, sections[NAV_SECTION_POSTINGS].size)
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_CELL_STARTS, (NAV_DB_NCELLS + 1) * sizeof(uint32_t))
+       || !nav_db_check_section(header, st.st_size, NAV_SECTION_CELL_IDS, n * sizeof(uint32_t))
+       || !nav_db_check_terminated(base, &sections[NAV_SECTION_STRINGS])
+       || !nav_db_check_terminated(base, &sections[NAV_SECTION_TEXT])
+       || !nav_db_check_contents(base, header)){
+        printf("Ignoring stale or invalid navigation database %s\n", filename);
+        munmap(base, st.st_size);
+        return false;
+    }
+
+    db.base = base;
+    db.size = st.st_size;
+    db.header = header;
+    db.airports = nav_db_section(NAV_SECTION_AIRPORTS);
+    db.strings = nav_db_section(NAV_SECTION_STRINGS);
+    db.strings_size = sections[NAV_SECTION_STRINGS].size;
+    db.index = (SearchIndex){
+        .nentries = n,
+        .text = nav_db_section(NAV_SECTION_TEXT),
+        .offsets = nav_db_section(NAV_SECTION_OFFSETS),
+        .masks = nav_db_section(NAV_SECTION_MASKS),
+        .words = nav_db_section(NAV_SECTION_WORDS),
+        .word_owners = nav_db_section(NAV_SECTION_WORD_OWNERS),
+        .nwords = sections[NAV_SECTION_WORDS].size / sizeof(uint32_t),
+        .gram_starts = nav_db_section(NAV_SECTION_GRAM_STARTS),
+        .postings = nav_db_section(NAV_SECTION_POSTINGS),
+        .borrowed = true
+    };
+    db.cell_starts = nav_db_section(NAV_SECTION_CELL_STARTS);
+    db.cell_ids = nav_db_section(NAV_SECTION_CELL_IDS);
+
+    return true;
+}
+
+/**
+ * @brief Unmaps the database.
+ */
+void nav_db_close(void)
+{
+    if(db.base)
+        munmap(db.base, db.size);
+    db = (NavDb){0};
+}
+
+size_t nav_db_airport_count(void)
+{
+    return db.base ? db.header->nairports : 0;
+}
+
+/**
+ * @brief Gets the length of the longest airport label, as found when the
+ * database was made: no need to go through all airports.
+ *
+ * @return The length, 0 if there is no database
+ */
+size_t nav_db_max_label_len(void)
+{
+    return db.base ? db.header->max_label_len : 0;
+}
+
+/**
+ * @brief Gets an airport. Airports are sorted by code.
+ *
+ * @param idx The airport index, less than nav_db_airport_count()
+ * @return The airport, NULL if @p idx is out of bounds.
+ */
+const NavAirport *nav_db_airport(size_t idx)
+{
+    if(idx >= nav_db_airport_count())
+        return NULL;
+    return &db.airports[idx];
+}
+
+/**
+ * @brief Gets a string of the database, e.g. an airport code.
+ *
+ * @param offset The string offset, as found in records
+ * @return The string, "" if @p offset is invalid.
+ */
+const char *nav_db_string(uint32_t offset)
+{
+    if(!db.base || offset >= db.strings_size)
+        return "";
+    return db.strings + offset;
+}
+
+/**
+ * @brief Gets the search index over the airports labels ("CODE -
+ * Name"), where results are airport indexes.
+ *
+ * The index only holds the data, use search_index_init_from to get an
+ * index that can be queried.
+ *
+ * @return The index, NULL if there is no database.
+ */
+const SearchIndex *nav_db_search_index(void)
+{
+    return db.base ? &db.index : NULL;
+}
+
+/**
+ * @brief Gets the airports located in a tile of the spatial index.
+ *
+ * @param tx Tile column, at NAV_DB_GRID_LEVEL
+ * @param ty Tile row, at NAV_DB_GRID_LEVEL
+ * @param count Set to the number of airports in the tile
+ * @return The indexes of the airports, ascending.
+ */
+const uint32_t *nav_db_cell(uint32_t tx, uint32_t ty, size_t *count)
+{
+    uint32_t cell;
+
+    *count = 0;
+    if(!db.base || tx >= NAV_DB_GRID_SIZE || ty >= NAV_DB_GRID_SIZE)
+        return NULL;
+    cell = ty * NAV_DB_GRID_SIZE + tx;
+    *count = db.cell_starts[cell+1] - db.cell_starts[cell];
+    return db.cell_ids + db.cell_starts[cell];
+}
+
+/**
+ * @brief Great circle distance between two points (haversine).
+ *
+ * @return The distance, in meters
+ */
+double nav_db_distance(double lat1, double lon1, double lat2, double lon2)
+{
+    double dlat, dlon, a;
+
+    dlat = sin(DEG2RAD(lat2 - lat1) / 2);
+    dlon = sin(DEG2RAD(lon2 - lon1) / 2);
+    a = dlat * dlat + cos(DEG2RAD(lat1)) * cos(DEG2RAD(lat2)) * dlon * dlon;
+    return 2 * EARTH_RADIUS * asin(sqrt(fmin(a, 1.0)));
+}
+
+/* Distance under which nothing outside of the tiles within @p r of
+ * (@p cx, @p cy) can be: to get there, one has to cross either the
+ * parallel of the top/bottom edge or the meridian of the left/right
+ * one.*/
+static double nav_db_ring_bound(double latitude, double longitude, int32_t cx, int32_t cy, int32_t r)
+{
+    double rv, lat, lon, dlon;
+
+    rv = INFINITY;
+    if(cy - r > 0){
+        map_math_pixel_to_geo(0, (cy - r) * 256, NAV_DB_GRID_LEVEL, &lat, &lon);
+        rv = fmin(rv, EARTH_RADIUS * DEG2RAD(lat - latitude));
+    }
+    if(cy + r + 1 < NAV_DB_GRID_SIZE){
+        map_math_pixel_to_geo(0, (cy + r + 1) * 256, NAV_DB_GRID_LEVEL, &lat, &lon);
+        rv = fmin(rv, EARTH_RADIUS * DEG2RAD(latitude - lat));
+    }
+    if(2 * r + 1 < NAV_DB_GRID_SIZE){
+        /*Tiles wrap around, the box is as wide either way*/
+        dlon = fmin(
+            longitude - ((cx - r) * 360.0 / NAV_DB_GRID_SIZE - 180),
+            ((cx + r + 1) * 360.0 / NAV_DB_GRID_SIZE - 180) - longitude
+        );
+        dlon = fmin(dlon, 90);
+        rv = fmin(rv, EARTH_RADIUS * asin(cos(DEG2RAD(latitude)) * sin(DEG2RAD(dlon))));
+    }
+    /*Rounding to pixels can put an airport that close in the next tile*/
+    return rv - NAV_DB_PIXEL_SIZE;
+}
+
+/*Keeps the @p k nearest, sorted by distance*/
+static inline void nav_db_add_neighbor(NavDbNeighbor *neighbors, size_t *n, size_t k, uint32_t id, double distance)
+{
+    size_t i;
+
+    if(*n == k){
+        if(distance >= neighbors[k-1].distance)
+            return;
+        (*n)--;
+    }
+    for(i = *n; i > 0 && neighbors[i-1].distance > distance; i--)
+        neighbors[i] = neighbors[i-1];
+    neighbors[i] = (NavDbNeighbor){.id = id, .distance = distance};
+    (*n)++;
+}
+
+static inline void nav_db_visit_cell(int32_t x, int32_t y, double latitude, double longitude, NavDbNeighbor *neighbors, size_t *n, size_t k)
+{
+    const uint32_t *ids;
+    NavAirport *airport;
+    size_t count;
+
+    ids = nav_db_cell((x + NAV_DB_GRID_SIZE) % NAV_DB_GRID_SIZE, y, &count);
+    for(size_t i = 0; i < count; i++){
+        airport = &db.airports[ids[i]];
+        nav_db_add_neighbor(neighbors, n, k, ids[i],
+            nav_db_distance(latitude, longitude, airport->latitude, airport->longitude)
+        );
+    }
+}
+
+/**
+ * @brief Finds the airports closest to a point.
+ *
+ * Goes through the tiles of the spatial index in rings around the point
+ * until no tile left can hold anything closer than what has been found.
+ *
+ * @param latitude Latitude of the point, in degrees
+ * @param longitude Longitude of the point, in degrees
+ * @param k How many airports to find
+ * @param neighbors Where to store the airports found, at least @p k of
+ * them. Sorted by distance.
+ * @return The number of airports found, less than @p k only if the
+ * database has fewer airports.
+ */
+size_t nav_db_find_nearest(double latitude, double longitude, size_t k, NavDbNeighbor *neighbors)
+{
+    int32_t px, py, cx, cy, y0, y1;
+    size_t rv;
+
+    rv = 0;
+    if(!db.base || !k)
+        return 0;
+
+    map_math_geo_to_pixel(latitude, longitude, NAV_DB_GRID_LEVEL, &px, &py);
+    cx = px / 256;
+    cy = py / 256;
+    for(int32_t r = 0; r <= NAV_DB_GRID_SIZE; r++){
+        y0 = MAX(cy - r, 0);
+        y1 = MIN(cy + r, NAV_DB_GRID_SIZE - 1);
+        for(int32_t y = y0; y <= y1; y++){
+            if(abs(y - cy) == r){
+                /*Whole row, at most once around the globe*/
+                for(int32_t x = cx - r; x <= cx + r && x - (cx - r) < NAV_DB_GRID_SIZE; x++)
+                    nav_db_visit_cell(x, y, latitude, longitude, neighbors, &rv, k);
+            }else if(2 * r <= NAV_DB_GRID_SIZE){
+                /*Both sides meet in the same column when going around*/
+                nav_db_visit_cell(cx - r, y, latitude, longitude, neighbors, &rv, k);
+                if(2 * r < NAV_DB_GRID_SIZE)
+                    nav_db_visit_cell(cx + r, y, latitude, longitude, neighbors, &rv, k);
+            }
+        }
+        if(rv == k && neighbors[k-1].distance <= nav_db_ring_bound(latitude, longitude, cx, cy, r))
+            break;
+    }
+
+    return rv;
+}
+
+/**
+ * @brief Finds the airports within an area of the map.
+ *
+ * @param level Map zoom level of the coordinates (see map-math.h)
+ * @param left Leftmost pixel of the area, world coordinates at @p level
+ * @param top Topmost pixel of the area
+ * @param right Rightmost pixel of the area, included
+ * @param bottom Bottommost pixel of the area, included
+ * @param ids Where to store the indexes of the airports found
+ * @param max Size of @p ids
+ * @return The number of airports within the area, which can be more
+ * than @p max. Only the first @p max are stored in @p ids then.
+ */
+size_t nav_db_find_in_area(uint8_t level, int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t *ids, size_t max)
+{
+    int32_t cleft, ctop, cright, cbottom;
+    int32_t px, py;
+    const uint32_t *cell;
+    NavAirport *airport;
+    int shift;
+    size_t count, rv;
+
+    rv = 0;
+    if(!db.base || left > right || top > bottom)
+        return 0;
+
+    /* Pixels at level to pixels at the grid level, give or take the one
+     * lost by rounding which could put an airport in the next tile*/
+    shift = level - NAV_DB_GRID_LEVEL;
+    if(shift >= 0){
+        cleft = (left >> shift) - 1;
+        ctop = (top >> shift) - 1;
+        cright = (right >> shift) + 1;
+        cbottom = (bottom >> shift) + 1;
+    }else{
+        cleft = (left << -shift) - 1;
+        ctop = (top << -shift) - 1;
+        cright = ((right + 1) << -shift);
+        cbottom = ((bottom + 1) << -shift);
+    }
+    cleft = MAX(cleft, 0) / 256;
+    ctop = MAX(ctop, 0) / 256;
+    cright = MIN(MAX(cright, 0) / 256, NAV_DB_GRID_SIZE - 1);
+    cbottom = MIN(MAX(cbottom, 0) / 256, NAV_DB_GRID_SIZE - 1);
+
+    for(int32_t y = ctop; y <= cbottom; y++){
+        for(int32_t x = cleft; x <= cright; x++){
+            cell = nav_db_cell(x, y, &count);
+            for(size_t i = 0; i < count; i++){
+                airport = &db.airports[cell[i]];
+                map_math_geo_to_pixel(airport->latitude, airport->longitude, level, &px, &py);
+                if(px < left || px > right || py < top || py > bottom)
+                    continue;
+                if(rv < max)
+                    ids[rv] = cell[i];
+                rv++;
+            }
+        }
+    }
+    return rv;
+}
+
+static bool nav_db_write_section(FILE *fp, NavDbHeader *header, NavDbSectionId id, const void *data, size_t size)
+{
+    static const uint8_t zeroes[NAV_DB_ALIGN] = {0};
+    long pos;
+
+    pos = ftell(fp);
+    if(pos < 0)
+        return false;
+    if(pos % NAV_DB_ALIGN){
+        if(fwrite(zeroes, NAV_DB_ALIGN - pos % NAV_DB_ALIGN, 1, fp) != 1)
+            return false;
+        pos += NAV_DB_ALIGN - pos % NAV_DB_ALIGN;
+    }
+    header->sections[id] = (NavDbSection){.offset = pos, .size = size};
+    if(size && fwrite(data, size, 1, fp) != 1)
+        return false;
+    return true;
+}
+
+/**
+ * @brief Writes a navigation database, building its indexes. Used by
+ * sofis-navdata.
+ *
+ * @param filename The file to write
+ * @param airports The airports, sorted by code. Their strings are offsets
+ * in @p strings.
+ * @param nairports Number of airports in @p airports
+ * @param strings The string pool, each string \0 terminated
+ * @param strings_size Size of @p strings, in bytes
+ * @return true on success, false otherwise.
+ */
+bool nav_db_write(const char *filename, NavAirport *airports, size_t nairports, const char *strings, size_t strings_size)
+{
+    NavDbHeader header;
+    SearchIndex index = {0};
+    char **labels;
+    uint32_t *cells, *cell_starts, *cell_ids, *cursor;
+    int32_t px, py;
+    FILE *fp;
+    bool rv;
+
+    rv = false;
+    fp = NULL;
+    cells = cell_starts = cell_ids = cursor = NULL;
+    labels = malloc(sizeof(char*) * (nairports ? nairports : 1));
+    if(!labels)
+        return false;
+
+    for(size_t i = 0; i < nairports; i++){
+        if(airports[i].label >= strings_size){
+            printf("%s: airport %zu has an invalid label\n", __FUNCTION__, i);
+            goto out;
+        }
+        labels[i] = (char*)strings + airports[i].label;
+    }
+    if(!search_index_init(&index, labels, nairports)){
+        printf("%s: Couldn't build the search index\n", __FUNCTION__);
+        goto out;
+    }
+
+    /*Spatial index: counting sort on tiles, ids stay ascending in each tile*/
+    cells = malloc(sizeof(uint32_t) * (nairports ? nairports : 1));
+    cell_ids = malloc(sizeof(uint32_t) * (nairports ? nairports : 1));
+    cell_starts = calloc(NAV_DB_NCELLS + 1, sizeof(uint32_t));
+    cursor = malloc(sizeof(uint32_t) * NAV_DB_NCELLS);
+    if(!cells || !cell_ids || !cell_starts || !cursor)
+        goto out;
+    for(size_t i = 0; i < nairports; i++){
+        map_math_geo_to_pixel(airports[i].latitude, airports[i].longitude, NAV_DB_GRID_LEVEL, &px, &py);
+        cells[i] = (py / 256) * NAV_DB_GRID_SIZE + px / 256;
+        cell_starts[cells[i] + 1]++;
+    }
+    for(size_t i = 0; i < NAV_DB_NCELLS; i++)
+        cell_starts[i+1] += cell_starts[i];
+    memcpy(cursor, cell_starts, sizeof(uint32_t) * NAV_DB_NCELLS);
+    for(size_t i = 0; i < nairports; i++)
+        cell_ids[cursor[cells[i]]++] = i;
+
+    fp = fopen(filename, "wb");
+    if(!fp){
+        printf("Couldn't open %s for writing\n", filename);
+        goto out;
+    }
+    header = (NavDbHeader){
+        .version = NAV_DB_VERSION,
+        .nairports = nairports
+    };
+    for(size_t i = 0; i < nairports; i++)
+        header.max_label_len = MAX(header.max_label_len, airports[i].label_len);
+    memcpy(header.magic, NAV_DB_MAGIC, sizeof(NAV_DB_MAGIC));
+    if(fwrite(&header, sizeof(NavDbHeader), 1, fp) != 1
+       || !nav_db_write_section(fp, &header, NAV_SECTION_AIRPORTS, airports, sizeof(NavAirport) * nairports)
+       || !nav_db_write_section(fp, &header, NAV_SECTION_STRINGS, strings, strings_size)
+       || !nav_db_write_section(fp, &header, NAV_SECTION_TEXT, index.text, index.offsets[nairports])
+       || !nav_db_write_section(fp, &header, NAV_SECTION_OFFSETS, index.offsets, sizeof(uint32_t) * (nairports + 1))
+       || !nav_db_write_section(fp, &header, NAV_SECTION_MASKS, index.masks, sizeof(uint64_t) * nairports)
+       || !nav_db_write_section(fp, &header, NAV_SECTION_WORDS, index.words, sizeof(uint32_t) * index.nwords)
+       || !nav_db_write_section(fp, &header, NAV_SECTION_WORD_OWNERS, index.word_owners, sizeof(uint32_t) * index.nwords)
+       || !nav_db_write_section(fp, &header, NAV_SECTION_GRAM_STARTS, index.gram_starts, sizeof(uint32_t) * (SEARCH_GRAMS + 1))
+       || !nav_db_write_section(fp, &header, NAV_SECTION_POSTINGS, index.postings, sizeof(uint32_t) * index.gram_starts[SEARCH_GRAMS])
+       || !nav_db_write_section(fp, &header, NAV_SECTION_CELL_STARTS, cell_starts, sizeof(uint32_t) * (NAV_DB_NCELLS + 1))
+       || !nav_db_write_section(fp, &header, NAV_SECTION_CELL_IDS, cell_ids, sizeof(uint32_t) * nairports)){
+        printf("Couldn't write %s\n", filename);
+        goto out;
+    }
+    /*Header again, now that the sections are known*/
+    header.size = ftell(fp);
+    if(fseek(fp, 0, SEEK_SET) || fwrite(&header, sizeof(NavDbHeader), 1, fp) != 1){
+        printf("Couldn't write %s\n", filename);
+        goto out;
+    }
+    rv = true;
+
+out:
+    if(fp && fclose(fp))
+        rv = false;
+    search_index_dispose(&index);
+    free(labels);
+    free(cells);
+    free(cell_ids);
+    free(cell_starts);
+    free(cursor);
+    return rv;
+}
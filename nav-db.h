@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef NAV_DB_H
+#define NAV_DB_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "res-dirs.h"
+#include "search-index.h"
+
+/* Navigation database: airports stored in a single file made by
+ * sofis-navdata from CSV exports (OurAirports, OpenAIP). At runtime the
+ * file is mapped and used in place: nothing is parsed or copied, pages
+ * are only read when used, whatever the size of the database.
+ *
+ * The file holds, each section 8 bytes aligned:
+ *  - a header with the offset and size of each section;
+ *  - fixed-size airport records, sorted by code;
+ *  - the string pool the records point into (\0 terminated);
+ *  - the search index of the "CODE - Name" labels (see search-index.h);
+ *  - a spatial index: airport ids bucketed by Web Mercator tile at
+ *  NAV_DB_GRID_LEVEL (see map-math.h), tiles in row-major order.
+ *
+ * Bump NAV_DB_VERSION when the layout changes.
+ */
+#define NAV_DB_MAGIC "SFSNAV"
+#define NAV_DB_VERSION 3
+#define NAV_DB_GRID_LEVEL 8 /*256x256 tiles, ~150km wide at the equator*/
+#define NAV_DB_GRID_SIZE (1 << NAV_DB_GRID_LEVEL)
+
+#ifndef NAVDATA_FILE
+#define NAVDATA_FILE SFS_HOME"/resources/sofis.nav"
+#endif
+
+typedef enum{
+    NAV_AIRPORT_UNKNOWN,
+    NAV_AIRPORT_SMALL,
+    NAV_AIRPORT_MEDIUM,
+    NAV_AIRPORT_LARGE,
+    NAV_AIRPORT_HELIPORT,
+    NAV_AIRPORT_SEAPLANE,
+    N_NAV_AIRPORT_TYPES
+}NavAirportType;
+
+typedef struct{
+    double latitude;
+    double longitude;
+    int32_t elevation; /*feet*/
+    uint32_t type; /*NavAirportType*/
+
+    /*Offsets in the string pool*/
+    uint32_t code;
+    uint32_t name;
+    uint32_t label; /*"CODE - Name", as listed*/
+    uint32_t label_len;
+}NavAirport;
+
+typedef struct{
+    uint32_t id; /*airport index*/
+    double distance; /*meters*/
+}NavDbNeighbor;
+
+typedef struct{
+    uint64_t offset; /*From the start of the file*/
+    uint64_t size; /*Bytes*/
+}NavDbSection;
+
+typedef enum{
+    NAV_SECTION_AIRPORTS,
+    NAV_SECTION_STRINGS,
+    /*Search index*/
+    NAV_SECTION_TEXT,
+    NAV_SECTION_OFFSETS,
+    NAV_SECTION_MASKS,
+    NAV_SECTION_WORDS,
+    NAV_SECTION_WORD_OWNERS,
+    NAV_SECTION_GRAM_STARTS,
+    NAV_SECTION_POSTINGS,
+    /*Spatial index*/
+    NAV_SECTION_CELL_STARTS,
+    NAV_SECTION_CELL_IDS,
+    N_NAV_SECTIONS
+}NavDbSectionId;
+
+typedef struct{
+    char magic[8];
+    uint32_t version;
+    uint32_t nairports;
+    uint32_t max_label_len; /*Longest label, lists size themselves with it*/
+    uint64_t size; /*Whole file, catches truncated files*/
+    NavDbSection sections[N_NAV_SECTIONS];
+}NavDbHeader;
+
+bool nav_db_open(const char *filename);
+void nav_db_close(void);
+
+size_t nav_db_airport_count(void);
+size_t nav_db_max_label_len(void);
+const NavAirport *nav_db_airport(size_t idx);
+const char *nav_db_string(uint32_t offset);
+const SearchIndex *nav_db_search_index(void);
+const uint32_t *nav_db_cell(uint32_t tx, uint32_t ty, size_t *count);
+
+size_t nav_db_find_nearest(double latitude, double longitude, size_t k, NavDbNeighbor *neighbors);
+size_t nav_db_find_in_area(uint8_t level, int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t *ids, size_t max);
+double nav_db_distance(double lat1, double lon1, double lat2, double lon2);
+
+bool nav_db_write(const char *filename, NavAirport *airports, size_t nairports, const char *strings, size_t strings_size);
+#endif /* NAV_DB_H */
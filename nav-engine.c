@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "nav-engine.h"
+
+#define EARTH_RADIUS_NM 3440.065
+#define DEG2RAD(x) ((x) * M_PI / 180.0)
+#define RAD2DEG(x) ((x) * 180.0 / M_PI)
+
+/* Ground speed is measured over at least that long, to not be thrown
+ * off by the jitter of the samples, and forgotten after MAX_SPEED_AGE
+ * without samples (paused replay, lost fix). Times are those of the
+ * DataSource (see DataSource.now), not the wall clock*/
+#define MIN_SPEED_PERIOD 1000 /*ms*/
+#define MAX_SPEED_AGE 10000 /*ms*/
+#define MIN_ETE_SPEED 5.0 /*kts, no ETE below*/
+
+typedef struct{
+    DataSource *ds;
+
+    bool active;
+    NavLeg leg;
+
+    bool has_sample;
+    GeoLocation sample; /*Last position used for the ground speed*/
+    uint32_t sample_time;
+    float ground_speed;
+}NavEngine;
+
+static NavEngine engine = {0};
+
+static inline void vec_from_geo(double latitude, double longitude, double v[3])
+{
+    double slat, clat, slon, clon;
+
+    slat = sin(DEG2RAD(latitude));
+    clat = cos(DEG2RAD(latitude));
+    slon = sin(DEG2RAD(longitude));
+    clon = cos(DEG2RAD(longitude));
+    v[0] = clat * clon;
+    v[1] = clat * slon;
+    v[2] = slat;
+}
+
+static inline double vec_dot(const double a[3], const double b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void vec_cross(const double a[3], const double b[3], double rv[3])
+{
+    rv[0] = a[1] * b[2] - a[2] * b[1];
+    rv[1] = a[2] * b[0] - a[0] * b[2];
+    rv[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+/* Course of direction @p d at point @p p (unit vector), in degrees
+ * true. North at p is (-z.x, -z.y, x²+y²), east (-y, x, 0), both
+ * scaled by 1/cos(lat) which doesn't change the angle.*/
+static inline double vec_course(const double p[3], const double d[3])
+{
+    double north, east, rv;
+
+    north = -p[2] * p[0] * d[0] - p[2] * p[1] * d[1] + (p[0] * p[0] + p[1] * p[1]) * d[2];
+    east = -p[1] * d[0] + p[0] * d[1];
+    rv = RAD2DEG(atan2(east, north));
+    return rv < 0 ? rv + 360 : rv;
+}
+
+/**
+ * @brief Sets up a leg, to then get the navigation values from any
+ * position with nav_leg_compute.
+ *
+ * @param self a NavLeg
+ * @param from Start of the leg
+ * @param to End of the leg, the destination
+ */
+void nav_leg_init(NavLeg *self, GeoLocation *from, GeoLocation *to)
+{
+    double f[3], len;
+
+    vec_from_geo(from->latitude, from->longitude, f);
+    vec_from_geo(to->latitude, to->longitude, self->to);
+    vec_cross(f, self->to, self->normal);
+    len = sqrt(vec_dot(self->normal, self->normal));
+    /*Less than ~1m apart: no usable leg plane*/
+    self->has_normal = len > 1e-7;
+    if(self->has_normal){
+        for(int i = 0; i < 3; i++)
+            self->normal[i] /= len;
+    }
+}
+
+/**
+ * @brief Gets the navigation values of a leg from a position.
+ *
+ * DTK is the course of the leg abeam the position (that of the
+ * point of the leg closest to it), which is what the aircraft should
+ * track to get back on the great circle.
+ *
+ * @param self a NavLeg
+ * @param latitude Current position latitude, in degrees
+ * @param longitude Current position longitude, in degrees
+ * @param data Where to store dtk, bearing, distance and xtk. Other fields
+ * are left untouched.
+ */
+void nav_leg_compute(NavLeg *self, double latitude, double longitude, NavData *data)
+{
+    double p[3], c[3], d[3], q[3];
+    double dot, s, len;
+
+    vec_from_geo(latitude, longitude, p);
+
+    /*Distance: angle between p and the destination*/
+    dot = vec_dot(p, self->to);
+    vec_cross(p, self->to, c);
+    data->distance = EARTH_RADIUS_NM * atan2(sqrt(vec_dot(c, c)), dot);
+
+    /*Bearing: the destination without its part along p*/
+    for(int i = 0; i < 3; i++)
+        d[i] = self->to[i] - dot * p[i];
+    data->bearing = vec_course(p, d);
+
+    if(!self->has_normal){
+        data->dtk = data->bearing;
+        data->xtk = 0;
+        return;
+    }
+
+    /*Left of the leg is on the side of the normal*/
+    s = vec_dot(p, self->normal);
+    data->xtk = -EARTH_RADIUS_NM * asin(fmax(-1.0, fmin(1.0, s)));
+
+    /*Closest point of the leg, and the direction of the leg there*/
+    for(int i = 0; i < 3; i++)
+        q[i] = p[i] - s * self->normal[i];
+    len = sqrt(vec_dot(q, q));
+    if(len < 1e-9){ /*At a pole of the leg, any course will do*/
+        data->dtk = data->bearing;
+        return;
+    }
+    for(int i = 0; i < 3; i++)
+        q[i] /= len;
+    vec_cross(self->normal, q, d);
+    data->dtk = vec_course(q, d);
+}
+
+static void nav_engine_update_speed(NavEngine *self, LocationData *location)
+{
+    uint32_t now, dt;
+    double distance;
+    float speed;
+
+    now = self->ds->now;
+    if(!self->has_sample || now - self->sample_time > MAX_SPEED_AGE){
+        self->has_sample = true;
+        self->sample = location->super;
+        self->sample_time = now;
+        self->ground_speed = -1;
+        return;
+    }
+    dt = now - self->sample_time;
+    if(dt < MIN_SPEED_PERIOD)
+        return;
+
+    distance = geo_location_distance_to(&self->sample, &location->super) / 1852.0; /*NM*/
+    speed = distance / (dt / 3600000.0);
+    /*Smoothed, once known*/
+    self->ground_speed = self->ground_speed < 0 ? speed : (self->ground_speed + speed) / 2;
+    self->sample = location->super;
+    self->sample_time = now;
+}
+
+static void nav_engine_publish(NavEngine *self, LocationData *location)
+{
+    NavData data = {0};
+
+    data.active = self->active;
+    data.ground_speed = self->ground_speed;
+    data.ete = -1;
+    data.position = location->super;
+    if(self->active){
+        nav_leg_compute(&self->leg, location->super.latitude, location->super.longitude, &data);
+        if(self->ground_speed >= MIN_ETE_SPEED)
+            data.ete = data.distance / self->ground_speed * 3600;
+    }
+    data_source_set_nav_data(self->ds, &data);
+}
+
+static void nav_engine_location_changed(NavEngine *self, LocationData *newv)
+{
+    nav_engine_update_speed(self, newv);
+    nav_engine_publish(self, newv);
+}
+
+static void nav_engine_route_changed(NavEngine *self, RouteData *newv)
+{
+    self->active = !isnan(newv->to.latitude) && !isnan(newv->from.latitude);
+    if(self->active)
+        nav_leg_init(&self->leg, &newv->from, &newv->to);
+    nav_engine_publish(self, &self->ds->location);
+}
+
+/**
+ * @brief Starts keeping @p ds NavData up to date. Values are computed
+ * on each location sample, as they come from the data source, once
+ * for all the gauges.
+ *
+ * @param ds The DataSource to listen to and publish on
+ * @return true on success, false if the listeners couldn't be added
+ */
+bool nav_engine_start(DataSource *ds)
+{
+    size_t n;
+
+    engine.ds = ds ? ds : data_source_get_instance();
+    n = data_source_add_events_listener(engine.ds, &engine, 2,
+        LOCATION_DATA, nav_engine_location_changed,
+        ROUTE_DATA, nav_engine_route_changed
+    );
+    return n == 2;
+}
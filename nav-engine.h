@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef NAV_ENGINE_H
+#define NAV_ENGINE_H
+#include <stdbool.h>
+
+#include "data-source.h"
+#include "geo-location.h"
+
+/* A great circle leg, with what only depends on its ends computed once:
+ * the ends as unit vectors (i.e. sin/cos of their latitude and
+ * longitude) and the normal of the leg plane. Each position then costs
+ * a sin/cos of its own latitude and longitude and a few products.*/
+typedef struct{
+    double to[3];
+    double normal[3]; /*from x to, unit*/
+    bool has_normal; /*false when the ends are (nearly) the same*/
+}NavLeg;
+
+void nav_leg_init(NavLeg *self, GeoLocation *from, GeoLocation *to);
+void nav_leg_compute(NavLeg *self, double latitude, double longitude, NavData *data);
+
+/* Keeps DataSource's NavData up to date for the active leg (the route
+ * of DataSource): listens to the location and the route and publishes
+ * through data_source_set_nav_data, for any gauge to use.*/
+bool nav_engine_start(DataSource *ds);
+#endif /* NAV_ENGINE_H */
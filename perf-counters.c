@@ -0,0 +1,300 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "perf-counters.h"
+
+#if ENABLE_PERF_COUNTERS
+#define ALLOC_CHUNK 16
+
+typedef struct{
+    PerfCounter **counters;
+    size_t ncounters;
+    size_t acounters;
+}PerfRegistry;
+
+bool perf_counters_enabled = true;
+
+static PerfRegistry types = {0};
+static PerfRegistry instances = {0};
+static PerfWindow frame_window = {0};
+
+static int perf_counters_cmp_u32(const void *a, const void *b);
+
+static PerfCounter *perf_registry_find(PerfRegistry *self, const void *key)
+{
+    for(int i = 0; i < self->ncounters; i++){
+        if(self->counters[i]->key == key)
+            return self->counters[i];
+    }
+    return NULL;
+}
+
+static PerfCounter *perf_registry_add(PerfRegistry *self, const void *key, bool is_type)
+{
+    PerfCounter *rv;
+
+    if(self->ncounters == self->acounters){
+        void *tmp;
+        tmp = realloc(self->counters, sizeof(PerfCounter*)*(self->acounters + ALLOC_CHUNK));
+        if(!tmp) return NULL;
+        self->counters = tmp;
+        self->acounters += ALLOC_CHUNK;
+    }
+
+    rv = calloc(1, sizeof(PerfCounter));
+    if(!rv) return NULL;
+    rv->key = key;
+    rv->is_type = is_type;
+    snprintf(rv->name, sizeof(rv->name), "%p", key);
+
+    self->counters[self->ncounters++] = rv;
+    return rv;
+}
+
+static void perf_registry_remove(PerfRegistry *self, PerfCounter *counter)
+{
+    for(int i = 0; i < self->ncounters; i++){
+        if(self->counters[i] != counter)
+            continue;
+        /*Order doesn't matter, fill the hole with the last one*/
+        self->counters[i] = self->counters[--self->ncounters];
+        free(counter);
+        return;
+    }
+}
+
+static void perf_registry_dispose(PerfRegistry *self)
+{
+    for(int i = 0; i < self->ncounters; i++)
+        free(self->counters[i]);
+    free(self->counters);
+    self->counters = NULL;
+    self->ncounters = 0;
+    self->acounters = 0;
+}
+
+/**
+ * @brief Returns the counter associated with @p gauge, creating it
+ * (and the counter of its type) if needed. The result is meant to be
+ * cached by the caller: lookups are linear.
+ *
+ * @param gauge The gauge instance
+ * @param ops The gauge ops, used to identify the gauge type
+ * @return The instance counter, NULL on allocation failure.
+ */
+PerfCounter *perf_counters_get(const void *gauge, const void *ops)
+{
+    PerfCounter *rv;
+
+    rv = perf_registry_find(&instances, gauge);
+    if(rv) return rv;
+
+    rv = perf_registry_add(&instances, gauge, false);
+    if(!rv) return NULL;
+
+    rv->type = perf_counters_get_type(ops);
+
+    return rv;
+}
+
+/**
+ * @brief Drops the counter of a gauge being disposed. Its samples live
+ * on in the counter of its type, the instance counter is freed so that
+ * creating and destroying gauges doesn't grow the registry: an other
+ * gauge allocated at the same address will get a new counter.
+ *
+ * @param counter An instance counter, invalid after the call
+ */
+void perf_counters_detach(PerfCounter *counter)
+{
+    if(!counter || counter->is_type)
+        return;
+    perf_registry_remove(&instances, counter);
+}
+
+/**
+ * @brief Returns the counter associated with a gauge type, creating
+ * it if needed.
+ *
+ * @param ops The BaseGaugeOps shared by all gauges of the type
+ * @return The type counter, NULL on allocation failure.
+ */
+PerfCounter *perf_counters_get_type(const void *ops)
+{
+    PerfCounter *rv;
+
+    rv = perf_registry_find(&types, ops);
+    if(!rv)
+        rv = perf_registry_add(&types, ops, true);
+    return rv;
+}
+
+/**
+ * @brief Gives a human-readable name to a counter. Counters default
+ * to their key address.
+ */
+void perf_counters_set_name(PerfCounter *counter, const char *name)
+{
+    if(!counter) return;
+    snprintf(counter->name, sizeof(counter->name), "%s", name);
+}
+
+static inline void perf_window_push(PerfWindow *self, uint64_t ns)
+{
+    uint32_t sample;
+
+    sample = ns > UINT32_MAX ? UINT32_MAX : ns;
+    self->samples[self->next] = sample;
+    self->next = (self->next + 1) % PERF_WINDOW_SIZE;
+    if(self->count < PERF_WINDOW_SIZE)
+        self->count++;
+
+    self->ncalls++;
+    self->total += ns;
+    if(sample > self->max)
+        self->max = sample;
+}
+
+void perf_counters_record(PerfCounter *counter, PerfPhase phase, uint64_t ns)
+{
+    perf_window_push(&counter->phases[phase], ns);
+    if(counter->type)
+        perf_window_push(&counter->type->phases[phase], ns);
+}
+
+/**
+ * @brief Records the time taken to render a whole frame (all top-level
+ * gauges).
+ */
+void perf_counters_record_frame(uint64_t ns)
+{
+    perf_window_push(&frame_window, ns);
+}
+
+PerfWindow *perf_counters_frame_window(void)
+{
+    return &frame_window;
+}
+
+/**
+ * @brief Computes percentiles over the samples currently in the window.
+ * Works on a copy so can be called at any time.
+ */
+void perf_window_stats(PerfWindow *self, PerfStats *stats)
+{
+    uint32_t sorted[PERF_WINDOW_SIZE];
+
+    stats->count = self->count;
+    if(!self->count){
+        stats->p50 = stats->p95 = stats->p99 = stats->max = 0;
+        return;
+    }
+
+    memcpy(sorted, self->samples, sizeof(uint32_t)*self->count);
+    qsort(sorted, self->count, sizeof(uint32_t), perf_counters_cmp_u32);
+
+    stats->p50 = sorted[(self->count-1) * 50 / 100];
+    stats->p95 = sorted[(self->count-1) * 95 / 100];
+    stats->p99 = sorted[(self->count-1) * 99 / 100];
+    stats->max = sorted[self->count-1];
+}
+
+/**
+ * @brief Fills @p out with at most @p max type counters.
+ *
+ * @return the number of counters written
+ */
+size_t perf_counters_get_types(PerfCounter **out, size_t max)
+{
+    size_t n;
+
+    n = types.ncounters < max ? types.ncounters : max;
+    memcpy(out, types.counters, sizeof(PerfCounter*)*n);
+    return n;
+}
+
+static void perf_counters_dump_registry(FILE *fp, PerfRegistry *registry, const char *scope)
+{
+    static const char *phase_names[PERF_NPHASES] = {"update_state", "render"};
+    PerfStats stats;
+    PerfCounter *counter;
+    PerfWindow *window;
+
+    for(int i = 0; i < registry->ncounters; i++){
+        counter = registry->counters[i];
+        for(int j = 0; j < PERF_NPHASES; j++){
+            window = &counter->phases[j];
+            if(!window->ncalls) continue;
+            perf_window_stats(window, &stats);
+            fprintf(fp, "%s,%s,%p,%s,%s,%lu,%lu,%lu,%u,%u,%u,%u\n",
+                scope, counter->name, counter->key,
+                counter->type ? counter->type->name : "",
+                phase_names[j],
+                (unsigned long)window->ncalls,
+                (unsigned long)window->total,
+                (unsigned long)(window->total / window->ncalls),
+                stats.p50, stats.p95, stats.p99,
+                window->max
+            );
+        }
+    }
+}
+
+/**
+ * @brief Writes all counters to @p filename as CSV, one line per
+ * counter and phase. Percentiles are computed over the current window,
+ * mean and max over the whole run. All times are in nanoseconds.
+ *
+ * @return true on success, false otherwise
+ */
+bool perf_counters_dump_csv(const char *filename)
+{
+    FILE *fp;
+    PerfStats stats;
+
+    fp = fopen(filename, "w");
+    if(!fp){
+        printf("Couldn't open %s for writing\n", filename);
+        return false;
+    }
+    fprintf(fp, "scope,name,key,type,phase,calls,total_ns,mean_ns,p50_ns,p95_ns,p99_ns,max_ns\n");
+    if(frame_window.ncalls){
+        perf_window_stats(&frame_window, &stats);
+        fprintf(fp, "frame,frame,,,render,%lu,%lu,%lu,%u,%u,%u,%u\n",
+            (unsigned long)frame_window.ncalls,
+            (unsigned long)frame_window.total,
+            (unsigned long)(frame_window.total / frame_window.ncalls),
+            stats.p50, stats.p95, stats.p99,
+            frame_window.max
+        );
+    }
+    perf_counters_dump_registry(fp, &types, "type");
+    perf_counters_dump_registry(fp, &instances, "instance");
+    fclose(fp);
+
+    return true;
+}
+
+void perf_counters_shutdown(void)
+{
+    perf_registry_dispose(&types);
+    perf_registry_dispose(&instances);
+    memset(&frame_window, 0, sizeof(PerfWindow));
+}
+
+static int perf_counters_cmp_u32(const void *a, const void *b)
+{
+    uint32_t ia = *(const uint32_t*)a;
+    uint32_t ib = *(const uint32_t*)b;
+
+    return (ia > ib) - (ia < ib);
+}
+#endif /* ENABLE_PERF_COUNTERS */
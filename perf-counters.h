@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+/* Per-gauge timing of update_state/render, fed by base_gauge_render.
+ * Everything compiles to nothing unless ENABLE_PERF_COUNTERS is set.
+ *
+ * Timings are aggregated twice: once per gauge instance and once per
+ * gauge type (using the BaseGaugeOps pointer as the type identity).
+ * Instance counters go away with their gauge, type counters stay.
+ * Each aggregate keeps the last PERF_WINDOW_SIZE samples in a ring so
+ * that percentiles reflect what is going on *now* rather than since
+ * startup.
+ */
+#define PERF_WINDOW_SIZE 256
+
+typedef enum{
+    PERF_UPDATE_STATE,
+    PERF_RENDER,
+    PERF_NPHASES
+}PerfPhase;
+
+typedef struct{
+    uint32_t samples[PERF_WINDOW_SIZE]; /*nanoseconds*/
+    size_t next; /*next slot to write*/
+    size_t count; /*valid samples, saturates at PERF_WINDOW_SIZE*/
+
+    uint64_t ncalls; /*lifetime*/
+    uint64_t total; /*lifetime, nanoseconds*/
+    uint32_t max; /*lifetime, nanoseconds*/
+}PerfWindow;
+
+typedef struct{
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max; /*max within the window*/
+    size_t count;
+}PerfStats;
+
+typedef struct _PerfCounter{
+    const void *key; /*BaseGaugeOps* for types, BaseGauge* for instances*/
+    char name[32];
+    bool is_type;
+    struct _PerfCounter *type; /*instances only*/
+
+    PerfWindow phases[PERF_NPHASES];
+}PerfCounter;
+
+#if ENABLE_PERF_COUNTERS
+
+extern bool perf_counters_enabled;
+
+static inline uint64_t perf_counters_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+PerfCounter *perf_counters_get(const void *gauge, const void *ops);
+PerfCounter *perf_counters_get_type(const void *ops);
+void perf_counters_detach(PerfCounter *counter);
+void perf_counters_record(PerfCounter *counter, PerfPhase phase, uint64_t ns);
+void perf_counters_record_frame(uint64_t ns);
+
+void perf_counters_set_name(PerfCounter *counter, const char *name);
+
+void perf_window_stats(PerfWindow *self, PerfStats *stats);
+PerfWindow *perf_counters_frame_window(void);
+size_t perf_counters_get_types(PerfCounter **out, size_t max);
+
+bool perf_counters_dump_csv(const char *filename);
+void perf_counters_shutdown(void);
+
+#endif /* ENABLE_PERF_COUNTERS */
+#endif /* PERF_COUNTERS_H */
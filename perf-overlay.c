@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "base-gauge.h"
+#include "perf-counters.h"
+#include "perf-overlay.h"
+#include "resource-manager.h"
+#include "sdl-colors.h"
+#include "misc.h"
+
+#define PERF_OVERLAY_W 300
+#define PERF_OVERLAY_LINE_H 12
+#define PERF_OVERLAY_LINE_LEN 48
+#define PERF_OVERLAY_MAX_TYPES 64
+
+static void perf_overlay_render(PerfOverlay *self, Uint32 dt, RenderContext *ctx);
+static BaseGaugeOps perf_overlay_ops = {
+    .render = (RenderFunc)perf_overlay_render,
+    .update_state = (StateUpdateFunc)NULL,
+    .dispose = (DisposeFunc)NULL
+};
+
+PerfOverlay *perf_overlay_new(void)
+{
+    PerfOverlay *self;
+
+    self = calloc(1, sizeof(PerfOverlay));
+    if(self){
+        if(!perf_overlay_init(self)){
+            return base_gauge_free(BASE_GAUGE(self));
+        }
+    }
+    return self;
+}
+
+PerfOverlay *perf_overlay_init(PerfOverlay *self)
+{
+    PCF_StaticFont *font;
+
+    base_gauge_init(BASE_GAUGE(self),
+        &perf_overlay_ops,
+        PERF_OVERLAY_W, PERF_OVERLAY_LINES * PERF_OVERLAY_LINE_H
+    );
+
+    font = resource_manager_get_static_font(TERMINUS_12,
+        &SDL_WHITE,
+        3, PCF_ALPHA, PCF_DIGITS, " .:/_-"
+    );
+    if(!font) return NULL;
+
+    for(int i = 0; i < PERF_OVERLAY_LINES; i++){
+        self->lines[i] = text_gauge_new(NULL, false, PERF_OVERLAY_W, PERF_OVERLAY_LINE_H);
+        if(!self->lines[i]) return NULL;
+        text_gauge_set_size(self->lines[i], PERF_OVERLAY_LINE_LEN);
+        text_gauge_set_static_font(self->lines[i], font);
+        self->lines[i]->alignment = VALIGN_MIDDLE | HALIGN_LEFT;
+        base_gauge_add_child(BASE_GAUGE(self), BASE_GAUGE(self->lines[i]), 0, i * PERF_OVERLAY_LINE_H);
+    }
+    self->since_refresh = PERF_OVERLAY_REFRESH; /*Fill on first frame*/
+
+    return self;
+}
+
+#if ENABLE_PERF_COUNTERS
+typedef struct{
+    PerfCounter *counter;
+    PerfStats stats[PERF_NPHASES];
+}PerfOverlayEntry;
+
+static int perf_overlay_entry_cmp(const void *a, const void *b)
+{
+    const PerfOverlayEntry *ea = a;
+    const PerfOverlayEntry *eb = b;
+    uint64_t va, vb;
+
+    va = (uint64_t)ea->stats[PERF_UPDATE_STATE].p95 + ea->stats[PERF_RENDER].p95;
+    vb = (uint64_t)eb->stats[PERF_UPDATE_STATE].p95 + eb->stats[PERF_RENDER].p95;
+
+    return (vb > va) - (vb < va); /*descending*/
+}
+
+static void perf_overlay_refresh(PerfOverlay *self)
+{
+    PerfCounter *counters[PERF_OVERLAY_MAX_TYPES];
+    PerfOverlayEntry entries[PERF_OVERLAY_MAX_TYPES];
+    PerfStats frame;
+    size_t ncounters;
+    int line;
+
+    perf_window_stats(perf_counters_frame_window(), &frame);
+    text_gauge_set_value_formatn(self->lines[0], PERF_OVERLAY_LINE_LEN,
+        "FRAME us p50 %u p95 %u p99 %u",
+        frame.p50/1000, frame.p95/1000, frame.p99/1000
+    );
+    text_gauge_set_value_formatn(self->lines[1], PERF_OVERLAY_LINE_LEN,
+        "%-16s %7s %7s %7s", "TYPE", "UPD95", "RDR50", "RDR95"
+    );
+
+    ncounters = perf_counters_get_types(counters, PERF_OVERLAY_MAX_TYPES);
+    for(int i = 0; i < ncounters; i++){
+        entries[i].counter = counters[i];
+        for(int j = 0; j < PERF_NPHASES; j++)
+            perf_window_stats(&counters[i]->phases[j], &entries[i].stats[j]);
+    }
+    qsort(entries, ncounters, sizeof(PerfOverlayEntry), perf_overlay_entry_cmp);
+
+    line = 2;
+    for(int i = 0; i < ncounters && line < PERF_OVERLAY_LINES; i++, line++){
+        text_gauge_set_value_formatn(self->lines[line], PERF_OVERLAY_LINE_LEN,
+            "%-16.16s %7u %7u %7u",
+            entries[i].counter->name,
+            entries[i].stats[PERF_UPDATE_STATE].p95/1000,
+            entries[i].stats[PERF_RENDER].p50/1000,
+            entries[i].stats[PERF_RENDER].p95/1000
+        );
+    }
+    for(; line < PERF_OVERLAY_LINES; line++)
+        text_gauge_set_value(self->lines[line], "");
+}
+#endif
+
+static void perf_overlay_render(PerfOverlay *self, Uint32 dt, RenderContext *ctx)
+{
+#if ENABLE_PERF_COUNTERS
+    self->since_refresh += dt;
+    if(self->since_refresh >= PERF_OVERLAY_REFRESH){
+        perf_overlay_refresh(self);
+        self->since_refresh = 0;
+    }
+#endif
+    base_gauge_fill(BASE_GAUGE(self), ctx, NULL, &(SDL_Color){0, 0, 0, 160}, false);
+}
@@ -0,0 +1,30 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef PERF_OVERLAY_H
+#define PERF_OVERLAY_H
+
+#include "base-gauge.h"
+#include "text-gauge.h"
+
+#define PERF_OVERLAY_LINES 12
+#define PERF_OVERLAY_REFRESH 500 /*milliseconds*/
+
+/* On-screen report of the perf counters: one line for the
+ * whole frame, then the most expensive gauge types sorted by
+ * p95 (update_state + render). Times are in microseconds.
+ */
+typedef struct{
+    BaseGauge super;
+
+    TextGauge *lines[PERF_OVERLAY_LINES];
+    Uint32 since_refresh;
+}PerfOverlay;
+
+PerfOverlay *perf_overlay_new(void);
+PerfOverlay *perf_overlay_init(PerfOverlay *self);
+#endif /* PERF_OVERLAY_H */
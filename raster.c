@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "raster.h"
+
+#define RASTER_ROW(surface, y) ((Uint32 *)((Uint8 *)(surface)->pixels + (y) * (surface)->pitch))
+
+static inline void raster_fill_row(Uint32 *row, int n, Uint32 color)
+{
+#if defined(__SSE2__)
+    __m128i v;
+
+    v = _mm_set1_epi32(color);
+    for(; n >= 4; n -= 4, row += 4)
+        _mm_storeu_si128((__m128i *)row, v);
+#elif defined(__ARM_NEON)
+    uint32x4_t v;
+
+    v = vdupq_n_u32(color);
+    for(; n >= 4; n -= 4, row += 4)
+        vst1q_u32(row, v);
+#else
+    SDL_memset4(row, color, n);
+    n = 0;
+#endif
+    for(; n > 0; n--)
+        *row++ = color;
+}
+
+/*Clips [*a, *b] to [0, max[, returns false if nothing's left*/
+static inline bool raster_clip(int *a, int *b, int max)
+{
+    if(*a < 0)
+        *a = 0;
+    if(*b >= max)
+        *b = max - 1;
+    return *a <= *b;
+}
+
+/**
+ * @brief Fills pixels x0 to x1 (included) of row @p y.
+ *
+ * @param surface A 32bpp surface
+ * @param x0 First pixel
+ * @param x1 Last pixel
+ * @param y The row
+ * @param color The color, in @p surface format
+ */
+void raster_hspan(SDL_Surface *surface, int x0, int x1, int y, Uint32 color)
+{
+    if(y < 0 || y >= surface->h)
+        return;
+    if(!raster_clip(&x0, &x1, surface->w))
+        return;
+    raster_fill_row(RASTER_ROW(surface, y) + x0, x1 - x0 + 1, color);
+}
+
+/**
+ * @brief Fills pixels y0 to y1 (included) of column @p x.
+ *
+ * @param surface A 32bpp surface
+ * @param x The column
+ * @param y0 First pixel
+ * @param y1 Last pixel
+ * @param color The color, in @p surface format
+ */
+void raster_vspan(SDL_Surface *surface, int x, int y0, int y1, Uint32 color)
+{
+    Uint8 *p;
+
+    if(x < 0 || x >= surface->w)
+        return;
+    if(!raster_clip(&y0, &y1, surface->h))
+        return;
+    p = (Uint8 *)(RASTER_ROW(surface, y0) + x);
+    for(int n = y1 - y0 + 1; n > 0; n--, p += surface->pitch)
+        *(Uint32 *)p = color;
+}
+
+/**
+ * @brief Fills the rectangle that goes from (x0,y0) to (x1,y1), both
+ * included.
+ *
+ * @param surface A 32bpp surface
+ * @param x0 Left column
+ * @param y0 Top row
+ * @param x1 Right column
+ * @param y1 Bottom row
+ * @param color The color, in @p surface format
+ */
+void raster_fill_rect(SDL_Surface *surface, int x0, int y0, int x1, int y1, Uint32 color)
+{
+    if(!raster_clip(&x0, &x1, surface->w) || !raster_clip(&y0, &y1, surface->h))
+        return;
+    for(int y = y0; y <= y1; y++)
+        raster_fill_row(RASTER_ROW(surface, y) + x0, x1 - x0 + 1, color);
+}
+
+/**
+ * @brief Draws a 1bpp bitmap (glyph) with its top-left corner at (@p x,
+ * @p y). Set bits are written with @p color, others are left untouched.
+ *
+ * @param surface A 32bpp surface
+ * @param x Destination column, can be out of the surface
+ * @param y Destination row, can be out of the surface
+ * @param bits The bitmap rows, most significant bit first
+ * @param w Bitmap width in pixels
+ * @param h Bitmap height in pixels
+ * @param pitch Bytes per bitmap row
+ * @param color The color, in @p surface format
+ */
+void raster_blit_bitmap(SDL_Surface *surface, int x, int y,
+                        const uint8_t *bits, int w, int h, int pitch,
+                        Uint32 color)
+{
+    int sx0, sx1, sy0, sy1;
+    const uint8_t *src;
+    Uint32 *row;
+    uint8_t byte;
+
+    /*Visible part, in bitmap coordinates*/
+    sx0 = -x;
+    sx1 = surface->w - x - 1;
+    sy0 = -y;
+    sy1 = surface->h - y - 1;
+    if(!raster_clip(&sx0, &sx1, w) || !raster_clip(&sy0, &sy1, h))
+        return;
+
+    for(int sy = sy0; sy <= sy1; sy++){
+        src = bits + sy * pitch;
+        row = RASTER_ROW(surface, y + sy) + x;
+        for(int sx = sx0; sx <= sx1; sx++){
+            byte = src[sx >> 3];
+            if(!byte){ /*Skips to the next byte*/
+                sx |= 7;
+                continue;
+            }
+            if(byte & (0x80 >> (sx & 7)))
+                row[sx] = color;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+/* Basic primitives for the generators that draw on 32bpp surfaces
+ * (rulers, ladder pages, barrels). Everything is clipped to the
+ * surface, and bounds are inclusive (x0..x1 is x1 - x0 + 1 pixels),
+ * which is how generators compute them. Nothing is done when the
+ * second bound is lower than the first one.
+ *
+ * Rows are filled with SSE2 or NEON stores when the compiler targets
+ * them, SDL_memset4 otherwise. Surfaces must be locked by the caller
+ * when needed.
+ */
+void raster_hspan(SDL_Surface *surface, int x0, int x1, int y, Uint32 color);
+void raster_vspan(SDL_Surface *surface, int x, int y0, int y1, Uint32 color);
+void raster_fill_rect(SDL_Surface *surface, int x0, int y0, int x1, int y1, Uint32 color);
+void raster_blit_bitmap(SDL_Surface *surface, int x, int y,
+                        const uint8_t *bits, int w, int h, int pitch,
+                        Uint32 color);
+#endif /* RASTER_H */
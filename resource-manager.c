@@ -8,16 +8,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdarg.h>
 
 #include "SDL_pixels.h"
 #include "SDL_pcf.h"
 
 #include "resource-manager.h"
+#include "glyph-run-cache.h"
 #include "misc.h"
 #include <res-dirs.h>
 
 static ResourceManager *_instance = NULL;
-static void resource_manager_push_static_font(PCF_StaticFont *font, FontResource creator);
+static void resource_manager_push_static_font(PCF_StaticFont *font, FontResource creator,
+                                             SDL_Color *color, GlyphSet *glyphs);
 
 static ResourceManager *resource_manager_new(void)
 {
@@ -25,7 +29,8 @@ static ResourceManager *resource_manager_new(void)
 
     self = calloc(1, sizeof(ResourceManager));
     if(self){
-        /*init as needed*/
+        for(int i = 0; i < SFONT_BUCKETS; i++)
+            self->buckets[i] = -1;
     }
     return self;
 }
@@ -73,6 +78,8 @@ void resource_manager_shutdown(void)
     }
     if(self->sfonts)
         free(self->sfonts);
+    /*Runs are keyed on static font addresses*/
+    glyph_run_cache_clear();
     free(self);
     _instance = NULL;
 }
@@ -111,67 +118,138 @@ PCF_Font *resource_manager_get_font(FontResource font)
     return self->fonts[font];
 }
 
-PCF_StaticFont *resource_manager_get_static_font(FontResource font, SDL_Color *color, int nsets, ...)
+static inline void glyph_set_add(GlyphSet *self, const char *str)
 {
-    char *str;
-    size_t tlen;
-    va_list ap;
-    ResourceManager *self;
-    PCF_StaticFont *rv;
+    unsigned char c;
 
-    self = resource_manager_get_instance();
+    for(; *str; str++){
+        c = *str;
+        self->bits[c >> 6] |= (uint64_t)1 << (c & 63);
+    }
+}
 
+static inline bool glyph_set_contains(GlyphSet *self, GlyphSet *other)
+{
+    for(int i = 0; i < 4; i++){
+        if(other->bits[i] & ~self->bits[i])
+            return false;
+    }
+    return true;
+}
 
-    tlen = 0;
-    va_start(ap, nsets);
-    for(int i = 0; i < nsets; i++){
-        tlen += strlen(va_arg(ap, char*));
+/* Writes the set as a string, in the same order as sorting
+ * with charcmp (plain char is signed). @p buffer must hold
+ * 257 chars.
+ */
+static size_t glyph_set_to_string(GlyphSet *self, char *buffer)
+{
+    unsigned char c;
+    size_t rv;
+
+    rv = 0;
+    for(int i = CHAR_MIN; i <= CHAR_MAX; i++){
+        c = (unsigned char)i;
+        if(c && self->bits[c >> 6] & ((uint64_t)1 << (c & 63)))
+            buffer[rv++] = c;
     }
+    buffer[rv] = '\0';
+    return rv;
+}
+
+static inline int resource_manager_bucket(FontResource font, SDL_Color *color)
+{
+    Uint32 key;
+
+    key = (color->r << 24 | color->g << 16 | color->b << 8 | color->a) ^ (font * 2654435761u);
+    key ^= key >> 16;
+    key ^= key >> 8;
+    return key & (SFONT_BUCKETS - 1);
+}
+
+static PCF_StaticFont *resource_manager_create_static_font(PCF_Font *font, SDL_Color *color,
+                                                           size_t tlen, ...)
+{
+    PCF_StaticFont *rv;
+    va_list ap;
+
+    va_start(ap, tlen);
+    rv = PCF_FontCreateStaticFontVA(font, color, 1, tlen, ap);
     va_end(ap);
 
-    str = malloc((tlen + 1) * sizeof(char));
-    if(!str) return NULL;
+    return rv;
+}
 
-    char *iter = str;
+/**
+ * @brief Gets a static font of @p font able to write all chars of the
+ * given sets, in the given color.
+ *
+ * Each static font is registered with the set of chars it can write as
+ * a 256 bits bitmap, hashed on font and color: looking up an existing
+ * font doesn't allocate anything. When a new font has to be created for
+ * a font/color couple that already has one, the new font gets the union
+ * of both sets so that later requests converge on a single atlas.
+ *
+ * @param font The font to derive the static font from
+ * @param color The text color
+ * @param nsets The number of strings that follow
+ * @param ... Strings of chars the static font must be able to write
+ * @return A static font, owned by the ResourceManager. Callers that keep
+ * it must take a reference.
+ */
+PCF_StaticFont *resource_manager_get_static_font(FontResource font, SDL_Color *color, int nsets, ...)
+{
+    ResourceManager *self;
+    StaticFontResource *res;
+    PCF_StaticFont *rv;
+    GlyphSet wanted;
+    char charset[257];
+    size_t len;
+    va_list ap;
+    int bucket;
+
+    self = resource_manager_get_instance();
+
+    wanted = (GlyphSet){0};
     va_start(ap, nsets);
-    for(int i = 0; i < nsets; i++){
-        char *tmp = va_arg(ap, char*);
-        strcpy(iter, tmp);
-        iter += strlen(tmp)*sizeof(char);
-    }
+    for(int i = 0; i < nsets; i++)
+        glyph_set_add(&wanted, va_arg(ap, char*));
     va_end(ap);
 
-    qsort(str, strlen(str), sizeof(char), charcmp);
-    filter_dedup(str, tlen);
-//    printf("ResourceManager: looking for a (r:%d,g:%d,b:%d,a:%d) font of type %d with the following charset: %s\n",color->r,color->g,color->b,color->a, font, str);
-    for(int i = 0; i < self->n_sfonts; i++){
-        if(self->sfonts[i].creator != font) continue;
-        if(PCF_StaticFontCanWrite(self->sfonts[i].font, color, str)){
-//            printf("Found existing instance %p(glyphs: %s)\n", self->sfonts[i].font, self->sfonts[i].font->glyphs);
-            rv = self->sfonts[i].font;
-            goto end;
-        }
+    bucket = resource_manager_bucket(font, color);
+    for(int i = self->buckets[bucket]; i >= 0; i = res->next){
+        res = &self->sfonts[i];
+        if(res->creator != font || !SDLExt_ColorEquals(&res->color, color))
+            continue;
+        if(glyph_set_contains(&res->glyphs, &wanted))
+            return res->font;
+        /*Newest compatible font first: merge with it*/
+        for(int j = 0; j < 4; j++)
+            wanted.bits[j] |= res->glyphs.bits[j];
+        break;
     }
 
-    va_start(ap, nsets);
-    rv = PCF_FontCreateStaticFontVA(
+    len = glyph_set_to_string(&wanted, charset);
+    rv = resource_manager_create_static_font(
         resource_manager_get_font(font),
         color,
-        nsets,
-        tlen, ap
+        len, charset
     );
-    va_end(ap);
-    resource_manager_push_static_font(rv, font);
-//    printf("Not found, created a new one: %p(glyphs: %s)\n", rv, rv->glyphs);
+    if(!rv)
+        return NULL;
+    /* Drawing code relies on the texture being there instead of
+     * checking for it on each glyph*/
+    if(!PCF_StaticFontCreateTexture(rv))
+        printf("ResourceManager: Couldn't create static font texture\n");
+    resource_manager_push_static_font(rv, font, color, &wanted);
 
-end:
-    free(str);
     return rv;
 }
 
-static void resource_manager_push_static_font(PCF_StaticFont *font, FontResource creator)
+static void resource_manager_push_static_font(PCF_StaticFont *font, FontResource creator,
+                                             SDL_Color *color, GlyphSet *glyphs)
 {
     ResourceManager *self;
+    int bucket;
 
     self = resource_manager_get_instance();
     if(self->n_sfonts == self->n_allocated){
@@ -182,8 +260,15 @@ static void resource_manager_push_static_font(PCF_StaticFont *font, FontResource
         self->sfonts = tmp;
         self->n_allocated += 4;
     }
-    self->sfonts[self->n_sfonts].font = font;
-    self->sfonts[self->n_sfonts].creator = creator;
+    bucket = resource_manager_bucket(creator, color);
+    self->sfonts[self->n_sfonts] = (StaticFontResource){
+        .font = font,
+        .color = *color,
+        .creator = creator,
+        .glyphs = *glyphs,
+        .next = self->buckets[bucket]
+    };
+    self->buckets[bucket] = self->n_sfonts;
     self->n_sfonts++;
     PCF_StaticFontRef(font);
 }
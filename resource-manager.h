@@ -8,6 +8,8 @@
 #ifndef RESOURCE_MANAGER_H
 #define RESOURCE_MANAGER_H
 
+#include <stdint.h>
+
 #include "SDL_pcf.h"
 
 
@@ -22,10 +24,19 @@ typedef enum{
     FONT_MAX
 }FontResource;
 
+/*Which of the 256 byte values a static font can write*/
+typedef struct{
+    uint64_t bits[4];
+}GlyphSet;
+
+#define SFONT_BUCKETS 16 /*power of 2*/
+
 typedef struct{
     PCF_StaticFont *font;
     SDL_Color color;
     FontResource creator;
+    GlyphSet glyphs;
+    int next; /*next font in the same bucket, -1 for none*/
 }StaticFontResource;
 
 typedef struct{
@@ -34,6 +45,9 @@ typedef struct{
     StaticFontResource *sfonts;
     size_t n_allocated;
     size_t n_sfonts;
+    /* Static fonts hashed on (creator, color), each bucket being
+     * a list of indices into sfonts, most recent first*/
+    int buckets[SFONT_BUCKETS];
 }ResourceManager;
 
 PCF_Font *resource_manager_get_font(FontResource font);
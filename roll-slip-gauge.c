@@ -14,6 +14,7 @@
 #include "roll-slip-gauge.h"
 #include "misc.h"
 #include "res-dirs.h"
+#include "rotate-blit.h"
 
 #define sign(x) (((x) > 0) - ((x) < 0))
 
@@ -46,15 +47,21 @@ RollSlipGauge *roll_slip_gauge_init(RollSlipGauge *self)
 
     generic_layer_init_from_file(&self->arc, IMG_DIR"/roll-arc.png");
     if(!self->arc.canvas) return NULL;
+#if !USE_SDL_GPU
+    if(!generic_layer_convert(&self->arc, SDL_PIXELFORMAT_RGBA32))
+        return NULL;
+#endif
     generic_layer_build_texture(&self->arc);
 
     generic_layer_init_from_file(&self->marker, IMG_DIR"/roll-marker.png");
     if(!self->marker.canvas) return NULL;
     generic_layer_build_texture(&self->marker);
+    generic_layer_release_canvas(&self->marker);
 
     generic_layer_init_from_file(&self->slip_marker, IMG_DIR"/slip-marker.png");
     if(!self->slip_marker.canvas) return NULL;
     generic_layer_build_texture(&self->slip_marker);
+    generic_layer_release_canvas(&self->slip_marker);
 
 
     //TODO: Center on with surfaces, generic_layer_midX, base_gauge_midx
@@ -76,9 +83,10 @@ RollSlipGauge *roll_slip_gauge_init(RollSlipGauge *self)
         base_gauge_h(BASE_GAUGE(self)),
         32, SDL_PIXELFORMAT_RGBA32
     );
-    self->renderer = SDL_CreateSoftwareRenderer(self->state.rbuffer);
-    self->arc_texture = SDL_CreateTextureFromSurface(self->renderer, tmp);
+    if(!self->state.rbuffer)
+        return NULL;
 #endif
+    generic_layer_release_canvas(&self->arc);
 
 	return self;
 }
@@ -91,7 +99,7 @@ static RollSlipGauge *roll_slip_gauge_dispose(RollSlipGauge *self)
 #if !USE_SDL_GPU
     if(self->state.rbuffer)
         SDL_FreeSurface(self->state.rbuffer);
-    SDL_DestroyRenderer(self->renderer); /*Will also free self->arrow*/
+    self->state.rbuffer = NULL;
 #endif
 
     return self;
@@ -133,14 +141,14 @@ static void roll_slip_gauge_update_state(RollSlipGauge *self, Uint32 dt)
 
     self->state.slip_rect.x = base_x + increment;
 #if !USE_SDL_GPU
-    SDL_FillRect(self->state.rbuffer, NULL, 0x00000000);
-	SDL_RenderCopyEx(self->renderer,
-        self->arc_texture,
-        NULL, /*Whole texture*/
-        NULL, /*Whole surface*/
+    /*Rotate on center, the arc is as large as the gauge*/
+    rotate_blit(self->arc.canvas,
+        generic_layer_w(&self->arc)/2.0f, generic_layer_h(&self->arc)/2.0f,
+        self->state.rbuffer,
+        self->state.rbuffer->w/2.0f, self->state.rbuffer->h/2.0f,
         -SFV_GAUGE(self)->value,
-        NULL, /*Rotate on center*/
-        SDL_FLIP_NONE);
+        NULL, ROTATE_BILINEAR, ROTATE_COPY
+    );
 #endif
 }
 
@@ -28,10 +28,6 @@ typedef struct{
     GenericLayer marker;
     GenericLayer slip_marker;
 
-#if !USE_SDL_GPU
-    SDL_Texture *arc_texture;
-	SDL_Renderer *renderer;
-#endif
     SDL_Rect marker_rect;
 
     RollSlipGaugeState state;
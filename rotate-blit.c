@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include <SDL2/SDL.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "rotate-blit.h"
+
+#define FIX_SHIFT 16
+#define FIX_ONE (1 << FIX_SHIFT)
+#define FIX_HALF (FIX_ONE >> 1)
+
+#define TEXEL(pixels, pitch, fu, fv) \
+    (*(const Uint32 *)((pixels) + ((fv) >> FIX_SHIFT) * (pitch) + (((fu) >> FIX_SHIFT) << 2)))
+
+/* Sample bounds, in 16.16 source coordinates: [ulo, uhi[ x [vlo, vhi[ */
+typedef struct{
+    int32_t ulo, uhi;
+    int32_t vlo, vhi;
+}RotateBounds;
+
+/* Per channel (a*(256-w) + b*w) >> 8, w in [0,256]. Channels are
+ * processed two at a time, one in each half of a 32 bit word.
+ */
+static inline Uint32 rotate_lerp(Uint32 a, Uint32 b, Uint32 w)
+{
+    Uint32 rb, ag;
+
+    rb = (((a & 0x00ff00ff) * (256 - w) + (b & 0x00ff00ff) * w) >> 8) & 0x00ff00ff;
+    ag = (((a >> 8) & 0x00ff00ff) * (256 - w) + ((b >> 8) & 0x00ff00ff) * w) & 0xff00ff00;
+    return rb | ag;
+}
+
+static inline void rotate_blend(Uint32 *dst, Uint32 pixel, int ashift)
+{
+    Uint32 a;
+
+    a = (pixel >> ashift) & 0xff;
+    if(a == 0xff)
+        *dst = pixel;
+    else if(a)
+        *dst = rotate_lerp(*dst, pixel, a + (a >> 7));
+}
+
+/* Bilinear sample with both (x0,y0) and (x0+1,y0+1) within the source.
+ * All three implementations compute exactly the same thing: vertical
+ * lerps first, then the horizontal one, truncating after each.
+ */
+static inline Uint32 rotate_bilinear(const Uint8 *pixels, int pitch, int32_t fu, int32_t fv)
+{
+    const Uint8 *p;
+    Uint32 wx, wy;
+
+    p = pixels + (fv >> FIX_SHIFT) * pitch + ((fu >> FIX_SHIFT) << 2);
+    wx = (fu >> 8) & 0xff;
+    wy = (fv >> 8) & 0xff;
+#if defined(__SSE2__)
+    __m128i zero, top, bottom, v, h;
+
+    zero = _mm_setzero_si128();
+    top = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p), zero);
+    bottom = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(p + pitch)), zero);
+    v = _mm_srli_epi16(_mm_add_epi16(
+            _mm_mullo_epi16(top, _mm_set1_epi16(256 - wy)),
+            _mm_mullo_epi16(bottom, _mm_set1_epi16(wy))
+        ), 8);
+    h = _mm_srli_epi16(_mm_add_epi16(
+            _mm_mullo_epi16(v, _mm_set1_epi16(256 - wx)),
+            _mm_mullo_epi16(_mm_srli_si128(v, 8), _mm_set1_epi16(wx))
+        ), 8);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(h, h));
+#elif defined(__ARM_NEON)
+    uint16x8_t top, bottom, v;
+    uint16x4_t h;
+
+    top = vmovl_u8(vld1_u8(p));
+    bottom = vmovl_u8(vld1_u8(p + pitch));
+    v = vshrq_n_u16(vaddq_u16(vmulq_n_u16(top, 256 - wy), vmulq_n_u16(bottom, wy)), 8);
+    h = vshr_n_u16(vadd_u16(
+            vmul_n_u16(vget_low_u16(v), 256 - wx),
+            vmul_n_u16(vget_high_u16(v), wx)
+        ), 8);
+    return vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(h, h))), 0);
+#else
+    const Uint32 *top, *bottom;
+
+    top = (const Uint32 *)p;
+    bottom = (const Uint32 *)(p + pitch);
+    return rotate_lerp(
+        rotate_lerp(top[0], bottom[0], wy),
+        rotate_lerp(top[1], bottom[1], wy),
+        wx
+    );
+#endif
+}
+
+/*Bilinear sample on the source border, neighbours clamped to the edge*/
+static Uint32 rotate_bilinear_clamped(SDL_Surface *src, int32_t fu, int32_t fv)
+{
+    const Uint8 *pixels;
+    int x0, y0, x1, y1;
+    Uint32 wx, wy;
+
+    pixels = src->pixels;
+    x0 = fu >> FIX_SHIFT;
+    y0 = fv >> FIX_SHIFT;
+    x1 = x0 + 1;
+    y1 = y0 + 1;
+    x0 = x0 < 0 ? 0 : (x0 >= src->w ? src->w - 1 : x0);
+    x1 = x1 < 0 ? 0 : (x1 >= src->w ? src->w - 1 : x1);
+    y0 = y0 < 0 ? 0 : (y0 >= src->h ? src->h - 1 : y0);
+    y1 = y1 < 0 ? 0 : (y1 >= src->h ? src->h - 1 : y1);
+    wx = (fu >> 8) & 0xff;
+    wy = (fv >> 8) & 0xff;
+
+#define CTEXEL(x, y) (*(const Uint32 *)(pixels + (y) * src->pitch + ((x) << 2)))
+    return rotate_lerp(
+        rotate_lerp(CTEXEL(x0, y0), CTEXEL(x0, y1), wy),
+        rotate_lerp(CTEXEL(x1, y0), CTEXEL(x1, y1), wy),
+        wx
+    );
+#undef CTEXEL
+}
+
+/**
+ * Narrows [*a, *b[ to the indices i for which lo <= p + i*step < hi.
+ * Computed in floating point, the result can be off by one pixel: it
+ * is then fixed up in fixed point by rotate_span_fixup.
+ */
+static void rotate_span(float p, float step, float lo, float hi, int *a, int *b)
+{
+    float ilo, ihi, tmp;
+
+    if(step == 0){
+        if(p < lo || p >= hi)
+            *b = *a;
+        return;
+    }
+    ilo = (lo - p) / step;
+    ihi = (hi - p) / step;
+    if(step < 0){
+        tmp = ilo;
+        ilo = ihi;
+        ihi = tmp;
+    }
+    if(ilo > *a)
+        *a = ilo >= *b ? *b : (int)ceilf(ilo);
+    if(ihi < *b)
+        *b = ihi <= *a ? *a : (int)ceilf(ihi);
+}
+
+static inline bool rotate_inside(RotateBounds *bounds, int32_t fu, int32_t fv)
+{
+    return fu >= bounds->ulo && fu < bounds->uhi
+        && fv >= bounds->vlo && fv < bounds->vhi;
+}
+
+/* Samples along a row are on a line and the bounds are convex: only
+ * the span ends need to be checked, using the exact same fixed point
+ * values the inner loops will compute.
+ */
+static void rotate_span_fixup(RotateBounds *bounds, int32_t fu, int32_t fv,
+                              int32_t du, int32_t dv, int *a, int *b)
+{
+    while(*a < *b && !rotate_inside(bounds, fu + *a * du, fv + *a * dv))
+        (*a)++;
+    while(*b > *a && !rotate_inside(bounds, fu + (*b - 1) * du, fv + (*b - 1) * dv))
+        (*b)--;
+}
+
+static void rotate_row(SDL_Surface *src, Uint32 *row, int n,
+                       int32_t fu, int32_t fv, int32_t du, int32_t dv,
+                       RotateFilter filter, RotateMode mode)
+{
+    const Uint8 *pixels;
+    int pitch, ashift;
+
+    pixels = src->pixels;
+    pitch = src->pitch;
+    ashift = src->format->Ashift;
+
+    if(filter == ROTATE_NEAREST){
+        if(mode == ROTATE_COPY){
+            for(int i = 0; i < n; i++, fu += du, fv += dv)
+                row[i] = TEXEL(pixels, pitch, fu, fv);
+        }else{
+            for(int i = 0; i < n; i++, fu += du, fv += dv)
+                rotate_blend(&row[i], TEXEL(pixels, pitch, fu, fv), ashift);
+        }
+    }else{
+        if(mode == ROTATE_COPY){
+            for(int i = 0; i < n; i++, fu += du, fv += dv)
+                row[i] = rotate_bilinear(pixels, pitch, fu, fv);
+        }else{
+            for(int i = 0; i < n; i++, fu += du, fv += dv)
+                rotate_blend(&row[i], rotate_bilinear(pixels, pitch, fu, fv), ashift);
+        }
+    }
+}
+
+static void rotate_row_clamped(SDL_Surface *src, Uint32 *row, int n,
+                               int32_t fu, int32_t fv, int32_t du, int32_t dv,
+                               RotateMode mode)
+{
+    for(int i = 0; i < n; i++, fu += du, fv += dv){
+        if(mode == ROTATE_COPY)
+            row[i] = rotate_bilinear_clamped(src, fu, fv);
+        else
+            rotate_blend(&row[i], rotate_bilinear_clamped(src, fu, fv), src->format->Ashift);
+    }
+}
+
+/**
+ * @brief Rotates @p src by @p angle degrees around (@p sx, @p sy) and
+ * draws it on @p dst so that the rotation center ends up at
+ * (@p dx, @p dy).
+ *
+ * Both surfaces must have the same 32bpp pixel format. Coordinates
+ * are in pixels, pixel (x,y) covering [x, x+1[ x [y, y+1[: the center
+ * of a w x h surface is (w/2, h/2).
+ *
+ * @param src The surface to rotate
+ * @param sx rotation center x, in @p src
+ * @param sy rotation center y, in @p src
+ * @param dst The destination surface
+ * @param dx x location of the rotation center in @p dst
+ * @param dy y location of the rotation center in @p dst
+ * @param angle The rotation, in degrees, clockwise on screen
+ * @param clip The destination area to draw to, NULL for the whole
+ * surface. Always restricted to @p dst clip rect.
+ * @param filter ROTATE_NEAREST or ROTATE_BILINEAR
+ * @param mode ROTATE_COPY to replace the whole clip area (transparent
+ * outside of the source), ROTATE_BLEND to draw the source over @p dst.
+ * @return true on success, false if the surfaces aren't suitable.
+ */
+bool rotate_blit(SDL_Surface *src, float sx, float sy,
+                 SDL_Surface *dst, float dx, float dy,
+                 float angle, SDL_Rect *clip,
+                 RotateFilter filter, RotateMode mode)
+{
+    SDL_Rect area;
+    RotateBounds inner, outer;
+    Uint32 *row;
+    float c, s, bias;
+    float u, v, rx, ry;
+    int32_t fu, fv, du, dv;
+    int a, b, oa, ob;
+
+    if(src->format->BytesPerPixel != 4 || src->format->format != dst->format->format){
+        printf("rotate_blit: source and destination must share the same 32bpp format\n");
+        return false;
+    }
+    if(!SDL_IntersectRect(clip ? clip : &dst->clip_rect, &dst->clip_rect, &area))
+        return true;
+
+    c = cosf(angle * M_PI / 180.0);
+    s = sinf(angle * M_PI / 180.0);
+    /*One destination pixel to the right moves by (c,-s) in the source*/
+    du = lrintf(c * FIX_ONE);
+    dv = lrintf(-s * FIX_ONE);
+
+    if(filter == ROTATE_BILINEAR){
+        /* Samples are shifted by half a texel so that the integer part
+         * is the top-left texel of the 2x2 block. The inner bounds need
+         * the whole block within the source, the outer ones only the
+         * pixel center (borders are then sampled with clamping).*/
+        bias = 0.5f;
+        inner = (RotateBounds){0, (src->w - 1) << FIX_SHIFT, 0, (src->h - 1) << FIX_SHIFT};
+        outer = (RotateBounds){
+            -FIX_HALF, (src->w << FIX_SHIFT) - FIX_HALF,
+            -FIX_HALF, (src->h << FIX_SHIFT) - FIX_HALF
+        };
+    }else{
+        bias = 0.0f;
+        inner = (RotateBounds){0, src->w << FIX_SHIFT, 0, src->h << FIX_SHIFT};
+        outer = inner;
+    }
+
+    if(SDL_MUSTLOCK(src))
+        SDL_LockSurface(src);
+    if(SDL_MUSTLOCK(dst))
+        SDL_LockSurface(dst);
+
+    for(int y = area.y; y < area.y + area.h; y++){
+        row = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch) + area.x;
+
+        /*Source location of the first pixel center of the row*/
+        rx = area.x + 0.5f - dx;
+        ry = y + 0.5f - dy;
+        u = c*rx + s*ry + sx - bias;
+        v = -s*rx + c*ry + sy - bias;
+        fu = lrintf(u * FIX_ONE);
+        fv = lrintf(v * FIX_ONE);
+
+        oa = 0;
+        ob = area.w;
+        rotate_span(u, c, outer.ulo / (float)FIX_ONE, outer.uhi / (float)FIX_ONE, &oa, &ob);
+        rotate_span(v, -s, outer.vlo / (float)FIX_ONE, outer.vhi / (float)FIX_ONE, &oa, &ob);
+        rotate_span_fixup(&outer, fu, fv, du, dv, &oa, &ob);
+
+        a = oa;
+        b = ob;
+        if(filter == ROTATE_BILINEAR){
+            rotate_span(u, c, inner.ulo / (float)FIX_ONE, inner.uhi / (float)FIX_ONE, &a, &b);
+            rotate_span(v, -s, inner.vlo / (float)FIX_ONE, inner.vhi / (float)FIX_ONE, &a, &b);
+            rotate_span_fixup(&inner, fu, fv, du, dv, &a, &b);
+        }
+
+        if(mode == ROTATE_COPY){
+            memset(row, 0, oa * sizeof(Uint32));
+            memset(row + ob, 0, (area.w - ob) * sizeof(Uint32));
+        }
+        if(a > oa){
+            rotate_row_clamped(src, row + oa, a - oa,
+                fu + oa * du, fv + oa * dv, du, dv, mode);
+        }
+        if(ob > b){
+            rotate_row_clamped(src, row + b, ob - b,
+                fu + b * du, fv + b * dv, du, dv, mode);
+        }
+        rotate_row(src, row + a, b - a,
+            fu + a * du, fv + a * dv, du, dv,
+            filter, mode);
+    }
+
+    if(SDL_MUSTLOCK(dst))
+        SDL_UnlockSurface(dst);
+    if(SDL_MUSTLOCK(src))
+        SDL_UnlockSurface(src);
+
+    return true;
+}
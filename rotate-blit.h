@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef ROTATE_BLIT_H
+#define ROTATE_BLIT_H
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+/* Software rotate-and-blit, for builds without SDL_gpu. Destination
+ * pixels are inverse-mapped into the source with 16.16 fixed point
+ * increments, the part of each row that falls within the source being
+ * computed upfront so that the inner loops have no bounds checks.
+ *
+ * Bilinear filtering uses SSE2 or NEON when the compiler targets them.
+ * Nearest filtering is a plain gather and stays scalar.
+ */
+typedef enum{
+    ROTATE_NEAREST,
+    ROTATE_BILINEAR
+}RotateFilter;
+
+typedef enum{
+    ROTATE_COPY,  /*Writes the whole clip area, transparent where the source doesn't cover*/
+    ROTATE_BLEND  /*Source over destination, only where the source covers*/
+}RotateMode;
+
+bool rotate_blit(SDL_Surface *src, float sx, float sy,
+                 SDL_Surface *dst, float dx, float dy,
+                 float angle, SDL_Rect *clip,
+                 RotateFilter filter, RotateMode mode);
+#endif /* ROTATE_BLIT_H */
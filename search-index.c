@@ -0,0 +1,438 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "search-index.h"
+
+/*qsort has no context argument, only used while building*/
+static const char *sort_text = NULL;
+
+/* 6 bits per character: folded letters and digits have their own class.
+ * 0 isn't used so that bigrams and trigrams keys never collide.*/
+static inline uint32_t search_index_class(unsigned char c)
+{
+    if(c >= 'a' && c <= 'z')
+        return c - 'a' + 1;
+    if(c >= '0' && c <= '9')
+        return c - '0' + 27;
+    if(c == ' ')
+        return 37;
+    if(c == '-')
+        return 38;
+    return 39 + c % 25;
+}
+
+static inline uint32_t search_index_bigram(const char *p)
+{
+    return search_index_class(p[0]) << 6
+         | search_index_class(p[1]);
+}
+
+static inline uint32_t search_index_trigram(const char *p)
+{
+    return search_index_class(p[0]) << 12
+         | search_index_bigram(p + 1);
+}
+
+static inline bool search_index_is_alnum(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c >= 0x80;
+}
+
+/*By word, then by position so that the order doesn't depend on qsort*/
+static int search_index_word_cmp(const void *a, const void *b)
+{
+    uint32_t ia = *(const uint32_t *)a;
+    uint32_t ib = *(const uint32_t *)b;
+    int rv;
+
+    rv = strcmp(sort_text + ia, sort_text + ib);
+    if(rv)
+        return rv;
+    return (ia > ib) - (ia < ib);
+}
+
+static int search_index_id_cmp(const void *a, const void *b)
+{
+    uint32_t ia = *(const uint32_t *)a;
+    uint32_t ib = *(const uint32_t *)b;
+
+    return (ia > ib) - (ia < ib);
+}
+
+/*Label that holds text offset @p pos*/
+static inline uint32_t search_index_owner(SearchIndex *self, uint32_t pos)
+{
+    size_t lo, hi, mid;
+
+    lo = 0;
+    hi = self->nentries;
+    while(hi - lo > 1){
+        mid = lo + (hi - lo)/2;
+        if(self->offsets[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static bool search_index_alloc_state(SearchIndex *self)
+{
+    size_t nalloc;
+
+    nalloc = self->nentries ? self->nentries : 1;
+    self->results = malloc(sizeof(uint32_t) * nalloc);
+    self->candidates = malloc(sizeof(uint32_t) * nalloc);
+    self->stamps = calloc(nalloc, sizeof(uint32_t));
+
+    return self->results && self->candidates && self->stamps;
+}
+
+/**
+ * @brief Builds the index over @p labels. Labels are copied, they can
+ * go away afterwards.
+ *
+ * @param self a SearchIndex
+ * @param labels The labels to search. Results are indexes in this
+ * array.
+ * @param nlabels Number of labels in @p labels
+ * @return @p self on success, NULL on failure. Call
+ * search_index_dispose in both cases.
+ */
+SearchIndex *search_index_init(SearchIndex *self, char **labels, size_t nlabels)
+{
+    size_t size, nwords, nalloc;
+    uint32_t *cursor;
+    const char *p;
+    char *q;
+    uint32_t t;
+
+    *self = (SearchIndex){0};
+    self->nentries = nlabels;
+    nalloc = nlabels ? nlabels : 1;
+
+    size = 0;
+    for(size_t i = 0; i < nlabels; i++)
+        size += strlen(labels[i]) + 1;
+    if(size > UINT32_MAX){
+        printf("%s: Too much text to index (%zu bytes)\n", __FUNCTION__, size);
+        return NULL;
+    }
+
+    self->text = malloc(size ? size : 1);
+    self->offsets = malloc(sizeof(uint32_t) * (nlabels + 1));
+    self->masks = calloc(nalloc, sizeof(uint64_t));
+    self->gram_starts = calloc(SEARCH_GRAMS + 1, sizeof(uint32_t));
+    if(!self->text || !self->offsets || !self->masks || !self->gram_starts)
+        return NULL;
+    if(!search_index_alloc_state(self))
+        return NULL;
+
+    /*Lowercased text, counting words on the way*/
+    q = self->text;
+    nwords = 0;
+    for(size_t i = 0; i < nlabels; i++){
+        self->offsets[i] = q - self->text;
+        for(p = labels[i]; *p; p++, q++){
+            *q = tolower((unsigned char)*p);
+            self->masks[i] |= 1ull << search_index_class(*q);
+            if(search_index_is_alnum(*q) && (p == labels[i] || !search_index_is_alnum(q[-1])))
+                nwords++;
+        }
+        *q++ = '\0';
+    }
+    self->offsets[nlabels] = q - self->text;
+
+    /*Words, sorted for prefix lookups*/
+    self->words = malloc(sizeof(uint32_t) * (nwords ? nwords : 1));
+    self->word_owners = malloc(sizeof(uint32_t) * (nwords ? nwords : 1));
+    if(!self->words || !self->word_owners)
+        return NULL;
+    for(size_t i = 0; i < nlabels; i++){
+        for(uint32_t j = self->offsets[i]; self->text[j]; j++){
+            if(search_index_is_alnum(self->text[j])
+               && (j == self->offsets[i] || !search_index_is_alnum(self->text[j-1])))
+                self->words[self->nwords++] = j;
+        }
+    }
+    sort_text = self->text;
+    qsort(self->words, self->nwords, sizeof(uint32_t), search_index_word_cmp);
+    sort_text = NULL;
+    for(size_t i = 0; i < self->nwords; i++)
+        self->word_owners[i] = search_index_owner(self, self->words[i]);
+
+    /* Bigram and trigram posting lists, counting sort: sizes first,
+     * then fill. Labels are walked in order so that lists are sorted
+     * and duplicates can be spotted by looking at the last id.*/
+    cursor = malloc(sizeof(uint32_t) * SEARCH_GRAMS);
+    if(!cursor)
+        return NULL;
+    memset(cursor, 0xff, sizeof(uint32_t) * SEARCH_GRAMS);
+    for(size_t i = 0; i < nlabels; i++){
+        for(p = self->text + self->offsets[i]; p[0] && p[1]; p++){
+            for(int k = 0; k < 2; k++){
+                if(k && !p[2])
+                    break;
+                t = k ? search_index_trigram(p) : search_index_bigram(p);
+                if(cursor[t] != i){
+                    cursor[t] = i;
+                    self->gram_starts[t+1]++;
+                }
+            }
+        }
+    }
+    for(t = 0; t < SEARCH_GRAMS; t++)
+        self->gram_starts[t+1] += self->gram_starts[t];
+
+    self->postings = malloc(sizeof(uint32_t) * (self->gram_starts[SEARCH_GRAMS] ? self->gram_starts[SEARCH_GRAMS] : 1));
+    if(!self->postings){
+        free(cursor);
+        return NULL;
+    }
+    memcpy(cursor, self->gram_starts, sizeof(uint32_t) * SEARCH_GRAMS);
+    for(size_t i = 0; i < nlabels; i++){
+        for(p = self->text + self->offsets[i]; p[0] && p[1]; p++){
+            for(int k = 0; k < 2; k++){
+                if(k && !p[2])
+                    break;
+                t = k ? search_index_trigram(p) : search_index_bigram(p);
+                if(cursor[t] > self->gram_starts[t] && self->postings[cursor[t]-1] == i)
+                    continue;
+                self->postings[cursor[t]++] = i;
+            }
+        }
+    }
+    free(cursor);
+
+    return self;
+}
+
+/**
+ * @brief Makes a queryable index out of an index built elsewhere, e.g.
+ * stored in a mapped file (see nav-db.h). The index arrays are used in
+ * place, only the query state is allocated.
+ *
+ * @param self a SearchIndex
+ * @param index The index to use. Only the index fields are read, they
+ * must outlive @p self.
+ * @return @p self on success, NULL on failure. Call
+ * search_index_dispose in both cases.
+ */
+SearchIndex *search_index_init_from(SearchIndex *self, const SearchIndex *index)
+{
+    *self = (SearchIndex){
+        .nentries = index->nentries,
+        .text = index->text,
+        .offsets = index->offsets,
+        .masks = index->masks,
+        .words = index->words,
+        .word_owners = index->word_owners,
+        .nwords = index->nwords,
+        .gram_starts = index->gram_starts,
+        .postings = index->postings,
+        .borrowed = true
+    };
+    if(!search_index_alloc_state(self))
+        return NULL;
+    return self;
+}
+
+void search_index_dispose(SearchIndex *self)
+{
+    if(self->borrowed)
+        goto state;
+    if(self->text)
+        free(self->text);
+    if(self->offsets)
+        free(self->offsets);
+    if(self->masks)
+        free(self->masks);
+    if(self->words)
+        free(self->words);
+    if(self->word_owners)
+        free(self->word_owners);
+    if(self->gram_starts)
+        free(self->gram_starts);
+    if(self->postings)
+        free(self->postings);
+state:
+    if(self->results)
+        free(self->results);
+    if(self->candidates)
+        free(self->candidates);
+    if(self->stamps)
+        free(self->stamps);
+}
+
+/*First word in [lo, hi[ for which strncmp(word, query, len) >= 0 (or > 0 if @p after)*/
+static size_t search_index_word_bound(SearchIndex *self, const char *query, size_t len, bool after)
+{
+    size_t lo, hi, mid;
+    int cmp;
+
+    lo = 0;
+    hi = self->nwords;
+    while(lo < hi){
+        mid = lo + (hi - lo)/2;
+        cmp = strncmp(self->text + self->words[mid], query, len);
+        if(cmp < 0 || (after && cmp == 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*Whether label @p id holds @p query, @p mask being the query's*/
+static inline bool search_index_match(SearchIndex *self, uint32_t id, const char *query, size_t len, uint64_t mask)
+{
+    const char *p;
+
+    if((self->masks[id] & mask) != mask)
+        return false;
+    if(len == 1 && search_index_class(query[0]) < 39) /*the mask tells it all*/
+        return true;
+    for(p = self->text + self->offsets[id]; (p = strchr(p, query[0])); p++){
+        if(!strncmp(p, query, len))
+            return true;
+    }
+    return false;
+}
+
+/*Trigram of @p query having the shortest posting list*/
+static uint32_t search_index_rarest_trigram(SearchIndex *self, const char *query, size_t len)
+{
+    uint32_t t, best;
+
+    best = search_index_trigram(query);
+    for(size_t i = 1; i + 2 < len; i++){
+        t = search_index_trigram(query + i);
+        if(self->gram_starts[t+1] - self->gram_starts[t] < self->gram_starts[best+1] - self->gram_starts[best])
+            best = t;
+    }
+    return best;
+}
+
+/**
+ * @brief Finds the labels that contain @p query, case-insensitively.
+ *
+ * Labels having a word that starts with @p query come first, in word
+ * order. Then come the other ones, in label order.
+ *
+ * @param self a SearchIndex
+ * @param query The text to look for, NULL or empty for all labels (in
+ * label order). Only the first SEARCH_MAX_QUERY-1 characters are used.
+ * @param results Set to the label indexes found, valid until the next
+ * query.
+ * @return The number of labels found
+ */
+size_t search_index_query(SearchIndex *self, const char *query, const uint32_t **results)
+{
+    char q[SEARCH_MAX_QUERY];
+    size_t len, lastlen, nfrom, ncandidates, lo, hi;
+    uint32_t match, prefix, id, t;
+    const uint32_t *from;
+    uint64_t mask;
+    bool sorted;
+
+    *results = self->results;
+
+    len = 0;
+    if(query){
+        for(; query[len] && len < SEARCH_MAX_QUERY - 1; len++)
+            q[len] = tolower((unsigned char)query[len]);
+    }
+    q[len] = '\0';
+    mask = 0;
+    for(size_t i = 0; i < len; i++)
+        mask |= 1ull << search_index_class(q[i]);
+
+    if(!len){
+        for(size_t i = 0; i < self->nentries; i++)
+            self->results[i] = i;
+        self->nresults = self->nentries;
+        self->has_last = false;
+        return self->nresults;
+    }
+    if(self->has_last && !strcmp(q, self->last))
+        return self->nresults;
+
+    /* Stamps tell, for each label, whether it matches the current query
+     * (match) and has already been put in the results (prefix). Using
+     * the generation saves clearing them on each query.*/
+    self->generation += 2;
+    if(self->generation < 2){ /*wrapped*/
+        memset(self->stamps, 0, sizeof(uint32_t) * self->nentries);
+        self->generation = 2;
+    }
+    match = self->generation;
+    prefix = self->generation + 1;
+
+    /* Labels to check: all of them (from == NULL), or those of the
+     * bigram/rarest trigram, or the previous results if the query has
+     * only got longer and they are fewer.*/
+    from = NULL;
+    nfrom = self->nentries;
+    sorted = true;
+    if(len >= 2){
+        t = (len == 2) ? search_index_bigram(q) : search_index_rarest_trigram(self, q, len);
+        from = self->postings + self->gram_starts[t];
+        nfrom = self->gram_starts[t+1] - self->gram_starts[t];
+    }
+    lastlen = self->has_last ? strlen(self->last) : 0;
+    if(lastlen && !strncmp(q, self->last, lastlen) && self->nresults < nfrom){
+        from = self->results;
+        nfrom = self->nresults;
+        sorted = false;
+    }
+
+    ncandidates = 0;
+    for(size_t i = 0; i < nfrom; i++){
+        id = from ? from[i] : i;
+        if(search_index_match(self, id, q, len, mask)){
+            self->stamps[id] = match;
+            self->candidates[ncandidates++] = id;
+        }
+    }
+    strcpy(self->last, q);
+    self->has_last = true;
+
+    /*Word prefix hits first*/
+    self->nresults = 0;
+    lo = search_index_word_bound(self, q, len, false);
+    hi = search_index_word_bound(self, q, len, true);
+    for(size_t i = lo; i < hi; i++){
+        id = self->word_owners[i];
+        if(self->stamps[id] == match){
+            self->stamps[id] = prefix;
+            self->results[self->nresults++] = id;
+        }
+    }
+
+    /*Then the others, in label order*/
+    if(!sorted && ncandidates > self->nentries / 8){
+        for(id = 0; id < self->nentries; id++){
+            if(self->stamps[id] == match)
+                self->results[self->nresults++] = id;
+        }
+    }else{
+        if(!sorted)
+            qsort(self->candidates, ncandidates, sizeof(uint32_t), search_index_id_cmp);
+        for(size_t i = 0; i < ncandidates; i++){
+            if(self->stamps[self->candidates[i]] == match)
+                self->results[self->nresults++] = self->candidates[i];
+        }
+    }
+
+    return self->nresults;
+}
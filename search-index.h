@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Case-insensitive substring search over a fixed set of labels (e.g.
+ * "LFPG - Paris Charles de Gaulle"), built once.
+ *
+ * Results come in two groups: labels having a word that starts with
+ * the query (found by a binary search in the sorted array of all words),
+ * then the other labels that contain the query, in label order.
+ *
+ * Queries of 3 characters and more look up the shortest posting list
+ * of their trigrams and only check the labels it lists, 2 characters
+ * queries use their bigram list and single characters go through all
+ * labels. When the query only gets characters appended, which is what
+ * typing does, the previous results are narrowed down instead, unless
+ * a posting list is shorter.
+ *
+ * Each label also has a mask of the characters it holds, checked
+ * before looking for the query in the label itself: most labels that
+ * can't match are skipped without touching their text.
+ */
+#define SEARCH_MAX_QUERY 64
+#define SEARCH_GRAMS (1 << 18) /*3 x 6 bits character classes, bigrams have a 0 class first*/
+
+typedef struct{
+    size_t nentries;
+
+    char *text; /*lowercased labels, each one \0-terminated*/
+    uint32_t *offsets; /*label i starts at text + offsets[i], nentries + 1 of them*/
+    uint64_t *masks; /*per label, bit n set if it has a character of class n*/
+
+    uint32_t *words; /*offsets of all word starts, sorted by word*/
+    uint32_t *word_owners; /*label of each word*/
+    size_t nwords;
+
+    uint32_t *gram_starts; /*posting list of gram g: postings[gram_starts[g]..gram_starts[g+1][*/
+    uint32_t *postings; /*label indexes, ascending in each list*/
+    bool borrowed; /*index arrays belong to someone else, see search_index_init_from*/
+
+    /*Query state*/
+    uint32_t *results;
+    size_t nresults;
+    uint32_t *candidates;
+    uint32_t *stamps; /*per label, see search_index_query*/
+    uint32_t generation;
+    char last[SEARCH_MAX_QUERY];
+    bool has_last;
+}SearchIndex;
+
+SearchIndex *search_index_init(SearchIndex *self, char **labels, size_t nlabels);
+SearchIndex *search_index_init_from(SearchIndex *self, const SearchIndex *index);
+void search_index_dispose(SearchIndex *self);
+
+size_t search_index_query(SearchIndex *self, const char *query, const uint32_t **results);
+#endif /* SEARCH_INDEX_H */
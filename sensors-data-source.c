@@ -21,6 +21,7 @@
 #endif
 
 static bool sensors_data_source_frame(SensorsDataSource *self, uint32_t dt);
+static void sensors_data_source_gps_fix(SensorsDataSource *self);
 static SensorsDataSource *sensors_data_source_dispose(SensorsDataSource *self);
 static DataSourceOps sensors_data_source_ops = {
     .frame = (DataSourceFrameFunc)sensors_data_source_frame,
@@ -59,6 +60,8 @@ SensorsDataSource *sensors_data_source_init(SensorsDataSource *self)
     }
 
 #if !ENABLE_MOCK_GPS
+    self->gps.on_fix = (GpsFixFunc)sensors_data_source_gps_fix;
+    self->gps.on_fix_target = self;
     gps_sensor_start(&self->gps);
 #else
     data_source_set_location(
@@ -80,6 +83,12 @@ SensorsDataSource *sensors_data_source_init(SensorsDataSource *self)
     return self;
 }
 
+/*GPS worker thread: new position, don't wait for the next frame to show it*/
+static void sensors_data_source_gps_fix(SensorsDataSource *self)
+{
+    data_source_wake(DATA_SOURCE(self));
+}
+
 static SensorsDataSource *sensors_data_source_dispose(SensorsDataSource *self)
 {
     bno080_dispose(&self->imu);
@@ -58,6 +58,7 @@ GpsSensor *gps_sensor_init(GpsSensor *self, const char *server, const char *port
 
     self->timeout = 5;      /* seconds */
     self->latitude = NAN;
+    self->on_fix = NULL;
 
     pthread_mutex_init(&self->mtx, NULL);
 
@@ -124,6 +125,8 @@ static void gps_sensor_set_fix(GpsSensor *self)
     );
 #endif
     pthread_mutex_unlock(&self->mtx);
+    if(self->on_fix)
+        self->on_fix(self->on_fix_target);
 }
 
 /*loosly modeled after gpsd's gps_mainloop*/
@@ -12,6 +12,8 @@
 
 #include <gps.h>
 
+typedef void (*GpsFixFunc)(void *target);
+
 typedef struct{
     struct gps_data_t gpsdata;
     time_t timeout;
@@ -22,6 +24,10 @@ typedef struct{
     double latitude;
     double longitude;
     double altitude;
+
+    /*Called from the worker thread on each new fix, can be NULL*/
+    GpsFixFunc on_fix;
+    void *on_fix_target;
 }GpsSensor;
 
 GpsSensor *gps_sensor_new(const char *server, const char *port);
@@ -22,8 +22,8 @@
 
 
 /**
- * @brief Sets the value either direcly or triggering a standard
- * duration animation.
+ * @brief Sets the value either direcly or through a spring animation.
+ * Values set while the animation runs only move its target.
  *
  * Intented to be called be derivatives if wrapping is needed or
  * by client code if the derived class doesn't provide a specific
@@ -47,8 +47,10 @@ bool sfv_gauge_set_value(SfvGauge *self, float value, bool animated)
         }else{
             animation = BASE_GAUGE(self)->animations[0];
         }
-        base_animation_start(animation, self->value, value, DEFAULT_DURATION);
+        base_animation_spring_to(animation, value);
     }else{
+        if(BASE_GAUGE(self)->nanimations > 0)
+            base_animation_stop(BASE_GAUGE(self)->animations[0]);
         if(value != self->value){
             self->value = value;
             BASE_GAUGE(self)->dirty = true;
@@ -95,8 +95,10 @@ bool tape_gauge_set_value(TapeGauge *self, float value, bool animated)
         }else{
             animation = BASE_GAUGE(self)->animations[0];
         }
-        base_animation_start(animation, SFV_GAUGE(self->ladder)->value, value, DEFAULT_DURATION);
+        base_animation_spring_to(animation, value);
     }else{
+        if(BASE_GAUGE(self)->nanimations > 0)
+            base_animation_stop(BASE_GAUGE(self)->animations[0]);
         ladder_gauge_set_value(self->ladder, value, false);
         odo_gauge_set_value(self->odo, value, false);
         BASE_GAUGE(self)->dirty = true;
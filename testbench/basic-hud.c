@@ -11,6 +11,7 @@
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
 
+#include "animation-scheduler.h"
 #include "base-gauge.h"
 #include "basic-hud.h"
 #include "data-source.h"
@@ -208,6 +209,7 @@ int main(int argc, char **argv)
         acc += elapsed;
 
         done = handle_events(elapsed);
+        animation_scheduler_step(elapsed);
 
         /* Not having this in the loop breaks ladder-gauge display
          * TODO: Check why and fix
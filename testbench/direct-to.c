@@ -16,6 +16,7 @@
 #include "base-widget.h"
 #include "direct-to-dialog.h"
 #include "mock-data-source.h"
+#include "nav-db.h"
 
 
 #define SCREEN_WIDTH 640
@@ -128,6 +129,8 @@ int main(int argc, char **argv)
     SDL_FillRect(screenSurface, NULL, SDL_UFBLUE(screenSurface));
 #endif
 
+    if(!nav_db_open(NAVDATA_FILE))
+        printf("No navigation database, see make navdata\n");
     direct = direct_to_dialog_new();
     SDL_Rect direct_rect ={
         640/2,
@@ -174,6 +177,7 @@ int main(int argc, char **argv)
     }while(!done);
 
     base_gauge_free(BASE_GAUGE(direct));
+    nav_db_close();
     resource_manager_shutdown();
     data_source_free(data_source_get_instance());
 #if USE_SDL_GPU
@@ -169,7 +169,7 @@ int main(int argc, char **argv)
     data_source_set((DataSource*)mock_data_source_new());
 
     map = map_gauge_new(128,128);
-    map->level = 7;
+    map_gauge_set_level(map, 7);
 //    map_gauge_set_marker_position(map, 45.21749913, 5.84249663);
     map_gauge_set_marker_position(map, 43.32066538, 3.35199859);
     map_gauge_center_on_marker(map, true);
@@ -17,6 +17,7 @@
 #include "base-gauge.h"
 #include "generic-layer.h"
 #include "text-gauge.h"
+#include "glyph-run-cache.h"
 #include "sdl-colors.h"
 #include "misc.h"
 
@@ -205,14 +206,10 @@ bool text_gauge_set_value_formatn(TextGauge *self, size_t size, const char *fmt,
 static inline void text_gauge_static_font_update_state(TextGauge *self, Uint32 dt)
 {
     SDL_Rect farea;
-    SDL_Rect glyph, cursor;
-    PCF_StaticFont *sfont;
 
     if(!self->state.chars)
         return;
 
-    sfont = self->font.static_font;
-
     farea = (SDL_Rect){
         .x = 0,
         .y = 0,
@@ -220,12 +217,10 @@ static inline void text_gauge_static_font_update_state(TextGauge *self, Uint32 d
         .h = base_gauge_h(BASE_GAUGE(self))
     };
 
-    PCF_StaticFontGetSizeRequestRect(sfont, self->value, true, &cursor);
-    SDLExt_RectAlign(&cursor, &farea, self->alignment);
-    self->state.nchars = PCF_StaticFontPreWriteString(sfont,
-        self->len, self->value,
-        true, &cursor,
-        self->state.achars, self->state.chars
+    self->state.nchars = glyph_run_cache_layout(self->font.static_font,
+        self->value, self->len,
+        true, &farea, self->alignment,
+        self->state.chars, self->state.achars
     );
 }
 
@@ -270,13 +265,10 @@ static inline void text_gauge_static_font_render(TextGauge *self, Uint32 dt,
     if(self->outlined)
         base_gauge_draw_outline(BASE_GAUGE(self), ctx, &SDL_WHITE, NULL);
 
-    for(int i = 0; i < self->state.nchars; i++){
-        base_gauge_draw_static_font_patch(BASE_GAUGE(self),
-            ctx,
-            self->font.static_font,
-            &self->state.chars[i]
-        );
-    }
+    base_gauge_draw_static_font_patches(BASE_GAUGE(self), ctx,
+        self->font.static_font,
+        self->state.chars, self->state.nchars
+    );
 }
 
 static inline void text_gauge_regular_font_render(TextGauge *self, Uint32 dt,
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Runs the startup asset generators once and saves their output as an
+ * asset blob (see asset-blob.h): all gauge images, converted to RGBA32,
+ * and the airspeed/altitude ladder pages over the given ranges. SoFIS
+ * maps the blob at startup instead of decoding and drawing all of that.
+ *
+ * Built with the software path (USE_SDL_GPU=0) by `make sofis-bake`,
+ * as pages must keep their canvas to be saved.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include <SDL2/SDL.h>
+
+#include "airspeed-indicator.h"
+#include "alt-group.h"
+#include "asset-blob.h"
+#include "basic-hud.h"
+#include "generic-layer.h"
+#include "ladder-page.h"
+#include "res-dirs.h"
+#include "resource-manager.h"
+
+#define DEFAULT_MAX_SPEED 300 /*kts*/
+#define DEFAULT_MIN_ALT -1000 /*ft*/
+#define DEFAULT_MAX_ALT 20000 /*ft*/
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-o blob] [-s max_speed] [-a min_alt] [-A max_alt]\n", progname);
+}
+
+static size_t bake_images(const char *dirname)
+{
+    struct dirent *entry;
+    GenericLayer layer;
+    char filename[512];
+    size_t len, rv;
+    DIR *dir;
+
+    dir = opendir(dirname);
+    if(!dir){
+        printf("Couldn't open %s\n", dirname);
+        return 0;
+    }
+    rv = 0;
+    while((entry = readdir(dir))){
+        len = strlen(entry->d_name);
+        if(len < 4 || strcmp(entry->d_name + len - 4, ".png"))
+            continue;
+        /*Same path as the gauges use, it's the asset name*/
+        snprintf(filename, sizeof(filename), "%s/%s", dirname, entry->d_name);
+        layer = (GenericLayer){0};
+        if(generic_layer_init_from_file(&layer, filename))
+            rv++;
+        generic_layer_dispose(&layer);
+    }
+    closedir(dir);
+
+    return rv;
+}
+
+static size_t bake_pages(LadderPageDescriptor *descriptor, float from, float to)
+{
+    LadderPage *page;
+    int first, last;
+
+    first = floorf(from / descriptor->page_size);
+    last = ceilf(to / descriptor->page_size);
+    for(int i = first; i <= last; i++){
+        page = ladder_page_descriptor_create_page(descriptor, i);
+        if(page)
+            ladder_page_free(page);
+    }
+
+    return last - first + 1;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    const char *output = BAKE_FILE;
+    float max_speed = DEFAULT_MAX_SPEED;
+    float min_alt = DEFAULT_MIN_ALT;
+    float max_alt = DEFAULT_MAX_ALT;
+    BasicHud *hud;
+    size_t nimages, npages;
+
+    while((opt = getopt(argc, argv, "o:s:a:A:h")) != -1){
+        switch(opt){
+            case 'o': output = optarg; break;
+            case 's': max_speed = atof(optarg); break;
+            case 'a': min_alt = atof(optarg); break;
+            case 'A': max_alt = atof(optarg); break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(max_speed <= 0 || max_alt <= min_alt){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if(SDL_Init(SDL_INIT_VIDEO) < 0){
+        printf("Couldn't init SDL: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    asset_blob_record_start();
+
+    nimages = bake_images(IMG_DIR);
+    /*Builds the ladder descriptors exactly as SoFIS does*/
+    hud = basic_hud_new();
+    if(!hud){
+        printf("Couldn't create the PFD, bailing out\n");
+        exit(EXIT_FAILURE);
+    }
+    npages = bake_pages(hud->airspeed->tape->ladder->descriptor, 0, max_speed);
+    npages += bake_pages(hud->altgroup->altimeter->tape->ladder->descriptor, min_alt, max_alt);
+
+    if(!asset_blob_record_save(output))
+        exit(EXIT_FAILURE);
+    printf("Baked %zu images and %zu ladder pages into %s\n", nimages, npages, output);
+
+    base_gauge_free(BASE_GAUGE(hud));
+    resource_manager_shutdown();
+    SDL_Quit();
+
+    return 0;
+}
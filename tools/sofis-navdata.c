@@ -0,0 +1,364 @@
+/*
+ * SPDX-FileCopyrightText: 2021 Samuel Cuella <samuel.cuella@gmail.com>
+ *
+ * This file is part of SoFIS - an open source EFIS
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+/*
+ * Converts airport CSV files into a navigation database (see nav-db.h)
+ * that SoFIS maps at startup.
+ *
+ * Columns are found by their name in the header line, which makes
+ * OurAirports' airports.csv work as is, as well as OpenAIP or hand-made
+ * exports using the same names:
+ *  - code: ident, icao, icao_code or code
+ *  - name: name
+ *  - latitude: latitude_deg, latitude or lat (decimal degrees)
+ *  - longitude: longitude_deg, longitude or lon (decimal degrees)
+ *  - elevation (optional): elevation_ft, elevation or elev (feet)
+ *  - type (optional): type, OurAirports values. Closed ones are skipped.
+ *  - country (optional): iso_country or country, see -c
+ *
+ * When several files have the same code, the first one wins.
+ *
+ * Built by `make navdata`.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "nav-db.h"
+
+#define ALLOC_CHUNK 1024
+#define MAX_FIELDS 64
+
+typedef enum{
+    COL_CODE,
+    COL_NAME,
+    COL_LATITUDE,
+    COL_LONGITUDE,
+    COL_ELEVATION,
+    COL_TYPE,
+    COL_COUNTRY,
+    N_COLS
+}Column;
+
+static const char *column_names[N_COLS][5] = {
+    [COL_CODE] = {"ident", "icao", "icao_code", "code", NULL},
+    [COL_NAME] = {"name", NULL},
+    [COL_LATITUDE] = {"latitude_deg", "latitude", "lat", NULL},
+    [COL_LONGITUDE] = {"longitude_deg", "longitude", "lon", NULL},
+    [COL_ELEVATION] = {"elevation_ft", "elevation", "elev", NULL},
+    [COL_TYPE] = {"type", NULL},
+    [COL_COUNTRY] = {"iso_country", "country", NULL}
+};
+
+static const char *type_names[N_NAV_AIRPORT_TYPES] = {
+    [NAV_AIRPORT_UNKNOWN] = "",
+    [NAV_AIRPORT_SMALL] = "small_airport",
+    [NAV_AIRPORT_MEDIUM] = "medium_airport",
+    [NAV_AIRPORT_LARGE] = "large_airport",
+    [NAV_AIRPORT_HELIPORT] = "heliport",
+    [NAV_AIRPORT_SEAPLANE] = "seaplane_base"
+};
+
+typedef struct{
+    NavAirport record;
+    char *code;
+    char *name;
+    size_t order; /*reading order*/
+}Entry;
+
+typedef struct{
+    Entry *entries;
+    size_t nentries;
+    size_t aentries;
+
+    char *strings;
+    size_t nstrings;
+    size_t astrings;
+}Converter;
+
+static void usage(const char *progname)
+{
+    printf("Usage: %s [-o output] [-c country] file.csv...\n", progname);
+}
+
+/* Splits a CSV record in place. Quoted fields can hold commas and
+ * doubled quotes, not line breaks.*/
+static size_t split_record(char *line, char **fields, size_t max)
+{
+    size_t rv;
+    char *r, *w;
+    bool quoted;
+
+    rv = 0;
+    r = line;
+    while(rv < max){
+        fields[rv++] = w = r;
+        quoted = (*r == '"');
+        if(quoted)
+            r++;
+        for(; *r; r++){
+            if(quoted && *r == '"'){
+                if(r[1] == '"'){
+                    *w++ = '"';
+                    r++;
+                    continue;
+                }
+                quoted = false;
+                continue;
+            }
+            if(!quoted && (*r == ',' || *r == '\n' || *r == '\r'))
+                break;
+            *w++ = *r;
+        }
+        if(*r != ','){
+            *w = '\0';
+            break;
+        }
+        *w = '\0';
+        r++;
+    }
+    return rv;
+}
+
+static NavAirportType parse_type(const char *type)
+{
+    for(int i = 1; i < N_NAV_AIRPORT_TYPES; i++){
+        if(!strcmp(type, type_names[i]))
+            return i;
+    }
+    return NAV_AIRPORT_UNKNOWN;
+}
+
+static bool converter_add(Converter *self, Entry *entry)
+{
+    void *tmp;
+
+    if(self->nentries == self->aentries){
+        tmp = realloc(self->entries, sizeof(Entry) * (self->aentries + ALLOC_CHUNK));
+        if(!tmp)
+            return false;
+        self->entries = tmp;
+        self->aentries += ALLOC_CHUNK;
+    }
+    self->entries[self->nentries++] = *entry;
+    return true;
+}
+
+/*Appends @p len bytes of @p str and a \0 to the pool, returns the offset*/
+static uint32_t converter_intern(Converter *self, const char *str, size_t len, bool *ok)
+{
+    size_t needed;
+    uint32_t rv;
+    void *tmp;
+
+    needed = self->nstrings + len + 1;
+    if(needed > UINT32_MAX){
+        *ok = false;
+        return 0;
+    }
+    if(needed > self->astrings){
+        tmp = realloc(self->strings, needed + ALLOC_CHUNK * 64);
+        if(!tmp){
+            *ok = false;
+            return 0;
+        }
+        self->strings = tmp;
+        self->astrings = needed + ALLOC_CHUNK * 64;
+    }
+    rv = self->nstrings;
+    memcpy(self->strings + self->nstrings, str, len);
+    self->strings[self->nstrings + len] = '\0';
+    self->nstrings = needed;
+    return rv;
+}
+
+static bool converter_read(Converter *self, const char *filename, const char *country)
+{
+    char *line = NULL;
+    size_t len = 0;
+    char *fields[MAX_FIELDS];
+    int cols[N_COLS];
+    size_t nfields, nread, nskipped;
+    Entry entry;
+    FILE *fp;
+    bool rv;
+
+    fp = fopen(filename, "r");
+    if(!fp){
+        printf("Couldn't open %s\n", filename);
+        return false;
+    }
+    rv = false;
+
+    if(getline(&line, &len, fp) < 0){
+        printf("%s: empty file\n", filename);
+        goto out;
+    }
+    /*Skip the UTF-8 BOM some exports start with*/
+    nfields = split_record(strncmp(line, "\xEF\xBB\xBF", 3) ? line : line + 3, fields, MAX_FIELDS);
+    for(int c = 0; c < N_COLS; c++){
+        cols[c] = -1;
+        for(size_t f = 0; f < nfields && cols[c] < 0; f++){
+            for(int k = 0; column_names[c][k]; k++){
+                if(!strcasecmp(fields[f], column_names[c][k])){
+                    cols[c] = f;
+                    break;
+                }
+            }
+        }
+    }
+    if(cols[COL_CODE] < 0 || cols[COL_NAME] < 0 || cols[COL_LATITUDE] < 0 || cols[COL_LONGITUDE] < 0){
+        printf("%s: needs code, name, latitude and longitude columns\n", filename);
+        goto out;
+    }
+    if(country && cols[COL_COUNTRY] < 0){
+        printf("%s: no country column, can't filter on %s\n", filename, country);
+        goto out;
+    }
+
+    nread = nskipped = 0;
+    while(getline(&line, &len, fp) >= 0){
+        nfields = split_record(line, fields, MAX_FIELDS);
+        for(int c = 0; c < N_COLS; c++){
+            if(cols[c] >= (int)nfields)
+                goto skip;
+        }
+        if(!*fields[cols[COL_CODE]])
+            goto skip;
+        if(country && strcasecmp(fields[cols[COL_COUNTRY]], country))
+            continue;
+        if(cols[COL_TYPE] >= 0 && !strcmp(fields[cols[COL_TYPE]], "closed"))
+            continue;
+
+        entry = (Entry){
+            .record = (NavAirport){
+                .latitude = strtod(fields[cols[COL_LATITUDE]], NULL),
+                .longitude = strtod(fields[cols[COL_LONGITUDE]], NULL),
+                .elevation = cols[COL_ELEVATION] >= 0 ? atoi(fields[cols[COL_ELEVATION]]) : 0,
+                .type = cols[COL_TYPE] >= 0 ? parse_type(fields[cols[COL_TYPE]]) : NAV_AIRPORT_UNKNOWN
+            },
+            .code = strdup(fields[cols[COL_CODE]]),
+            .name = strdup(fields[cols[COL_NAME]]),
+            .order = self->nentries
+        };
+        if(!entry.code || !entry.name || !converter_add(self, &entry)){
+            printf("%s: out of memory\n", filename);
+            free(entry.code);
+            free(entry.name);
+            goto out;
+        }
+        nread++;
+        continue;
+skip:
+        nskipped++;
+    }
+    printf("%s: %zu airports, %zu invalid lines skipped\n", filename, nread, nskipped);
+    rv = true;
+
+out:
+    free(line);
+    fclose(fp);
+    return rv;
+}
+
+/*By code, then by reading order to keep the first of duplicates*/
+static int entry_cmp(const void *a, const void *b)
+{
+    const Entry *ea = a;
+    const Entry *eb = b;
+    int rv;
+
+    rv = strcmp(ea->code, eb->code);
+    if(rv)
+        return rv;
+    return (ea->order > eb->order) - (ea->order < eb->order);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    const char *output = NAVDATA_FILE;
+    const char *country = NULL;
+    Converter conv = {0};
+    NavAirport *records;
+    Entry *entry;
+    char *label;
+    size_t nrecords, len;
+    bool ok;
+    int rv;
+
+    while((opt = getopt(argc, argv, "o:c:h")) != -1){
+        switch(opt){
+            case 'o': output = optarg; break;
+            case 'c': country = optarg; break;
+            default:
+                usage(argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if(optind >= argc){
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    rv = EXIT_FAILURE;
+    records = NULL;
+    for(int i = optind; i < argc; i++){
+        if(!converter_read(&conv, argv[i], country))
+            goto out;
+    }
+    /*Stable on reading order, see entry_cmp*/
+    qsort(conv.entries, conv.nentries, sizeof(Entry), entry_cmp);
+
+    records = malloc(sizeof(NavAirport) * (conv.nentries ? conv.nentries : 1));
+    if(!records){
+        printf("Out of memory\n");
+        goto out;
+    }
+    ok = true;
+    nrecords = 0;
+    for(size_t i = 0; i < conv.nentries && ok; i++){
+        entry = &conv.entries[i];
+        if(nrecords && !strcmp(entry->code, conv.entries[i-1].code))
+            continue;
+        records[nrecords] = entry->record;
+        /*The name is the end of the label*/
+        len = strlen(entry->code);
+        if(asprintf(&label, "%s - %s", entry->code, entry->name) < 0){
+            ok = false;
+            break;
+        }
+        records[nrecords].label = converter_intern(&conv, label, strlen(label), &ok);
+        records[nrecords].label_len = strlen(label);
+        records[nrecords].name = records[nrecords].label + len + 3;
+        records[nrecords].code = converter_intern(&conv, entry->code, len, &ok);
+        free(label);
+        nrecords++;
+    }
+    if(!ok){
+        printf("Out of memory or too many strings\n");
+        goto out;
+    }
+
+    if(!nav_db_write(output, records, nrecords, conv.strings, conv.nstrings))
+        goto out;
+    printf("Wrote %zu airports to %s\n", nrecords, output);
+    rv = EXIT_SUCCESS;
+
+out:
+    for(size_t i = 0; i < conv.nentries; i++){
+        free(conv.entries[i].code);
+        free(conv.entries[i].name);
+    }
+    free(conv.entries);
+    free(conv.strings);
+    free(records);
+    return rv;
+}
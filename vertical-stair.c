@@ -14,6 +14,7 @@
 #include "base-gauge.h"
 #include "generic-layer.h"
 #include "vertical-stair.h"
+#include "glyph-run-cache.h"
 #include "resource-manager.h"
 #include "sdl-colors.h"
 #include "misc.h"
@@ -107,19 +108,17 @@ static void vertical_stair_update_state(VerticalStair *self, Uint32 dt)
         generic_layer_h(&self->cursor)
     };
 
-    PCF_StaticFontGetSizeRequestRect(self->font, number, false, &self->state.tloc);
-    SDLExt_RectAlign(&self->state.tloc,
-        &self->state.cloc,
-        HALIGN_LEFT | VALIGN_MIDDLE
-    );
-    self->state.tloc.x += self->font->metrics.characterWidth;
-
-    SDL_Rect glyph, cursor;
-    cursor = self->state.tloc;
-    self->state.nchars = PCF_StaticFontPreWriteString(self->font,
-        len, number,
-        false, &cursor,
-        VS_VALUE_MAX_LEN-1, self->state.chars
+    /*Left-aligned in the cursor, one char away from its left border*/
+    self->state.tloc = (SDL_Rect){
+        self->state.cloc.x + self->font->metrics.characterWidth,
+        self->state.cloc.y,
+        self->state.cloc.w - self->font->metrics.characterWidth,
+        self->state.cloc.h
+    };
+    self->state.nchars = glyph_run_cache_layout(self->font,
+        number, len,
+        false, &self->state.tloc, HALIGN_LEFT | VALIGN_MIDDLE,
+        self->state.chars, VS_VALUE_MAX_LEN-1
     );
 }
 
@@ -138,11 +137,8 @@ static void vertical_stair_render(VerticalStair *self, Uint32 dt, RenderContext
         &self->cursor, NULL, &self->state.cloc
     );
 
-    for(int i = 0; i < self->state.nchars; i++){
-        base_gauge_draw_static_font_patch(BASE_GAUGE(self),
-            ctx,
-            self->font,
-            &self->state.chars[i]
-        );
-    }
+    base_gauge_draw_static_font_patches(BASE_GAUGE(self), ctx,
+        self->font,
+        self->state.chars, self->state.nchars
+    );
 }
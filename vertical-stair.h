@@ -18,7 +18,7 @@
 
 typedef struct{
     SDL_Rect cloc; /*cursor location*/
-    SDL_Rect tloc; /*text location*/
+    SDL_Rect tloc; /*text area*/
 
     /* -1 because we don't need to render the \0*/
     PCF_StaticFontPatch chars[VS_VALUE_MAX_LEN-1];
@@ -74,6 +74,23 @@ ListBox *list_box_init(ListBox *self, FontResource font_id, int width, int heigh
             * self->state.apatches
         );
         printf("allocated %zu patches\n", self->state.apatches);
+    if(!self->state.patches)
+        return NULL;
+
+    /*Twice the visible rows: enough to scroll back and forth*/
+    self->state.line_apatches = nhchars+1;
+    self->state.nlines = 2 * (nvchars+1);
+    self->state.lines = calloc(self->state.nlines, sizeof(ListBoxLine));
+    if(!self->state.lines)
+        return NULL;
+    self->state.lines[0].patches = malloc(sizeof(PCF_StaticFontPatch)
+        * self->state.line_apatches * self->state.nlines
+    );
+    if(!self->state.lines[0].patches)
+        return NULL;
+    for(int i = 1; i < self->state.nlines; i++)
+        self->state.lines[i].patches = self->state.lines[0].patches + i * self->state.line_apatches;
+    self->state.generation = 1;
 
         self->sfont = resource_manager_get_static_font(font_id,
             &SDL_WHITE,
@@ -82,7 +99,6 @@ ListBox *list_box_init(ListBox *self, FontResource font_id, int width, int heigh
         );
         if(!self->sfont)
             return NULL;
-        PCF_StaticFontCreateTexture(self->sfont);
 
 
     BASE_GAUGE(self)->dirty = true;
@@ -96,6 +112,10 @@ static ListBox *list_box_dispose(ListBox *self)
         PCF_StaticFontUnref(self->sfont);
     if(self->state.patches)
         free(self->state.patches);
+    if(self->state.lines){
+        free(self->state.lines[0].patches);
+        free(self->state.lines);
+    }
     if(self->model)
         list_model_free(self->model);
     return self;
@@ -110,9 +130,14 @@ void list_box_set_model(ListBox *self, ListModel *model)
 
 void list_box_model_changed(ListBox *self)
 {
-    self->text_size.h = self->model->nrows * PCF_StaticFontCharHeight(self->sfont);
+    self->text_size.h = list_model_get_row_count(self->model) * PCF_StaticFontCharHeight(self->sfont);
     self->text_size.w = self->model->maxlen * PCF_StaticFontCharWidth(self->sfont);
 
+    /*Drops the laid out rows*/
+    self->state.generation++;
+    if(!self->state.generation)
+        self->state.generation++;
+
     self->selected_row = 0;
     self->state.selected_h = 0;
     self->state.selected_y = 0;
@@ -139,7 +164,7 @@ bool list_box_vertical_scroll(ListBox *self, int_fast8_t direction)
 
     old_selected = self->selected_row;
     if(direction > 0){
-        if(self->selected_row < self->model->nrows-1)
+        if(self->selected_row + 1 < list_model_get_row_count(self->model))
             self->selected_row++;
     }else if(direction < 0){
         if(self->selected_row > 0)
@@ -154,14 +179,65 @@ bool list_box_vertical_scroll(ListBox *self, int_fast8_t direction)
 }
 
 
+/**
+ * @brief Gets the laid out patches of a fully visible row from the
+ * cache, laying it out on a miss.
+ *
+ * @return The line, with patches placed as if the row was at the top of
+ * the list box
+ */
+static ListBoxLine *list_box_get_line(ListBox *self, size_t row)
+{
+    ListBoxState *state;
+    ListBoxLine *line, *victim;
+    const char *label;
+    size_t len;
+    bool fresh;
+
+    state = &(self->state);
+    state->clock++;
+    /* Any slot can hold the row: look at all of them before choosing a
+     * victim, stale slots first then the least recently used one*/
+    victim = NULL;
+    for(size_t i = 0; i < state->nlines; i++){
+        line = &state->lines[i];
+        fresh = line->generation == state->generation;
+        if(fresh && line->row == row && line->offset_x == state->offset.x){
+            line->last_used = state->clock;
+            return line;
+        }
+        if(!victim || (victim->generation == state->generation
+                       && (!fresh || line->last_used < victim->last_used)))
+            victim = line;
+    }
+
+    label = list_model_get_row_label(self->model, row, &len);
+    victim->npatches = PCF_StaticFontPreWriteStringOffset(
+        self->sfont,
+        len, label,
+        false,
+        &(SDL_Rect){0, 0, BASE_GAUGE(self)->frame.w, PCF_StaticFontCharHeight(self->sfont)},
+        state->offset.x * -1, 0,
+        state->line_apatches,
+        victim->patches
+    );
+    victim->row = row;
+    victim->offset_x = state->offset.x;
+    victim->generation = state->generation;
+    victim->last_used = state->clock;
+    return victim;
+}
+
 static void list_box_update(ListBox *self, Uint32 dt)
 {
     ListBoxState *state;
-    SDL_Rect glyph;
-    size_t current_height;
+    ListBoxLine *line;
+    const char *label;
+    size_t current_height, nrows, len;
 
     state = &(self->state);
-    if(self->model->nrows == 0){
+    nrows = list_model_get_row_count(self->model);
+    if(nrows == 0){
         state->npatches = 0;
         return;
     }
@@ -179,7 +255,7 @@ static void list_box_update(ListBox *self, Uint32 dt)
     ibegin_v = state->offset.y / PCF_StaticFontCharHeight(self->sfont);
     Uint32 endy = state->offset.y + (MIN(BASE_GAUGE(self)->frame.h, self->text_size.h)-1);
     iend_v = ceilf(endy*1.0f/PCF_StaticFontCharHeight(self->sfont));
-    iend_v = MIN(iend_v, self->model->nrows);
+    iend_v = MIN(iend_v, nrows);
 
     state->npatches = 0; /*TODO compute*/
     current_height = 0;
@@ -189,13 +265,6 @@ static void list_box_update(ListBox *self, Uint32 dt)
             PCF_StaticFontCharHeight(self->sfont),
             yremaining
         );
-        SDL_Rect tarea = {
-            0,0,
-            BASE_GAUGE(self)->frame.w,
-            BASE_GAUGE(self)->frame.h
-        };
-        tarea.y += current_height;
-        tarea.h = (BASE_GAUGE(self)->frame.h-1) - tarea.y + 1;
 
         int lyoffset = 0;
         if(y == ibegin_v){
@@ -203,16 +272,35 @@ static void list_box_update(ListBox *self, Uint32 dt)
         }
 
         size_t n_line_patches;
-        n_line_patches = PCF_StaticFontPreWriteStringOffset(
-            self->sfont,
-            self->model->row_lenghts[y],
-            self->model->rows[y].label,
-            false,
-            &tarea,
-            state->offset.x * -1, lyoffset * -1,
-            state->apatches - state->npatches,
-            state->patches + state->npatches
-        );
+        if(!lyoffset && line_height == PCF_StaticFontCharHeight(self->sfont)){
+            /*Fully visible: laid out once, moved in place*/
+            line = list_box_get_line(self, y);
+            n_line_patches = MIN(line->npatches, state->apatches - state->npatches);
+            for(int i = 0; i < n_line_patches; i++){
+                state->patches[state->npatches + i] = line->patches[i];
+                state->patches[state->npatches + i].dst.y += current_height;
+            }
+        }else{
+            SDL_Rect tarea = {
+                0,0,
+                BASE_GAUGE(self)->frame.w,
+                BASE_GAUGE(self)->frame.h
+            };
+            tarea.y += current_height;
+            tarea.h = (BASE_GAUGE(self)->frame.h-1) - tarea.y + 1;
+
+            label = list_model_get_row_label(self->model, y, &len);
+            n_line_patches = PCF_StaticFontPreWriteStringOffset(
+                self->sfont,
+                len,
+                label,
+                false,
+                &tarea,
+                state->offset.x * -1, lyoffset * -1,
+                state->apatches - state->npatches,
+                state->patches + state->npatches
+            );
+        }
 #if 0
         printf("Line %d patches:\n", y);
         for(int i = state->npatches; i < state->npatches + n_line_patches; i++){
@@ -257,14 +345,10 @@ static void list_box_render(ListBox *self, Uint32 dt, RenderContext *ctx)
 
     }
 
-    for(int i = 0; i < self->state.npatches; i++){
-        if(self->state.patches[i].src.x < 0) continue;
-
-        base_gauge_draw_static_font_rect_patch(BASE_GAUGE(self), ctx,
-            self->sfont,
-            &self->state.patches[i]
-        );
-    }
+    base_gauge_draw_static_font_rect_patches(BASE_GAUGE(self), ctx,
+        self->sfont,
+        self->state.patches, self->state.npatches
+    );
 
     base_widget_draw_outline(BASE_WIDGET(self), ctx);
 }
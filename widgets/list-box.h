@@ -21,6 +21,19 @@ typedef struct{
 }SDLExt_UPoint;
 #endif
 
+/* A row laid out as if it was at the top of the list box. Fully
+ * visible rows are kept in a small LRU so that scrolling only lays out
+ * the rows coming into view.*/
+typedef struct{
+    size_t row;
+    Uint32 offset_x;
+    Uint32 generation; /*of the model contents, 0 when unused*/
+    Uint32 last_used;
+
+    PCF_StaticFontPatch *patches;
+    size_t npatches;
+}ListBoxLine;
+
 typedef struct{
     PCF_StaticFontPatch *patches;
     size_t apatches;
@@ -29,6 +42,12 @@ typedef struct{
     Uint32 selected_h;
 
     SDLExt_UPoint offset; /*offset in the virtual rectangle*/
+
+    ListBoxLine *lines;
+    size_t nlines;
+    size_t line_apatches; /*patches of each line*/
+    Uint32 generation; /*bumped when the model changes*/
+    Uint32 clock;
 }ListBoxState;
 
 typedef struct _ListBox{
@@ -57,12 +76,17 @@ void list_box_model_changed(ListBox *self);
 bool list_box_vertical_scroll(ListBox *self, int_fast8_t direction);
 bool list_box_horizontal_scroll(ListBox *self, int_fast8_t direction);
 
-static inline ListModelRow *list_box_get_selected(ListBox *self)
+/**
+ * @brief Gets the key of the selected row
+ *
+ * @return The key, NULL if nothing is selected
+ */
+static inline void *list_box_get_selected(ListBox *self)
 {
-    if(!self->model || self->selected_row >= self->model->nrows)
+    if(!self->model || self->selected_row >= list_model_get_row_count(self->model))
         return NULL;
 
-    return &self->model->rows[self->selected_row];
+    return list_model_get_row_key(self->model, self->selected_row);
 }
 
 static inline void list_box_set_selection_changed_listener(ListBox *self, EventListenerFunc callback, void *target)
@@ -12,10 +12,13 @@
 /**
  * @brief Allocate @param arows
  *
+ * Virtual models (see ListModelOps) pass 0 and get no rows.
  */
 ListModel *list_model_init(ListModel *self, ListModelOps *ops, int arows)
 {
     self->ops = ops;
+    if(!arows)
+        return self;
 
     self->rows = malloc(sizeof(ListModelRow)*arows);
     if(!self->rows)
@@ -10,11 +10,21 @@
 #include <stdlib.h>
 
 typedef void* (*DisposeFunc)(void *self);
+typedef size_t (*ListModelRowCountFunc)(void *self);
+typedef const char *(*ListModelRowLabelFunc)(void *self, size_t row, size_t *len);
+typedef void *(*ListModelRowKeyFunc)(void *self, size_t row);
 
 typedef struct _ListBox ListBox;
 
+/* Virtual models implement get_row_count, get_row_label and
+ * get_row_key and leave rows empty: ListBox only asks for the rows it
+ * shows, so the model never needs to materialize them all. Models
+ * leaving those NULL fill the rows below.*/
 typedef struct{
     DisposeFunc dispose;
+    ListModelRowCountFunc get_row_count;
+    ListModelRowLabelFunc get_row_label; /*Sets len to the label strlen*/
+    ListModelRowKeyFunc get_row_key;
 }ListModelOps;
 
 typedef struct{
@@ -35,7 +45,7 @@ typedef struct{
     size_t nrows;
     size_t arows;
     size_t *row_lenghts;
-    size_t maxlen; /*strlen of the largest row*/
+    size_t maxlen; /*strlen of the largest row, virtual models included*/
 }ListModel;
 
 #define LIST_MODEL(self) ((ListModel *)(self))
@@ -44,6 +54,28 @@ typedef struct{
 ListModel *list_model_init(ListModel *self, ListModelOps *ops, int arows);
 ListModel *list_model_dispose(ListModel *self);
 
+static inline size_t list_model_get_row_count(ListModel *self)
+{
+    if(self->ops->get_row_count)
+        return self->ops->get_row_count(self);
+    return self->nrows;
+}
+
+static inline const char *list_model_get_row_label(ListModel *self, size_t row, size_t *len)
+{
+    if(self->ops->get_row_label)
+        return self->ops->get_row_label(self, row, len);
+    *len = self->row_lenghts[row];
+    return self->rows[row].label;
+}
+
+static inline void *list_model_get_row_key(ListModel *self, size_t row)
+{
+    if(self->ops->get_row_key)
+        return self->ops->get_row_key(self, row);
+    return self->rows[row].key;
+}
+
 static inline ListModel *list_model_free(ListModel *self)
 {
     if(self->ops->dispose)
@@ -3,7 +3,7 @@
 #include "SDL_keycode.h"
 #include "SDL_pcf.h"
 #include "base-gauge.h"
-#include "button.h"
+#include "glyph-run-cache.h"
 #include "softkey.h"
 #include "misc.h"
 #include "resource-manager.h"
@@ -14,17 +14,19 @@
 #define SOFTKEY_BAR_H 16
 #define SOFTKEY_BUTTON_W 53
 #define SOFTKEY_BUTTON_H 16
+#define SOFTKEY_BUTTON_X(i) (2 + (i) * SOFTKEY_BUTTON_W)
 
 
 static intf8_t softkey_bar_key_to_button_index(SDL_KeyboardEvent *event);
 
 static void softkey_bar_render(SoftkeyBar *self, Uint32 dt, RenderContext *ctx);
+static SoftkeyBar *softkey_bar_dispose(SoftkeyBar *self);
 static bool softkey_bar_handle_event(SoftkeyBar *self, SDL_KeyboardEvent *event);
 
 static BaseWidgetOps softkey_bar_ops = {
     .super.update_state = (StateUpdateFunc)NULL,
     .super.render = (RenderFunc)softkey_bar_render,
-    .super.dispose = (DisposeFunc)NULL,
+    .super.dispose = (DisposeFunc)softkey_bar_dispose,
     .handle_event = (EventHandlerFunc)softkey_bar_handle_event
 };
 
@@ -42,6 +44,8 @@ SoftkeyBar *softkey_bar_new(FontResource font_id, SoftkeyModel *model)
     return self;
 }
 
+static int softkey_bar_get_page(SoftkeyBar *self, SoftkeyModel *model);
+
 SoftkeyBar *softkey_bar_init(SoftkeyBar *self, SoftkeyModel *model, FontResource font_id, int w, int h)
 {
     base_widget_init(BASE_WIDGET(self),
@@ -49,98 +53,303 @@ SoftkeyBar *softkey_bar_init(SoftkeyBar *self, SoftkeyModel *model, FontResource
         w, h
     );
 
-    self->model = model;
+    self->font_id = font_id;
+    self->pages = calloc(SOFTKEY_BAR_MAX_PAGES, sizeof(SoftkeyPage));
+    if(!self->pages) return NULL;
 
-    /* The following is a trick to pre-load needed glyph
-     * TODO: Have a self-configuration mechanism for the ResourceManager:
-     * save to a file what was needed in the previous run and merge as one
-     * big font.
-     * */
-    PCF_StaticFont *sfont = resource_manager_get_static_font(
-        font_id, &SDL_WHITE,
-        1, PCF_UPPER_CASE
-    );
-    if(!sfont) return NULL;
+    for(int i = 0; i < N_SOFTKEY_STATES; i++)
+        softkey_chrome_init(&self->chrome[i], i, SOFTKEY_BUTTON_W, SOFTKEY_BUTTON_H);
 
-    for(int i = 0, x = 2; i < N_SOFTKEYS; i++, x += SOFTKEY_BUTTON_W){
-        SoftkeyDetails *details = self->model
-                                ? softkey_model_get_details_at(self->model, i)
-                                : NULL;
-        softkey_init(&(self->buttons[i]),
-            details ? details->caption : "",
-            font_id,
-            SOFTKEY_BUTTON_W, SOFTKEY_BUTTON_H
-        );
-        base_gauge_add_child(BASE_GAUGE(self), BASE_GAUGE(&(self->buttons[i])), x , 0);
+    /* Lays out the model and all the menus that can be reached from it,
+     * navigating won't need anything more*/
+    if(model){
+        if(softkey_bar_get_page(self, model) < 0)
+            return NULL;
+        softkey_bar_set_model(self, model);
     }
 
     return self;
 }
 
+static SoftkeyBar *softkey_bar_dispose(SoftkeyBar *self)
+{
+    for(int i = 0; i < N_SOFTKEY_STATES; i++){
+        if(self->fonts[i])
+            PCF_StaticFontUnref(self->fonts[i]);
+    }
+    if(self->pages)
+        free(self->pages);
+    return self;
+}
+
+/* Adds a page for @p model, and the pages it leads to. Nothing is laid
+ * out yet, see softkey_bar_layout. Returns the index of the page of
+ * @p model, -1 if there isn't enough room.*/
+static int softkey_bar_add_page(SoftkeyBar *self, SoftkeyModel *model)
+{
+    SoftkeyPage *page;
+    SoftkeyDetails *details;
+    int rv, next;
+
+    for(rv = 0; rv < self->npages; rv++){
+        if(self->pages[rv].model == model)
+            return rv;
+    }
+    if(self->npages == SOFTKEY_BAR_MAX_PAGES){
+        printf("SoftkeyBar: Too many menus, max is %d\n", SOFTKEY_BAR_MAX_PAGES);
+        return -1;
+    }
+
+    rv = self->npages++;
+    page = &self->pages[rv];
+    page->model = model;
+    /*Before any recursion: menus leading back to this one will find it*/
+    for(int i = 0; i < N_SOFTKEYS; i++){
+        page->details[i] = softkey_model_get_details_at(model, i);
+        page->next[i] = SOFTKEY_PAGE_NONE;
+    }
+    for(int i = 0; i < N_SOFTKEYS; i++){
+        details = page->details[i];
+        if(!details) continue;
+        if(details->type == SOFTKEY_TYPE_BACK){
+            page->next[i] = SOFTKEY_PAGE_BACK;
+        }else if(details->type == SOFTKEY_TYPE_SEGUE && details->action.next){
+            next = softkey_bar_add_page(self, details->action.next);
+            if(next < 0)
+                return -1;
+            page->next[i] = next;
+        }
+    }
+    return rv;
+}
+
+/* Gets the fonts able to write the captions of all the pages, and lays
+ * all of them out with it.*/
+static bool softkey_bar_layout(SoftkeyBar *self)
+{
+    bool seen[256] = {false};
+    char chars[257];
+    size_t nchars;
+    SoftkeyPage *page;
+    PCF_StaticFont *font;
+    SDL_Color color;
+    SDL_Rect area;
+    const char *caption;
+    uint16_t n;
+
+    nchars = 0;
+    for(int p = 0; p < self->npages; p++){
+        for(int i = 0; i < N_SOFTKEYS; i++){
+            if(!self->pages[p].details[i]) continue;
+            for(caption = self->pages[p].details[i]->caption; *caption; caption++){
+                if(!seen[(unsigned char)*caption]){
+                    seen[(unsigned char)*caption] = true;
+                    chars[nchars++] = *caption;
+                }
+            }
+        }
+    }
+    chars[nchars] = '\0';
+
+    for(int s = 0; s < N_SOFTKEY_STATES; s++){
+        color = softkey_text_color(s);
+        font = resource_manager_get_static_font(self->font_id, &color, 1, chars);
+        if(!font) return false;
+        PCF_StaticFontRef(font);
+        if(self->fonts[s])
+            PCF_StaticFontUnref(self->fonts[s]);
+        self->fonts[s] = font;
+
+        for(int p = 0; p < self->npages; p++){
+            page = &self->pages[p];
+            n = 0;
+            for(int i = 0; i < N_SOFTKEYS; i++){
+                page->first[s][i] = n;
+                if(!page->details[i]) continue;
+                caption = page->details[i]->caption;
+                /*Within the border, which is thicker on the top left*/
+                area = (SDL_Rect){
+                    SOFTKEY_BUTTON_X(i) + 1, 2,
+                    SOFTKEY_BUTTON_W, SOFTKEY_BUTTON_H
+                };
+                /*Never negative: a failed caption leaves its key blank*/
+                n += glyph_run_cache_layout(font,
+                    caption, strlen(caption),
+                    true, &area, HALIGN_CENTER | VALIGN_MIDDLE,
+                    page->patches[s] + n, SOFTKEY_PAGE_PATCHES - n
+                );
+            }
+            page->first[s][N_SOFTKEYS] = n;
+        }
+    }
+    return true;
+}
+
+/* Page of @p model, laid out (with the ones it leads to) the first time
+ * only. Returns -1 on failure.*/
+static int softkey_bar_get_page(SoftkeyBar *self, SoftkeyModel *model)
+{
+    size_t npages;
+    int rv;
+
+    npages = self->npages;
+    rv = softkey_bar_add_page(self, model);
+    if(rv < 0){
+        self->npages = npages;
+        return -1;
+    }
+    if(self->npages != npages && !softkey_bar_layout(self)){
+        self->npages = npages;
+        return -1;
+    }
+    return rv;
+}
+
+static void softkey_bar_show(SoftkeyBar *self)
+{
+    self->model = self->depth ? self->pages[self->stack[self->depth-1]].model : NULL;
+    for(int i = 0; i < N_SOFTKEYS; i++)
+        self->states[i] = SOFTKEY_STATE_RELEASED;
+    BASE_GAUGE(self)->dirty = true;
+}
+
+static bool softkey_bar_push_page(SoftkeyBar *self, int page)
+{
+    if(self->depth == SOFTKEY_BAR_MAX_DEPTH){
+        printf("SoftkeyBar: Too many menu levels, max is %d\n", SOFTKEY_BAR_MAX_DEPTH);
+        return false;
+    }
+    self->stack[self->depth++] = page;
+    softkey_bar_show(self);
+    return true;
+}
+
+/**
+ * @brief Shows @p model in place of the current menu level (or as the
+ * first one).
+ *
+ * @param self a SoftkeyBar
+ * @param model The model to show, NULL to empty the bar
+ */
 void softkey_bar_set_model(SoftkeyBar *self, SoftkeyModel *model)
 {
-    self->model = model;
+    int page;
 
-    for(int i = 0, x = 2; i < N_SOFTKEYS; i++, x += SOFTKEY_BUTTON_W){
-        SoftkeyDetails *details = self->model
-                                ? softkey_model_get_details_at(self->model, i)
-                                : NULL;
-        button_set_caption(BUTTON(&(self->buttons[i])), details ? details->caption : "");
+    if(!model){
+        self->depth = 0;
+        softkey_bar_show(self);
+        return;
     }
-    BASE_GAUGE(self)->dirty = true; /*TODO: Check if that is needed*/
+
+    page = softkey_bar_get_page(self, model);
+    if(page < 0) return;
+
+    if(!self->depth)
+        self->depth = 1;
+    self->stack[self->depth-1] = page;
+    softkey_bar_show(self);
 }
 
+/**
+ * @brief Shows @p model as a new menu level, softkey_bar_pop_model goes
+ * back to the current one.
+ */
 void softkey_bar_push_model(SoftkeyBar *self, SoftkeyModel *model)
 {
-    model->prev = self->model;
-    softkey_bar_set_model(self, model);
+    int page;
+
+    page = softkey_bar_get_page(self, model);
+    if(page < 0) return;
+
+    softkey_bar_push_page(self, page);
 }
 
+/**
+ * @brief Goes back to the previous menu level, or to an empty bar from
+ * the first one.
+ *
+ * @return true on success, false if the bar was already empty
+ */
 bool softkey_bar_pop_model(SoftkeyBar *self)
 {
-    SoftkeyModel *previous;
+    if(!self->depth) return false;
 
-    if(!self->model) return false;
-
-    previous = self->model->prev;
-    self->model->prev = NULL;
-    softkey_bar_set_model(self, previous);
+    self->depth--;
+    softkey_bar_show(self);
 
     return true;
 }
 
 static void softkey_bar_render(SoftkeyBar *self, Uint32 dt, RenderContext *ctx)
 {
+    SoftkeyPage *page;
+    SoftkeyChrome *chrome;
+    SDL_Rect rect;
+    int j;
+
     base_gauge_fill(BASE_GAUGE(self), ctx, NULL, &(SDL_BLACK), false);
+    if(!self->depth) return;
+
+    page = &self->pages[self->stack[self->depth-1]];
+    for(int i = 0; i < N_SOFTKEYS; i++){
+        chrome = &self->chrome[self->states[i]];
+        for(int r = 0; r < chrome->nrects; r++){
+            rect = chrome->rects[r];
+            rect.x += SOFTKEY_BUTTON_X(i);
+            base_gauge_fill(BASE_GAUGE(self), ctx, &rect, &chrome->colors[r], false);
+        }
+    }
+
+    /*Captions of consecutive buttons in the same state go as one run*/
+    for(int i = 0; i < N_SOFTKEYS; i = j){
+        SoftkeyState s = self->states[i];
+        for(j = i + 1; j < N_SOFTKEYS && self->states[j] == s; j++);
+        if(page->first[s][j] > page->first[s][i]){
+            base_gauge_draw_static_font_patches(BASE_GAUGE(self), ctx,
+                self->fonts[s],
+                &page->patches[s][page->first[s][i]],
+                page->first[s][j] - page->first[s][i]
+            );
+        }
+    }
 }
 
 /*Always return false, we do not care about focus*/
 static bool softkey_bar_handle_event(SoftkeyBar *self, SDL_KeyboardEvent *event)
 {
-    if(!self->model) return false;
+    SoftkeyPage *page;
+    SoftkeyDetails *details;
+
+    if(!self->depth) return false;
     if(event->state != SDL_PRESSED && event->state != SDL_RELEASED) return false;
 
     intf8_t idx = softkey_bar_key_to_button_index(event);
-    if(idx < 0) return false;
+    if(idx < 0 || idx >= N_SOFTKEYS) return false;
 
-    SoftkeyDetails *details = softkey_model_get_details_at(self->model, idx);
+    page = &self->pages[self->stack[self->depth-1]];
+    details = page->details[idx];
     if(!details) return false;
 
     if(event->state == SDL_PRESSED){
-        softkey_set_state(&(self->buttons[idx]), SOFTKEY_STATE_PRESSED);
-//        printf("%s: Pressed\n",__FUNCTION__);
+        self->states[idx] = SOFTKEY_STATE_PRESSED;
+        BASE_GAUGE(self)->dirty = true;
         return true;
     }
 
-    softkey_set_state(&(self->buttons[idx]), SOFTKEY_STATE_RELEASED);
-//    printf("%s: Released\n",__FUNCTION__);
+    self->states[idx] = SOFTKEY_STATE_RELEASED;
+    BASE_GAUGE(self)->dirty = true;
     /*TODO: Animate the button press, change state before doing the actions*/
-    if(details->type == SOFTKEY_TYPE_REGULAR){
-        //invoke callback
-    }else if(details->type == SOFTKEY_TYPE_SEGUE){
-        softkey_bar_push_model(self, details->action.next);
-    }else if(details->type == SOFTKEY_TYPE_BACK){
-        softkey_bar_pop_model(self);
+    switch(page->next[idx]){
+        case SOFTKEY_PAGE_NONE:
+            if(details->type == SOFTKEY_TYPE_REGULAR && details->action.clickedCallback)
+                details->action.clickedCallback();
+            break;
+        case SOFTKEY_PAGE_BACK:
+            softkey_bar_pop_model(self);
+            break;
+        default:
+            softkey_bar_push_page(self, page->next[idx]);
+            break;
     }
 
     return false;
@@ -7,13 +7,44 @@
 #include "resource-manager.h"
 
 #define N_SOFTKEYS 12
+#define SOFTKEY_BAR_MAX_PAGES 8
+#define SOFTKEY_BAR_MAX_DEPTH 4
+#define SOFTKEY_PAGE_PATCHES (N_SOFTKEYS * (SOFTKEY_CAPTION_MAX - 1))
+
+/*Transitions of SoftkeyPage.next that don't go to another page*/
+#define SOFTKEY_PAGE_NONE -1
+#define SOFTKEY_PAGE_BACK -2
+
+/* A model laid out once and for all: the captions of its buttons in
+ * the font of each state, one run per state with the buttons in
+ * order (button i is patches [first[s][i], first[s][i+1]) of state s),
+ * and the page each button leads to. Switching between menus swaps
+ * pages, showing them draws what's there.*/
+typedef struct{
+    SoftkeyModel *model;
+
+    SoftkeyDetails *details[N_SOFTKEYS];
+    int8_t next[N_SOFTKEYS]; /*Page index, or SOFTKEY_PAGE_NONE/BACK*/
+
+    PCF_StaticFontPatch patches[N_SOFTKEY_STATES][SOFTKEY_PAGE_PATCHES];
+    uint16_t first[N_SOFTKEY_STATES][N_SOFTKEYS+1];
+}SoftkeyPage;
 
 typedef struct {
     BaseWidget super;
 
-    Softkey buttons[N_SOFTKEYS];
+    FontResource font_id;
+    PCF_StaticFont *fonts[N_SOFTKEY_STATES]; /*Caption font of each state*/
+    SoftkeyChrome chrome[N_SOFTKEY_STATES];
+    SoftkeyState states[N_SOFTKEYS];
 
-    SoftkeyModel *model;
+    SoftkeyPage *pages;
+    size_t npages;
+    /*Menu levels, the last one is shown*/
+    int8_t stack[SOFTKEY_BAR_MAX_DEPTH];
+    size_t depth;
+
+    SoftkeyModel *model; /*Model of the page shown*/
 }SoftkeyBar;
 
 
@@ -29,9 +29,11 @@ typedef struct{
     GetButtonDetailsAtFunc get_details_at;
 }SoftkeyModelOps;
 
+/* A menu level. Models are static: SoftkeyBar lays them out once and
+ * keeps the navigation between them (see SoftkeyPage), the details
+ * must not change afterwards.*/
 typedef struct _SoftkeyModel{
     SoftkeyModelOps *ops;
-    SoftkeyModel *prev;
 }SoftkeyModel;
 
 #define SOFTKEY_MODEL(self) ((SoftkeyModel *)(self))
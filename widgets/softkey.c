@@ -10,7 +10,6 @@
 static BaseWidgetOps softkey_ops = { 0 };
 
 
-static inline void softkey_draw_border(Softkey *self, Uint32 dt, RenderContext *ctx);
 static void softkey_render(Softkey *self, Uint32 dt, RenderContext *ctx);
 
 Softkey *softkey_new(const char *caption, FontResource font_id, int w, int h)
@@ -50,74 +49,93 @@ Softkey *softkey_init(Softkey *self, const char *caption, FontResource font_id,
 
 void softkey_set_state(Softkey *self, SoftkeyState state)
 {
+    SoftkeyChrome chrome;
+
     if(self->state == state) return;
 
     self->state = state;
-    switch(self->state){
+    softkey_chrome_init(&chrome, state, 1, 1);
+    button_set_color(BUTTON(self), softkey_text_color(state), TEXT_COLOR);
+    button_set_color(BUTTON(self), chrome.colors[0], BACKGROUND_COLOR);
+}
+
+/**
+ * @brief Color of the caption of a softkey in the given state.
+ */
+SDL_Color softkey_text_color(SoftkeyState state)
+{
+    switch(state){
         case SOFTKEY_STATE_DISABLED:
-            button_set_color(BUTTON(self), (SDL_Color){64, 64, 64, SDL_ALPHA_OPAQUE}, TEXT_COLOR);
-            button_set_color(BUTTON(self), (SDL_Color){32, 32, 32, SDL_ALPHA_OPAQUE}, BACKGROUND_COLOR);
-            break;
+            return (SDL_Color){64, 64, 64, SDL_ALPHA_OPAQUE};
         case SOFTKEY_STATE_PRESSED:
-            button_set_color(BUTTON(self), (SDL_Color){32, 32, 32, SDL_ALPHA_OPAQUE}, TEXT_COLOR);
-            button_set_color(BUTTON(self), (SDL_Color){128, 128, 128, SDL_ALPHA_OPAQUE}, BACKGROUND_COLOR);
-            break;
+            return (SDL_Color){32, 32, 32, SDL_ALPHA_OPAQUE};
         case SOFTKEY_STATE_RELEASED:
-            button_set_color(BUTTON(self), SDL_WHITE, TEXT_COLOR);
-            button_set_color(BUTTON(self), (SDL_Color){32, 32, 32, SDL_ALPHA_OPAQUE}, BACKGROUND_COLOR);
-            break;
+        default:
+            return SDL_WHITE;
     }
 }
 
-
-static void softkey_render(Softkey *self, Uint32 dt, RenderContext *ctx)
+static inline void softkey_chrome_add(SoftkeyChrome *self, SDL_Rect rect, SDL_Color color)
 {
-    base_gauge_fill(BASE_GAUGE(self), ctx, NULL, &(BUTTON(self)->text->bg_color), false);
-    softkey_draw_border(self, dt, ctx);
+    self->rects[self->nrects] = rect;
+    self->colors[self->nrects] = color;
+    self->nrects++;
 }
 
-static inline void softkey_draw_border(Softkey *self, Uint32 dt, RenderContext *ctx)
+/**
+ * @brief Computes what a softkey of the given size draws below its
+ * caption in the given state. The first rectangle is the whole
+ * background.
+ *
+ * @param self The SoftkeyChrome to fill
+ * @param state The state of the softkey
+ * @param w Width of the softkey
+ * @param h Height of the softkey
+ */
+void softkey_chrome_init(SoftkeyChrome *self, SoftkeyState state, int w, int h)
 {
     /*TODO: Add the first top white line*/
-    SDL_Rect top = (SDL_Rect){
-        .x = 0,
-        .y = 0,
-        .w = base_gauge_w(BASE_GAUGE(self)),
-        .h = 1
-    };
-    SDL_Rect top_second = (SDL_Rect){
-        .x = 0,
-        .y = 1,
-        .w = base_gauge_w(BASE_GAUGE(self)),
-        .h = 1
-    };
-
-    SDL_Rect left = (SDL_Rect){
-        .x = 0,
-        .y = 1,
-        .w = 1,
-        .h = base_gauge_h(BASE_GAUGE(self)) - 1 /*TODO: Fix potential overdrawing, i.e a gauge can draw out of its area*/
-    };
-    SDL_Rect right = (SDL_Rect){
-        .x = base_gauge_w(BASE_GAUGE(self)) - 1,
-        .y = 1,
-        .w = 1,
-        .h = base_gauge_h(BASE_GAUGE(self)) - 1
-    };
-
-
-    if(self->state == SOFTKEY_STATE_RELEASED){
-        base_gauge_fill(BASE_GAUGE(self), ctx, &top, &SDL_WHITE, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &top_second, &SDL_LIGHTGREY, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &left, &SDL_LIGHTGREY, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &right, &SDL_BLACK, false);
-    }else if(self->state == SOFTKEY_STATE_PRESSED){
-        SDL_Rect pre_left = left;
+    SDL_Rect top = {.x = 0, .y = 0, .w = w, .h = 1};
+    SDL_Rect top_second = {.x = 0, .y = 1, .w = w, .h = 1};
+    /*TODO: Fix potential overdrawing, i.e a gauge can draw out of its area*/
+    SDL_Rect left = {.x = 0, .y = 1, .w = 1, .h = h - 1};
+    SDL_Rect right = {.x = w - 1, .y = 1, .w = 1, .h = h - 1};
+    SDL_Rect pre_left;
+
+    self->nrects = 0;
+    softkey_chrome_add(self, (SDL_Rect){0, 0, w, h},
+        state == SOFTKEY_STATE_PRESSED
+        ? (SDL_Color){128, 128, 128, SDL_ALPHA_OPAQUE}
+        : (SDL_Color){32, 32, 32, SDL_ALPHA_OPAQUE}
+    );
+    if(state == SOFTKEY_STATE_RELEASED){
+        softkey_chrome_add(self, top, SDL_WHITE);
+        softkey_chrome_add(self, top_second, SDL_LIGHTGREY);
+        softkey_chrome_add(self, left, SDL_LIGHTGREY);
+        softkey_chrome_add(self, right, SDL_BLACK);
+    }else if(state == SOFTKEY_STATE_PRESSED){
+        pre_left = left;
         left.x++;
-        base_gauge_fill(BASE_GAUGE(self), ctx, &top, &SDL_GREY, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &top_second, &SDL_BLACK, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &pre_left, &SDL_GREY, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &left, &SDL_BLACK, false);
-        base_gauge_fill(BASE_GAUGE(self), ctx, &right, &SDL_WHITE, false);
-   }
+        softkey_chrome_add(self, top, SDL_GREY);
+        softkey_chrome_add(self, top_second, SDL_BLACK);
+        softkey_chrome_add(self, pre_left, SDL_GREY);
+        softkey_chrome_add(self, left, SDL_BLACK);
+        softkey_chrome_add(self, right, SDL_WHITE);
+    }
+}
+
+
+static void softkey_render(Softkey *self, Uint32 dt, RenderContext *ctx)
+{
+    SoftkeyChrome chrome;
+
+    softkey_chrome_init(&chrome,
+        self->state,
+        base_gauge_w(BASE_GAUGE(self)),
+        base_gauge_h(BASE_GAUGE(self))
+    );
+    /*Background: from the button, which may have been given another color*/
+    chrome.colors[0] = BUTTON(self)->text->bg_color;
+    for(int i = 0; i < chrome.nrects; i++)
+        base_gauge_fill(BASE_GAUGE(self), ctx, &chrome.rects[i], &chrome.colors[i], false);
 }
@@ -2,7 +2,17 @@
 
 #include "button.h"
 
-typedef enum{SOFTKEY_STATE_RELEASED, SOFTKEY_STATE_PRESSED, SOFTKEY_STATE_DISABLED } SoftkeyState;
+typedef enum{SOFTKEY_STATE_RELEASED, SOFTKEY_STATE_PRESSED, SOFTKEY_STATE_DISABLED, N_SOFTKEY_STATES } SoftkeyState;
+
+#define SOFTKEY_CHROME_MAX 6
+/* Everything but the caption of a softkey in a given state: background
+ * and border, as rectangles to fill in order. Depends only on the
+ * state and the size, can be computed once.*/
+typedef struct{
+    SDL_Rect rects[SOFTKEY_CHROME_MAX];
+    SDL_Color colors[SOFTKEY_CHROME_MAX];
+    uint8_t nrects;
+}SoftkeyChrome;
 
 typedef struct {
     Button super;
@@ -15,5 +25,8 @@ Softkey *softkey_new(const char *caption, FontResource font_id, int w, int h);
 Softkey *softkey_init(Softkey *self, const char *caption, FontResource font_id, int w, int h);
 
 void softkey_set_state(Softkey *self, SoftkeyState state);
+
+SDL_Color softkey_text_color(SoftkeyState state);
+void softkey_chrome_init(SoftkeyChrome *self, SoftkeyState state, int w, int h);
 #define SOFTKEY_H
 #endif /* SOFTKEY_H */
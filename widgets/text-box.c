@@ -26,6 +26,7 @@ static bool text_box_validate_font(TextBox *self);
 
 static void text_box_render(TextBox *self, Uint32 dt, RenderContext *ctx);
 static void text_box_update(TextBox *self);
+static void text_box_invalidate(TextBox *self, size_t begin, size_t end);
 static TextBox *text_box_dispose(TextBox *self);
 static bool text_box_handle_event(TextBox *self, SDL_KeyboardEvent *event);
 
@@ -74,6 +75,7 @@ TextBox *text_box_init(TextBox *self, FontResource font_id, int width, int heigh
      * = 1 full char width*/
     self->state.apatches = nchars+1;
     self->state.patches = malloc(sizeof(PCF_StaticFontPatch)*self->state.apatches);
+    self->state.relayout = true;
     BASE_GAUGE(self)->dirty = true;
     return self;
 }
@@ -127,6 +129,7 @@ bool text_box_set_allowed_chars(TextBox *self, bool keep_order, int nsets, ...)
         kill_duplicates(self->allowed_chars, self->nallowed_chars);
     }
 
+    self->state.relayout = true;
     return text_box_validate_font(self);
 }
 
@@ -144,6 +147,8 @@ bool text_box_set_text(TextBox *self, const char *text)
         self->tlen = 2;
         self->current_index = 0;
         self->text_size = (SDL_Rect){0,0,0,0};
+        self->state.relayout = true;
+        self->changed = false;
         BASE_GAUGE(self)->dirty = true;
         return true;
     }
@@ -162,6 +167,9 @@ bool text_box_set_text(TextBox *self, const char *text)
     }
     strncpy(self->text, text, ntlen+1);
     self->tlen = ntlen+1;
+    self->state.relayout = true;
+    self->changed = false;
+    BASE_GAUGE(self)->dirty = true;
 
     if(!text_box_validate_font(self))
         return false;
@@ -196,6 +204,7 @@ bool text_box_move_cursor(TextBox *self, int_fast8_t direction)
             self->text[self->current_index+1] = '\0';
             self->tlen++;
             PCF_StaticFontGetSizeRequestRect(self->sfont, self->text, false, &(self->text_size));
+            text_box_invalidate(self, self->current_index, self->current_index+1);
         }else{
             self->current_index++;
         }
@@ -204,8 +213,9 @@ bool text_box_move_cursor(TextBox *self, int_fast8_t direction)
             while(self->current_index > 0 && self->text[self->current_index] == ' '){
                 self->text[self->current_index] = '\0';
                 self->current_index--;
-                self->tlen--;
             }
+            /*Also when the spaces were not at the end: the text ends there now*/
+            self->tlen = self->current_index + 2;
         }else{
             self->current_index--;
         }
@@ -244,10 +254,9 @@ void text_box_cycle_char(TextBox *self, int_fast8_t direction)
         if(self->text[self->current_index] >= 127) /*TODO: Modulo?*/
             self->text[self->current_index] = 32;
     }
-    BASE_GAUGE(self)->dirty = true;
-
-    if(self->changed_callback)
-        self->changed_callback(self, self->userdata);
+    text_box_invalidate(self, self->current_index, self->current_index+1);
+    /*Deferred to the update: a burst of keys makes a single call*/
+    self->changed = true;
 }
 
 bool text_box_release_focus(TextBox *self)
@@ -256,61 +265,132 @@ bool text_box_release_focus(TextBox *self)
     return false;
 }
 
+/*Marks characters [begin, end) as to be laid out again on next update*/
+static void text_box_invalidate(TextBox *self, size_t begin, size_t end)
+{
+    TextBoxState *state;
+
+    state = &(self->state);
+    if(state->dirty_begin < state->dirty_end){
+        begin = begin < state->dirty_begin ? begin : state->dirty_begin;
+        end = end > state->dirty_end ? end : state->dirty_end;
+    }
+    state->dirty_begin = begin;
+    state->dirty_end = end;
+    BASE_GAUGE(self)->dirty = true;
+}
+
+/* Lays out characters [begin, end) of the text, starting at patch
+ * ipatch (character first_index is patch 0). Characters are placed
+ * where they are in the virtual rectangle, moved by startx. Returns the
+ * number of patches written*/
+static size_t text_box_layout(TextBox *self, size_t begin, size_t end, size_t ipatch)
+{
+    TextBoxState *state;
+    SDL_Rect tarea;
+
+    state = &(self->state);
+    tarea = BASE_GAUGE(self)->frame;
+    return PCF_StaticFontPreWriteStringOffset(
+        self->sfont,
+        end - begin,
+        self->text+begin,
+        false,
+        &tarea,
+        (int)begin * PCF_StaticFontCharWidth(self->sfont) - (int)state->startx, 0,
+        state->apatches - ipatch, state->patches + ipatch
+    );
+}
+
 static void text_box_update(TextBox *self)
 {
     TextBoxState *state;
+    size_t len, begin, ipatch, n;
+    Uint32 startx;
 
     state = &(self->state);
     int charx = self->current_index * PCF_StaticFontCharWidth(self->sfont);
     /*no need to -1 *both* for cmp*/
     int outx = charx + PCF_StaticFontCharWidth(self->sfont); /*first pixel out of glyph*/
 
-    if(outx > state->startx + BASE_GAUGE(self)->frame.w){
-        state->startx = (outx-1) - (BASE_GAUGE(self)->frame.w-1);
-    }else if(charx < state->startx){
-        state->startx = charx;
+    startx = state->startx;
+    if(outx > startx + BASE_GAUGE(self)->frame.w){
+        startx = (outx-1) - (BASE_GAUGE(self)->frame.w-1);
+    }else if(charx < startx){
+        startx = charx;
     }
 
-    size_t ibegin; /*string indices*/
-    ibegin = state->startx / PCF_StaticFontCharWidth(self->sfont);
-    state->first_index = ibegin;
+    len = self->tlen-1; /*without the '\0'*/
+    if(startx != state->startx || len < state->first_index)
+        state->relayout = true;
+
+    if(!state->relayout){
+        /*Characters deleted at the end*/
+        if(state->npatches > len - state->first_index)
+            state->npatches = len - state->first_index;
+        if(state->dirty_end > len)
+            state->dirty_end = len;
+        /*Left of the text box, scrolled out*/
+        begin = state->dirty_begin > state->first_index ? state->dirty_begin : state->first_index;
+        if(begin < state->dirty_end){
+            ipatch = begin - state->first_index;
+            if(ipatch > state->npatches || ipatch >= state->apatches){
+                state->relayout = true;
+            }else{
+                n = text_box_layout(self, begin, state->dirty_end, ipatch);
+                if(ipatch + n > state->npatches)
+                    state->npatches = ipatch + n;
+                /* Some of the characters fell out on the right: fine at
+                 * the end of the text, otherwise the patches after
+                 * them aren't where they should be anymore*/
+                if(n != state->dirty_end - begin && state->dirty_end < len)
+                    state->relayout = true;
+            }
+        }
+    }
 
-    SDL_Rect tarea = BASE_GAUGE(self)->frame;
-    state->npatches = PCF_StaticFontPreWriteStringOffset(
-        self->sfont,
-        self->tlen-1,
-        self->text+ibegin,
-        false,
-        &tarea,
-        state->startx * -1, 0,
-        state->apatches, state->patches
-    );
+    if(state->relayout){
+        state->startx = startx;
+        state->first_index = startx / PCF_StaticFontCharWidth(self->sfont);
+        /* The whole visible text. first_index is at least partly
+         * visible, so that patch i is character first_index + i*/
+        state->npatches = text_box_layout(self, state->first_index, len, 0);
+    }
+    state->dirty_begin = state->dirty_end = 0;
+    state->relayout = false;
 
     BASE_GAUGE(self)->dirty = false;
+
+    if(self->changed){
+        self->changed = false;
+        if(self->changed_callback)
+            self->changed_callback(self, self->userdata);
+    }
 }
 
 
 static void text_box_render(TextBox *self, Uint32 dt, RenderContext *ctx)
 {
-    for(int i = 0; i < self->state.npatches; i++){
-        if(self->state.first_index + i == self->current_index && BASE_WIDGET(self)->has_focus){
-            /*TODO: PCF_StaticFontPatch(Src|Dst)Rect */
-            base_gauge_fill(BASE_GAUGE(self), ctx, &(SDL_Rect){
-                    self->state.patches[i].dst.x,
-                    self->state.patches[i].dst.y,
-                    self->state.patches[i].src.w,
-                    self->state.patches[i].src.h
-                }, &SDL_RED, false
-            );
-        }
-        if(self->state.patches[i].src.x < 0) continue;
-
-        base_gauge_draw_static_font_rect_patch(BASE_GAUGE(self), ctx,
-            self->sfont,
-            &self->state.patches[i]
+    int cursor;
+
+    /*Cursor first, so that the whole text goes in one batch over it*/
+    cursor = (int)self->current_index - (int)self->state.first_index;
+    if(BASE_WIDGET(self)->has_focus && cursor >= 0 && cursor < (int)self->state.npatches){
+        /*TODO: PCF_StaticFontPatch(Src|Dst)Rect */
+        base_gauge_fill(BASE_GAUGE(self), ctx, &(SDL_Rect){
+                self->state.patches[cursor].dst.x,
+                self->state.patches[cursor].dst.y,
+                self->state.patches[cursor].src.w,
+                self->state.patches[cursor].src.h
+            }, &SDL_RED, false
         );
     }
 
+    base_gauge_draw_static_font_rect_patches(BASE_GAUGE(self), ctx,
+        self->sfont,
+        self->state.patches, self->state.npatches
+    );
+
     base_widget_draw_outline(BASE_WIDGET(self), ctx);
 }
 
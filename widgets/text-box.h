@@ -26,6 +26,13 @@ typedef struct{
     size_t first_index;
 
     Uint32 startx; /*offset in the virtual rectangle*/
+
+    /* Characters [dirty_begin, dirty_end) have to be laid out again.
+     * As long as the text doesn't scroll, only those are, not the whole
+     * visible text. relayout forces a full layout.*/
+    size_t dirty_begin;
+    size_t dirty_end;
+    bool relayout;
 }TextBoxState;
 
 typedef struct _TextBox{
@@ -48,8 +55,11 @@ typedef struct _TextBox{
 
     TextBoxState state;
 
+    /* Called once per frame at most, when the text box gets updated,
+     * whatever the number of changes in between*/
     TextBoxTextChanged changed_callback;
     void *userdata;
+    bool changed; /*pending call to changed_callback*/
 }TextBox;
 
 TextBox *text_box_new(FontResource font_id, int width, int height);